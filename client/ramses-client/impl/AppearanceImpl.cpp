@@ -551,14 +551,14 @@ namespace ramses
         return getDataArrayChecked<ContainerT>(elementCount, reinterpret_cast<ContainerT*>(valuesOut), input);
     }
 
-    template <typename T>
-    status_t AppearanceImpl::setDataArrayChecked(uint32_t elementCount, const T* values, const EffectInputImpl& input)
+    status_t AppearanceImpl::getDataInstanceForInputValue(const EffectInputImpl& input, uint32_t elementCount, ramses_internal::EDataType valueDataType,
+        ramses_internal::DataInstanceHandle& dataInstance, ramses_internal::DataFieldHandle& dataField) const
     {
         if (input.getSemantics() != ramses_internal::EFixedSemantics_Invalid)
         {
             return addErrorEntry("Appearance::set failed, can't access value of semantic uniform");
         }
-        CHECK_RETURN_ERR(checkEffectInputValidityAndValueCompatibility(input, elementCount, ramses_internal::TypeToEDataTypeTraits<T>::DataType));
+        CHECK_RETURN_ERR(checkEffectInputValidityAndValueCompatibility(input, elementCount, valueDataType));
 
         const BindableInput* bindableInput = m_bindableInputs.get(input.getInputIndex());
         const bool isBindable = (bindableInput != nullptr);
@@ -567,24 +567,33 @@ namespace ramses
             return addErrorEntry("Appearance::set failed, given uniform input is currently bound to a DataObject. Either unbind it from input first or set value on the DataObject itself.");
         }
 
-        const ramses_internal::DataFieldHandle dataField(input.getInputIndex());
+        const ramses_internal::DataFieldHandle uniformField(input.getInputIndex());
         if (isBindable)
         {
-            const ramses_internal::DataInstanceHandle dataReference = getDataReference(dataField, input.getDataType());
-            const T* currentValues = ramses_internal::ISceneDataArrayAccessor::GetDataArray<T>(&getIScene(), dataReference, ramses_internal::DataFieldHandle(0u));
-            if (ramses_internal::PlatformMemory::Compare(currentValues, values, 1u * sizeof(T)) != 0)
-            {
-                ramses_internal::ISceneDataArrayAccessor::SetDataArray<T>(&getIScene(), dataReference, ramses_internal::DataFieldHandle(0u), 1u, values);
-            }
+            dataInstance = getDataReference(uniformField, input.getDataType());
+            dataField = ramses_internal::DataFieldHandle(0u);
         }
         else
         {
-            assert(getIScene().getDataLayout(m_uniformLayout).getField(dataField).elementCount == elementCount);
-            const T* currentValues = ramses_internal::ISceneDataArrayAccessor::GetDataArray<T>(&getIScene(), m_uniformInstance, dataField);
-            if (ramses_internal::PlatformMemory::Compare(currentValues, values, elementCount * sizeof(T)) != 0)
-            {
-                ramses_internal::ISceneDataArrayAccessor::SetDataArray<T>(&getIScene(), m_uniformInstance, dataField, elementCount, values);
-            }
+            assert(getIScene().getDataLayout(m_uniformLayout).getField(uniformField).elementCount == elementCount);
+            dataInstance = m_uniformInstance;
+            dataField = uniformField;
+        }
+
+        return StatusOK;
+    }
+
+    template <typename T>
+    status_t AppearanceImpl::setDataArrayChecked(uint32_t elementCount, const T* values, const EffectInputImpl& input)
+    {
+        ramses_internal::DataInstanceHandle dataInstance;
+        ramses_internal::DataFieldHandle dataField;
+        CHECK_RETURN_ERR(getDataInstanceForInputValue(input, elementCount, ramses_internal::TypeToEDataTypeTraits<T>::DataType, dataInstance, dataField));
+
+        const T* currentValues = ramses_internal::ISceneDataArrayAccessor::GetDataArray<T>(&getIScene(), dataInstance, dataField);
+        if (ramses_internal::PlatformMemory::Compare(currentValues, values, elementCount * sizeof(T)) != 0)
+        {
+            ramses_internal::ISceneDataArrayAccessor::SetDataArray<T>(&getIScene(), dataInstance, dataField, elementCount, values);
         }
 
         return StatusOK;
@@ -81,6 +81,10 @@ namespace ramses
         template <typename ContainerT, typename ElementT>
         status_t getInputValueWithElementTypeCast(const EffectInputImpl& input, uint32_t elementCount, ElementT* valuesOut) const;
 
+        // checks that values can be set to input and gives data instance and field storing them in scene
+        status_t getDataInstanceForInputValue(const EffectInputImpl& input, uint32_t elementCount, ramses_internal::EDataType valueDataType,
+            ramses_internal::DataInstanceHandle& dataInstance, ramses_internal::DataFieldHandle& dataField) const;
+
         status_t setInputTexture(const EffectInputImpl& input, const TextureSamplerImpl& textureSampler);
         status_t getInputTexture(const EffectInputImpl& input, const TextureSampler*& textureSampler);
 
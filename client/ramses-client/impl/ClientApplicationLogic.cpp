@@ -48,11 +48,11 @@ namespace ramses_internal
         m_scenegraphProviderComponent = nullptr;
     }
 
-    void ClientApplicationLogic::createScene(ClientScene& scene, bool enableLocalOnlyOptimization)
+    void ClientApplicationLogic::createScene(ClientScene& scene, bool disableSceneShadowCopy, bool enableAsynchronousFlush)
     {
         PlatformGuard guard(m_frameworkLock);
         LOG_TRACE(CONTEXT_CLIENT, "ClientApplicationLogic::createScene:  '" << scene.getName() << "' with id '" << scene.getSceneId().getValue() << "'");
-        m_scenegraphProviderComponent->handleCreateScene(scene, enableLocalOnlyOptimization);
+        m_scenegraphProviderComponent->handleCreateScene(scene, disableSceneShadowCopy, enableAsynchronousFlush);
     }
 
     void ClientApplicationLogic::publishScene(SceneId sceneId, EScenePublicationMode publicationMode)
@@ -45,7 +45,7 @@ namespace ramses_internal
         void deinit();
 
         // Scene handling
-        void createScene(ClientScene& scene, bool enableLocalOnlyOptimization);
+        void createScene(ClientScene& scene, bool disableSceneShadowCopy, bool enableAsynchronousFlush);
         void publishScene(SceneId sceneId, EScenePublicationMode publicationMode);
         void unpublishScene(SceneId sceneId);
         Bool isScenePublished(SceneId sceneId) const;
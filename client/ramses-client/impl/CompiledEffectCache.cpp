@@ -0,0 +1,247 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "CompiledEffectCache.h"
+#include "glslEffectBlock/GlslEffect.h"
+#include "Resource/EffectResource.h"
+#include "Resource/IResource.h"
+#include "Components/SingleResourceSerialization.h"
+#include "PlatformAbstraction/PlatformGuard.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include "Utils/BinaryOutputStream.h"
+#include "Utils/LogMacros.h"
+#include <city.h>
+#include <algorithm>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        std::unique_ptr<EffectResource> CompileEffect(const EffectSource& source, ResourceCacheFlag cacheFlag, const String& name, String& errorMessages)
+        {
+            GlslEffect effectBlock(source.vertexShader, source.fragmentShader, source.compilerDefines, source.semanticInputs, name);
+            std::unique_ptr<EffectResource> effectResource(effectBlock.createEffectResource(cacheFlag));
+            if (!effectResource)
+            {
+                errorMessages = effectBlock.getErrorMessages();
+            }
+            return effectResource;
+        }
+    }
+
+    CompiledEffectCache::CompiledEffectCache()
+    {
+    }
+
+    CompiledEffectCache::~CompiledEffectCache()
+    {
+    }
+
+    EffectResource* CompiledEffectCache::createEffectResource(const EffectSource& source, ResourceCacheFlag cacheFlag, const String& name, String& errorMessages)
+    {
+        const ResourceContentHash key = CreateKey(source);
+        const EffectResource* compiledEffect = find(key);
+        if (compiledEffect)
+        {
+            PlatformLightweightGuard guard(m_lock);
+            ++m_numberOfHits;
+        }
+        else
+        {
+            std::unique_ptr<EffectResource> newCompiledEffect = CompileEffect(source, cacheFlag, name, errorMessages);
+            {
+                PlatformLightweightGuard guard(m_lock);
+                ++m_numberOfCompilations;
+            }
+            if (!newCompiledEffect)
+            {
+                return nullptr;
+            }
+            insert(key, std::move(newCompiledEffect));
+            // might have been inserted concurrently from other thread, use the one stored in cache
+            compiledEffect = find(key);
+        }
+
+        return CreateFromCompiled(*compiledEffect, cacheFlag, name);
+    }
+
+    UInt32 CompiledEffectCache::precompile(const std::vector<EffectSource>& sources)
+    {
+        const UInt64 startTime = PlatformTime::GetMillisecondsMonotonic();
+
+        // compile every distinct source not yet in cache exactly once,
+        // all on the calling thread because glslang is built with its single threaded OS layer
+        UInt32 numberOfCompilations = 0u;
+        UInt32 numberOfFailures = 0u;
+        for (const auto& source : sources)
+        {
+            const ResourceContentHash key = CreateKey(source);
+            if (find(key) != nullptr)
+            {
+                continue;
+            }
+
+            String errorMessages;
+            std::unique_ptr<EffectResource> compiledEffect = CompileEffect(source, ResourceCacheFlag_DoNotCache, "", errorMessages);
+            ++numberOfCompilations;
+            if (compiledEffect)
+            {
+                insert(key, std::move(compiledEffect));
+            }
+            else
+            {
+                ++numberOfFailures;
+                LOG_ERROR(CONTEXT_CLIENT, "CompiledEffectCache::precompile: failed to compile effect:\n    " << errorMessages);
+            }
+        }
+
+        if (numberOfCompilations == 0u)
+        {
+            return 0u;
+        }
+
+        {
+            PlatformLightweightGuard guard(m_lock);
+            m_numberOfCompilations += numberOfCompilations;
+        }
+
+        LOG_INFO(CONTEXT_CLIENT, "CompiledEffectCache::precompile: compiled " << numberOfCompilations - numberOfFailures << " of " << numberOfCompilations
+            << " effects not found in cache (" << sources.size() << " requested) in " << PlatformTime::GetMillisecondsMonotonic() - startTime << " ms");
+
+        return numberOfFailures;
+    }
+
+    void CompiledEffectCache::writeToStream(IOutputStream& stream) const
+    {
+        PlatformLightweightGuard guard(m_lock);
+        stream << static_cast<UInt32>(m_compiledEffects.size());
+        for (const auto& entry : m_compiledEffects)
+        {
+            // key is repeated after the resource to detect records which were not read completely
+            stream << entry.first;
+            stream << entry.second->getHash();
+            SingleResourceSerialization::SerializeResource(stream, *entry.second);
+            stream << entry.first;
+        }
+    }
+
+    Bool CompiledEffectCache::readFromStream(IInputStream& stream)
+    {
+        UInt32 numberOfEntries = 0u;
+        stream >> numberOfEntries;
+
+        // entries are only added to cache after all of them were read and verified
+        std::vector<std::pair<ResourceContentHash, std::unique_ptr<EffectResource>>> readEntries;
+        for (UInt32 i = 0u; i < numberOfEntries && stream.getState() == EStatus_RAMSES_OK; ++i)
+        {
+            ResourceContentHash key;
+            ResourceContentHash resourceHash;
+            stream >> key;
+            stream >> resourceHash;
+
+            std::unique_ptr<IResource> resource(SingleResourceSerialization::DeserializeResource(stream, resourceHash));
+            ResourceContentHash keyAfterResource;
+            stream >> keyAfterResource;
+            if (stream.getState() != EStatus_RAMSES_OK)
+            {
+                break;
+            }
+
+            if (!resource || resource->getTypeID() != EResourceType_Effect || keyAfterResource != key)
+            {
+                LOG_ERROR(CONTEXT_CLIENT, "CompiledEffectCache::readFromStream: unexpected resource in stream, effect cache entries are corrupt");
+                return false;
+            }
+
+            // recreate effect to verify its content against stored hash
+            std::unique_ptr<EffectResource> compiledEffect(CreateFromCompiled(static_cast<const EffectResource&>(*resource), ResourceCacheFlag_DoNotCache, ""));
+            if (compiledEffect->getHash() != resourceHash)
+            {
+                LOG_ERROR(CONTEXT_CLIENT, "CompiledEffectCache::readFromStream: content of effect does not match its hash, effect cache entries are corrupt");
+                return false;
+            }
+            readEntries.push_back({ key, std::move(compiledEffect) });
+        }
+
+        if (stream.getState() != EStatus_RAMSES_OK || readEntries.size() != numberOfEntries)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "CompiledEffectCache::readFromStream: read " << readEntries.size() << " of " << numberOfEntries << " effect cache entries, stream is truncated");
+            return false;
+        }
+
+        for (auto& entry : readEntries)
+        {
+            insert(entry.first, std::move(entry.second));
+        }
+        return true;
+    }
+
+    UInt32 CompiledEffectCache::getNumberOfEntries() const
+    {
+        PlatformLightweightGuard guard(m_lock);
+        return static_cast<UInt32>(m_compiledEffects.size());
+    }
+
+    UInt32 CompiledEffectCache::getNumberOfHits() const
+    {
+        PlatformLightweightGuard guard(m_lock);
+        return m_numberOfHits;
+    }
+
+    UInt32 CompiledEffectCache::getNumberOfCompilations() const
+    {
+        PlatformLightweightGuard guard(m_lock);
+        return m_numberOfCompilations;
+    }
+
+    ResourceContentHash CompiledEffectCache::CreateKey(const EffectSource& source)
+    {
+        // semantics are hashed in name order, so that key does not depend on order of their insertion
+        std::vector<std::pair<String, EFixedSemantics>> semantics;
+        semantics.reserve(source.semanticInputs.count());
+        for (const auto& semantic : source.semanticInputs)
+        {
+            semantics.push_back({ semantic.key, semantic.value });
+        }
+        std::sort(semantics.begin(), semantics.end(), [](const std::pair<String, EFixedSemantics>& a, const std::pair<String, EFixedSemantics>& b) { return a.first < b.first; });
+
+        BinaryOutputStream stream(source.vertexShader.getLength() + source.fragmentShader.getLength() + 1024u);
+        stream << source.vertexShader << source.fragmentShader;
+        stream << static_cast<UInt32>(source.compilerDefines.size());
+        for (const auto& define : source.compilerDefines)
+        {
+            stream << define;
+        }
+        stream << static_cast<UInt32>(semantics.size());
+        for (const auto& semantic : semantics)
+        {
+            stream << semantic.first << static_cast<UInt32>(semantic.second);
+        }
+
+        const cityhash::uint128 hash = cityhash::CityHash128(stream.getData(), stream.getSize());
+        return ResourceContentHash(cityhash::Uint128Low64(hash), cityhash::Uint128High64(hash));
+    }
+
+    EffectResource* CompiledEffectCache::CreateFromCompiled(const EffectResource& compiled, ResourceCacheFlag cacheFlag, const String& name)
+    {
+        return new EffectResource(compiled.getVertexShader(), compiled.getFragmentShader(), compiled.getUniformInputs(), compiled.getAttributeInputs(), name, cacheFlag);
+    }
+
+    const EffectResource* CompiledEffectCache::find(const ResourceContentHash& key) const
+    {
+        PlatformLightweightGuard guard(m_lock);
+        const auto it = m_compiledEffects.find(key);
+        return (it != m_compiledEffects.cend() ? it->second.get() : nullptr);
+    }
+
+    void CompiledEffectCache::insert(const ResourceContentHash& key, std::unique_ptr<EffectResource> compiledEffect)
+    {
+        PlatformLightweightGuard guard(m_lock);
+        m_compiledEffects.emplace(key, std::move(compiledEffect));
+    }
+}
@@ -0,0 +1,76 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_COMPILEDEFFECTCACHE_H
+#define RAMSES_COMPILEDEFFECTCACHE_H
+
+#include "Collections/String.h"
+#include "Collections/HashMap.h"
+#include "SceneAPI/EFixedSemantics.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include "SceneAPI/SceneResourceData.h"
+#include "PlatformAbstraction/PlatformLock.h"
+#include <unordered_map>
+#include <memory>
+#include <vector>
+
+namespace ramses_internal
+{
+    class EffectResource;
+    class IInputStream;
+    class IOutputStream;
+
+    struct EffectSource
+    {
+        String vertexShader;
+        String fragmentShader;
+        std::vector<String> compilerDefines;
+        HashMap<String, EFixedSemantics> semanticInputs;
+    };
+
+    // Keeps results of GLSL effect compilation keyed by hash of effect source, so that creating an effect
+    // from identical source, defines and semantics does not need to parse, link and reflect the shaders again.
+    // Effect resources created from cache are new instances with given name and cache flag, compiled content
+    // is shared only within the cache.
+    class CompiledEffectCache
+    {
+    public:
+        CompiledEffectCache();
+        ~CompiledEffectCache();
+
+        // returns new effect resource owned by caller or nullptr and error messages if compilation failed
+        EffectResource* createEffectResource(const EffectSource& source, ResourceCacheFlag cacheFlag, const String& name, String& errorMessages);
+
+        // compiles all sources not yet in cache on the calling thread
+        // returns number of sources that failed to compile
+        UInt32 precompile(const std::vector<EffectSource>& sources);
+
+        void writeToStream(IOutputStream& stream) const;
+        // adds all entries from stream, or none of them if stream is truncated or corrupt
+        Bool readFromStream(IInputStream& stream);
+
+        UInt32 getNumberOfEntries() const;
+        UInt32 getNumberOfHits() const;
+        UInt32 getNumberOfCompilations() const;
+
+        static ResourceContentHash CreateKey(const EffectSource& source);
+
+    private:
+        static EffectResource* CreateFromCompiled(const EffectResource& compiled, ResourceCacheFlag cacheFlag, const String& name);
+
+        const EffectResource* find(const ResourceContentHash& key) const;
+        void insert(const ResourceContentHash& key, std::unique_ptr<EffectResource> compiledEffect);
+
+        mutable PlatformLightweightLock m_lock;
+        std::unordered_map<ResourceContentHash, std::unique_ptr<const EffectResource>> m_compiledEffects;
+        UInt32 m_numberOfHits = 0u;
+        UInt32 m_numberOfCompilations = 0u;
+    };
+}
+
+#endif
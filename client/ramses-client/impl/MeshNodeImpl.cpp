@@ -138,6 +138,26 @@ namespace ramses
         m_renderableHandle = getIScene().allocateRenderable(getNodeHandle(), ramses_internal::RenderableHandle::Invalid());
     }
 
+    void MeshNodeImpl::initializeFrameworkData(AppearanceImpl& appearanceImpl, GeometryBindingImpl& geometryImpl)
+    {
+        initializeFrameworkData();
+
+        assert(AreGeometryAndAppearanceCompatible(geometryImpl, appearanceImpl));
+        m_appearanceImpl = &appearanceImpl;
+        m_geometryImpl = &geometryImpl;
+
+        const ramses_internal::ResourceContentHash effectHash = appearanceImpl.getEffectImpl()->getLowlevelResourceHash();
+        getIScene().setRenderableDataInstanceAndStateAndEffect(m_renderableHandle, appearanceImpl.getUniformDataInstance(), appearanceImpl.getRenderStateHandle(), effectHash);
+
+        // start index of newly allocated renderable is 0 already
+        const uint32_t numberOfIndicesFromGeometryBinding = geometryImpl.getIndicesCount();
+        if (numberOfIndicesFromGeometryBinding > 0)
+        {
+            setIndexCount(numberOfIndicesFromGeometryBinding);
+        }
+        getIScene().setRenderableDataInstance(m_renderableHandle, ramses_internal::ERenderableDataSlotType_Geometry, geometryImpl.getAttributeDataInstance());
+    }
+
     void MeshNodeImpl::deinitializeFrameworkData()
     {
         assert(m_renderableHandle.isValid());
@@ -226,12 +246,6 @@ namespace ramses
         return StatusOK;
     }
 
-    status_t MeshNodeImpl::setFlattenedVisibility(bool visible)
-    {
-        getIScene().setRenderableVisibility(m_renderableHandle, visible);
-        return StatusOK;
-    }
-
     status_t MeshNodeImpl::setInstanceCount(uint32_t instanceCount)
     {
         if (instanceCount == 0)
@@ -310,6 +324,26 @@ namespace ramses
         return getIScene().getRenderable(m_renderableHandle).instanceCount;
     }
 
+    status_t MeshNodeImpl::setBoundingSphere(float xCenter, float yCenter, float zCenter, float radius)
+    {
+        if (radius < 0.f)
+        {
+            return addErrorEntry("MeshNode::setBoundingSphere failed: radius must not be negative!");
+        }
+
+        getIScene().setRenderableBoundingSphere(m_renderableHandle, ramses_internal::Vector4(xCenter, yCenter, zCenter, radius));
+        return StatusOK;
+    }
+
+    void MeshNodeImpl::getBoundingSphere(float& xCenter, float& yCenter, float& zCenter, float& radius) const
+    {
+        const ramses_internal::Vector4& boundingSphere = getIScene().getRenderable(m_renderableHandle).boundingSphere;
+        xCenter = boundingSphere.x;
+        yCenter = boundingSphere.y;
+        zCenter = boundingSphere.z;
+        radius = boundingSphere.w;
+    }
+
     bool MeshNodeImpl::AreGeometryAndAppearanceCompatible(const GeometryBindingImpl& geometry, const AppearanceImpl& appearance)
     {
         return geometry.getEffectHash() == appearance.getEffectImpl()->getLowlevelResourceHash();
@@ -32,6 +32,8 @@ namespace ramses
         virtual ~MeshNodeImpl();
 
         void             initializeFrameworkData();
+        // initializes mesh node already using given appearance and geometry, those must be compatible
+        void             initializeFrameworkData(AppearanceImpl& appearanceImpl, GeometryBindingImpl& geometryImpl);
         virtual void     deinitializeFrameworkData() override;
         virtual status_t serialize(ramses_internal::IOutputStream& outStream, SerializationContext& serializationContext) const override;
         virtual status_t deserialize(ramses_internal::IInputStream& inStream, DeserializationContext& serializationContext) override;
@@ -45,13 +47,16 @@ namespace ramses
         uint32_t getStartIndex() const;
         status_t setIndexCount(uint32_t indexCount);
         uint32_t getIndexCount() const;
-        status_t setFlattenedVisibility(bool visible);
         bool     getFlattenedVisibility() const;
         status_t setInstanceCount(uint32_t instanceCount);
         uint32_t getInstanceCount() const;
+        status_t setBoundingSphere(float xCenter, float yCenter, float zCenter, float radius);
+        void     getBoundingSphere(float& xCenter, float& yCenter, float& zCenter, float& radius) const;
 
         ramses_internal::RenderableHandle   getRenderableHandle() const;
 
+        static bool AreGeometryAndAppearanceCompatible(const GeometryBindingImpl& geometry, const AppearanceImpl& appearance);
+
         const AppearanceImpl*  getAppearanceImpl() const;
         const Appearance*      getAppearance() const;
         Appearance*            getAppearance();
@@ -61,8 +66,6 @@ namespace ramses
         GeometryBinding*       getGeometryBinding();
 
     private:
-        static bool AreGeometryAndAppearanceCompatible(const GeometryBindingImpl& geometry, const AppearanceImpl& appearance);
-
         ramses_internal::RenderableHandle       m_renderableHandle;
 
         const AppearanceImpl*      m_appearanceImpl;
@@ -271,6 +271,17 @@ namespace ramses
         return getSceneImpl().getObjectRegistry().isNodeDirty(*this);
     }
 
+    bool NodeImpl::isEffectiveVisibilityUpToDate(bool effectiveVisibility) const
+    {
+        return m_effectiveVisibilityKnown && m_effectiveVisibility == effectiveVisibility;
+    }
+
+    void NodeImpl::setEffectiveVisibility(bool effectiveVisibility)
+    {
+        m_effectiveVisibilityKnown = true;
+        m_effectiveVisibility = effectiveVisibility;
+    }
+
     void NodeImpl::removeChildInternally(NodeVector::iterator childIt)
     {
         NodeImpl& child = **childIt;
@@ -79,6 +79,10 @@ namespace ramses
         void markDirty();
         bool isDirty() const;
 
+        // visibility of node combined with all its ancestors as last applied to its subtree by hierarchical visibility
+        bool isEffectiveVisibilityUpToDate(bool effectiveVisibility) const;
+        void setEffectiveVisibility(bool effectiveVisibility);
+
     private:
         typedef std::vector<NodeImpl*> NodeVector;
 
@@ -93,6 +97,9 @@ namespace ramses
 
         //The actual visibility
         bool m_visibility;
+
+        bool m_effectiveVisibilityKnown = false;
+        bool m_effectiveVisibility = true;
     };
 }
 
@@ -6,7 +6,6 @@
 //  file, You can obtain one at https://mozilla.org/MPL/2.0/.
 //  -------------------------------------------------------------------------
 
-#include "glslEffectBlock/GlslEffect.h"
 #include "ramses-client-api/Effect.h"
 #include "ramses-client-api/EffectDescription.h"
 #include "ramses-client-api/ResourceFileDescriptionSet.h"
@@ -50,6 +49,7 @@
 #include "SceneAPI/SceneCreationInformation.h"
 #include "Resource/TextureResource.h"
 #include "Scene/ScenePersistation.h"
+#include "Scene/SceneImage.h"
 #include "Scene/ClientScene.h"
 #include "Components/ResourcePersistation.h"
 #include "Components/ManagedResource.h"
@@ -64,6 +64,7 @@
 #include "SerializationContext.h"
 #include "Utils/BinaryFileOutputStream.h"
 #include "Utils/BinaryFileInputStream.h"
+#include "Utils/BinaryBoundedInputStream.h"
 #include "Utils/LogContext.h"
 #include "Utils/File.h"
 #include "Collections/IInputStream.h"
@@ -71,11 +72,13 @@
 #include "Collections/HashMap.h"
 #include "PlatformAbstraction/PlatformTime.h"
 #include "PlatformAbstraction/PlatformGuard.h"
+#include "PlatformAbstraction/PlatformConditionVariable.h"
 #include "Utils/LogMacros.h"
 #include "Utils/RamsesLogger.h"
 
 #include "PlatformAbstraction/PlatformTypes.h"
 #include <array>
+#include <atomic>
 
 namespace ramses
 {
@@ -539,13 +542,37 @@ namespace ramses
         ramses_internal::ResourcePersistation::WriteNamedResourcesWithTOCToStream(resourceOutputStream, managedResources, compress);
     }
 
-    status_t RamsesClientImpl::writeSceneObjectsToStream(SceneImpl& scene, ramses_internal::IOutputStream& outputStream) const
+    status_t RamsesClientImpl::writeSceneObjectsToStream(SceneImpl& scene, ramses_internal::File& outputFile, ramses_internal::BinaryFileOutputStream& outputStream) const
     {
+        // reserve space for section index, it is written when offsets of all sections are known
+        ramses_internal::UInt indexStart = 0;
+        outputFile.getPos(indexStart);
+        const ramses_internal::UInt64 metadataStart = indexStart + ramses_internal::SceneFileSectionIndex::GetSizeInStream();
+        outputFile.seek(static_cast<ramses_internal::Int>(metadataStart), ramses_internal::EFileSeekOrigin_BeginningOfFile);
+
         ramses_internal::ScenePersistation::WriteSceneMetadataToStream(outputStream, scene.getIScene());
-        ramses_internal::ScenePersistation::WriteSceneToStream(outputStream, scene.getIScene());
+        ramses_internal::UInt lowLevelSceneStart = 0;
+        outputFile.getPos(lowLevelSceneStart);
+
+        ramses_internal::SceneImage::WriteToStream(outputStream, scene.getIScene());
+        ramses_internal::UInt highLevelObjectsStart = 0;
+        outputFile.getPos(highLevelObjectsStart);
 
         SerializationContext serializationContext;
-        return scene.serialize(outputStream, serializationContext);
+        CHECK_RETURN_ERR(scene.serialize(outputStream, serializationContext));
+        ramses_internal::UInt highLevelObjectsEnd = 0;
+        outputFile.getPos(highLevelObjectsEnd);
+
+        ramses_internal::SceneFileSectionIndex index;
+        index.setSection(ramses_internal::ESceneFileSection_Metadata, metadataStart, lowLevelSceneStart - metadataStart);
+        index.setSection(ramses_internal::ESceneFileSection_LowLevelScene, lowLevelSceneStart, highLevelObjectsStart - lowLevelSceneStart);
+        index.setSection(ramses_internal::ESceneFileSection_HighLevelObjects, highLevelObjectsStart, highLevelObjectsEnd - highLevelObjectsStart);
+
+        outputFile.seek(static_cast<ramses_internal::Int>(indexStart), ramses_internal::EFileSeekOrigin_BeginningOfFile);
+        index.writeToStream(outputStream);
+        outputFile.seek(static_cast<ramses_internal::Int>(highLevelObjectsEnd), ramses_internal::EFileSeekOrigin_BeginningOfFile);
+
+        return StatusOK;
     }
 
     status_t RamsesClientImpl::saveSceneToFile(SceneImpl& scene, const char* fileName, const ResourceFileDescriptionSet& resourceFileInformation, bool compress) const
@@ -570,7 +597,7 @@ namespace ramses
             CHECK_RETURN_ERR( writeResourcesToFile(description, compress) );
         }
 
-        const status_t status = writeSceneObjectsToStream(scene, outputStream);
+        const status_t status = writeSceneObjectsToStream(scene, outputFile, outputStream);
 
         if (outputFile.close() != ramses_internal::EStatus_RAMSES_OK)
         {
@@ -755,16 +782,86 @@ namespace ramses
         return m_appLogic.getResource(hash);
     }
 
-    Scene* RamsesClientImpl::prepareSceneFromInputStream(const char* caller, const ramses_internal::String& filename, ramses_internal::IInputStream& inputStream)
+    // Shared state of loading resource files of one scene, the loading thread and tasks pick files until none
+    // is left. Tasks might start executing only after loading finished (e.g. when task queue is busy with
+    // other loads), so they only touch the client if there is still a file to load.
+    class RamsesClientImpl::ResourceFilesLoading
     {
-        LOG_TRACE(ramses_internal::CONTEXT_CLIENT, "RamsesClient::prepareSceneFromInputStream:  start loading scene from input stream");
+    public:
+        ResourceFilesLoading(RamsesClientImpl& client, const std::vector<ramses_internal::String>& filenames)
+            : m_client(client)
+            , m_filenames(filenames)
+            , m_results(filenames.size(), StatusOK)
+            , m_numberOfFiles(static_cast<uint32_t>(filenames.size()))
+        {
+        }
+
+        void loadRemainingFiles()
+        {
+            for (;;)
+            {
+                const uint32_t index = m_nextFileIndex++;
+                if (index >= m_numberOfFiles)
+                    return;
+
+                m_results[index] = m_client.readResourcesFromFile(m_filenames[index]);
+
+                ramses_internal::PlatformLightweightGuard guard(m_lock);
+                ++m_numberOfLoadedFiles;
+                if (m_numberOfLoadedFiles == m_numberOfFiles)
+                    m_allLoaded.broadcast();
+            }
+        }
+
+        void waitUntilAllFilesLoaded()
+        {
+            ramses_internal::PlatformLightweightGuard guard(m_lock);
+            while (m_numberOfLoadedFiles < m_numberOfFiles)
+                m_allLoaded.wait(&m_lock);
+        }
+
+        const std::vector<status_t>& getResults() const
+        {
+            return m_results;
+        }
+
+    private:
+        RamsesClientImpl& m_client;
+        const std::vector<ramses_internal::String> m_filenames;
+        std::vector<status_t> m_results;
+        const uint32_t m_numberOfFiles;
+        std::atomic<uint32_t> m_nextFileIndex{ 0u };
+
+        ramses_internal::PlatformLightweightLock m_lock;
+        ramses_internal::PlatformConditionVariable m_allLoaded;
+        uint32_t m_numberOfLoadedFiles = 0u;
+    };
+
+    RamsesClientImpl::LoadResourceFileRunnable::LoadResourceFileRunnable(const std::shared_ptr<ResourceFilesLoading>& loading)
+        : m_loading(loading)
+    {
+    }
+
+    void RamsesClientImpl::LoadResourceFileRunnable::execute()
+    {
+        m_loading->loadRemainingFiles();
+    }
+
+    SceneImpl* RamsesClientImpl::prepareSceneFromMetadataStream(const char* caller, const ramses_internal::String& filename, ramses_internal::IInputStream& metadataStream)
+    {
+        LOG_TRACE(ramses_internal::CONTEXT_CLIENT, "RamsesClient::prepareSceneFromMetadataStream:  start loading scene from input stream");
 
         ramses_internal::SceneCreationInformation createInfo;
-        ramses_internal::ScenePersistation::ReadSceneMetadataFromStream(inputStream, createInfo);
+        ramses_internal::ScenePersistation::ReadSceneMetadataFromStream(metadataStream, createInfo);
+        if (metadataStream.getState() != ramses_internal::EStatus_RAMSES_OK)
+        {
+            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": failed to read scene metadata from " << filename << ", file is corrupt");
+            return nullptr;
+        }
         const ramses_internal::SceneSizeInformation& sizeInformation = createInfo.m_sizeInfo;
         const ramses_internal::SceneInfo sceneInfo(createInfo.m_id, createInfo.m_name);
 
-        LOG_DEBUG(ramses_internal::CONTEXT_CLIENT, "RamsesClient::prepareSceneFromInputStream:  scene to be loaded has " << sizeInformation.asString());
+        LOG_DEBUG(ramses_internal::CONTEXT_CLIENT, "RamsesClient::prepareSceneFromMetadataStream:  scene to be loaded has " << sizeInformation.asString());
 
         ramses_internal::ClientScene* internalScene = nullptr;
         {
@@ -777,12 +874,10 @@ namespace ramses
         }
         internalScene->preallocateSceneSize(sizeInformation);
 
-        ramses_internal::AnimationSystemFactory animSystemFactory(ramses_internal::EAnimationSystemOwner_Client, &internalScene->getSceneActionCollection());
-
         // need first to create the pimpl, so that internal framework components know the new scene
         SceneConfigImpl sceneConfig;
-        ramses_internal::PlatformGuard g(m_clientLock);
         {
+            ramses_internal::PlatformGuard g(m_clientLock);
             if (m_scenesMarkedForLoadAsLocalOnly.hasElement(createInfo.m_id))
             {
                 LOG_INFO(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": Mark file loaded from " << filename << " with sceneId " << createInfo.m_id << " as local only");
@@ -790,16 +885,60 @@ namespace ramses
             }
         }
 
-        SceneImpl& pimpl = *new SceneImpl(*internalScene, sceneConfig, *this);
+        return new SceneImpl(*internalScene, sceneConfig, *this);
+    }
 
-        // now the scene is registered, so it's possible to load the low level content into the scene
+    SceneImpl* RamsesClientImpl::prepareLowLevelSceneFromInputStreams(const char* caller, const ramses_internal::String& filename, ramses_internal::IInputStream& metadataStream, ramses_internal::IInputStream& lowLevelSceneStream)
+    {
+        SceneImpl* pimpl = prepareSceneFromMetadataStream(caller, filename, metadataStream);
+        if (nullptr == pimpl)
+        {
+            return nullptr;
+        }
+
+        // now the scene is registered, so it's possible to load the low level content into the scene,
+        // it is not reachable through client yet, so this is done without client lock to not block loading of resources
         LOG_TRACE(ramses_internal::CONTEXT_CLIENT, "    Reading low level scene from stream");
-        ramses_internal::ScenePersistation::ReadSceneFromStream(inputStream, *internalScene, &animSystemFactory);
+        ramses_internal::ClientScene& internalScene = pimpl->getIScene();
+        ramses_internal::AnimationSystemFactory animSystemFactory(ramses_internal::EAnimationSystemOwner_Client, &internalScene.getSceneActionCollection(), internalScene.getSceneLock());
+        if (!ramses_internal::ScenePersistation::ReadSceneFromStream(lowLevelSceneStream, internalScene, &animSystemFactory))
+        {
+            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": failed to read low level scene from " << filename << ", file is corrupt");
+            delete pimpl;
+            return nullptr;
+        }
+
+        return pimpl;
+    }
+
+    SceneImpl* RamsesClientImpl::prepareLowLevelSceneFromSceneImage(const char* caller, const ramses_internal::String& filename, ramses_internal::IInputStream& metadataStream, const std::vector<ramses_internal::Char>& sceneImage)
+    {
+        SceneImpl* pimpl = prepareSceneFromMetadataStream(caller, filename, metadataStream);
+        if (nullptr == pimpl)
+        {
+            return nullptr;
+        }
 
+        // same as for scene actions, registered scene is not reachable through client yet and is restored without client lock
+        LOG_TRACE(ramses_internal::CONTEXT_CLIENT, "    Restoring low level scene from scene image");
+        ramses_internal::ClientScene& internalScene = pimpl->getIScene();
+        ramses_internal::AnimationSystemFactory animSystemFactory(ramses_internal::EAnimationSystemOwner_Client, &internalScene.getSceneActionCollection(), internalScene.getSceneLock());
+        if (!ramses_internal::SceneImage::ReadFromMemory(sceneImage.data(), sceneImage.size(), internalScene, &animSystemFactory))
+        {
+            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": failed to restore low level scene from " << filename << ", file is corrupt");
+            delete pimpl;
+            return nullptr;
+        }
+
+        return pimpl;
+    }
+
+    Scene* RamsesClientImpl::deserializeHighLevelObjectsFromInputStream(SceneImpl& pimpl, ramses_internal::IInputStream& highLevelObjectsStream)
+    {
         LOG_TRACE(ramses_internal::CONTEXT_CLIENT, "    Deserializing high level scene objects from stream");
         DeserializationContext deserializationContext;
         ObjectIDType objectID = DeserializationContext::GetObjectIDNull();
-        const status_t stat = SerializationHelper::DeserializeObjectImpl(inputStream, deserializationContext, pimpl, objectID);
+        const status_t stat = SerializationHelper::DeserializeObjectImpl(highLevelObjectsStream, deserializationContext, pimpl, objectID);
         if (stat != StatusOK)
         {
             LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "    Failed to deserialize high level scene:");
@@ -813,51 +952,153 @@ namespace ramses
         return new Scene(pimpl);
     }
 
+    bool RamsesClientImpl::ReadSceneFileSection(ramses_internal::File& inputFile, const ramses_internal::SceneFileSectionIndex& index, ramses_internal::ESceneFileSection section, std::vector<ramses_internal::Char>& sectionData)
+    {
+        const ramses_internal::SceneFileSectionIndex::Section& sectionInfo = index.getSection(section);
+        sectionData.resize(static_cast<size_t>(sectionInfo.size));
+        ramses_internal::UInt numBytesRead = 0;
+        return inputFile.seek(static_cast<ramses_internal::Int>(sectionInfo.offset), ramses_internal::EFileSeekOrigin_BeginningOfFile) == ramses_internal::EStatus_RAMSES_OK &&
+            inputFile.read(sectionData.data(), sectionData.size(), numBytesRead) == ramses_internal::EStatus_RAMSES_OK &&
+            numBytesRead == sectionData.size();
+    }
+
     Scene* RamsesClientImpl::prepareSceneAndResourcesFromFiles(const char* caller, const ramses_internal::String& sceneFilename,
         const std::vector<ramses_internal::String>& resourceFilenames, std::vector<ResourceLoadStatus>& resourceloadStatus)
     {
+        const ramses_internal::UInt64 startTime = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
+
+        // resources are only needed by high level scene objects, so resource files are read on task queue while
+        // the scene file is read and low level scene deserialized
         LOG_TRACE(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": Reading resources from files");
-        bool allResourcesLoadedSuccessfully = true;
-        for (const auto& filename : resourceFilenames)
+        auto resourceFilesLoading = std::make_shared<ResourceFilesLoading>(*this, resourceFilenames);
+        for (size_t i = 0u; i < resourceFilenames.size(); ++i)
         {
-            if (StatusOK != readResourcesFromFile(filename))
+            LoadResourceFileRunnable* task = new LoadResourceFileRunnable(resourceFilesLoading);
+            m_loadFromFileTaskQueue.enqueue(*task);
+            task->release();
+        }
+
+        SceneImpl* pimpl = nullptr;
+        bool hasSectionIndex = false;
+        std::vector<ramses_internal::Char> highLevelObjectsData;
+        ramses_internal::File inputFile(sceneFilename);
+        ramses_internal::BinaryFileInputStream inputStream(inputFile);
+        ramses_internal::UInt64 lowLevelSceneTime = 0u;
+
+        if (inputStream.getState() != ramses_internal::EStatus_RAMSES_OK)
+        {
+            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ":  failed to open file");
+        }
+        else if (!ReadRamsesVersionAndPrintWarningOnMismatch(inputStream, "scene file"))
+        {
+            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": failed to read from file");
+        }
+        else
+        {
+            ramses_internal::UInt indexStart = 0;
+            inputFile.getPos(indexStart);
+            ramses_internal::SceneFileSectionIndex index;
+            hasSectionIndex = index.readFromStream(inputStream);
+            ramses_internal::UInt fileSize = 0;
+            if (hasSectionIndex && (inputFile.getSizeInBytes(fileSize) != ramses_internal::EStatus_RAMSES_OK ||
+                !index.hasConsecutiveSections(indexStart + ramses_internal::SceneFileSectionIndex::GetSizeInStream(), fileSize)))
             {
-                LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": failed to read resources from file " << filename);
-                resourceloadStatus.push_back({ false, filename });
-                allResourcesLoadedSuccessfully = false;
+                LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": section index does not match size of scene file, file is corrupt");
+            }
+            else if (hasSectionIndex)
+            {
+                std::vector<ramses_internal::Char> metadata;
+                std::vector<ramses_internal::Char> lowLevelSceneData;
+                if (ReadSceneFileSection(inputFile, index, ramses_internal::ESceneFileSection_Metadata, metadata) &&
+                    ReadSceneFileSection(inputFile, index, ramses_internal::ESceneFileSection_LowLevelScene, lowLevelSceneData) &&
+                    ReadSceneFileSection(inputFile, index, ramses_internal::ESceneFileSection_HighLevelObjects, highLevelObjectsData))
+                {
+                    const ramses_internal::UInt64 lowLevelSceneStartTime = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
+                    ramses_internal::BinaryBoundedInputStream metadataStream(metadata.data(), metadata.size());
+                    pimpl = prepareLowLevelSceneFromSceneImage(caller, sceneFilename, metadataStream, lowLevelSceneData);
+                    lowLevelSceneTime = ramses_internal::PlatformTime::GetMillisecondsMonotonic() - lowLevelSceneStartTime;
+
+                    // scene image checks its size on its own
+                    if (pimpl && metadataStream.getRemainingSize() != 0u)
+                    {
+                        LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": size of metadata section does not match its content, file is corrupt");
+                        delete pimpl;
+                        pimpl = nullptr;
+                    }
+                }
+                else
+                {
+                    LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": failed to read sections of scene file, file is corrupt");
+                }
             }
             else
             {
-                resourceloadStatus.push_back({ true, filename });
+                // scene file without section index, all sections follow version in sequence
+                inputFile.seek(static_cast<ramses_internal::Int>(indexStart), ramses_internal::EFileSeekOrigin_BeginningOfFile);
+                const ramses_internal::UInt64 lowLevelSceneStartTime = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
+                pimpl = prepareLowLevelSceneFromInputStreams(caller, sceneFilename, inputStream, inputStream);
+                lowLevelSceneTime = ramses_internal::PlatformTime::GetMillisecondsMonotonic() - lowLevelSceneStartTime;
             }
         }
+        const ramses_internal::UInt64 sceneFileDoneTime = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
 
-        // if not all resources loaded scene loading fails
-        if (!allResourcesLoadedSuccessfully)
+        resourceFilesLoading->loadRemainingFiles();
+        resourceFilesLoading->waitUntilAllFilesLoaded();
+        const ramses_internal::UInt64 resourcesDoneTime = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
+
+        bool allResourcesLoadedSuccessfully = true;
+        const std::vector<status_t>& resourceFileResults = resourceFilesLoading->getResults();
+        for (size_t i = 0u; i < resourceFilenames.size(); ++i)
         {
-            return nullptr;
+            if (StatusOK != resourceFileResults[i])
+            {
+                LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": failed to read resources from file " << resourceFilenames[i]);
+                resourceloadStatus.push_back({ false, resourceFilenames[i] });
+                allResourcesLoadedSuccessfully = false;
+            }
+            else
+            {
+                resourceloadStatus.push_back({ true, resourceFilenames[i] });
+            }
         }
 
-        ramses_internal::File inputFile(sceneFilename);
-        ramses_internal::BinaryFileInputStream inputStream(inputFile);
-
-        if (inputStream.getState() != ramses_internal::EStatus_RAMSES_OK)
+        Scene* scene = nullptr;
+        if (pimpl)
         {
-            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ":  failed to open file");
-            return nullptr;
+            // if not all resources loaded scene loading fails
+            if (!allResourcesLoadedSuccessfully)
+            {
+                delete pimpl;
+            }
+            else if (hasSectionIndex)
+            {
+                ramses_internal::BinaryBoundedInputStream highLevelObjectsStream(highLevelObjectsData.data(), highLevelObjectsData.size());
+                scene = deserializeHighLevelObjectsFromInputStream(*pimpl, highLevelObjectsStream);
+                if (scene && (highLevelObjectsStream.getState() != ramses_internal::EStatus_RAMSES_OK || highLevelObjectsStream.getRemainingSize() != 0u))
+                {
+                    LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": high level objects section size does not match its content, file is corrupt");
+                    delete scene;
+                    scene = nullptr;
+                }
+            }
+            else
+            {
+                scene = deserializeHighLevelObjectsFromInputStream(*pimpl, inputStream);
+            }
         }
+        const ramses_internal::UInt64 endTime = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
 
-        if (!ReadRamsesVersionAndPrintWarningOnMismatch(inputStream, "scene file"))
+        if (inputFile.isOpen() && inputFile.close() != ramses_internal::EStatus_RAMSES_OK)
         {
-            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": failed to read from file");
-            return nullptr;
+            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ":  failed to close file, continue anyway");
         }
 
-        Scene* scene = prepareSceneFromInputStream(caller, sceneFilename, inputStream);
-
-        if (inputFile.close() != ramses_internal::EStatus_RAMSES_OK)
+        if (scene)
         {
-            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ":  failed to close file, continue anyway");
+            LOG_INFO(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": timings for '" << sceneFilename << "' in ms: total " << endTime - startTime
+                << ", scene file " << sceneFileDoneTime - startTime << " (low level scene " << lowLevelSceneTime << ")"
+                << ", " << resourceFilenames.size() << " resource files in parallel " << resourcesDoneTime - startTime
+                << ", high level objects " << endTime - resourcesDoneTime);
         }
 
         return scene;
@@ -1157,16 +1398,20 @@ namespace ramses
         return nullptr;
     }
 
+    static ramses_internal::EffectSource CreateEffectSource(const EffectDescription& effectDesc)
+    {
+        return { effectDesc.getVertexShader(), effectDesc.getFragmentShader(), effectDesc.impl.getCompilerDefines(), effectDesc.impl.getSemanticsMap() };
+    }
+
     Effect* RamsesClientImpl::createEffect(const EffectDescription& effectDesc, resourceCacheFlag_t cacheFlag, const char* name)
     {
-        //create effect using vertex and fragment shaders
+        //create effect using vertex and fragment shaders, compilation result is reused if equal effect was created before
         ramses_internal::String effectName(name);
-        ramses_internal::GlslEffect effectBlock(effectDesc.getVertexShader(), effectDesc.getFragmentShader(), effectDesc.impl.getCompilerDefines(),
-            effectDesc.impl.getSemanticsMap(), effectName);
-        ramses_internal::EffectResource* effectResource = effectBlock.createEffectResource(ramses_internal::ResourceCacheFlag(cacheFlag.getValue()));
+        ramses_internal::String errorMessages;
+        ramses_internal::EffectResource* effectResource = m_effectCache.createEffectResource(CreateEffectSource(effectDesc), ramses_internal::ResourceCacheFlag(cacheFlag.getValue()), effectName, errorMessages);
         if (!effectResource)
         {
-            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::createEffect  Failed to create effect resource (name: '" << effectName << "') :\n    " << effectBlock.getErrorMessages());
+            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::createEffect  Failed to create effect resource (name: '" << effectName << "') :\n    " << errorMessages);
             return nullptr;
         }
 
@@ -1192,6 +1437,88 @@ namespace ramses
         return effect;
     }
 
+    status_t RamsesClientImpl::precompileEffects(const EffectDescription* const effectDescriptions[], uint32_t count)
+    {
+        if (count > 0u && effectDescriptions == nullptr)
+        {
+            return addErrorEntry("RamsesClient::precompileEffects failed, effect descriptions must not be null.");
+        }
+
+        std::vector<ramses_internal::EffectSource> sources;
+        sources.reserve(count);
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            if (effectDescriptions[i] == nullptr)
+            {
+                return addErrorEntry("RamsesClient::precompileEffects failed, effect descriptions must not be null.");
+            }
+            sources.push_back(CreateEffectSource(*effectDescriptions[i]));
+        }
+
+        const ramses_internal::UInt32 numberOfFailures = m_effectCache.precompile(sources);
+        if (numberOfFailures > 0u)
+        {
+            return addErrorEntry((ramses_internal::StringOutputStream() << "RamsesClient::precompileEffects failed, " << numberOfFailures << " effects could not be compiled.").c_str());
+        }
+
+        return StatusOK;
+    }
+
+    status_t RamsesClientImpl::saveEffectCache(const char* fileName) const
+    {
+        ramses_internal::File outputFile(fileName);
+        ramses_internal::BinaryFileOutputStream outputStream(outputFile);
+        if (!outputFile.isOpen())
+        {
+            return addErrorEntry("RamsesClient::saveEffectCache failed, could not open file for writing.");
+        }
+
+        WriteCurrentBuildVersionToStream(outputStream);
+        m_effectCache.writeToStream(outputStream);
+
+        if (outputFile.close() != ramses_internal::EStatus_RAMSES_OK)
+        {
+            return addErrorEntry("RamsesClient::saveEffectCache failed, close file failed.");
+        }
+
+        LOG_INFO(ramses_internal::CONTEXT_CLIENT, "RamsesClient::saveEffectCache:  saved " << m_effectCache.getNumberOfEntries() << " compiled effects to '" << fileName << "'.");
+        return StatusOK;
+    }
+
+    status_t RamsesClientImpl::loadEffectCache(const char* fileName)
+    {
+        ramses_internal::File inputFile(fileName);
+        ramses_internal::BinaryFileInputStream inputStream(inputFile);
+        if (inputStream.getState() != ramses_internal::EStatus_RAMSES_OK)
+        {
+            return addErrorEntry("RamsesClient::loadEffectCache failed, could not open file.");
+        }
+
+        // compiled effects depend on shader compiler, only reuse them if built by same version
+        ramses_internal::RamsesVersion::VersionInfo readVersion;
+        if (!ramses_internal::RamsesVersion::ReadFromStream(inputStream, readVersion))
+        {
+            return addErrorEntry("RamsesClient::loadEffectCache failed, could not read version from file.");
+        }
+        if (readVersion.versionString != ::ramses_sdk::RAMSES_SDK_PROJECT_VERSION_STRING || readVersion.gitHash != ::ramses_sdk::RAMSES_SDK_GIT_COMMIT_HASH)
+        {
+            return addErrorEntry("RamsesClient::loadEffectCache failed, file was created by different RAMSES version.");
+        }
+
+        if (!m_effectCache.readFromStream(inputStream))
+        {
+            return addErrorEntry("RamsesClient::loadEffectCache failed, file is corrupt.");
+        }
+
+        LOG_INFO(ramses_internal::CONTEXT_CLIENT, "RamsesClient::loadEffectCache:  effect cache contains " << m_effectCache.getNumberOfEntries() << " compiled effects after loading '" << fileName << "'.");
+        return StatusOK;
+    }
+
+    const ramses_internal::CompiledEffectCache& RamsesClientImpl::getEffectCache() const
+    {
+        return m_effectCache;
+    }
+
     ramses_internal::ManagedResource RamsesClientImpl::manageResource(const ramses_internal::IResource* res)
     {
         ramses_internal::ManagedResource managedRes = m_appLogic.addResource(res);
@@ -23,6 +23,8 @@
 #include "RamsesObjectImpl.h"
 #include "RamsesObjectRegistry.h"
 #include "ResourceObjects.h"
+#include "CompiledEffectCache.h"
+#include "SceneFileSectionIndex.h"
 #include "Collections/Vector.h"
 #include "RamsesObjectVector.h"
 #include "ClientCommands/SceneCommandTypes.h"
@@ -39,6 +41,7 @@
 #include "city.h"
 #include "RamsesFrameworkTypesImpl.h"
 #include <chrono>
+#include <memory>
 
 
 namespace ramses_internal
@@ -52,6 +55,7 @@ namespace ramses_internal
     class BinaryFileOutputStream;
     class BinaryFileInputStream;
     class ClientScene;
+    class File;
 }
 
 namespace ramses
@@ -142,6 +146,10 @@ namespace ramses
 
         Effect* createEffect(const EffectDescription& effectDesc, resourceCacheFlag_t cacheFlag, const char* name);
         Effect* createEffectFromResource(const ramses_internal::EffectResource* res, const ramses_internal::String& name);
+        status_t precompileEffects(const EffectDescription* const effectDescriptions[], uint32_t count);
+        status_t saveEffectCache(const char* fileName) const;
+        status_t loadEffectCache(const char* fileName);
+        const ramses_internal::CompiledEffectCache& getEffectCache() const;
 
         RamsesFrameworkImpl& getFramework();
         static RamsesClientImpl& createImpl(const char* name, RamsesFrameworkImpl& components);
@@ -184,6 +192,18 @@ namespace ramses
             std::vector<ramses_internal::String> m_resourceFilenames;
         };
 
+        class ResourceFilesLoading;
+
+        class LoadResourceFileRunnable : public ramses_internal::ITask
+        {
+        public:
+            explicit LoadResourceFileRunnable(const std::shared_ptr<ResourceFilesLoading>& loading);
+            virtual void execute() override;
+
+        private:
+            std::shared_ptr<ResourceFilesLoading> m_loading;
+        };
+
         class DeleteSceneRunnable : public ramses_internal::ITask
         {
         public:
@@ -219,9 +239,13 @@ namespace ramses
         status_t writeHLResourcesToStream(ramses_internal::IOutputStream& resourceOutputStream, const ResourceObjects& resources) const;
         void writeLowLevelResourcesToStream(const ResourceObjects& resources, ramses_internal::BinaryFileOutputStream& resourceOutputStream, bool compress) const;
 
-        status_t writeSceneObjectsToStream(SceneImpl& scene, ramses_internal::IOutputStream& outputStream) const;
+        status_t writeSceneObjectsToStream(SceneImpl& scene, ramses_internal::File& outputFile, ramses_internal::BinaryFileOutputStream& outputStream) const;
 
-        Scene* prepareSceneFromInputStream(const char* caller, const ramses_internal::String& filename, ramses_internal::IInputStream& inputStream);
+        SceneImpl* prepareSceneFromMetadataStream(const char* caller, const ramses_internal::String& filename, ramses_internal::IInputStream& metadataStream);
+        SceneImpl* prepareLowLevelSceneFromInputStreams(const char* caller, const ramses_internal::String& filename, ramses_internal::IInputStream& metadataStream, ramses_internal::IInputStream& lowLevelSceneStream);
+        SceneImpl* prepareLowLevelSceneFromSceneImage(const char* caller, const ramses_internal::String& filename, ramses_internal::IInputStream& metadataStream, const std::vector<ramses_internal::Char>& sceneImage);
+        Scene* deserializeHighLevelObjectsFromInputStream(SceneImpl& pimpl, ramses_internal::IInputStream& highLevelObjectsStream);
+        static bool ReadSceneFileSection(ramses_internal::File& inputFile, const ramses_internal::SceneFileSectionIndex& index, ramses_internal::ESceneFileSection section, std::vector<ramses_internal::Char>& sectionData);
         template <typename ObjectType, typename ObjectImplType>
         status_t createAndDeserializeResourceImpls(ramses_internal::IInputStream& inStream, DeserializationContext& deserializationContext, uint32_t count, ResourceVector& container);
         status_t readResourcesFromFile(const ramses_internal::String& resourceFilename);
@@ -262,6 +286,7 @@ namespace ramses
         mutable ramses_internal::PlatformLock m_clientLock;
 
         ramses_internal::TaskForwardingQueue m_loadFromFileTaskQueue;
+        ramses_internal::CompiledEffectCache m_effectCache;
         ramses_internal::EnqueueOnlyOneAtATimeQueue m_deleteSceneQueue;
 
         std::vector<ResourceLoadStatus> m_asyncResourceLoadStatusVec;
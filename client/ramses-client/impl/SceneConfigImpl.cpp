@@ -20,4 +20,26 @@ namespace ramses
     {
         return m_publicationMode;
     }
+
+    status_t SceneConfigImpl::setAsynchronousFlushEnabled(bool enable)
+    {
+        m_asynchronousFlush = enable;
+        return StatusOK;
+    }
+
+    bool SceneConfigImpl::isAsynchronousFlushEnabled() const
+    {
+        return m_asynchronousFlush;
+    }
+
+    status_t SceneConfigImpl::setSceneShadowCopyEnabled(bool enable)
+    {
+        m_sceneShadowCopy = enable;
+        return StatusOK;
+    }
+
+    bool SceneConfigImpl::isSceneShadowCopyEnabled() const
+    {
+        return m_sceneShadowCopy;
+    }
 }
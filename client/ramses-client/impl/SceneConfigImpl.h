@@ -21,9 +21,15 @@ namespace ramses
     public:
         status_t setPublicationMode(EScenePublicationMode publicationMode);
         EScenePublicationMode getPublicationMode() const;
+        status_t setAsynchronousFlushEnabled(bool enable);
+        bool isAsynchronousFlushEnabled() const;
+        status_t setSceneShadowCopyEnabled(bool enable);
+        bool isSceneShadowCopyEnabled() const;
 
     private:
         EScenePublicationMode m_publicationMode = EScenePublicationMode_LocalAndRemote;
+        bool m_asynchronousFlush = false;
+        bool m_sceneShadowCopy = true;
     };
 }
 
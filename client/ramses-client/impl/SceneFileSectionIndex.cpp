@@ -0,0 +1,80 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SceneFileSectionIndex.h"
+#include "Collections/IInputStream.h"
+#include "Collections/IOutputStream.h"
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // 'RSFI' - marks scene file with section index
+        const UInt32 SectionIndexMarker = 0x49465352u;
+        const UInt32 SectionIndexRevision = 1u;
+    }
+
+    void SceneFileSectionIndex::setSection(ESceneFileSection section, UInt64 offset, UInt64 size)
+    {
+        m_sections[section].offset = offset;
+        m_sections[section].size = size;
+    }
+
+    const SceneFileSectionIndex::Section& SceneFileSectionIndex::getSection(ESceneFileSection section) const
+    {
+        return m_sections[section];
+    }
+
+    void SceneFileSectionIndex::writeToStream(IOutputStream& stream) const
+    {
+        stream << SectionIndexMarker << SectionIndexRevision;
+        for (const auto& section : m_sections)
+        {
+            stream << section.offset << section.size;
+        }
+    }
+
+    Bool SceneFileSectionIndex::readFromStream(IInputStream& stream)
+    {
+        UInt32 marker = 0u;
+        UInt32 revision = 0u;
+        stream >> marker >> revision;
+        if (stream.getState() != EStatus_RAMSES_OK || marker != SectionIndexMarker || revision != SectionIndexRevision)
+        {
+            return false;
+        }
+
+        for (auto& section : m_sections)
+        {
+            stream >> section.offset >> section.size;
+        }
+
+        return stream.getState() == EStatus_RAMSES_OK;
+    }
+
+    Bool SceneFileSectionIndex::hasConsecutiveSections(UInt64 firstSectionOffset, UInt64 fileSize) const
+    {
+        UInt64 expectedOffset = firstSectionOffset;
+        for (const auto& section : m_sections)
+        {
+            // compare against remaining size instead of computing end of section, which could overflow
+            if (section.offset != expectedOffset || section.size == 0u || expectedOffset > fileSize || section.size > fileSize - expectedOffset)
+            {
+                return false;
+            }
+            expectedOffset += section.size;
+        }
+
+        return expectedOffset == fileSize;
+    }
+
+    UInt64 SceneFileSectionIndex::GetSizeInStream()
+    {
+        return 2u * sizeof(UInt32) + ESceneFileSection_NUMBER_OF_ELEMENTS * 2u * sizeof(UInt64);
+    }
+}
@@ -0,0 +1,62 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENEFILESECTIONINDEX_H
+#define RAMSES_SCENEFILESECTIONINDEX_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include <array>
+
+namespace ramses_internal
+{
+    class IInputStream;
+    class IOutputStream;
+
+    enum ESceneFileSection
+    {
+        ESceneFileSection_Metadata = 0,
+        ESceneFileSection_LowLevelScene,
+        ESceneFileSection_HighLevelObjects,
+
+        ESceneFileSection_NUMBER_OF_ELEMENTS
+    };
+
+    // Table of contents written to a scene file right after the version header. It stores absolute file offset
+    // and size of every section, so each section can be read from file in one block and checked for being consumed
+    // completely after deserialization. Scene files written before the index was introduced start with the scene
+    // metadata directly, those are detected by the missing marker and have to be read sequentially.
+    // Low level scene section of indexed files holds a scene image (see SceneImage), files without index hold scene actions.
+    class SceneFileSectionIndex
+    {
+    public:
+        struct Section
+        {
+            UInt64 offset = 0u;
+            UInt64 size = 0u;
+        };
+
+        void setSection(ESceneFileSection section, UInt64 offset, UInt64 size);
+        const Section& getSection(ESceneFileSection section) const;
+
+        void writeToStream(IOutputStream& stream) const;
+        // returns false if stream does not contain an index at current position
+        Bool readFromStream(IInputStream& stream);
+
+        // sections are read from file blocks without bounds checks, so their layout must be verified before:
+        // all sections are non-empty and consecutive, starting at given offset and ending at end of file
+        Bool hasConsecutiveSections(UInt64 firstSectionOffset, UInt64 fileSize) const;
+
+        // index has fixed size, so that writer can reserve space for it and fill it after all sections are written
+        static UInt64 GetSizeInStream();
+
+    private:
+        std::array<Section, ESceneFileSection_NUMBER_OF_ELEMENTS> m_sections;
+    };
+}
+
+#endif
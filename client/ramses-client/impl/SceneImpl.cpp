@@ -93,6 +93,9 @@
 #include "Components/FlushTimeInformation.h"
 #include "PlatformAbstraction/PlatformMath.h"
 #include "Utils/TextureMathUtils.h"
+#include "Utils/TraceEventRecorder.h"
+#include "SceneUtils/ISceneDataArrayAccessor.h"
+#include "PlatformAbstraction/PlatformMemory.h"
 
 #include <array>
 
@@ -107,8 +110,8 @@ namespace ramses
         LOG_INFO(ramses_internal::CONTEXT_CLIENT, "Scene::Scene: sceneId " << scene.getSceneId()  <<
                  ", publicationMode " << (sceneConfig.getPublicationMode() == EScenePublicationMode_LocalAndRemote ? "LocalAndRemote" : "LocalOnly"));
         getClientImpl().getFramework().getPeriodicLogger().registerStatisticCollectionScene(m_scene.getSceneId(), m_scene.getStatisticCollection());
-        const bool enableLocalOnlyOptimization = sceneConfig.getPublicationMode() == EScenePublicationMode_LocalOnly;
-        getClientImpl().getClientApplication().createScene(scene, enableLocalOnlyOptimization);
+        const bool disableSceneShadowCopy = sceneConfig.getPublicationMode() == EScenePublicationMode_LocalOnly || !sceneConfig.isSceneShadowCopyEnabled();
+        getClientImpl().getClientApplication().createScene(scene, disableSceneShadowCopy, sceneConfig.isAsynchronousFlushEnabled());
     }
 
     SceneImpl::~SceneImpl()
@@ -700,6 +703,92 @@ namespace ramses
         return newNode;
     }
 
+    status_t SceneImpl::createMeshNodes(Appearance& appearance, GeometryBinding& geometry, MeshNode* meshNodes[], uint32_t count)
+    {
+        if (!containsSceneObject(appearance.impl) || !containsSceneObject(geometry.impl))
+        {
+            return addErrorEntry("Scene::createMeshNodes failed, appearance or geometry is not from this scene.");
+        }
+
+        if (count > 0u && meshNodes == nullptr)
+        {
+            return addErrorEntry("Scene::createMeshNodes failed, no array given for created mesh nodes.");
+        }
+
+        if (!MeshNodeImpl::AreGeometryAndAppearanceCompatible(geometry.impl, appearance.impl))
+        {
+            return addErrorEntry("Scene::createMeshNodes failed, geometry does not provide all vertex attributes required by appearance.");
+        }
+
+        // reserve for all mesh nodes at once, so that neither object registry nor scene pools have to grow while creating them.
+        // Scene preallocation is also sent as one scene action, so that renderer side reserves as well.
+        m_objectRegistry.reserveAdditionalObjectCapacity(ERamsesObjectType_MeshNode, count);
+        ramses_internal::SceneSizeInformation sizeInfo = m_scene.getSceneSizeInformation();
+        sizeInfo.nodeCount += count;
+        sizeInfo.renderableCount += count;
+        m_scene.preallocateSceneSize(sizeInfo);
+
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            MeshNodeImpl* pimpl = new MeshNodeImpl(*this, nullptr);
+            pimpl->initializeFrameworkData(appearance.impl, geometry.impl);
+            meshNodes[i] = new MeshNode(*pimpl);
+            registerCreatedObject(*meshNodes[i]);
+        }
+
+        return StatusOK;
+    }
+
+    template <typename T>
+    status_t SceneImpl::setAppearancesInputValue(Appearance* const appearances[], uint32_t appearanceCount, const EffectInputImpl& input, const T* values)
+    {
+        if (appearanceCount == 0u)
+        {
+            return StatusOK;
+        }
+
+        if (appearances == nullptr || values == nullptr)
+        {
+            return addErrorEntry("Scene::setAppearancesInputValue failed, no appearances or values given.");
+        }
+
+        // all appearances are validated before any value is set, values which did not change are skipped
+        const uint32_t elementCount = input.getElementCount();
+        const ramses_internal::EDataType dataType = ramses_internal::TypeToEDataTypeTraits<T>::DataType;
+        ramses_internal::DataFieldHandle dataField;
+        std::vector<ramses_internal::DataInstanceHandle> changedDataInstances;
+        std::vector<T> changedValues;
+        for (uint32_t i = 0u; i < appearanceCount; ++i)
+        {
+            const Appearance* appearance = appearances[i];
+            if (appearance == nullptr || !containsSceneObject(appearance->impl))
+            {
+                return addErrorEntry("Scene::setAppearancesInputValue failed, appearance is not from this scene.");
+            }
+
+            ramses_internal::DataInstanceHandle dataInstance;
+            const status_t status = appearance->impl.getDataInstanceForInputValue(input, elementCount, dataType, dataInstance, dataField);
+            if (status != StatusOK)
+            {
+                return addErrorEntry((ramses_internal::StringOutputStream() << "Scene::setAppearancesInputValue failed for appearance " << appearance->getName()
+                    << ": " << appearance->impl.getStatusMessage(status)).c_str());
+            }
+
+            const T* appearanceValues = values + i * elementCount;
+            const T* currentValues = ramses_internal::ISceneDataArrayAccessor::GetDataArray<T>(&m_scene, dataInstance, dataField);
+            if (ramses_internal::PlatformMemory::Compare(currentValues, appearanceValues, elementCount * sizeof(T)) != 0)
+            {
+                changedDataInstances.push_back(dataInstance);
+                changedValues.insert(changedValues.end(), appearanceValues, appearanceValues + elementCount);
+            }
+        }
+
+        m_scene.setDataArrayForInstances(changedDataInstances.data(), static_cast<uint32_t>(changedDataInstances.size()), dataField, dataType, elementCount,
+            reinterpret_cast<const ramses_internal::Byte*>(changedValues.data()));
+
+        return StatusOK;
+    }
+
     RenderGroup* SceneImpl::createRenderGroup(const char* name /*= 0*/)
     {
         RenderGroupImpl& pimpl = *new RenderGroupImpl(*this, name);
@@ -1361,6 +1450,7 @@ namespace ramses
 
     status_t SceneImpl::flush(sceneVersionTag_t sceneVersion)
     {
+        TRACE_SCOPE_WITH_ID("client", "Flush", m_scene.getSceneId().getValue());
         if (m_nextSceneVersion != InvalidSceneVersionTag && sceneVersion == InvalidSceneVersionTag)
         {
             sceneVersion = m_nextSceneVersion;
@@ -1415,7 +1505,7 @@ namespace ramses
 
     AnimationSystemImpl& SceneImpl::createAnimationSystemImpl(uint32_t flags, ERamsesObjectType type, const char* name)
     {
-        ramses_internal::AnimationSystemFactory animSystemFactory(ramses_internal::EAnimationSystemOwner_Client, &m_scene.getSceneActionCollection());
+        ramses_internal::AnimationSystemFactory animSystemFactory(ramses_internal::EAnimationSystemOwner_Client, &m_scene.getSceneActionCollection(), m_scene.getSceneLock());
         ramses_internal::IAnimationSystem* ianimationSystem =
             animSystemFactory.createAnimationSystem(flags, ramses_internal::AnimationSystemSizeInformation());
         AnimationSystemImpl& pimpl = *new AnimationSystemImpl(*this, type, name);
@@ -1527,6 +1617,13 @@ namespace ramses
                 visibilityToApply = node.getVisibility();
             }
 
+            // subtree is up to date if its effective visibility did not change and there is no change within it
+            if (node.isEffectiveVisibilityUpToDate(visibilityToApply) && !node.isDirty() && !m_nodesWithDirtyDescendants.hasElement(&node))
+            {
+                continue;
+            }
+            node.setEffectiveVisibility(visibilityToApply);
+
             if (nodeType == ERamsesObjectType_MeshNode)
             {
                 MeshNodeImpl& meshNode = static_cast<MeshNodeImpl&>(node);
@@ -1534,7 +1631,7 @@ namespace ramses
 
                 if (currentVisibility != visibilityToApply)
                 {
-                    meshNode.setFlattenedVisibility(visibilityToApply);
+                    (visibilityToApply ? m_renderablesToBecomeVisible : m_renderablesToBecomeInvisible).push_back(meshNode.getRenderableHandle());
                 }
             }
 
@@ -1553,6 +1650,7 @@ namespace ramses
     {
         const NodeImplSet& dirtyNodes = m_objectRegistry.getDirtyNodes();
         nodesToProcess.reserve(dirtyNodes.count());
+        m_nodesWithDirtyDescendants.clear();
 
         for (auto node : dirtyNodes)
         {
@@ -1560,17 +1658,28 @@ namespace ramses
 
             // find a visibility state of the branch this dirty node is in
             // while doing that also check if any ancestor is already dirty,
-            // in that case this node does not need processing
+            // in that case this node does not need processing.
+            // All ancestors are remembered so that processing of dirty ancestor does not skip the subtree containing this node
             bool needsToBeProcessed = true;
             bool parentVisibility = true;
             NodeImpl* currParent = node->getParentImpl();
-            while (parentVisibility && (currParent != nullptr) && needsToBeProcessed)
+            while (currParent != nullptr)
             {
                 if (currParent->isOfType(ERamsesObjectType_Node))
                 {
                     parentVisibility = parentVisibility && currParent->getVisibility();
                 }
-                needsToBeProcessed = !dirtyNodes.hasElement(currParent);
+                needsToBeProcessed = needsToBeProcessed && !dirtyNodes.hasElement(currParent);
+                if (m_nodesWithDirtyDescendants.hasElement(currParent))
+                {
+                    // ancestors were already visited from another dirty node, only need to find out visibility and dirty state
+                    if (!needsToBeProcessed)
+                        break;
+                }
+                else
+                {
+                    m_nodesWithDirtyDescendants.put(currParent);
+                }
                 currParent = currParent->getParentImpl();
             }
 
@@ -1599,7 +1708,20 @@ namespace ramses
             applyVisibilityToSubtree(*nodeInfo.first, nodeInfo.second);
         }
 
+        // changed renderables are updated in batches to avoid one scene action per renderable
+        if (!m_renderablesToBecomeVisible.empty())
+        {
+            m_scene.setRenderablesVisibility(m_renderablesToBecomeVisible, true);
+            m_renderablesToBecomeVisible.clear();
+        }
+        if (!m_renderablesToBecomeInvisible.empty())
+        {
+            m_scene.setRenderablesVisibility(m_renderablesToBecomeInvisible, false);
+            m_renderablesToBecomeInvisible.clear();
+        }
+
         m_objectRegistry.clearDirtyNodes();
+        m_nodesWithDirtyDescendants.clear();
     }
 
     void SceneImpl::enqueueSceneCommand(const ramses_internal::SceneCommand& command)
@@ -1723,4 +1845,16 @@ namespace ramses
     {
         return m_scene.getStatisticCollection();
     }
+
+    template status_t SceneImpl::setAppearancesInputValue<float>(Appearance* const[], uint32_t, const EffectInputImpl&, const float*);
+    template status_t SceneImpl::setAppearancesInputValue<ramses_internal::Vector2>(Appearance* const[], uint32_t, const EffectInputImpl&, const ramses_internal::Vector2*);
+    template status_t SceneImpl::setAppearancesInputValue<ramses_internal::Vector3>(Appearance* const[], uint32_t, const EffectInputImpl&, const ramses_internal::Vector3*);
+    template status_t SceneImpl::setAppearancesInputValue<ramses_internal::Vector4>(Appearance* const[], uint32_t, const EffectInputImpl&, const ramses_internal::Vector4*);
+    template status_t SceneImpl::setAppearancesInputValue<int32_t>(Appearance* const[], uint32_t, const EffectInputImpl&, const int32_t*);
+    template status_t SceneImpl::setAppearancesInputValue<ramses_internal::Vector2i>(Appearance* const[], uint32_t, const EffectInputImpl&, const ramses_internal::Vector2i*);
+    template status_t SceneImpl::setAppearancesInputValue<ramses_internal::Vector3i>(Appearance* const[], uint32_t, const EffectInputImpl&, const ramses_internal::Vector3i*);
+    template status_t SceneImpl::setAppearancesInputValue<ramses_internal::Vector4i>(Appearance* const[], uint32_t, const EffectInputImpl&, const ramses_internal::Vector4i*);
+    template status_t SceneImpl::setAppearancesInputValue<ramses_internal::Matrix22f>(Appearance* const[], uint32_t, const EffectInputImpl&, const ramses_internal::Matrix22f*);
+    template status_t SceneImpl::setAppearancesInputValue<ramses_internal::Matrix33f>(Appearance* const[], uint32_t, const EffectInputImpl&, const ramses_internal::Matrix33f*);
+    template status_t SceneImpl::setAppearancesInputValue<ramses_internal::Matrix44f>(Appearance* const[], uint32_t, const EffectInputImpl&, const ramses_internal::Matrix44f*);
 }
@@ -55,6 +55,7 @@ namespace ramses
     class GeometryBinding;
     class AnimationSystemImpl;
     class AttributeInput;
+    class EffectInputImpl;
     class NodeImpl;
     class RenderGroup;
     class RenderPass;
@@ -116,6 +117,10 @@ namespace ramses
 
         Node*               createNode(const char* name);
         MeshNode*           createMeshNode(const char* name);
+        status_t            createMeshNodes(Appearance& appearance, GeometryBinding& geometry, MeshNode* meshNodes[], uint32_t count);
+
+        template <typename T>
+        status_t            setAppearancesInputValue(Appearance* const appearances[], uint32_t appearanceCount, const EffectInputImpl& input, const T* values);
 
         ramses::RenderGroup*  createRenderGroup(const char* name);
         ramses::RenderPass*   createRenderPass(const char* name);
@@ -282,9 +287,12 @@ namespace ramses
 
         RamsesObjectRegistry m_objectRegistry;
 
-        // This is essentially a local variable only used in the "applyVisibilityToSubtree" method.
-        // This is for performance reasons, so we can re-use the same vector each time the method is called.
+        // These are essentially local variables only used when applying hierarchical visibility.
+        // This is for performance reasons, so we can re-use the same containers each time the method is called.
         NodeVisibilityInfoVector m_dataStackForSubTreeVisibilityApplying;
+        NodeImplSet m_nodesWithDirtyDescendants;
+        std::vector<ramses_internal::RenderableHandle> m_renderablesToBecomeVisible;
+        std::vector<ramses_internal::RenderableHandle> m_renderablesToBecomeInvisible;
         EScenePublicationMode m_futurePublicationMode;
 
         ramses_internal::FlushTime::Clock::time_point m_expirationTimestamp;
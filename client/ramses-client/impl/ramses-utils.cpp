@@ -112,6 +112,50 @@ namespace ramses
         return effect;
     }
 
+    Effect* RamsesUtils::CreateSDFTextEffect(RamsesClient& client, UniformInput& colorInput)
+    {
+        EffectDescription effectDesc;
+        effectDesc.setVertexShader(
+            "#version 300 es\n"
+            "precision highp float;\n"
+            "uniform highp mat4 mvpMatrix;\n"
+            "in vec2 a_position; \n"
+            "in vec2 a_texcoord; \n"
+            "\n"
+            "out vec2 v_texcoord; \n"
+            "\n"
+            "void main()\n"
+            "{\n"
+            "  v_texcoord = a_texcoord; \n"
+            "  gl_Position = mvpMatrix * vec4(a_position, 0.0, 1.0); \n"
+            "}\n");
+        // glyph outline is at distance value 0.5, antialiased over one screen pixel regardless of the glyph scale
+        effectDesc.setFragmentShader(
+            "#version 300 es\n"
+            "precision highp float;\n"
+            "uniform sampler2D u_texture; \n"
+            "uniform vec4 u_color; \n"
+            "in vec2 v_texcoord; \n"
+            "out vec4 fragColor; \n"
+            "\n"
+            "void main(void)\n"
+            "{\n"
+            "  float distance = texture(u_texture, v_texcoord).r; \n"
+            "  float smoothing = max(fwidth(distance) * 0.5, 0.001); \n"
+            "  float a = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance); \n"
+            "  fragColor = vec4(u_color.x, u_color.y, u_color.z, u_color.w * a); \n"
+            "}\n");
+
+        effectDesc.setAttributeSemantic("a_position", EEffectAttributeSemantic_TextPositions);
+        effectDesc.setAttributeSemantic("a_texcoord", EEffectAttributeSemantic_TextTextureCoordinates);
+        effectDesc.setUniformSemantic("u_texture", EEffectUniformSemantic_TextTexture);
+        effectDesc.setUniformSemantic("mvpMatrix", EEffectUniformSemantic_ModelViewProjectionMatrix);
+
+        Effect* effect = client.impl.createEffect(effectDesc, ResourceCacheFlag_DoNotCache, "");
+        effect->findUniformInput("u_color", colorInput);
+        return effect;
+    }
+
     bool IsPowerOfTwo(uint32_t val)
     {
         while (((val & 1) == 0) && val > 1)
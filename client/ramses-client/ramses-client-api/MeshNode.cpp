@@ -102,4 +102,14 @@ namespace ramses
     {
         return impl.getInstanceCount();
     }
+
+    status_t MeshNode::setBoundingSphere(float xCenter, float yCenter, float zCenter, float radius)
+    {
+        return impl.setBoundingSphere(xCenter, yCenter, zCenter, radius);
+    }
+
+    void MeshNode::getBoundingSphere(float& xCenter, float& yCenter, float& zCenter, float& radius) const
+    {
+        impl.getBoundingSphere(xCenter, yCenter, zCenter, radius);
+    }
 }
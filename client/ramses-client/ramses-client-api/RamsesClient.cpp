@@ -55,6 +55,27 @@ namespace ramses
         return effect;
     }
 
+    status_t RamsesClient::precompileEffects(const EffectDescription* const effectDescriptions[], uint32_t count)
+    {
+        const status_t status = impl.precompileEffects(effectDescriptions, count);
+        LOG_HL_CLIENT_API2(status, LOG_API_GENERIC_PTR_STRING(effectDescriptions), count);
+        return status;
+    }
+
+    status_t RamsesClient::saveEffectCache(const char* fileName) const
+    {
+        const status_t status = impl.saveEffectCache(fileName);
+        LOG_HL_CLIENT_API1(status, fileName);
+        return status;
+    }
+
+    status_t RamsesClient::loadEffectCache(const char* fileName)
+    {
+        const status_t status = impl.loadEffectCache(fileName);
+        LOG_HL_CLIENT_API1(status, fileName);
+        return status;
+    }
+
     const Vector3fArray* RamsesClient::createConstVector3fArray(uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
     {
         const Vector3fArray* arr = impl.createConstVector3fArray(count, arrayData, cacheFlag, name);
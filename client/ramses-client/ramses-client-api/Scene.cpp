@@ -45,10 +45,12 @@
 #include "ramses-client-api/IndexDataBuffer.h"
 #include "ramses-client-api/VertexDataBuffer.h"
 #include "ramses-client-api/Texture2DBuffer.h"
+#include "ramses-client-api/UniformInput.h"
 
 // internal
 #include "SceneImpl.h"
 #include "EffectImpl.h"
+#include "EffectInputImpl.h"
 #include "TextureSamplerImpl.h"
 #include "Utils/StringUtils.h"
 
@@ -120,6 +122,90 @@ namespace ramses
         return meshNode;
     }
 
+    status_t Scene::createMeshNodes(Appearance& appearance, GeometryBinding& geometry, MeshNode* meshNodes[], uint32_t count)
+    {
+        const status_t status = impl.createMeshNodes(appearance, geometry, meshNodes, count);
+        LOG_HL_CLIENT_API4(status, LOG_API_RAMSESOBJECT_STRING(appearance), LOG_API_RAMSESOBJECT_STRING(geometry), LOG_API_GENERIC_PTR_STRING(meshNodes), count);
+        return status;
+    }
+
+    status_t Scene::setAppearancesInputValueFloat(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values)
+    {
+        const status_t status = impl.setAppearancesInputValue(appearances, appearanceCount, input.impl, values);
+        LOG_HL_CLIENT_API4(status, LOG_API_GENERIC_PTR_STRING(appearances), appearanceCount, LOG_API_GENERIC_OBJECT_STRING(input), LOG_API_GENERIC_PTR_STRING(values));
+        return status;
+    }
+
+    status_t Scene::setAppearancesInputValueVector2f(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values)
+    {
+        const status_t status = impl.setAppearancesInputValue(appearances, appearanceCount, input.impl, reinterpret_cast<const ramses_internal::Vector2*>(values));
+        LOG_HL_CLIENT_API4(status, LOG_API_GENERIC_PTR_STRING(appearances), appearanceCount, LOG_API_GENERIC_OBJECT_STRING(input), LOG_API_GENERIC_PTR_STRING(values));
+        return status;
+    }
+
+    status_t Scene::setAppearancesInputValueVector3f(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values)
+    {
+        const status_t status = impl.setAppearancesInputValue(appearances, appearanceCount, input.impl, reinterpret_cast<const ramses_internal::Vector3*>(values));
+        LOG_HL_CLIENT_API4(status, LOG_API_GENERIC_PTR_STRING(appearances), appearanceCount, LOG_API_GENERIC_OBJECT_STRING(input), LOG_API_GENERIC_PTR_STRING(values));
+        return status;
+    }
+
+    status_t Scene::setAppearancesInputValueVector4f(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values)
+    {
+        const status_t status = impl.setAppearancesInputValue(appearances, appearanceCount, input.impl, reinterpret_cast<const ramses_internal::Vector4*>(values));
+        LOG_HL_CLIENT_API4(status, LOG_API_GENERIC_PTR_STRING(appearances), appearanceCount, LOG_API_GENERIC_OBJECT_STRING(input), LOG_API_GENERIC_PTR_STRING(values));
+        return status;
+    }
+
+    status_t Scene::setAppearancesInputValueInt32(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const int32_t* values)
+    {
+        const status_t status = impl.setAppearancesInputValue(appearances, appearanceCount, input.impl, values);
+        LOG_HL_CLIENT_API4(status, LOG_API_GENERIC_PTR_STRING(appearances), appearanceCount, LOG_API_GENERIC_OBJECT_STRING(input), LOG_API_GENERIC_PTR_STRING(values));
+        return status;
+    }
+
+    status_t Scene::setAppearancesInputValueVector2i(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const int32_t* values)
+    {
+        const status_t status = impl.setAppearancesInputValue(appearances, appearanceCount, input.impl, reinterpret_cast<const ramses_internal::Vector2i*>(values));
+        LOG_HL_CLIENT_API4(status, LOG_API_GENERIC_PTR_STRING(appearances), appearanceCount, LOG_API_GENERIC_OBJECT_STRING(input), LOG_API_GENERIC_PTR_STRING(values));
+        return status;
+    }
+
+    status_t Scene::setAppearancesInputValueVector3i(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const int32_t* values)
+    {
+        const status_t status = impl.setAppearancesInputValue(appearances, appearanceCount, input.impl, reinterpret_cast<const ramses_internal::Vector3i*>(values));
+        LOG_HL_CLIENT_API4(status, LOG_API_GENERIC_PTR_STRING(appearances), appearanceCount, LOG_API_GENERIC_OBJECT_STRING(input), LOG_API_GENERIC_PTR_STRING(values));
+        return status;
+    }
+
+    status_t Scene::setAppearancesInputValueVector4i(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const int32_t* values)
+    {
+        const status_t status = impl.setAppearancesInputValue(appearances, appearanceCount, input.impl, reinterpret_cast<const ramses_internal::Vector4i*>(values));
+        LOG_HL_CLIENT_API4(status, LOG_API_GENERIC_PTR_STRING(appearances), appearanceCount, LOG_API_GENERIC_OBJECT_STRING(input), LOG_API_GENERIC_PTR_STRING(values));
+        return status;
+    }
+
+    status_t Scene::setAppearancesInputValueMatrix22f(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values)
+    {
+        const status_t status = impl.setAppearancesInputValue(appearances, appearanceCount, input.impl, reinterpret_cast<const ramses_internal::Matrix22f*>(values));
+        LOG_HL_CLIENT_API4(status, LOG_API_GENERIC_PTR_STRING(appearances), appearanceCount, LOG_API_GENERIC_OBJECT_STRING(input), LOG_API_GENERIC_PTR_STRING(values));
+        return status;
+    }
+
+    status_t Scene::setAppearancesInputValueMatrix33f(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values)
+    {
+        const status_t status = impl.setAppearancesInputValue(appearances, appearanceCount, input.impl, reinterpret_cast<const ramses_internal::Matrix33f*>(values));
+        LOG_HL_CLIENT_API4(status, LOG_API_GENERIC_PTR_STRING(appearances), appearanceCount, LOG_API_GENERIC_OBJECT_STRING(input), LOG_API_GENERIC_PTR_STRING(values));
+        return status;
+    }
+
+    status_t Scene::setAppearancesInputValueMatrix44f(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values)
+    {
+        const status_t status = impl.setAppearancesInputValue(appearances, appearanceCount, input.impl, reinterpret_cast<const ramses_internal::Matrix44f*>(values));
+        LOG_HL_CLIENT_API4(status, LOG_API_GENERIC_PTR_STRING(appearances), appearanceCount, LOG_API_GENERIC_OBJECT_STRING(input), LOG_API_GENERIC_PTR_STRING(values));
+        return status;
+    }
+
     status_t Scene::publish(EScenePublicationMode publicationMode)
     {
         const status_t status = impl.publish(publicationMode);
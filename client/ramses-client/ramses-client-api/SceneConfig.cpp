@@ -37,4 +37,18 @@ namespace ramses
         LOG_HL_CLIENT_API1(status, publicationMode);
         return status;
     }
+
+    status_t SceneConfig::setAsynchronousFlushEnabled(bool enable)
+    {
+        const status_t status = impl.setAsynchronousFlushEnabled(enable);
+        LOG_HL_CLIENT_API1(status, enable);
+        return status;
+    }
+
+    status_t SceneConfig::setSceneShadowCopyEnabled(bool enable)
+    {
+        const status_t status = impl.setSceneShadowCopyEnabled(enable);
+        LOG_HL_CLIENT_API1(status, enable);
+        return status;
+    }
 }
@@ -129,6 +129,35 @@ namespace ramses
         */
         uint32_t getInstanceCount() const;
 
+        /**
+        * @brief Sets a bounding sphere enclosing all vertices of this mesh, in the local
+        *        coordinate space of the MeshNode.
+        *
+        * The renderer uses the bounding sphere to skip rendering of the mesh when it is
+        * completely outside of the viewing frustum of the camera used in a render pass.
+        * A mesh without bounding sphere (radius 0, default) is never skipped.
+        * BoundingSphereCollection::ComputeBoundingSphereForVertices can be used to compute
+        * the bounding sphere from vertex positions.
+        *
+        * @param[in] xCenter X coordinate of the sphere center
+        * @param[in] yCenter Y coordinate of the sphere center
+        * @param[in] zCenter Z coordinate of the sphere center
+        * @param[in] radius Radius of the sphere, 0 to remove the bounding sphere. Cannot be negative.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setBoundingSphere(float xCenter, float yCenter, float zCenter, float radius);
+
+        /**
+        * @brief Gets the bounding sphere of this mesh in the local coordinate space of the MeshNode.
+        *
+        * @param[out] xCenter X coordinate of the sphere center
+        * @param[out] yCenter Y coordinate of the sphere center
+        * @param[out] zCenter Z coordinate of the sphere center
+        * @param[out] radius Radius of the sphere, 0 if no bounding sphere is set
+        */
+        void getBoundingSphere(float& xCenter, float& yCenter, float& zCenter, float& radius) const;
+
         /**
         * Stores internal data for implementation specifics of MeshNode.
         */
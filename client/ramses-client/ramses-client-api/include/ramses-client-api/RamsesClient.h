@@ -415,6 +415,40 @@ namespace ramses
         */
         Effect* createEffect(const EffectDescription& effectDesc, resourceCacheFlag_t cacheFlag = ResourceCacheFlag_DoNotCache, const char* name = 0);
 
+        /**
+        * @brief Compiles effects described by given EffectDescription instances on the calling thread and keeps
+        *        the results in the effect cache of this client. Subsequent calls to createEffect with an equal description
+        *        (shaders, compiler defines and semantics) reuse the compilation result and do not parse the shaders again.
+        *        No Effect objects are created by this call.
+        *
+        * @param[in] effectDescriptions Array of effect descriptions to compile.
+        * @param[in] count Number of elements in effectDescriptions.
+        * @return StatusOK if all effects were compiled successfully, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t precompileEffects(const EffectDescription* const effectDescriptions[], uint32_t count);
+
+        /**
+        * @brief Writes all compiled effects from the effect cache of this client to a file.
+        *        The file can be loaded with loadEffectCache by a client of the same RAMSES version,
+        *        so that effects can be created without compiling shaders.
+        *
+        * @param[in] fileName File name to write the effect cache to.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t saveEffectCache(const char* fileName) const;
+
+        /**
+        * @brief Adds compiled effects stored in a file by saveEffectCache to the effect cache of this client.
+        *        Loading fails if the file was created by a different RAMSES version.
+        *
+        * @param[in] fileName File name to read the effect cache from.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t loadEffectCache(const char* fileName);
+
         /**
         * @brief Get an object from the client by name.
         *        Only resource and scene names are searched.
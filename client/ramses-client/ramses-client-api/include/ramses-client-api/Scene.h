@@ -38,6 +38,7 @@ namespace ramses
     class RenderTargetDescription;
     class TextureSampler;
     class AttributeInput;
+    class UniformInput;
     class DataObject;
     class DataFloat;
     class DataVector2f;
@@ -187,6 +188,158 @@ namespace ramses
         */
         MeshNode* createMeshNode(const char* name = 0);
 
+        /**
+         * @brief Creates the given number of MeshNodes, all of them using the same Appearance and GeometryBinding.
+         *        The result is the same as calling createMeshNode(), MeshNode::setAppearance() and MeshNode::setGeometryBinding()
+         *        for every MeshNode, but capacity is reserved once for all of them, which is considerably faster when
+         *        creating large numbers of objects, e.g. for procedurally generated scenes. Created MeshNodes have no name,
+         *        appearance or geometry can be changed per MeshNode afterwards as usual.
+         *
+         * @param[in] appearance Appearance used by all created MeshNodes.
+         * @param[in] geometry GeometryBinding used by all created MeshNodes, must be compatible with appearance.
+         * @param[out] meshNodes Array of at least count elements, filled with pointers to the created MeshNodes.
+         * @param[in] count Number of MeshNodes to create.
+         * @return StatusOK on success, otherwise the returned status can be used
+         *         to resolve error message using getStatusMessage(). No MeshNode is created on failure.
+         */
+        status_t createMeshNodes(Appearance& appearance, GeometryBinding& geometry, MeshNode* meshNodes[], uint32_t count);
+
+        /**
+        * @brief Sets value of the same float uniform input of many appearances at once.
+        *        All appearances must be from this scene and use the effect the input belongs to. The result is
+        *        the same as calling Appearance::setInputValueFloat() for each of them, but the input is validated
+        *        once per call and all changed values are sent to renderer as a single scene action.
+        *        If input cannot be set on any of the appearances, no value is changed at all.
+        *
+        * @param[in] appearances Array of appearances to set the input value on.
+        * @param[in] appearanceCount Number of elements in appearances.
+        * @param[in] input The effect uniform input to set the values to
+        * @param[in] values Pointer to the values, UniformInput::getElementCount() values for each appearance consecutively
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setAppearancesInputValueFloat(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values);
+
+        /**
+        * @brief Sets value of the same Vector2f uniform input of many appearances at once, see setAppearancesInputValueFloat().
+        *
+        * @param[in] appearances Array of appearances to set the input value on.
+        * @param[in] appearanceCount Number of elements in appearances.
+        * @param[in] input The effect uniform input to set the values to
+        * @param[in] values Pointer to the values, 2 floats per element of UniformInput::getElementCount() elements for each appearance consecutively
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setAppearancesInputValueVector2f(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values);
+
+        /**
+        * @brief Sets value of the same Vector3f uniform input of many appearances at once, see setAppearancesInputValueFloat().
+        *
+        * @param[in] appearances Array of appearances to set the input value on.
+        * @param[in] appearanceCount Number of elements in appearances.
+        * @param[in] input The effect uniform input to set the values to
+        * @param[in] values Pointer to the values, 3 floats per element of UniformInput::getElementCount() elements for each appearance consecutively
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setAppearancesInputValueVector3f(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values);
+
+        /**
+        * @brief Sets value of the same Vector4f uniform input of many appearances at once, see setAppearancesInputValueFloat().
+        *
+        * @param[in] appearances Array of appearances to set the input value on.
+        * @param[in] appearanceCount Number of elements in appearances.
+        * @param[in] input The effect uniform input to set the values to
+        * @param[in] values Pointer to the values, 4 floats per element of UniformInput::getElementCount() elements for each appearance consecutively
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setAppearancesInputValueVector4f(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values);
+
+        /**
+        * @brief Sets value of the same Int32 uniform input of many appearances at once, see setAppearancesInputValueFloat().
+        *
+        * @param[in] appearances Array of appearances to set the input value on.
+        * @param[in] appearanceCount Number of elements in appearances.
+        * @param[in] input The effect uniform input to set the values to
+        * @param[in] values Pointer to the values, one value per element of UniformInput::getElementCount() elements for each appearance consecutively
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setAppearancesInputValueInt32(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const int32_t* values);
+
+        /**
+        * @brief Sets value of the same Vector2i uniform input of many appearances at once, see setAppearancesInputValueFloat().
+        *
+        * @param[in] appearances Array of appearances to set the input value on.
+        * @param[in] appearanceCount Number of elements in appearances.
+        * @param[in] input The effect uniform input to set the values to
+        * @param[in] values Pointer to the values, 2 int32_t per element of UniformInput::getElementCount() elements for each appearance consecutively
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setAppearancesInputValueVector2i(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const int32_t* values);
+
+        /**
+        * @brief Sets value of the same Vector3i uniform input of many appearances at once, see setAppearancesInputValueFloat().
+        *
+        * @param[in] appearances Array of appearances to set the input value on.
+        * @param[in] appearanceCount Number of elements in appearances.
+        * @param[in] input The effect uniform input to set the values to
+        * @param[in] values Pointer to the values, 3 int32_t per element of UniformInput::getElementCount() elements for each appearance consecutively
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setAppearancesInputValueVector3i(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const int32_t* values);
+
+        /**
+        * @brief Sets value of the same Vector4i uniform input of many appearances at once, see setAppearancesInputValueFloat().
+        *
+        * @param[in] appearances Array of appearances to set the input value on.
+        * @param[in] appearanceCount Number of elements in appearances.
+        * @param[in] input The effect uniform input to set the values to
+        * @param[in] values Pointer to the values, 4 int32_t per element of UniformInput::getElementCount() elements for each appearance consecutively
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setAppearancesInputValueVector4i(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const int32_t* values);
+
+        /**
+        * @brief Sets value of the same Matrix22f uniform input of many appearances at once, see setAppearancesInputValueFloat().
+        *
+        * @param[in] appearances Array of appearances to set the input value on.
+        * @param[in] appearanceCount Number of elements in appearances.
+        * @param[in] input The effect uniform input to set the values to
+        * @param[in] values Pointer to the values, 4 floats per element of UniformInput::getElementCount() elements for each appearance consecutively
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setAppearancesInputValueMatrix22f(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values);
+
+        /**
+        * @brief Sets value of the same Matrix33f uniform input of many appearances at once, see setAppearancesInputValueFloat().
+        *
+        * @param[in] appearances Array of appearances to set the input value on.
+        * @param[in] appearanceCount Number of elements in appearances.
+        * @param[in] input The effect uniform input to set the values to
+        * @param[in] values Pointer to the values, 9 floats per element of UniformInput::getElementCount() elements for each appearance consecutively
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setAppearancesInputValueMatrix33f(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values);
+
+        /**
+        * @brief Sets value of the same Matrix44f uniform input of many appearances at once, see setAppearancesInputValueFloat().
+        *
+        * @param[in] appearances Array of appearances to set the input value on.
+        * @param[in] appearanceCount Number of elements in appearances.
+        * @param[in] input The effect uniform input to set the values to
+        * @param[in] values Pointer to the values, 16 floats per element of UniformInput::getElementCount() elements for each appearance consecutively
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setAppearancesInputValueMatrix44f(Appearance* const appearances[], uint32_t appearanceCount, const UniformInput& input, const float* values);
+
         /**
         * @brief Destroys a previously created object using this scene
         * The object must be owned by this scene in order to be destroyed.
@@ -49,6 +49,38 @@ namespace ramses
         */
         status_t setPublicationMode(EScenePublicationMode publicationMode);
 
+        /**
+        * @brief Enable asynchronous flush for this scene.
+        *
+        * When enabled, Scene::flush only collects the scene changes and returns,
+        * applying them to the internal scene copy and sending them to subscribers
+        * is done by a separate thread in the order the flushes were issued.
+        * Pending flushes are processed at latest when the scene gets published, unpublished or destroyed.
+        * Asynchronous flush is not supported for scenes with EScenePublicationMode_LocalOnly
+        * or disabled scene shadow copy (see setSceneShadowCopyEnabled), such scenes are always flushed synchronously.
+        *
+        * @param[in] enable Enable (true) or disable (false, default) asynchronous flush.
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setAsynchronousFlushEnabled(bool enable);
+
+        /**
+        * @brief Enable or disable the internal shadow copy of the scene.
+        *
+        * By default a published scene is kept twice in memory, the second copy is updated on every flush
+        * and used to send the scene to new subscribers at any time.
+        * When disabled, there is no second copy and flushes do not have to update it. New subscribers
+        * get the scene state created on demand instead: right away if there are no changes since last flush,
+        * otherwise with the next flush.
+        * Scenes with EScenePublicationMode_LocalOnly never use a shadow copy.
+        *
+        * @param[in] enable Enable (true, default) or disable (false) scene shadow copy.
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setSceneShadowCopyEnabled(bool enable);
+
         /**
         * Stores internal data for implementation specifics of SceneConfig.
         */
@@ -67,6 +67,16 @@ namespace ramses
         */
         static Effect* CreateStandardTextEffect(RamsesClient& client, UniformInput& colorInput);
 
+        /**
+        * @brief Create an instance of text rendering effect for signed distance field glyphs
+        *        (see FontRegistry::createFreetype2FontInstanceSDF). Text rendered with it stays sharp
+        *        at any scale. Requires OpenGL ES 3.0 shader support. You obtain ownership of the effect.
+        * @param client Reference to a client object to use for effect creation
+        * @param colorInput the color uniform input in the created effect, you can use this to change the color of appearances created from the Effect.
+        * @return the text effect created.
+        */
+        static Effect* CreateSDFTextEffect(RamsesClient& client, UniformInput& colorInput);
+
         /**
         * @brief Generate mip maps from original texture 2D data. You obtain ownership of all the
         *        data returned in the mip map data object.
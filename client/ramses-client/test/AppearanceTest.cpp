@@ -1031,4 +1031,106 @@ namespace ramses
         EXPECT_EQ(EBlendOperation_Subtract, opColor);
         EXPECT_EQ(EBlendOperation_ReverseSubtract, opAlpha);
     }
+
+    TEST_F(AAppearanceTest, setsSameInputOfMultipleAppearancesAtOnce)
+    {
+        UniformInput inputObject;
+        EXPECT_EQ(StatusOK, sharedTestState->effect->findUniformInput("vec4fInput", inputObject));
+
+        Scene& scene = sharedTestState->getScene();
+        Appearance* appearances[] = { appearance, scene.createAppearance(*sharedTestState->effect), scene.createAppearance(*sharedTestState->effect) };
+        ASSERT_TRUE(appearances[1] != nullptr && appearances[2] != nullptr);
+
+        const float values[] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f };
+        EXPECT_EQ(StatusOK, scene.setAppearancesInputValueVector4f(appearances, 3u, inputObject, values));
+
+        for (uint32_t i = 0u; i < 3u; ++i)
+        {
+            float getValues[4] = { 0.f };
+            EXPECT_EQ(StatusOK, appearances[i]->getInputValueVector4f(inputObject, getValues[0], getValues[1], getValues[2], getValues[3]));
+            EXPECT_EQ(0, ramses_internal::PlatformMemory::Compare(values + 4u * i, getValues, sizeof(getValues)));
+        }
+
+        EXPECT_EQ(StatusOK, scene.destroy(*appearances[1]));
+        EXPECT_EQ(StatusOK, scene.destroy(*appearances[2]));
+    }
+
+    TEST_F(AAppearanceTest, setsSameArrayInputOfMultipleAppearancesAtOnce)
+    {
+        UniformInput inputObject;
+        EXPECT_EQ(StatusOK, sharedTestState->effect->findUniformInput("vec2iInputArray", inputObject));
+
+        Scene& scene = sharedTestState->getScene();
+        Appearance* appearances[] = { appearance, scene.createAppearance(*sharedTestState->effect) };
+        ASSERT_TRUE(appearances[1] != nullptr);
+
+        const int32_t values[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+        EXPECT_EQ(StatusOK, scene.setAppearancesInputValueVector2i(appearances, 2u, inputObject, values));
+
+        for (uint32_t i = 0u; i < 2u; ++i)
+        {
+            int32_t getValues[6] = { 0 };
+            EXPECT_EQ(StatusOK, appearances[i]->getInputValueVector2i(inputObject, 3u, getValues));
+            EXPECT_EQ(0, ramses_internal::PlatformMemory::Compare(values + 6u * i, getValues, sizeof(getValues)));
+        }
+
+        EXPECT_EQ(StatusOK, scene.destroy(*appearances[1]));
+    }
+
+    TEST_F(AAppearanceTest, sendsSameInputOfMultipleAppearancesAsSingleSceneActionOnlyForChangedValues)
+    {
+        UniformInput inputObject;
+        EXPECT_EQ(StatusOK, sharedTestState->effect->findUniformInput("floatInput", inputObject));
+
+        Scene& scene = sharedTestState->getScene();
+        Appearance* appearances[] = { appearance, scene.createAppearance(*sharedTestState->effect), scene.createAppearance(*sharedTestState->effect) };
+        EXPECT_EQ(StatusOK, appearances[1]->setInputValueFloat(inputObject, 2.f));
+
+        const ramses_internal::SceneActionCollection& actions = scene.impl.getIScene().getSceneActionCollection();
+        const uint32_t numberOfActions = actions.numberOfActions();
+        const float values[] = { 1.f, 2.f, 3.f };
+        EXPECT_EQ(StatusOK, scene.setAppearancesInputValueFloat(appearances, 3u, inputObject, values));
+        ASSERT_EQ(numberOfActions + 1u, actions.numberOfActions());
+        EXPECT_EQ(ramses_internal::ESceneActionId_SetDataArrayForInstances, actions.back().type());
+
+        // nothing changed, no scene action
+        EXPECT_EQ(StatusOK, scene.setAppearancesInputValueFloat(appearances, 3u, inputObject, values));
+        EXPECT_EQ(numberOfActions + 1u, actions.numberOfActions());
+
+        EXPECT_EQ(StatusOK, scene.destroy(*appearances[1]));
+        EXPECT_EQ(StatusOK, scene.destroy(*appearances[2]));
+    }
+
+    TEST_F(AAppearanceTest, failsToSetSameInputOfMultipleAppearancesIfAnyOfThemCannotBeSet)
+    {
+        UniformInput inputObject;
+        EXPECT_EQ(StatusOK, sharedTestState->effect->findUniformInput("floatInput", inputObject));
+
+        Scene& scene = sharedTestState->getScene();
+        Appearance* otherAppearance = scene.createAppearance(*sharedTestState->effect);
+        ASSERT_TRUE(otherAppearance != nullptr);
+        EXPECT_EQ(StatusOK, appearance->setInputValueFloat(inputObject, 1.f));
+        EXPECT_EQ(StatusOK, otherAppearance->setInputValueFloat(inputObject, 1.f));
+
+        DataFloat* dataObject = scene.createDataFloat();
+        ASSERT_TRUE(dataObject != nullptr);
+        EXPECT_EQ(StatusOK, otherAppearance->bindInput(inputObject, *dataObject));
+
+        Appearance* appearances[] = { appearance, otherAppearance };
+        const float values[] = { 2.f, 3.f };
+        EXPECT_NE(StatusOK, scene.setAppearancesInputValueFloat(appearances, 2u, inputObject, values));
+
+        float value = 0.f;
+        EXPECT_EQ(StatusOK, appearance->getInputValueFloat(inputObject, value));
+        EXPECT_EQ(1.f, value);
+
+        EXPECT_NE(StatusOK, scene.setAppearancesInputValueInt32(appearances, 1u, inputObject, reinterpret_cast<const int32_t*>(values)));
+        Appearance* noAppearances[] = { nullptr };
+        EXPECT_NE(StatusOK, scene.setAppearancesInputValueFloat(noAppearances, 1u, inputObject, values));
+        EXPECT_EQ(StatusOK, scene.setAppearancesInputValueFloat(nullptr, 0u, inputObject, nullptr));
+
+        EXPECT_EQ(StatusOK, otherAppearance->unbindInput(inputObject));
+        EXPECT_EQ(StatusOK, scene.destroy(*otherAppearance));
+        EXPECT_EQ(StatusOK, scene.destroy(*dataObject));
+    }
 }
@@ -42,8 +42,8 @@ protected:
 
     void createDummyScene()
     {
-        EXPECT_CALL(scenegraphProviderComponent, handleCreateScene(Ref(dummyScene), false));
-        logic.createScene(dummyScene, false);
+        EXPECT_CALL(scenegraphProviderComponent, handleCreateScene(Ref(dummyScene), false, false));
+        logic.createScene(dummyScene, false, false);
     }
 };
 
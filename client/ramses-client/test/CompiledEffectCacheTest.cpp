@@ -0,0 +1,176 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include "CompiledEffectCache.h"
+#include "Resource/EffectResource.h"
+#include "Components/SingleResourceSerialization.h"
+#include "Utils/BinaryOutputStream.h"
+#include "Utils/BinaryInputStream.h"
+
+namespace ramses_internal
+{
+    class ACompiledEffectCache : public ::testing::Test
+    {
+    public:
+        ACompiledEffectCache()
+        {
+            source.vertexShader = "void main(void) {gl_Position=vec4(0);}";
+            source.fragmentShader = "void main(void) {gl_FragColor=vec4(0);}";
+            source.compilerDefines.push_back("FOO 1");
+            source.semanticInputs.put("a", EFixedSemantics_ModelMatrix);
+            source.semanticInputs.put("b", EFixedSemantics_ViewMatrix);
+        }
+
+    protected:
+        // fills cache via stream with given effect as compiled result of source, this way no shader compilation is needed
+        void fillCacheFromStream(CompiledEffectCache& cache, const EffectResource& compiledEffect)
+        {
+            BinaryOutputStream outStream;
+            writeEntry(outStream, compiledEffect, compiledEffect.getHash());
+
+            BinaryInputStream inStream(outStream.getData());
+            EXPECT_TRUE(cache.readFromStream(inStream));
+        }
+
+        void writeEntry(BinaryOutputStream& outStream, const EffectResource& compiledEffect, const ResourceContentHash& storedHash)
+        {
+            const ResourceContentHash key = CompiledEffectCache::CreateKey(source);
+            outStream << 1u << key << storedHash;
+            SingleResourceSerialization::SerializeResource(outStream, compiledEffect);
+            outStream << key;
+        }
+
+        EffectSource source;
+        const EffectInputInformationVector uniformInputs{ EffectInputInformation("u", 1, EDataType_Float, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid) };
+        const EffectInputInformationVector attributeInputs{ EffectInputInformation("a", 1, EDataType_Vector3Buffer, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid) };
+        const EffectResource compiledEffect{ "vertex", "fragment", uniformInputs, attributeInputs, "compiled", ResourceCacheFlag_DoNotCache };
+    };
+
+    TEST_F(ACompiledEffectCache, createsSameKeyForEqualSources)
+    {
+        const EffectSource otherSource = source;
+        EXPECT_EQ(CompiledEffectCache::CreateKey(source), CompiledEffectCache::CreateKey(otherSource));
+    }
+
+    TEST_F(ACompiledEffectCache, createsSameKeyIndependentOfOrderOfSemantics)
+    {
+        EffectSource otherSource = source;
+        otherSource.semanticInputs.clear();
+        otherSource.semanticInputs.put("b", EFixedSemantics_ViewMatrix);
+        otherSource.semanticInputs.put("a", EFixedSemantics_ModelMatrix);
+        EXPECT_EQ(CompiledEffectCache::CreateKey(source), CompiledEffectCache::CreateKey(otherSource));
+    }
+
+    TEST_F(ACompiledEffectCache, createsDifferentKeyIfAnyPartOfSourceDiffers)
+    {
+        const ResourceContentHash key = CompiledEffectCache::CreateKey(source);
+
+        EffectSource otherSource = source;
+        otherSource.vertexShader += " ";
+        EXPECT_NE(key, CompiledEffectCache::CreateKey(otherSource));
+
+        otherSource = source;
+        otherSource.fragmentShader += " ";
+        EXPECT_NE(key, CompiledEffectCache::CreateKey(otherSource));
+
+        otherSource = source;
+        otherSource.compilerDefines.push_back("BAR 1");
+        EXPECT_NE(key, CompiledEffectCache::CreateKey(otherSource));
+
+        otherSource = source;
+        otherSource.semanticInputs.put("a", EFixedSemantics_ProjectionMatrix);
+        EXPECT_NE(key, CompiledEffectCache::CreateKey(otherSource));
+
+        // shader code moved between vertex and fragment shader must not give same key
+        otherSource = source;
+        otherSource.vertexShader = source.vertexShader + source.fragmentShader;
+        otherSource.fragmentShader = "";
+        EXPECT_NE(key, CompiledEffectCache::CreateKey(otherSource));
+    }
+
+    TEST_F(ACompiledEffectCache, isEmptyInitially)
+    {
+        CompiledEffectCache cache;
+        EXPECT_EQ(0u, cache.getNumberOfEntries());
+        EXPECT_EQ(0u, cache.getNumberOfHits());
+        EXPECT_EQ(0u, cache.getNumberOfCompilations());
+    }
+
+    TEST_F(ACompiledEffectCache, createsEffectResourceFromCachedCompilationWithGivenNameAndCacheFlag)
+    {
+        CompiledEffectCache cache;
+        fillCacheFromStream(cache, compiledEffect);
+        EXPECT_EQ(1u, cache.getNumberOfEntries());
+
+        String errorMessages;
+        std::unique_ptr<EffectResource> effect(cache.createEffectResource(source, ResourceCacheFlag(5u), "effect", errorMessages));
+        ASSERT_TRUE(effect);
+        EXPECT_STREQ("vertex", effect->getVertexShader());
+        EXPECT_STREQ("fragment", effect->getFragmentShader());
+        EXPECT_EQ(uniformInputs, effect->getUniformInputs());
+        EXPECT_EQ(attributeInputs, effect->getAttributeInputs());
+        EXPECT_EQ(String("effect"), effect->getName());
+        EXPECT_EQ(ResourceCacheFlag(5u), effect->getCacheFlag());
+        EXPECT_TRUE(errorMessages.empty());
+
+        EXPECT_EQ(1u, cache.getNumberOfHits());
+        EXPECT_EQ(0u, cache.getNumberOfCompilations());
+    }
+
+    TEST_F(ACompiledEffectCache, writesAndReadsAllEntries)
+    {
+        CompiledEffectCache cache;
+        fillCacheFromStream(cache, compiledEffect);
+
+        BinaryOutputStream outStream;
+        cache.writeToStream(outStream);
+
+        CompiledEffectCache otherCache;
+        BinaryInputStream inStream(outStream.getData());
+        EXPECT_TRUE(otherCache.readFromStream(inStream));
+        EXPECT_EQ(1u, otherCache.getNumberOfEntries());
+
+        String errorMessages;
+        std::unique_ptr<EffectResource> effect(otherCache.createEffectResource(source, ResourceCacheFlag_DoNotCache, "compiled", errorMessages));
+        ASSERT_TRUE(effect);
+        EXPECT_EQ(compiledEffect.getHash(), effect->getHash());
+        EXPECT_EQ(0u, otherCache.getNumberOfCompilations());
+    }
+
+    TEST_F(ACompiledEffectCache, keepsNoEntriesFromStreamIfLaterEntryIsCorrupt)
+    {
+        EffectSource otherSource = source;
+        otherSource.vertexShader += " ";
+
+        BinaryOutputStream outStream;
+        outStream << 2u << CompiledEffectCache::CreateKey(source) << compiledEffect.getHash();
+        SingleResourceSerialization::SerializeResource(outStream, compiledEffect);
+        outStream << CompiledEffectCache::CreateKey(source);
+        outStream << CompiledEffectCache::CreateKey(otherSource) << compiledEffect.getHash();
+        SingleResourceSerialization::SerializeResource(outStream, compiledEffect);
+        // key after resource does not match, e.g. record of different layout
+        outStream << CompiledEffectCache::CreateKey(source);
+
+        CompiledEffectCache cache;
+        BinaryInputStream inStream(outStream.getData());
+        EXPECT_FALSE(cache.readFromStream(inStream));
+        EXPECT_EQ(0u, cache.getNumberOfEntries());
+    }
+
+    TEST_F(ACompiledEffectCache, rejectsEntryWhoseContentDoesNotMatchStoredHash)
+    {
+        BinaryOutputStream outStream;
+        writeEntry(outStream, compiledEffect, ResourceContentHash(1u, 2u));
+
+        CompiledEffectCache cache;
+        BinaryInputStream inStream(outStream.getData());
+        EXPECT_FALSE(cache.readFromStream(inStream));
+        EXPECT_EQ(0u, cache.getNumberOfEntries());
+    }
+}
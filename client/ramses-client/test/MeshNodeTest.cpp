@@ -343,6 +343,39 @@ namespace ramses
         EXPECT_NE(StatusOK, m_meshNode->setInstanceCount(0u));
     }
 
+    TEST_F(MeshNodeTest, hasNoBoundingSphereByDefault)
+    {
+        float x = -1.f;
+        float y = -1.f;
+        float z = -1.f;
+        float radius = -1.f;
+        m_meshNode->getBoundingSphere(x, y, z, radius);
+        EXPECT_EQ(0.f, x);
+        EXPECT_EQ(0.f, y);
+        EXPECT_EQ(0.f, z);
+        EXPECT_EQ(0.f, radius);
+    }
+
+    TEST_F(MeshNodeTest, setsAndGetsSameBoundingSphere)
+    {
+        EXPECT_EQ(StatusOK, m_meshNode->setBoundingSphere(1.f, 2.f, 3.f, 4.f));
+
+        float x = 0.f;
+        float y = 0.f;
+        float z = 0.f;
+        float radius = 0.f;
+        m_meshNode->getBoundingSphere(x, y, z, radius);
+        EXPECT_EQ(1.f, x);
+        EXPECT_EQ(2.f, y);
+        EXPECT_EQ(3.f, z);
+        EXPECT_EQ(4.f, radius);
+    }
+
+    TEST_F(MeshNodeTest, doesNotAllowNegativeBoundingSphereRadius)
+    {
+        EXPECT_NE(StatusOK, m_meshNode->setBoundingSphere(0.f, 0.f, 0.f, -1.f));
+    }
+
     TEST_F(MeshNodeTest, succeedsValidationIfNotUsingIndexArray)
     {
         setAnAppearanceForTesting();
@@ -360,4 +393,102 @@ namespace ramses
 
         EXPECT_NE(StatusOK, m_meshNode->validate());
     }
+
+    TEST_F(MeshNodeTest, createsMultipleMeshNodesUsingSameAppearanceAndGeometry)
+    {
+        Effect* effect = TestEffects::CreateTestEffect(client);
+        Appearance* appearance = m_scene.createAppearance(*effect, "appearance");
+        GeometryBinding& geometry = createValidGeometry(effect);
+
+        MeshNode* meshNodes[3] = {};
+        EXPECT_EQ(StatusOK, m_scene.createMeshNodes(*appearance, geometry, meshNodes, 3u));
+
+        for (const auto meshNode : meshNodes)
+        {
+            ASSERT_TRUE(meshNode != nullptr);
+            EXPECT_NE(m_meshNode, meshNode);
+            EXPECT_EQ(appearance, meshNode->getAppearance());
+            EXPECT_EQ(&geometry, meshNode->getGeometryBinding());
+            EXPECT_EQ(0u, meshNode->getStartIndex());
+            EXPECT_EQ(createValidIndexArray().impl.getElementCount(), meshNode->getIndexCount());
+            EXPECT_EQ(StatusOK, meshNode->validate());
+
+            m_meshNode = meshNode;
+            EXPECT_TRUE(meshNodeUniformAndAttributesIsSetInScene(*appearance, geometry));
+        }
+    }
+
+    TEST_F(MeshNodeTest, createsMeshNodesLikeSingleMeshNodeWithAppearanceAndGeometry)
+    {
+        Effect* effect = TestEffects::CreateTestEffect(client);
+        Appearance* appearance = m_scene.createAppearance(*effect, "appearance");
+        GeometryBinding& geometry = createValidGeometry(effect);
+        EXPECT_EQ(StatusOK, m_meshNode->setAppearance(*appearance));
+        EXPECT_EQ(StatusOK, m_meshNode->setGeometryBinding(geometry));
+
+        MeshNode* meshNode = nullptr;
+        EXPECT_EQ(StatusOK, m_scene.createMeshNodes(*appearance, geometry, &meshNode, 1u));
+        ASSERT_TRUE(meshNode != nullptr);
+
+        const Renderable& expected = m_internalScene.getRenderable(m_meshNode->impl.getRenderableHandle());
+        const Renderable& actual = m_internalScene.getRenderable(meshNode->impl.getRenderableHandle());
+        EXPECT_EQ(meshNode->impl.getNodeHandle(), actual.node);
+        EXPECT_EQ(expected.dataInstances[ERenderableDataSlotType_Uniforms], actual.dataInstances[ERenderableDataSlotType_Uniforms]);
+        EXPECT_EQ(expected.dataInstances[ERenderableDataSlotType_Geometry], actual.dataInstances[ERenderableDataSlotType_Geometry]);
+        EXPECT_EQ(expected.effectResource, actual.effectResource);
+        EXPECT_EQ(expected.renderState, actual.renderState);
+        EXPECT_EQ(expected.startIndex, actual.startIndex);
+        EXPECT_EQ(expected.indexCount, actual.indexCount);
+        EXPECT_EQ(expected.isVisible, actual.isVisible);
+    }
+
+    TEST_F(MeshNodeTest, reservesSceneForAllMeshNodesCreatedAtOnce)
+    {
+        Effect* effect = TestEffects::CreateTestEffect(client);
+        Appearance* appearance = m_scene.createAppearance(*effect, "appearance");
+        GeometryBinding& geometry = createValidGeometry(effect);
+
+        const UInt32 nodeCount = m_internalScene.getNodeCount();
+        const UInt32 renderableCount = m_internalScene.getRenderableCount();
+
+        MeshNode* meshNodes[10] = {};
+        EXPECT_EQ(StatusOK, m_scene.createMeshNodes(*appearance, geometry, meshNodes, 10u));
+        EXPECT_EQ(nodeCount + 10u, m_internalScene.getNodeCount());
+        EXPECT_EQ(renderableCount + 10u, m_internalScene.getRenderableCount());
+    }
+
+    TEST_F(MeshNodeTest, createsNoMeshNodesForZeroCount)
+    {
+        Effect* effect = TestEffects::CreateTestEffect(client);
+        Appearance* appearance = m_scene.createAppearance(*effect, "appearance");
+        GeometryBinding& geometry = createValidGeometry(effect);
+
+        const uint32_t numMeshNodes = m_scene.impl.getObjectRegistry().getNumberOfObjects(ERamsesObjectType_MeshNode);
+        EXPECT_EQ(StatusOK, m_scene.createMeshNodes(*appearance, geometry, nullptr, 0u));
+        EXPECT_EQ(numMeshNodes, m_scene.impl.getObjectRegistry().getNumberOfObjects(ERamsesObjectType_MeshNode));
+    }
+
+    TEST_F(MeshNodeTest, reportsErrorWhenCreatingMeshNodesWithAppearanceFromAnotherScene)
+    {
+        Scene& anotherScene = *client.createScene(12u);
+        Effect* effect = TestEffects::CreateTestEffect(client);
+        Appearance* appearance = anotherScene.createAppearance(*effect, "appearance");
+        ASSERT_TRUE(appearance != nullptr);
+        GeometryBinding& geometry = createValidGeometry(effect);
+
+        MeshNode* meshNode = nullptr;
+        EXPECT_NE(StatusOK, m_scene.createMeshNodes(*appearance, geometry, &meshNode, 1u));
+        EXPECT_EQ(nullptr, meshNode);
+        client.destroy(anotherScene);
+    }
+
+    TEST_F(MeshNodeTest, reportsErrorWhenCreatingMeshNodesWithIncompatibleAppearanceAndGeometry)
+    {
+        Appearance* appearance = m_scene.createAppearance(*TestEffects::CreateTestEffect(client), "appearance");
+        GeometryBinding& geometry = *m_scene.createGeometryBinding(*TestEffects::CreateDifferentTestEffect(client));
+
+        MeshNode* meshNode = nullptr;
+        EXPECT_NE(StatusOK, m_scene.createMeshNodes(*appearance, geometry, &meshNode, 1u));
+        EXPECT_EQ(nullptr, meshNode);
+    }
 }
@@ -120,4 +120,78 @@ namespace ramses
         this->m_scene.flush();
         EXPECT_FALSE(this->m_childMesh->impl.getFlattenedVisibility());
     }
+    class AHierarchicalVisibility : public LocalTestClientWithScene, public testing::Test
+    {
+    protected:
+        AHierarchicalVisibility()
+            : m_root(createObject<Node>("root"))
+            , m_intermediate(createObject<Node>("intermediate"))
+            , m_leafParent(createObject<Node>("leafParent"))
+            , m_mesh(createObject<MeshNode>("mesh"))
+            , m_otherMesh(createObject<MeshNode>("otherMesh"))
+        {
+            m_intermediate.setParent(m_root);
+            m_leafParent.setParent(m_intermediate);
+            m_mesh.setParent(m_leafParent);
+            m_otherMesh.setParent(m_intermediate);
+            m_scene.flush();
+        }
+
+        Node& m_root;
+        Node& m_intermediate;
+        Node& m_leafParent;
+        MeshNode& m_mesh;
+        MeshNode& m_otherMesh;
+    };
+
+    TEST_F(AHierarchicalVisibility, propagatesVisibilityChangesDeepIntoHierarchyAndBack)
+    {
+        m_root.setVisibility(false);
+        m_scene.flush();
+        EXPECT_FALSE(m_mesh.impl.getFlattenedVisibility());
+        EXPECT_FALSE(m_otherMesh.impl.getFlattenedVisibility());
+
+        m_root.setVisibility(true);
+        m_scene.flush();
+        EXPECT_TRUE(m_mesh.impl.getFlattenedVisibility());
+        EXPECT_TRUE(m_otherMesh.impl.getFlattenedVisibility());
+    }
+
+    TEST_F(AHierarchicalVisibility, appliesChangeOfNodeBelowUnchangedSubtreeOfOtherDirtyNode)
+    {
+        Node& newRoot = createObject<Node>("newRoot");
+        m_root.setParent(newRoot);
+        m_leafParent.setVisibility(false);
+        m_scene.flush();
+
+        EXPECT_FALSE(m_mesh.impl.getFlattenedVisibility());
+        EXPECT_TRUE(m_otherMesh.impl.getFlattenedVisibility());
+    }
+
+    TEST_F(AHierarchicalVisibility, keepsVisibilityOfInvisibleSubtreeWhenAncestorBecomesVisibleAgain)
+    {
+        m_leafParent.setVisibility(false);
+        m_scene.flush();
+        m_root.setVisibility(false);
+        m_scene.flush();
+        m_root.setVisibility(true);
+        m_scene.flush();
+
+        EXPECT_FALSE(m_mesh.impl.getFlattenedVisibility());
+        EXPECT_TRUE(m_otherMesh.impl.getFlattenedVisibility());
+    }
+
+    TEST_F(AHierarchicalVisibility, sendsSingleSceneActionForAllRenderablesChangingVisibility)
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            createObject<MeshNode>("additionalMesh").setParent(m_leafParent);
+        }
+        m_scene.flush();
+
+        const uint32_t actionsBefore = m_scene.impl.getIScene().getStatisticCollection().statSceneActionsGenerated.getCounterValue();
+        m_root.setVisibility(false);
+        m_scene.flush();
+        EXPECT_EQ(1u, m_scene.impl.getIScene().getStatisticCollection().statSceneActionsGenerated.getCounterValue() - actionsBefore);
+    }
 }
@@ -295,6 +295,98 @@ namespace ramses
         EXPECT_FALSE(nullptr != effectFixture);
     }
 
+    TEST_F(ALocalRamsesClient, createEffectReusesCompilationOfEqualEffectDescription)
+    {
+        const ramses::Effect* effect1 = client.createEffect(effectDescriptionEmpty, ramses::ResourceCacheFlag_DoNotCache, "name");
+        const ramses::Effect* effect2 = client.createEffect(effectDescriptionEmpty, ramses::ResourceCacheFlag_DoNotCache, "name");
+        ASSERT_TRUE(nullptr != effect1);
+        ASSERT_TRUE(nullptr != effect2);
+        EXPECT_EQ(effect1->getResourceId(), effect2->getResourceId());
+
+        EXPECT_EQ(1u, client.impl.getEffectCache().getNumberOfCompilations());
+        EXPECT_EQ(1u, client.impl.getEffectCache().getNumberOfHits());
+    }
+
+    TEST_F(ALocalRamsesClient, createEffectCompilesAgainIfDefinesDiffer)
+    {
+        EXPECT_TRUE(nullptr != client.createEffect(effectDescriptionEmpty, ramses::ResourceCacheFlag_DoNotCache, "name"));
+        effectDescriptionEmpty.addCompilerDefine("float dummy;");
+        EXPECT_TRUE(nullptr != client.createEffect(effectDescriptionEmpty, ramses::ResourceCacheFlag_DoNotCache, "name"));
+
+        EXPECT_EQ(2u, client.impl.getEffectCache().getNumberOfCompilations());
+        EXPECT_EQ(0u, client.impl.getEffectCache().getNumberOfHits());
+    }
+
+    TEST_F(ALocalRamsesClient, doesNotCacheFailedEffectCompilation)
+    {
+        effectDescriptionEmpty.setVertexShader("void main(void) {dsadsadasd}");
+        EXPECT_TRUE(nullptr == client.createEffect(effectDescriptionEmpty, ramses::ResourceCacheFlag_DoNotCache, "name"));
+        EXPECT_TRUE(nullptr == client.createEffect(effectDescriptionEmpty, ramses::ResourceCacheFlag_DoNotCache, "name"));
+
+        EXPECT_EQ(2u, client.impl.getEffectCache().getNumberOfCompilations());
+        EXPECT_EQ(0u, client.impl.getEffectCache().getNumberOfEntries());
+    }
+
+    TEST_F(ALocalRamsesClient, createsEffectsWithoutCompilationAfterPrecompilingThem)
+    {
+        ramses::EffectDescription effectDescriptionWithDefine;
+        effectDescriptionWithDefine.setVertexShader(effectDescriptionEmpty.getVertexShader());
+        effectDescriptionWithDefine.setFragmentShader(effectDescriptionEmpty.getFragmentShader());
+        effectDescriptionWithDefine.addCompilerDefine("float dummy;");
+
+        const ramses::EffectDescription* effectDescriptions[] = { &effectDescriptionEmpty, &effectDescriptionWithDefine, &effectDescriptionEmpty };
+        EXPECT_EQ(ramses::StatusOK, client.precompileEffects(effectDescriptions, 3u));
+        EXPECT_EQ(2u, client.impl.getEffectCache().getNumberOfCompilations());
+
+        EXPECT_TRUE(nullptr != client.createEffect(effectDescriptionEmpty, ramses::ResourceCacheFlag_DoNotCache, "name"));
+        EXPECT_TRUE(nullptr != client.createEffect(effectDescriptionWithDefine, ramses::ResourceCacheFlag_DoNotCache, "name"));
+        EXPECT_EQ(2u, client.impl.getEffectCache().getNumberOfCompilations());
+        EXPECT_EQ(2u, client.impl.getEffectCache().getNumberOfHits());
+    }
+
+    TEST_F(ALocalRamsesClient, reportsErrorWhenPrecompilingInvalidEffect)
+    {
+        ramses::EffectDescription invalidEffectDescription;
+        invalidEffectDescription.setVertexShader("void main(void) {dsadsadasd}");
+        invalidEffectDescription.setFragmentShader(effectDescriptionEmpty.getFragmentShader());
+
+        const ramses::EffectDescription* effectDescriptions[] = { &effectDescriptionEmpty, &invalidEffectDescription };
+        EXPECT_NE(ramses::StatusOK, client.precompileEffects(effectDescriptions, 2u));
+        EXPECT_EQ(1u, client.impl.getEffectCache().getNumberOfEntries());
+    }
+
+    TEST_F(ALocalRamsesClient, reportsErrorWhenPrecompilingNullEffectDescription)
+    {
+        const ramses::EffectDescription* effectDescriptions[] = { &effectDescriptionEmpty, nullptr };
+        EXPECT_NE(ramses::StatusOK, client.precompileEffects(effectDescriptions, 2u));
+        EXPECT_NE(ramses::StatusOK, client.precompileEffects(nullptr, 1u));
+    }
+
+    TEST_F(ALocalRamsesClient, canCreateEffectFromLoadedEffectCacheWithoutCompilation)
+    {
+        const ramses::Effect* compiledEffect = client.createEffect(effectDescriptionEmpty, ramses::ResourceCacheFlag_DoNotCache, "name");
+        ASSERT_TRUE(nullptr != compiledEffect);
+        EXPECT_EQ(ramses::StatusOK, client.saveEffectCache("ramses-client-test_effectCache.bin"));
+
+        LocalTestClient otherClient;
+        const ramses::status_t status = otherClient.getClient().loadEffectCache("ramses-client-test_effectCache.bin");
+        EXPECT_EQ(ramses::StatusOK, status) << otherClient.getClient().getStatusMessage(status);
+        EXPECT_EQ(1u, otherClient.getClient().impl.getEffectCache().getNumberOfEntries());
+
+        const ramses::Effect* effectFromCache = otherClient.getClient().createEffect(effectDescriptionEmpty, ramses::ResourceCacheFlag_DoNotCache, "name");
+        ASSERT_TRUE(nullptr != effectFromCache);
+        EXPECT_EQ(compiledEffect->getResourceId(), effectFromCache->getResourceId());
+        EXPECT_EQ(0u, otherClient.getClient().impl.getEffectCache().getNumberOfCompilations());
+        EXPECT_EQ(1u, otherClient.getClient().impl.getEffectCache().getNumberOfHits());
+
+        ramses_internal::File("ramses-client-test_effectCache.bin").remove();
+    }
+
+    TEST_F(ALocalRamsesClient, reportsErrorWhenLoadingNonExistingEffectCache)
+    {
+        EXPECT_NE(ramses::StatusOK, client.loadEffectCache("this_file_should_not_exist_fdsfdsjf84w9wufw.bin"));
+    }
+
     // effect from file: valid uses
     TEST_F(ALocalRamsesClient, createEffectFromGLSL_withName)
     {
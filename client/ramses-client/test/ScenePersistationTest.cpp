@@ -77,6 +77,14 @@
 #include "AnimatedSetterImpl.h"
 #include "AnimationSequenceImpl.h"
 #include "Utils/File.h"
+#include "Utils/BinaryFileInputStream.h"
+#include "Utils/BinaryFileOutputStream.h"
+#include "Utils/BinaryOutputStream.h"
+#include "Scene/ScenePersistation.h"
+#include "SceneFileSectionIndex.h"
+#include "SerializationContext.h"
+#include "RamsesVersion.h"
+#include "ramses-sdk-build-config.h"
 #include "ramses-utils.h"
 
 #include "IndexDataBufferImpl.h"
@@ -321,7 +329,8 @@ namespace ramses
         EXPECT_EQ(StatusOK, meshNode->setGeometryBinding(*geometry));
         EXPECT_EQ(StatusOK, meshNode->setStartIndex(456));
         EXPECT_EQ(StatusOK, meshNode->setIndexCount(678u));
-        EXPECT_EQ(StatusOK, meshNode->impl.setFlattenedVisibility(false));
+        EXPECT_EQ(StatusOK, meshNode->setVisibility(false));
+        this->m_scene.flush();
         doWriteReadCycle();
 
         MeshNode* loadedMeshNode = this->getObjectForTesting<MeshNode>("a meshnode");
@@ -1197,6 +1206,172 @@ namespace ramses
         EXPECT_EQ(geometryLoaded, mesh3Loaded->getGeometryBinding());
     }
 
+    TEST_F(ASceneAndAnimationSystemLoadedFromFile, canReadWriteSceneWithResourcesInMultipleFiles)
+    {
+        EffectDescription effectDesc;
+        EXPECT_EQ(StatusOK, effectDesc.setVertexShaderFromFile("res/ramses-client-test_shader.vert"));
+        EXPECT_EQ(StatusOK, effectDesc.setFragmentShaderFromFile("res/ramses-client-test_minimalShader.frag"));
+        Effect* const effect = this->client.createEffect(effectDesc, ramses::ResourceCacheFlag_DoNotCache, "effect");
+        ASSERT_TRUE(effect != nullptr);
+        m_resources.add(effect);
+
+        static const uint16_t inds[3] = { 0, 1, 2 };
+        const UInt16Array* const indices = this->client.createConstUInt16Array(3u, inds, ramses::ResourceCacheFlag_DoNotCache, "indices");
+        ResourceFileDescription otherResources("someOtherTemporaryResources.ramres");
+        otherResources.add(indices);
+
+        GeometryBinding* const geometry = this->m_scene.createGeometryBinding(*effect, "geometry");
+        ASSERT_TRUE(geometry != nullptr);
+        EXPECT_EQ(StatusOK, geometry->setIndices(*indices));
+
+        m_resourceVector.add(m_resources);
+        m_resourceVector.add(otherResources);
+        doWriteReadCycle(m_resourceVector, true, true);
+
+        const GeometryBinding* const geometryLoaded = getObjectForTesting<GeometryBinding>("geometry");
+        ASSERT_TRUE(geometryLoaded != nullptr);
+        const RamsesObject* const indicesLoaded = this->m_clientForLoading.findObjectByName("indices");
+        EXPECT_TRUE(indicesLoaded != nullptr && indicesLoaded->isOfType(ERamsesObjectType_UInt16Array));
+        EXPECT_EQ(this->m_clientForLoading.findObjectByName("effect"), &geometryLoaded->getEffect());
+    }
+
+    TEST_F(ASceneAndAnimationSystemLoadedFromFile, writesSceneFileWithSectionIndexOfConsecutiveSectionsUpToEndOfFile)
+    {
+        EXPECT_EQ(StatusOK, client.saveSceneToFile(m_scene, "someTemporaryFile.ram", {}, false));
+
+        ramses_internal::File file("someTemporaryFile.ram");
+        ramses_internal::BinaryFileInputStream inStream(file);
+        ramses_internal::RamsesVersion::VersionInfo version;
+        ASSERT_TRUE(ramses_internal::RamsesVersion::ReadFromStream(inStream, version));
+        ramses_internal::UInt indexStart = 0u;
+        file.getPos(indexStart);
+
+        ramses_internal::SceneFileSectionIndex index;
+        ASSERT_TRUE(index.readFromStream(inStream));
+
+        ramses_internal::UInt64 expectedOffset = indexStart + ramses_internal::SceneFileSectionIndex::GetSizeInStream();
+        for (auto section : { ramses_internal::ESceneFileSection_Metadata, ramses_internal::ESceneFileSection_LowLevelScene, ramses_internal::ESceneFileSection_HighLevelObjects })
+        {
+            EXPECT_EQ(expectedOffset, index.getSection(section).offset);
+            EXPECT_LT(0u, index.getSection(section).size);
+            expectedOffset += index.getSection(section).size;
+        }
+
+        ramses_internal::UInt fileSize = 0u;
+        file.getSizeInBytes(fileSize);
+        EXPECT_EQ(fileSize, expectedOffset);
+    }
+
+    TEST_F(ASceneAndAnimationSystemLoadedFromFile, canLoadSceneFileWithoutSectionIndex)
+    {
+        m_scene.createNode("a node");
+        {
+            // scene file layout before section index was introduced
+            ramses_internal::File file("someTemporaryFile.ram");
+            ramses_internal::BinaryFileOutputStream outStream(file);
+            ramses_internal::RamsesVersion::WriteToStream(outStream, ::ramses_sdk::RAMSES_SDK_PROJECT_VERSION_STRING, ::ramses_sdk::RAMSES_SDK_GIT_COMMIT_HASH);
+            ramses_internal::ScenePersistation::WriteSceneMetadataToStream(outStream, m_scene.impl.getIScene());
+            ramses_internal::ScenePersistation::WriteSceneToStream(outStream, m_scene.impl.getIScene());
+            SerializationContext serializationContext;
+            EXPECT_EQ(StatusOK, m_scene.impl.serialize(outStream, serializationContext));
+        }
+
+        m_sceneLoaded = m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram", {});
+        ASSERT_TRUE(nullptr != m_sceneLoaded);
+        EXPECT_TRUE(nullptr != m_sceneLoaded->findObjectByName("a node"));
+        EXPECT_EQ(m_scene.impl.getIScene().getSceneSizeInformation(), m_sceneLoaded->impl.getIScene().getSceneSizeInformation());
+    }
+
+    TEST_F(ASceneAndAnimationSystemLoadedFromFile, failsToLoadSceneFileWithSectionsExceedingFile)
+    {
+        EXPECT_EQ(StatusOK, client.saveSceneToFile(m_scene, "someTemporaryFile.ram", {}, false));
+
+        std::vector<ramses_internal::Char> fileContent;
+        {
+            ramses_internal::File file("someTemporaryFile.ram");
+            ramses_internal::UInt fileSize = 0u;
+            file.getSizeInBytes(fileSize);
+            fileContent.resize(fileSize);
+            ramses_internal::UInt numBytesRead = 0u;
+            ASSERT_EQ(ramses_internal::EStatus_RAMSES_OK, file.open(ramses_internal::EFileMode_ReadOnlyBinary));
+            ASSERT_EQ(ramses_internal::EStatus_RAMSES_OK, file.read(fileContent.data(), fileSize, numBytesRead));
+            file.close();
+        }
+        {
+            ramses_internal::File file("someTemporaryFile.ram");
+            ASSERT_EQ(ramses_internal::EStatus_RAMSES_OK, file.open(ramses_internal::EFileMode_WriteNewBinary));
+            file.write(fileContent.data(), fileContent.size() - 1u);
+            file.close();
+        }
+
+        EXPECT_EQ(nullptr, m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram", {}));
+    }
+
+    TEST_F(ASceneAndAnimationSystemLoadedFromFile, failsToLoadSceneFileWithOverlappingSections)
+    {
+        EXPECT_EQ(StatusOK, client.saveSceneToFile(m_scene, "someTemporaryFile.ram", {}, false));
+
+        ramses_internal::UInt indexStart = 0u;
+        ramses_internal::SceneFileSectionIndex index;
+        {
+            ramses_internal::File file("someTemporaryFile.ram");
+            ramses_internal::BinaryFileInputStream inStream(file);
+            ramses_internal::RamsesVersion::VersionInfo version;
+            ASSERT_TRUE(ramses_internal::RamsesVersion::ReadFromStream(inStream, version));
+            file.getPos(indexStart);
+            ASSERT_TRUE(index.readFromStream(inStream));
+        }
+        {
+            // low level scene section claims to start inside metadata, total size still matches file
+            const auto& metadata = index.getSection(ramses_internal::ESceneFileSection_Metadata);
+            const auto& lowLevelScene = index.getSection(ramses_internal::ESceneFileSection_LowLevelScene);
+            index.setSection(ramses_internal::ESceneFileSection_LowLevelScene, lowLevelScene.offset - 1u, lowLevelScene.size + 1u);
+            index.setSection(ramses_internal::ESceneFileSection_Metadata, metadata.offset, metadata.size);
+
+            ramses_internal::File file("someTemporaryFile.ram");
+            ASSERT_EQ(ramses_internal::EStatus_RAMSES_OK, file.open(ramses_internal::EFileMode_WriteExistingBinary));
+            ASSERT_EQ(ramses_internal::EStatus_RAMSES_OK, file.seek(static_cast<ramses_internal::Int>(indexStart), ramses_internal::EFileSeekOrigin_BeginningOfFile));
+            ramses_internal::BinaryOutputStream outStream;
+            index.writeToStream(outStream);
+            ASSERT_EQ(ramses_internal::EStatus_RAMSES_OK, file.write(outStream.getData(), outStream.getSize()));
+            file.close();
+        }
+
+        EXPECT_EQ(nullptr, m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram", {}));
+    }
+
+    TEST_F(ASceneAndAnimationSystemLoadedFromFile, failsToLoadSceneFileWithCorruptedSceneImage)
+    {
+        EXPECT_EQ(StatusOK, client.saveSceneToFile(m_scene, "someTemporaryFile.ram", {}, false));
+
+        ramses_internal::SceneFileSectionIndex index;
+        {
+            ramses_internal::File file("someTemporaryFile.ram");
+            ramses_internal::BinaryFileInputStream inStream(file);
+            ramses_internal::RamsesVersion::VersionInfo version;
+            ASSERT_TRUE(ramses_internal::RamsesVersion::ReadFromStream(inStream, version));
+            ASSERT_TRUE(index.readFromStream(inStream));
+        }
+        {
+            // section layout and scene image header are valid, but last byte of image does not match its hash anymore
+            const auto& lowLevelScene = index.getSection(ramses_internal::ESceneFileSection_LowLevelScene);
+            const ramses_internal::Int lastByteOffset = static_cast<ramses_internal::Int>(lowLevelScene.offset + lowLevelScene.size - 1u);
+
+            ramses_internal::File file("someTemporaryFile.ram");
+            ASSERT_EQ(ramses_internal::EStatus_RAMSES_OK, file.open(ramses_internal::EFileMode_WriteExistingBinary));
+            ASSERT_EQ(ramses_internal::EStatus_RAMSES_OK, file.seek(lastByteOffset, ramses_internal::EFileSeekOrigin_BeginningOfFile));
+            ramses_internal::Char lastByte = 0;
+            ramses_internal::UInt numBytesRead = 0u;
+            ASSERT_EQ(ramses_internal::EStatus_RAMSES_OK, file.read(&lastByte, 1u, numBytesRead));
+            lastByte = static_cast<ramses_internal::Char>(lastByte ^ 0xff);
+            ASSERT_EQ(ramses_internal::EStatus_RAMSES_OK, file.seek(lastByteOffset, ramses_internal::EFileSeekOrigin_BeginningOfFile));
+            ASSERT_EQ(ramses_internal::EStatus_RAMSES_OK, file.write(&lastByte, 1u));
+            file.close();
+        }
+
+        EXPECT_EQ(nullptr, m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram", {}));
+    }
+
     TEST_F(ASceneAndAnimationSystemLoadedFromFile, canReadWriteTransformDataSlot)
     {
         Node* node = this->m_scene.createNode("node");
@@ -41,6 +41,7 @@ namespace ramses
         FontId                  createFreetype2Font(const char* fontPath);
         FontInstanceId          createFreetype2FontInstance(FontId fontId, uint32_t size, bool forceAutohinting);
         FontInstanceId          createFreetype2FontInstanceWithHarfBuzz(FontId fontId, uint32_t size, bool forceAutohinting);
+        FontInstanceId          createFreetype2FontInstanceSDF(FontId fontId, uint32_t size);
 
         bool                    deleteFont(FontId fontId);
         bool                    deleteFontInstance(FontInstanceId fontInstance);
@@ -68,7 +69,14 @@ namespace ramses
         FontInstances m_fontInstances;
         FontInstanceId m_lastFontInstanceId{ 0u };
 
+        // font instances providing the signed distance field glyphs for all SDF font instances of a font
+        std::unordered_map<FontId, FontInstanceId> m_sdfReferenceInstances;
+        // font of every SDF font instance, a font cannot be deleted while SDF font instances of it exist
+        std::unordered_map<FontInstanceId, FontId> m_sdfFontInstances;
+
         static constexpr uint32_t Freetype2FontType = 0x1;
+        static constexpr uint32_t SDFReferenceSize = 32u;
+        static constexpr uint32_t SDFSpread = 4u;
     };
 }
 
@@ -14,6 +14,7 @@
 #include "ramses-text-api/Glyph.h"
 #include "ramses-text/FontData.h"
 #include <unordered_map>
+#include <vector>
 
 namespace ramses
 {
@@ -22,7 +23,9 @@ namespace ramses
     class Freetype2FontInstance : public IFontInstance
     {
     public:
-        Freetype2FontInstance(FontInstanceId id, FT_Library freetypeLib, const FontData& font, uint32_t pixelSize, bool forceAutohinting);
+        // sdfSpread > 0 makes the instance provide signed distance fields instead of coverage bitmaps,
+        // glyphs (metrics and bitmaps) are extended by the spread on each side (see SignedDistanceField)
+        Freetype2FontInstance(FontInstanceId id, FT_Library freetypeLib, const FontData& font, uint32_t pixelSize, bool forceAutohinting, uint32_t sdfSpread = 0u);
         virtual ~Freetype2FontInstance();
 
         virtual bool      supportsCharacter(char32_t character) const override final;
@@ -32,39 +35,38 @@ namespace ramses
 
         virtual void      loadAndAppendGlyphMetrics(std::u32string::const_iterator charsBegin, std::u32string::const_iterator charsEnd, GlyphMetricsVector& positionedGlyphs) override;
         virtual GlyphData loadGlyphBitmapData(GlyphId glyphId, uint32_t& sizeX, uint32_t& sizeY) override final;
+        // glyphs which are not cached yet are rasterized concurrently, every thread uses own FT library and face
+        virtual void      loadGlyphBitmaps(const std::vector<GlyphId>& glyphIds, uint32_t maxThreads, GlyphBitmaps& bitmaps) override final;
 
         GlyphId getGlyphId(char32_t character) const;
 
     protected:
-        struct GlyphBitmapData;
-
         const GlyphMetrics*    getGlyphMetricsData(GlyphId glyphId);
-        const GlyphBitmapData* getGlyphBitmapData(GlyphId glyphId);
+        const GlyphBitmap*     getGlyphBitmapData(GlyphId glyphId);
         bool                   loadGlyph(GlyphId glyphId);
         void                   activateSize() const;
         int32_t                getKerningAdvance(GlyphId glyphIdentifier1, GlyphId glyphIdentifier2) const;
+        void                   rasterizeGlyphs(const std::vector<GlyphId>& glyphIds, size_t first, size_t step, std::vector<GlyphBitmap>& bitmaps, std::vector<uint8_t>& loaded) const;
+
+        static bool            LoadGlyph(FT_Face face, GlyphId glyphId, bool forceAutohinting);
+        static bool            RenderGlyphBitmap(FT_GlyphSlot glyphSlot, uint32_t sdfSpread, GlyphBitmap& bitmap);
 
         FontInstanceId          m_id;
         const FontData&         m_font;
         FT_Face                 m_face = nullptr;
         FT_Size                 m_size = nullptr;
+        uint32_t                m_pixelSize = 0u;
         bool                    m_forceAutohinting = false;
+        uint32_t                m_sdfSpread = 0u;
         int                     m_height = 0;
         int                     m_ascender = 0;
         int                     m_descender = 0;
 
-        struct GlyphBitmapData
-        {
-            GlyphData data;
-            uint32_t  width;
-            uint32_t  height;
-        };
-
         // The reason for separation of the metrics and bitmap data cache
         // is that bitmap loading is relatively heavy and not needed for determining text layout
         // which needs metrics only.
         std::unordered_map<GlyphId, GlyphMetrics> m_glyphMetricsCache;
-        std::unordered_map<GlyphId, GlyphBitmapData> m_glyphBitmapCache;
+        std::unordered_map<GlyphId, GlyphBitmap> m_glyphBitmapCache;
     };
 }
 
@@ -22,6 +22,8 @@ namespace ramses
         // a font is expensive
         uint32_t refCount;
         Quad quad;
+        // order in which glyphs became unused, the glyph used longest ago is evicted first
+        uint64_t lastUse = 0u;
     };
 
     using GlyphMappings = std::unordered_map<size_t, GlyphMapping>;
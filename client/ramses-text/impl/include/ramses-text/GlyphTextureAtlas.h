@@ -17,6 +17,7 @@
 #include <unordered_map>
 #include <set>
 #include <memory>
+#include <limits>
 
 namespace ramses
 {
@@ -32,11 +33,41 @@ namespace ramses
         void registerGlyph(const GlyphKey& key, const QuadSize& size, GlyphData&& data);
         bool isGlyphRegistered(const GlyphKey& key) const;
 
-        GlyphGeometry mapGlyphsAndCreateGeometry(const GlyphMetricsVector& positionedGlyphVector);
+        // preferred page is tried first, e.g. page of the text line being updated, so that its appearance can stay.
+        // If glyphs fit on no page and maximum page count is reached, unused glyphs are evicted, least recently used first.
+        GlyphGeometry mapGlyphsAndCreateGeometry(const GlyphMetricsVector& positionedGlyphVector, size_t preferredAtlasPage = std::numeric_limits<size_t>::max());
+        // glyphs stay mapped when no text line uses them anymore, until they are evicted
         void unmapGlyphsFromPage(const GlyphMetricsVector& positionedGlyphVector, size_t atlasPage);
+        // maps registered glyphs which are not mapped to any page yet, existing pages are filled first, then new pages created
+        // up to maximum page count, every page texture is updated only once. Glyphs are mapped as unused, no glyphs are evicted.
+        void mapGlyphs(const GlyphKeyVector& glyphs);
+        // glyphs must be mapped to the page already
+        GlyphGeometry createGlyphsGeometry(size_t atlasPage, const GlyphMetricsVector& glyphs) const;
 
         const TextureSampler& getTextureSampler(size_t atlasPage) const;
 
+        void setMaximumPageCount(size_t pageCount);
+        size_t getMaximumPageCount() const;
+        size_t getPageCount() const;
+        // number of pages up to and including the last page with a mapped glyph
+        size_t getUsedPageCount() const;
+        // number of glyphs mapped to at least one page
+        size_t getMappedGlyphCount() const;
+
+        // Atlas compaction: all glyphs are unmapped and the space of all pages released, glyphs are mapped
+        // again afterwards and pages not needed anymore are removed from the end.
+        // If compaction cannot be completed, the mapping state taken before is restored: glyphs of restored
+        // mappings are written to the page textures again and pages created since are removed.
+        struct MappingState
+        {
+            std::vector<std::pair<GlyphKey, GlyphMappings>> glyphMappings;
+            std::vector<Quads> freeSpace;
+        };
+        MappingState getMappingState() const;
+        void restoreMappingState(const MappingState& state);
+        void unmapAllGlyphs();
+        void removePagesAtEnd(size_t remainingPageCount);
+
     private:
         GlyphTextureAtlas(const GlyphTextureAtlas&) = delete;
         GlyphTextureAtlas& operator=(const GlyphTextureAtlas&) = delete;
@@ -49,8 +80,10 @@ namespace ramses
         GlyphTexturePage const& getPage(size_t atlasPage) const;
 
         bool findMappingForPage(size_t atlasPage, const GlyphMetricsVector& glyphs);
-        GlyphGeometry createGlyphsGeometry(size_t atlasPage, const GlyphMetricsVector& glyphs);
         void categorizeGlyphs(size_t atlasPage, const GlyphMetricsVector& glyphs, std::vector<GlyphKey>& tomap, std::vector<GlyphKey>& mapped);
+        bool evictUnusedGlyphsUntilMapped(const GlyphMetricsVector& glyphs, size_t& atlasPage);
+        // page is not changed, checks if glyphs would fit on it if given quads were released before
+        bool canMapAfterReleasing(size_t atlasPage, const GlyphMetricsVector& glyphs, const Quads& quadsToRelease);
 
         Scene& m_scene;
 
@@ -60,6 +93,8 @@ namespace ramses
 
         using GlyphTexturePageVector = std::vector<std::unique_ptr<GlyphTexturePage>>;
         GlyphTexturePageVector m_glyphAtlasPages;
+        size_t m_maximumPageCount = std::numeric_limits<size_t>::max();
+        uint64_t m_lastUseCounter = 0u;
 
         struct GlyphInfo
         {
@@ -10,6 +10,8 @@
 #define RAMSES_GLYPHTEXTUREPAGE_H
 
 #include "ramses-text/Quad.h"
+#include <vector>
+#include <utility>
 
 namespace ramses
 {
@@ -30,22 +32,30 @@ namespace ramses
 
         using QuadIndex = size_t;
         using GlyphPageData = std::vector<uint8_t>;
+        // target quad (including padding) with glyph pixel data (without padding)
+        using QuadData = std::pair<Quad, const uint8_t*>;
 
         // Free space management
         const Quads& getFreeSpace() const;
         QuadOffset claimSpace(QuadIndex freeQuadIndex, const QuadSize& subportionSize);
         void releaseSpace(Quad quad);
+        // whole page becomes one free quad, data of previously claimed space is kept until overwritten
+        void releaseAllSpace();
+        // free space saved before by getFreeSpace, used to try out claiming space without changing the page
+        void restoreFreeSpace(const Quads& freeSpace);
         QuadIndex findFreeSpace(QuadSize const& size) const;
 
         // Texture data management
         void updateDataWithPadding(const Quad& targetQuad, const uint8_t* sourceData, GlyphPageData& cacheForDataUpdate);
+        // updates the texture only once for all given glyphs
+        void updateDataWithPadding(const std::vector<QuadData>& targetQuadsWithData, GlyphPageData& cacheForDataUpdate);
         const Texture2DBuffer& getTextureBuffer() const;
         const TextureSampler& getSampler() const;
 
     private:
         bool mergeFreeQuad(Quad& freeQuadInAndOut);
-        void copyPaddingToCache(const Quad& updateQuad, GlyphPageData& cacheForDataUpdate);
-        void copyUpdateDataWithoutPaddingToCache(const Quad& updateQuad, const uint8_t* data, GlyphPageData& cacheForDataUpdate);
+        void copyPaddingToCache(const QuadSize& updateSize, uint8_t* target, uint32_t targetStride);
+        void copyUpdateDataWithoutPaddingToCache(const QuadSize& updateSize, const uint8_t* data, uint8_t* target, uint32_t targetStride);
         void updateTextureResource(const Quad& updateQuade, const GlyphPageData& pageData);
 
         const QuadSize m_size;
@@ -0,0 +1,43 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TEXT_RANGEALLOCATOR_H
+#define RAMSES_TEXT_RANGEALLOCATOR_H
+
+#include <stdint.h>
+#include <map>
+#include <limits>
+
+namespace ramses
+{
+    // Manages free space of a linear buffer (e.g. quads in a text batch data buffer).
+    // Allocates first free range that fits and merges adjacent ranges on release.
+    class RangeAllocator
+    {
+    public:
+        static const uint32_t InvalidOffset = std::numeric_limits<uint32_t>::max();
+
+        explicit RangeAllocator(uint32_t capacity = 0u);
+
+        // returns InvalidOffset if there is no free range of given size, grow capacity in that case
+        uint32_t allocate(uint32_t size);
+        void release(uint32_t offset, uint32_t size);
+        void grow(uint32_t newCapacity);
+
+        uint32_t getCapacity() const;
+        // end of last allocated range, all space behind it is free
+        uint32_t getUsedEnd() const;
+
+    private:
+        uint32_t m_capacity;
+        // offset -> size
+        std::map<uint32_t, uint32_t> m_freeRanges;
+    };
+}
+
+#endif
@@ -0,0 +1,43 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SDFFONTINSTANCE_H
+#define RAMSES_SDFFONTINSTANCE_H
+
+#include "ramses-text-api/IFontInstance.h"
+
+namespace ramses
+{
+    class Freetype2FontInstance;
+
+    // Font instance of any size backed by a reference instance providing signed distance field glyphs.
+    // Metrics are those of the reference instance scaled to the pixel size, glyph keys stay the ones
+    // of the reference instance, so SDF instances of all sizes share the same glyphs in a texture atlas.
+    class SDFFontInstance : public IFontInstance
+    {
+    public:
+        SDFFontInstance(Freetype2FontInstance& referenceInstance, uint32_t referenceSize, uint32_t pixelSize);
+
+        virtual bool      supportsCharacter(char32_t character) const override;
+        virtual int       getHeight() const override;
+        virtual int       getAscender() const override;
+        virtual int       getDescender() const override;
+
+        virtual void      loadAndAppendGlyphMetrics(std::u32string::const_iterator charsBegin, std::u32string::const_iterator charsEnd, GlyphMetricsVector& positionedGlyphs) override;
+        virtual GlyphData loadGlyphBitmapData(GlyphId glyphId, uint32_t& sizeX, uint32_t& sizeY) override;
+        virtual void      loadGlyphBitmaps(const std::vector<GlyphId>& glyphIds, uint32_t maxThreads, GlyphBitmaps& bitmaps) override;
+
+    private:
+        int32_t scale(int32_t value) const;
+
+        Freetype2FontInstance& m_referenceInstance;
+        const float            m_scale;
+    };
+}
+
+#endif
@@ -0,0 +1,76 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TEXT_SHAPINGCACHE_H
+#define RAMSES_TEXT_SHAPINGCACHE_H
+
+#include "ramses-text-api/GlyphMetrics.h"
+#include "ramses-text-api/FontInstanceOffsets.h"
+#include "ramses-text-api/ShapingCacheStatistics.h"
+#include <unordered_map>
+#include <string>
+#include <list>
+
+namespace ramses
+{
+    // Least recently used cache of glyph metrics of strings laid out with given font instances.
+    // Capacity 0 disables the cache.
+    class ShapingCache
+    {
+    public:
+        explicit ShapingCache(uint32_t capacity = 0u);
+
+        // returns nullptr and counts a miss if there is no entry, the entry becomes most recently used otherwise
+        const GlyphMetricsVector* find(const std::u32string& str, const FontInstanceOffsets& fontOffsets);
+        // evicts least recently used entry if cache is full
+        void add(const std::u32string& str, const FontInstanceOffsets& fontOffsets, const GlyphMetricsVector& glyphs);
+
+        // removes all entries of strings laid out with the font instance, e.g. because it was deleted
+        void removeEntriesOfFontInstance(FontInstanceId fontInstance);
+
+        void setCapacity(uint32_t capacity);
+        void clear();
+        ShapingCacheStatistics getStatistics() const;
+
+    private:
+        struct Key
+        {
+            std::u32string str;
+            FontInstanceOffsets fontOffsets;
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key& key) const;
+        };
+
+        struct KeyEqual
+        {
+            bool operator()(const Key& a, const Key& b) const;
+        };
+
+        using UsageOrder = std::list<const Key*>;
+
+        struct Entry
+        {
+            GlyphMetricsVector glyphs;
+            UsageOrder::iterator usage;
+        };
+
+        void evictLeastRecentlyUsed();
+
+        uint32_t m_capacity;
+        std::unordered_map<Key, Entry, KeyHash, KeyEqual> m_entries;
+        // keys of entries, most recently used first
+        UsageOrder m_usageOrder;
+        uint64_t m_hits = 0u;
+        uint64_t m_misses = 0u;
+    };
+}
+
+#endif
@@ -0,0 +1,31 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TEXT_SIGNEDDISTANCEFIELD_H
+#define RAMSES_TEXT_SIGNEDDISTANCEFIELD_H
+
+#include "ramses-text-api/Glyph.h"
+#include <vector>
+
+namespace ramses
+{
+    class SignedDistanceField
+    {
+    public:
+        // Converts anti-aliased glyph coverage (one byte per pixel, rows without padding) to a signed distance field.
+        // The field is extended by 'spread' pixels on each side, its size is (width + 2*spread) x (height + 2*spread).
+        // Value 128 lies on the glyph outline, values grow inside of the glyph and reach 0 or 255 at distance 'spread' from it.
+        static GlyphData CreateFromCoverage(const uint8_t* coverage, uint32_t width, uint32_t height, uint32_t spread);
+
+    private:
+        static void TransformRowOrColumn(std::vector<float>& grid, size_t offset, size_t stride, size_t length);
+        static void TransformGrid(std::vector<float>& grid, uint32_t width, uint32_t height);
+    };
+}
+
+#endif
@@ -10,7 +10,10 @@
 #define RAMSES_TEXTCACHEIMPL_H
 
 #include "ramses-text/GlyphTextureAtlas.h"
+#include "ramses-text/RangeAllocator.h"
+#include "ramses-text/ShapingCache.h"
 #include "ramses-text-api/TextLine.h"
+#include "ramses-text-api/TextBatch.h"
 #include "ramses-text-api/FontInstanceOffsets.h"
 #include <unordered_map>
 #include <string>
@@ -20,6 +23,8 @@ namespace ramses
 {
     class Scene;
     class MeshNode;
+    class GeometryBinding;
+    class Appearance;
     class Effect;
     class IFontAccessor;
 
@@ -31,11 +36,27 @@ namespace ramses
 
         GlyphMetricsVector      getPositionedGlyphs(const std::u32string& str, FontInstanceId font);
         GlyphMetricsVector      getPositionedGlyphs(const std::u32string& str, const FontInstanceOffsets& fontOffsets);
+        void                    setShapingCacheCapacity(uint32_t capacity);
+        void                    clearShapingCache();
+        ShapingCacheStatistics  getShapingCacheStatistics() const;
 
+        bool                    preloadGlyphs(const GlyphMetricsVector& glyphs, uint32_t maxThreads);
         TextLineId              createTextLine(const GlyphMetricsVector& glyphs, const Effect& effect);
         TextLine const*         getTextLine(TextLineId textId) const;
         TextLine*               getTextLine(TextLineId textId);
         bool                    deleteTextLine(TextLineId textId);
+        bool                    updateTextLine(TextLineId textId, const GlyphMetricsVector& glyphs);
+
+        TextBatchId             createTextBatch(const Effect& effect);
+        TextBatch const*        getTextBatch(TextBatchId batchId) const;
+        bool                    deleteTextBatch(TextBatchId batchId);
+        TextLineId              createTextLine(const GlyphMetricsVector& glyphs, TextBatchId batchId, float offsetX, float offsetY);
+        bool                    setTextLineOffset(TextLineId textId, float offsetX, float offsetY);
+
+        void                    setMaximumAtlasPageCount(uint32_t maximumPageCount);
+        uint32_t                getAtlasPageCount() const;
+        uint32_t                getAtlasGlyphCount() const;
+        bool                    compactAtlas();
 
     private:
         TextCacheImpl(const TextCacheImpl&) = delete;
@@ -43,14 +64,73 @@ namespace ramses
         TextCacheImpl(TextCacheImpl&&) = delete;
         TextCacheImpl& operator=(TextCacheImpl&&) = delete;
 
+        // Mesh and shared data buffers of all text lines of a batch on one atlas page.
+        // Buffer contents are kept also here, so that they can be copied to larger buffers when the page grows.
+        struct TextBatchPage
+        {
+            MeshNode* meshNode = nullptr;
+            GeometryBinding* geometryBinding = nullptr;
+            Appearance* appearance = nullptr;
+            VertexDataBuffer* positions = nullptr;
+            VertexDataBuffer* textureCoordinates = nullptr;
+            IndexDataBuffer* indices = nullptr;
+            RangeAllocator quads;
+            std::vector<float> positionsData;
+            std::vector<float> textureCoordinatesData;
+            std::vector<uint32_t> indicesData;
+        };
+
+        struct TextBatchData
+        {
+            const Effect* effect = nullptr;
+            TextBatch batch;
+            std::unordered_map<size_t, TextBatchPage> pages;
+        };
+
+        struct BatchedTextLine
+        {
+            TextBatchId batch = InvalidTextBatchId;
+            uint32_t quadOffset = 0u;
+            uint32_t quadCount = 0u;
+            float offsetX = 0.f;
+            float offsetY = 0.f;
+        };
+
+        bool                    registerGlyphs(const GlyphMetricsVector& glyphs);
+        bool                    updateTextLineMesh(TextLine& textLine, const GlyphGeometry& geometry);
+        bool                    updateBatchedTextLine(TextLineId textId, TextLine& textLine, const GlyphGeometry& geometry);
+        // reserving quads for new geometry can fail, writing it to reserved quads cannot
+        bool                    reserveBatchedTextLineQuads(TextLineId textId, const TextLine& textLine, const GlyphGeometry& geometry, uint32_t& quadOffset);
+        void                    releaseReservedBatchedTextLineQuads(TextLineId textId, const TextLine& textLine, const GlyphGeometry& geometry, uint32_t quadOffset);
+        void                    writeBatchedTextLineQuads(TextLineId textId, TextLine& textLine, const GlyphGeometry& geometry, uint32_t quadOffset);
+        bool                    isBatchedTextLineUpdatedInPlace(TextLineId textId, const TextLine& textLine, const GlyphGeometry& geometry, uint32_t quadOffset) const;
+        void                    updateTextLineTextureCoordinates(TextLine& textLine, const GlyphGeometry& geometry);
+        void                    destroyBatchPagesFrom(size_t atlasPage);
+        TextBatchPage*          getOrCreateBatchPage(TextBatchId batchId, size_t atlasPage);
+        bool                    growBatchPage(TextBatchId batchId, TextBatchPage& page, uint32_t minimumCapacity);
+        uint32_t                allocateBatchPageQuads(TextBatchId batchId, TextBatchPage& page, uint32_t quadCount);
+        void                    writeBatchPageQuads(TextBatchPage& page, uint32_t quadOffset, const GlyphGeometry& geometry, float offsetX, float offsetY);
+        void                    releaseBatchPageQuads(TextBatchPage& page, uint32_t quadOffset, uint32_t quadCount);
+        void                    uploadBatchPageQuads(TextBatchPage& page, uint32_t quadOffset, uint32_t quadCount);
+        void                    releaseBatchedTextLine(TextLineId textId);
+        void                    destroyBatchPage(TextBatchPage& page);
+        void                    destroyBatchPageBuffers(TextBatchPage& page);
+
         Scene& m_scene;
         IFontAccessor& m_fontAccessor;
         GlyphTextureAtlas m_textureAtlas;
+        ShapingCache m_shapingCache;
 
         using Texts = std::unordered_map<TextLineId, TextLine>;
         Texts m_textLines;
 
         TextLineId m_textIdCounter{ 0u };
+
+        using Batches = std::unordered_map<TextBatchId, TextBatchData>;
+        Batches m_textBatches;
+        std::unordered_map<TextLineId, BatchedTextLine> m_batchedTextLines;
+
+        TextBatchId m_batchIdCounter{ 0u };
     };
 }
 
@@ -9,6 +9,7 @@
 #include "ramses-text/FontRegistryImpl.h"
 #include "ramses-text/Freetype2FontInstance.h"
 #include "ramses-text/HarfbuzzFontInstance.h"
+#include "ramses-text/SDFFontInstance.h"
 #include <fstream>
 #include <assert.h>
 
@@ -60,11 +61,31 @@ namespace ramses
 
     bool FontRegistryImpl::deleteFont(FontId fontId)
     {
-        if (m_fonts.erase(fontId) == 0u)
+        if (m_fonts.count(fontId) == 0u)
         {
             LOG_TEXT_ERROR("FontRegistryImpl::deleteFont: Cannot delete font " << fontId.getValue() << ", no such entry");
             return false;
         }
+
+        // SDF font instances refer to the font instance providing their glyphs, which is deleted with the font
+        for (const auto& sdfInstance : m_sdfFontInstances)
+        {
+            if (sdfInstance.second == fontId)
+            {
+                LOG_TEXT_ERROR("FontRegistryImpl::deleteFont: Cannot delete font " << fontId.getValue() << ", SDF font instance " << sdfInstance.first.getValue() << " of it still exists");
+                return false;
+            }
+        }
+
+        m_fonts.erase(fontId);
+
+        const auto sdfReferenceIt = m_sdfReferenceInstances.find(fontId);
+        if (sdfReferenceIt != m_sdfReferenceInstances.end())
+        {
+            m_fontInstances.erase(sdfReferenceIt->second);
+            m_sdfReferenceInstances.erase(sdfReferenceIt);
+        }
+
         return true;
     }
 
@@ -98,13 +119,53 @@ namespace ramses
         return fontInstanceId;
     }
 
+    FontInstanceId FontRegistryImpl::createFreetype2FontInstanceSDF(FontId fontId, uint32_t size)
+    {
+        const FontData* fontData = getFontData(fontId);
+        if (fontData == nullptr || fontData->type != Freetype2FontType)
+        {
+            LOG_TEXT_ERROR("FontRegistry: Failed to create font instance, fontId " << fontId.getValue() << " does not exist or is of invalid type");
+            return InvalidFontInstanceId;
+        }
+        if (size == 0u)
+        {
+            LOG_TEXT_ERROR("FontRegistry: Failed to create SDF font instance, size must be greater than zero");
+            return InvalidFontInstanceId;
+        }
+
+        auto sdfReferenceIt = m_sdfReferenceInstances.find(fontId);
+        if (sdfReferenceIt == m_sdfReferenceInstances.end())
+        {
+            const FontInstanceId referenceInstanceId = reserveFontInstanceId();
+            registerFontInstance(referenceInstanceId, std::unique_ptr<IFontInstance>{ new Freetype2FontInstance(referenceInstanceId, m_ft2Library.get(), *fontData, SDFReferenceSize, false, SDFSpread) });
+            sdfReferenceIt = m_sdfReferenceInstances.insert(std::make_pair(fontId, referenceInstanceId)).first;
+        }
+
+        auto& referenceInstance = static_cast<Freetype2FontInstance&>(*getFontInstance(sdfReferenceIt->second));
+        const FontInstanceId fontInstanceId = reserveFontInstanceId();
+        registerFontInstance(fontInstanceId, std::unique_ptr<IFontInstance>{ new SDFFontInstance(referenceInstance, SDFReferenceSize, size) });
+        m_sdfFontInstances.insert(std::make_pair(fontInstanceId, fontId));
+
+        return fontInstanceId;
+    }
+
     bool FontRegistryImpl::deleteFontInstance(FontInstanceId fontInstance)
     {
+        for (const auto& sdfReference : m_sdfReferenceInstances)
+        {
+            if (sdfReference.second == fontInstance)
+            {
+                LOG_TEXT_ERROR("FontRegistryImpl::deleteFontInstance: Cannot delete font instance " << fontInstance.getValue() << ", it provides glyphs of SDF font instances and is deleted with its font");
+                return false;
+            }
+        }
+
         if (m_fontInstances.erase(fontInstance) == 0u)
         {
             LOG_TEXT_ERROR("FontRegistryImpl::deleteFontInstance: Cannot delete font instance " << fontInstance.getValue() << ", no such entry");
             return false;
         }
+        m_sdfFontInstances.erase(fontInstance);
         return true;
     }
 
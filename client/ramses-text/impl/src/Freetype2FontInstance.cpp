@@ -9,16 +9,22 @@
 #include "ramses-text/Freetype2FontInstance.h"
 #include "ramses-text/Logger.h"
 #include "ramses-text/Quad.h"
+#include "ramses-text/SignedDistanceField.h"
 #include <assert.h>
 #include <iostream>
 #include <cstring>
+#include <thread>
+#include <algorithm>
+#include <unordered_set>
 
 namespace ramses
 {
-    Freetype2FontInstance::Freetype2FontInstance(FontInstanceId id, FT_Library freetypeLib, const FontData& font, uint32_t pixelSize, bool forceAutohinting)
+    Freetype2FontInstance::Freetype2FontInstance(FontInstanceId id, FT_Library freetypeLib, const FontData& font, uint32_t pixelSize, bool forceAutohinting, uint32_t sdfSpread)
         : m_id(id)
         , m_font(font)
+        , m_pixelSize(pixelSize)
         , m_forceAutohinting(forceAutohinting)
+        , m_sdfSpread(sdfSpread)
     {
         // TODO Violin check if face has to be created per instance, or is enough to have it per font
 
@@ -110,7 +116,7 @@ namespace ramses
     {
         activateSize();
 
-        const GlyphBitmapData* data = getGlyphBitmapData(glyphId);
+        const GlyphBitmap* data = getGlyphBitmapData(glyphId);
         if (data == nullptr)
         {
             sizeX = 0u;
@@ -149,10 +155,19 @@ namespace ramses
         metrics.posY = (glyphMetrics.horiBearingY - glyphMetrics.height) / 64;
         metrics.advance = glyphMetrics.horiAdvance / 64;
 
+        if (m_sdfSpread > 0u && metrics.width > 0u && metrics.height > 0u)
+        {
+            const int32_t spread = static_cast<int32_t>(m_sdfSpread);
+            metrics.width += 2u * m_sdfSpread;
+            metrics.height += 2u * m_sdfSpread;
+            metrics.posX -= spread;
+            metrics.posY -= spread;
+        }
+
         return &m_glyphMetricsCache.insert({ glyphId, std::move(metrics) }).first->second;
     }
 
-    const Freetype2FontInstance::GlyphBitmapData* Freetype2FontInstance::getGlyphBitmapData(GlyphId glyphId)
+    const GlyphBitmap* Freetype2FontInstance::getGlyphBitmapData(GlyphId glyphId)
     {
         const auto it = m_glyphBitmapCache.find(glyphId);
         if (it != m_glyphBitmapCache.cend())
@@ -161,15 +176,94 @@ namespace ramses
         if (!loadGlyph(glyphId))
             return nullptr;
 
-        GlyphBitmapData data;
+        GlyphBitmap data;
+        if (!RenderGlyphBitmap(m_face->glyph, m_sdfSpread, data))
+            return nullptr;
+
+        return &m_glyphBitmapCache.insert({ glyphId, std::move(data) }).first->second;
+    }
+
+    void Freetype2FontInstance::loadGlyphBitmaps(const std::vector<GlyphId>& glyphIds, uint32_t maxThreads, GlyphBitmaps& bitmaps)
+    {
+        std::vector<GlyphId> glyphsToRasterize;
+        glyphsToRasterize.reserve(glyphIds.size());
+        std::unordered_set<GlyphId> uniqueGlyphs;
+        for (const auto& glyphId : glyphIds)
+        {
+            if (glyphId.getValue() != 0 && m_glyphBitmapCache.count(glyphId) == 0u && uniqueGlyphs.insert(glyphId).second)
+                glyphsToRasterize.push_back(glyphId);
+        }
+
+        const size_t threadCount = std::min<size_t>(maxThreads, glyphsToRasterize.size());
+        if (threadCount > 1u)
+        {
+            std::vector<GlyphBitmap> rasterizedBitmaps(glyphsToRasterize.size());
+            std::vector<uint8_t> rasterized(glyphsToRasterize.size(), 0u);
+
+            std::vector<std::thread> threads;
+            threads.reserve(threadCount);
+            for (size_t t = 0u; t < threadCount; ++t)
+                threads.emplace_back([&, t]() { rasterizeGlyphs(glyphsToRasterize, t, threadCount, rasterizedBitmaps, rasterized); });
+            for (auto& thread : threads)
+                thread.join();
+
+            for (size_t i = 0u; i < glyphsToRasterize.size(); ++i)
+            {
+                if (rasterized[i] != 0u)
+                    m_glyphBitmapCache.insert({ glyphsToRasterize[i], std::move(rasterizedBitmaps[i]) });
+            }
+        }
+
+        activateSize();
+        bitmaps.resize(glyphIds.size());
+        for (size_t i = 0u; i < glyphIds.size(); ++i)
+        {
+            // glyphs which failed to rasterize concurrently are tried once more here, errors are logged
+            const GlyphBitmap* data = (glyphIds[i].getValue() != 0 ? getGlyphBitmapData(glyphIds[i]) : nullptr);
+            bitmaps[i] = (data != nullptr ? *data : GlyphBitmap{});
+        }
+    }
+
+    void Freetype2FontInstance::rasterizeGlyphs(const std::vector<GlyphId>& glyphIds, size_t first, size_t step, std::vector<GlyphBitmap>& bitmaps, std::vector<uint8_t>& loaded) const
+    {
+        // FT library and face must not be used by multiple threads at the same time, font data is only read
+        FT_Library freetypeLib = nullptr;
+        if (FT_Init_FreeType(&freetypeLib) != 0)
+            return;
+
+        FT_Face face = nullptr;
+        FT_Open_Args fontDataArgs;
+        fontDataArgs.flags = FT_OPEN_MEMORY;
+        fontDataArgs.memory_base = m_font.data.data();
+        fontDataArgs.memory_size = static_cast<FT_Long>(m_font.data.size());
+        fontDataArgs.num_params = 0;
+
+        if (FT_Open_Face(freetypeLib, &fontDataArgs, 0, &face) == 0)
+        {
+            if (FT_Set_Pixel_Sizes(face, 0, m_pixelSize) == 0)
+            {
+                for (size_t i = first; i < glyphIds.size(); i += step)
+                {
+                    if (LoadGlyph(face, glyphIds[i], m_forceAutohinting) && RenderGlyphBitmap(face->glyph, m_sdfSpread, bitmaps[i]))
+                        loaded[i] = 1u;
+                }
+            }
+            FT_Done_Face(face);
+        }
+
+        FT_Done_FreeType(freetypeLib);
+    }
+
+    bool Freetype2FontInstance::RenderGlyphBitmap(FT_GlyphSlot glyphSlot, uint32_t sdfSpread, GlyphBitmap& bitmap)
+    {
         FT_Glyph ftGlyph = nullptr;
-        auto error = FT_Get_Glyph(m_face->glyph, &ftGlyph);
+        auto error = FT_Get_Glyph(glyphSlot, &ftGlyph);
         {
             if (error)
             {
                 LOG_TEXT_ERROR("Freetype2FontInstance::extractGlyphBitmapData:  FT_Get_Glyph failed - error: " << error);
                 assert(ftGlyph == nullptr);
-                return nullptr;
+                return false;
             }
             assert(ftGlyph != nullptr);
 
@@ -180,24 +274,37 @@ namespace ramses
                 {
                     LOG_TEXT_ERROR("Freetype2FontInstance::extractGlyphBitmapData:  FT_Glyph_To_Bitmap failed - error: " << error);
                     FT_Done_Glyph(ftGlyph);
-                    return nullptr;
+                    return false;
                 }
             }
 
             const FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(ftGlyph);
             const QuadSize glyphBitmapSize(bitmapGlyph->bitmap.width, bitmapGlyph->bitmap.rows);
-            data.width = glyphBitmapSize.x;
-            data.height = glyphBitmapSize.y;
+            bitmap.width = glyphBitmapSize.x;
+            bitmap.height = glyphBitmapSize.y;
             const uint32_t numberPixels = glyphBitmapSize.getArea();
             const uint8_t* bitmapBuffer = reinterpret_cast<uint8_t*>(bitmapGlyph->bitmap.buffer);
-            data.data = GlyphData(bitmapBuffer, bitmapBuffer + numberPixels);
+            if (sdfSpread > 0u && numberPixels > 0u)
+            {
+                bitmap.data = SignedDistanceField::CreateFromCoverage(bitmapBuffer, bitmap.width, bitmap.height, sdfSpread);
+                bitmap.width += 2u * sdfSpread;
+                bitmap.height += 2u * sdfSpread;
+            }
+            else
+                bitmap.data = GlyphData(bitmapBuffer, bitmapBuffer + numberPixels);
         }
         FT_Done_Glyph(ftGlyph);
 
-        return &m_glyphBitmapCache.insert({ glyphId, std::move(data) }).first->second;
+        return true;
     }
 
     bool Freetype2FontInstance::loadGlyph(GlyphId glyphId)
+    {
+        // must call activateSize() before loading
+        return LoadGlyph(m_face, glyphId, m_forceAutohinting);
+    }
+
+    bool Freetype2FontInstance::LoadGlyph(FT_Face face, GlyphId glyphId, bool forceAutohinting)
     {
         if (glyphId.getValue() == 0)
         {
@@ -205,12 +312,11 @@ namespace ramses
             return false;
         }
 
-        // must call activateSize() before loading
         int32_t flags = FT_LOAD_DEFAULT;
-        if (m_forceAutohinting)
+        if (forceAutohinting)
             flags = FT_LOAD_FORCE_AUTOHINT;
 
-        const uint32_t error = FT_Load_Glyph(m_face, glyphId.getValue(), flags);
+        const uint32_t error = FT_Load_Glyph(face, glyphId.getValue(), flags);
         if (error != 0)
         {
             LOG_TEXT_ERROR("Freetype2FontInstance: Failed to load glyph " << glyphId.getValue() << ", FT error " << error);
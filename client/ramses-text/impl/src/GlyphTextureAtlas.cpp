@@ -10,6 +10,7 @@
 
 #include <assert.h>
 #include <algorithm>
+#include <unordered_set>
 #include "ramses-text/Logger.h"
 
 namespace ramses
@@ -131,23 +132,37 @@ namespace ramses
         }
     }
 
-    GlyphGeometry GlyphTextureAtlas::mapGlyphsAndCreateGeometry(const GlyphMetricsVector& glyphs)
+    GlyphGeometry GlyphTextureAtlas::mapGlyphsAndCreateGeometry(const GlyphMetricsVector& glyphs, size_t preferredAtlasPage)
     {
         assert(glyphs.end() == std::find_if(glyphs.begin(), glyphs.end(), [this](GlyphMetrics const& glyph)
         {
             return !isGlyphRegistered(glyph.key);
         }));
 
+        if (preferredAtlasPage < m_glyphAtlasPages.size() && findMappingForPage(preferredAtlasPage, glyphs))
+            return createGlyphsGeometry(preferredAtlasPage, glyphs);
+
         size_t atlasPage = 0;
         bool success = false;
         for (; atlasPage < m_glyphAtlasPages.size(); ++atlasPage)
         {
+            if (atlasPage == preferredAtlasPage)
+                continue;
             success = findMappingForPage(atlasPage, glyphs);
             if (success)
                 break;
         }
 
-        if (!success)
+        if (!success && m_glyphAtlasPages.size() >= m_maximumPageCount)
+        {
+            // no results and no more pages allowed, so make space on existing pages
+            if (!evictUnusedGlyphsUntilMapped(glyphs, atlasPage))
+            {
+                LOG_TEXT_ERROR("GlyphTextureAtlas::mapGlyphsAndCreateGeometry failed - glyphs do not fit on any page and maximum page count " << m_maximumPageCount << " is reached, delete text lines or compact atlas");
+                return {};
+            }
+        }
+        else if (!success)
         {
             // no results, so try new, empty page
             atlasPage = createNewPage();
@@ -162,7 +177,7 @@ namespace ramses
         return createGlyphsGeometry(atlasPage, glyphs);
     }
 
-    GlyphGeometry GlyphTextureAtlas::createGlyphsGeometry(size_t atlasPage, const GlyphMetricsVector& glyphs)
+    GlyphGeometry GlyphTextureAtlas::createGlyphsGeometry(size_t atlasPage, const GlyphMetricsVector& glyphs) const
     {
         GlyphGeometry geometry;
         geometry.positions.reserve(glyphs.size() * 8);
@@ -250,8 +265,165 @@ namespace ramses
             auto& glyphToPageMapping = m_glyphInfoMap.at(glyphkey).glyphMapping.at(atlasPage);
             assert(glyphToPageMapping.refCount != 0);
             --glyphToPageMapping.refCount;
-            // TODO(Violin) implement explicit control of glyph memory
-            // Idea: remove refcount altogether, cache glyph memory in IFontAccessor
+            if (glyphToPageMapping.refCount == 0u)
+                glyphToPageMapping.lastUse = ++m_lastUseCounter;
+        }
+    }
+
+    bool GlyphTextureAtlas::evictUnusedGlyphsUntilMapped(const GlyphMetricsVector& glyphs, size_t& atlasPage)
+    {
+        struct UnusedGlyph
+        {
+            uint64_t lastUse;
+            GlyphKey key;
+            size_t atlasPage;
+        };
+
+        // unused glyphs which are requested again are kept, they are used again once mapped
+        std::unordered_set<GlyphKey> requestedGlyphs;
+        for (const auto& glyph : glyphs)
+            requestedGlyphs.insert(glyph.key);
+
+        std::vector<UnusedGlyph> unusedGlyphs;
+        for (const auto& glyphInfo : m_glyphInfoMap)
+        {
+            if (requestedGlyphs.count(glyphInfo.first) != 0u)
+                continue;
+            for (const auto& glyphMapping : glyphInfo.second.glyphMapping)
+            {
+                if (glyphMapping.second.refCount == 0u)
+                    unusedGlyphs.push_back({ glyphMapping.second.lastUse, glyphInfo.first, glyphMapping.first });
+            }
+        }
+        std::sort(unusedGlyphs.begin(), unusedGlyphs.end(), [](const UnusedGlyph& a, const UnusedGlyph& b) { return a.lastUse < b.lastUse; });
+
+        // pages are tried in order of their least recently used glyph, glyphs are evicted only from
+        // the page where the requested glyphs fit once enough of its unused glyphs are evicted
+        std::vector<bool> triedPages(m_glyphAtlasPages.size(), false);
+        for (const auto& candidate : unusedGlyphs)
+        {
+            if (triedPages[candidate.atlasPage])
+                continue;
+            triedPages[candidate.atlasPage] = true;
+
+            std::vector<const UnusedGlyph*> unusedGlyphsOnPage;
+            Quads unusedQuadsOnPage;
+            for (const auto& unusedGlyph : unusedGlyphs)
+            {
+                if (unusedGlyph.atlasPage != candidate.atlasPage)
+                    continue;
+                unusedGlyphsOnPage.push_back(&unusedGlyph);
+                unusedQuadsOnPage.push_back(m_glyphInfoMap.at(unusedGlyph.key).glyphMapping.at(candidate.atlasPage).quad);
+            }
+            if (!canMapAfterReleasing(candidate.atlasPage, glyphs, unusedQuadsOnPage))
+                continue;
+
+            // evict one glyph after the other, so that no more glyphs than needed are lost. Mapping is only done
+            // once it succeeds, a failed attempt could leave the free space split differently than checked above.
+            for (const auto unusedGlyph : unusedGlyphsOnPage)
+            {
+                GlyphMappings& glyphMappings = m_glyphInfoMap.at(unusedGlyph->key).glyphMapping;
+                const auto mappingIt = glyphMappings.find(candidate.atlasPage);
+                getPage(candidate.atlasPage).releaseSpace(mappingIt->second.quad);
+                glyphMappings.erase(mappingIt);
+
+                if (canMapAfterReleasing(candidate.atlasPage, glyphs, {}))
+                {
+                    const bool mapped = findMappingForPage(candidate.atlasPage, glyphs);
+                    assert(mapped);
+                    static_cast<void>(mapped);
+                    atlasPage = candidate.atlasPage;
+                    return true;
+                }
+            }
+            assert(false && "glyphs must fit after evicting all unused glyphs of page");
+        }
+
+        return false;
+    }
+
+    bool GlyphTextureAtlas::canMapAfterReleasing(size_t atlasPage, const GlyphMetricsVector& glyphs, const Quads& quadsToRelease)
+    {
+        // quads are released and claimed in same order as when glyphs are actually evicted and mapped
+        GlyphTexturePage& page = getPage(atlasPage);
+        const Quads freeSpace = page.getFreeSpace();
+        for (const auto& quad : quadsToRelease)
+            page.releaseSpace(quad);
+
+        std::vector<GlyphKey> tomap;
+        std::vector<GlyphKey> mapped;
+        categorizeGlyphs(atlasPage, glyphs, tomap, mapped);
+        bool fits = true;
+        for (const auto& glyphkey : tomap)
+        {
+            const GlyphInfo& glyphInfo = m_glyphInfoMap.at(glyphkey);
+            const QuadSize sizeInAtlas(glyphInfo.size.x + 2, glyphInfo.size.y + 2);
+            const GlyphTexturePage::QuadIndex freeQuadOnPage = page.findFreeSpace(sizeInAtlas);
+            if (freeQuadOnPage == std::numeric_limits<GlyphTexturePage::QuadIndex>::max())
+            {
+                fits = false;
+                break;
+            }
+            page.claimSpace(freeQuadOnPage, sizeInAtlas);
+        }
+
+        page.restoreFreeSpace(freeSpace);
+        return fits;
+    }
+
+    void GlyphTextureAtlas::mapGlyphs(const GlyphKeyVector& glyphs)
+    {
+        GlyphKeyVector tomap;
+        tomap.reserve(glyphs.size());
+        std::unordered_set<GlyphKey> uniqueGlyphs;
+        for (const auto& glyphkey : glyphs)
+        {
+            const GlyphInfo& glyphInfo = m_glyphInfoMap.at(glyphkey);
+            if (glyphInfo.size.getArea() == 0u || !glyphInfo.glyphMapping.empty() || !uniqueGlyphs.insert(glyphkey).second)
+                continue;
+
+            // padding requires 2 more pixels for each dimension
+            if (glyphInfo.size.x + 2 > m_pageSize.x || glyphInfo.size.y + 2 > m_pageSize.y)
+            {
+                LOG_TEXT_ERROR("GlyphTextureAtlas::mapGlyphs: glyph " << glyphkey.identifier.getValue() << " does not fit on a page, increase atlas texture size");
+                continue;
+            }
+
+            tomap.push_back(glyphkey);
+        }
+
+        auto glyphIt = tomap.cbegin();
+        for (size_t atlasPage = 0u; glyphIt != tomap.cend(); ++atlasPage)
+        {
+            const bool isNewPage = (atlasPage == m_glyphAtlasPages.size());
+            if (isNewPage && atlasPage >= m_maximumPageCount)
+            {
+                LOG_TEXT_ERROR("GlyphTextureAtlas::mapGlyphs: maximum page count " << m_maximumPageCount << " is reached, " << (tomap.cend() - glyphIt) << " glyphs are not mapped");
+                break;
+            }
+            if (isNewPage)
+                createNewPage();
+
+            std::vector<GlyphTexturePage::QuadData> glyphsOnPage;
+            for (; glyphIt != tomap.cend(); ++glyphIt)
+            {
+                GlyphInfo& glyphInfo = m_glyphInfoMap.at(*glyphIt);
+                const QuadSize sizeInAtlas(glyphInfo.size.x + 2, glyphInfo.size.y + 2);
+                const GlyphTexturePage::QuadIndex freeQuadOnPage = getPage(atlasPage).findFreeSpace(sizeInAtlas);
+                if (freeQuadOnPage == std::numeric_limits<GlyphTexturePage::QuadIndex>::max())
+                {
+                    // continue on next page, every glyph fits on an empty page
+                    assert(!isNewPage || !glyphsOnPage.empty());
+                    break;
+                }
+
+                const Quad quad(getPage(atlasPage).claimSpace(freeQuadOnPage, sizeInAtlas), sizeInAtlas);
+                // no text line references the glyph yet
+                glyphInfo.glyphMapping.emplace(atlasPage, GlyphMapping{ 0u, quad, ++m_lastUseCounter });
+                glyphsOnPage.emplace_back(quad, glyphInfo.data.data());
+            }
+
+            getPage(atlasPage).updateDataWithPadding(glyphsOnPage, m_cacheForGlyphPageDataUpdate);
         }
     }
 
@@ -259,4 +431,92 @@ namespace ramses
     {
         return getPage(atlasPage).getSampler();
     }
+
+    void GlyphTextureAtlas::setMaximumPageCount(size_t pageCount)
+    {
+        m_maximumPageCount = pageCount;
+    }
+
+    size_t GlyphTextureAtlas::getMaximumPageCount() const
+    {
+        return m_maximumPageCount;
+    }
+
+    size_t GlyphTextureAtlas::getPageCount() const
+    {
+        return m_glyphAtlasPages.size();
+    }
+
+    size_t GlyphTextureAtlas::getUsedPageCount() const
+    {
+        size_t usedPageCount = 0u;
+        for (const auto& glyphInfo : m_glyphInfoMap)
+        {
+            for (const auto& glyphMapping : glyphInfo.second.glyphMapping)
+                usedPageCount = std::max(usedPageCount, glyphMapping.first + 1u);
+        }
+        return usedPageCount;
+    }
+
+    size_t GlyphTextureAtlas::getMappedGlyphCount() const
+    {
+        return static_cast<size_t>(std::count_if(m_glyphInfoMap.cbegin(), m_glyphInfoMap.cend(), [](const GlyphInfoMap::value_type& glyphInfo)
+        {
+            return !glyphInfo.second.glyphMapping.empty();
+        }));
+    }
+
+    GlyphTextureAtlas::MappingState GlyphTextureAtlas::getMappingState() const
+    {
+        MappingState state;
+        for (const auto& glyphInfo : m_glyphInfoMap)
+        {
+            if (!glyphInfo.second.glyphMapping.empty())
+                state.glyphMappings.emplace_back(glyphInfo.first, glyphInfo.second.glyphMapping);
+        }
+        state.freeSpace.reserve(m_glyphAtlasPages.size());
+        for (const auto& page : m_glyphAtlasPages)
+            state.freeSpace.push_back(page->getFreeSpace());
+        return state;
+    }
+
+    void GlyphTextureAtlas::restoreMappingState(const MappingState& state)
+    {
+        // pages can only have been added since state was taken
+        assert(state.freeSpace.size() <= m_glyphAtlasPages.size());
+        m_glyphAtlasPages.resize(state.freeSpace.size());
+
+        for (auto& glyphInfo : m_glyphInfoMap)
+            glyphInfo.second.glyphMapping.clear();
+
+        std::vector<std::vector<GlyphTexturePage::QuadData>> glyphsOnPages(m_glyphAtlasPages.size());
+        for (const auto& glyphMappings : state.glyphMappings)
+        {
+            GlyphInfo& glyphInfo = m_glyphInfoMap.at(glyphMappings.first);
+            glyphInfo.glyphMapping = glyphMappings.second;
+            for (const auto& glyphMapping : glyphInfo.glyphMapping)
+                glyphsOnPages[glyphMapping.first].emplace_back(glyphMapping.second.quad, glyphInfo.data.data());
+        }
+
+        for (size_t atlasPage = 0u; atlasPage < m_glyphAtlasPages.size(); ++atlasPage)
+        {
+            getPage(atlasPage).restoreFreeSpace(state.freeSpace[atlasPage]);
+            getPage(atlasPage).updateDataWithPadding(glyphsOnPages[atlasPage], m_cacheForGlyphPageDataUpdate);
+        }
+    }
+
+    void GlyphTextureAtlas::unmapAllGlyphs()
+    {
+        for (auto& glyphInfo : m_glyphInfoMap)
+            glyphInfo.second.glyphMapping.clear();
+        for (auto& page : m_glyphAtlasPages)
+            page->releaseAllSpace();
+    }
+
+    void GlyphTextureAtlas::removePagesAtEnd(size_t remainingPageCount)
+    {
+        assert(remainingPageCount >= getUsedPageCount());
+        if (remainingPageCount < m_glyphAtlasPages.size())
+            m_glyphAtlasPages.resize(remainingPageCount);
+    }
 }
@@ -11,6 +11,7 @@
 #include "ramses-client-api/TextureSampler.h"
 #include "ramses-client-api/Texture2DBuffer.h"
 #include <assert.h>
+#include <algorithm>
 
 
 namespace
@@ -74,11 +75,63 @@ namespace ramses
             cacheForDataUpdate.resize(targetQuadArea);
         }
 
-        copyPaddingToCache(targetQuad, cacheForDataUpdate);
-        copyUpdateDataWithoutPaddingToCache(targetQuad, sourceData, cacheForDataUpdate);
+        copyPaddingToCache(targetQuad.getSize(), cacheForDataUpdate.data(), targetQuad.getSize().x);
+        copyUpdateDataWithoutPaddingToCache(targetQuad.getSize(), sourceData, cacheForDataUpdate.data(), targetQuad.getSize().x);
         updateTextureResource(targetQuad, cacheForDataUpdate);
     }
 
+    void GlyphTexturePage::updateDataWithPadding(const std::vector<QuadData>& targetQuadsWithData, GlyphPageData& cacheForDataUpdate)
+    {
+        if (targetQuadsWithData.empty())
+            return;
+
+        uint32_t minX = m_size.x;
+        uint32_t minY = m_size.y;
+        uint32_t maxX = 0u;
+        uint32_t maxY = 0u;
+        for (const auto& quadData : targetQuadsWithData)
+        {
+            const Quad& targetQuad = quadData.first;
+            assert(targetQuad.getSize().x >= 2);
+            assert(targetQuad.getSize().y >= 2);
+            assert(targetQuad.getOrigin().x + targetQuad.getSize().x <= m_size.x);
+            assert(targetQuad.getOrigin().y + targetQuad.getSize().y <= m_size.y);
+
+            minX = std::min(minX, targetQuad.getOrigin().x);
+            minY = std::min(minY, targetQuad.getOrigin().y);
+            maxX = std::max(maxX, targetQuad.getOrigin().x + targetQuad.getSize().x);
+            maxY = std::max(maxY, targetQuad.getOrigin().y + targetQuad.getSize().y);
+        }
+
+        // all glyphs are written to one region enclosing them, texels of the region between the glyphs
+        // are taken over from the current texture data
+        const Quad updateQuad(QuadOffset(minX, minY), QuadSize(maxX - minX, maxY - minY));
+        const uint32_t updateStride = updateQuad.getSize().x;
+        if (cacheForDataUpdate.size() < updateQuad.getSize().getArea())
+            cacheForDataUpdate.resize(updateQuad.getSize().getArea());
+
+        if (targetQuadsWithData.size() > 1u)
+        {
+            GlyphPageData currentPageData(m_size.getArea());
+            m_textureBuffer.getMipLevelData(0u, reinterpret_cast<char*>(currentPageData.data()), m_size.getArea());
+            for (uint32_t row = 0u; row < updateQuad.getSize().y; ++row)
+            {
+                const auto rowBegin = currentPageData.cbegin() + (minY + row) * m_size.x + minX;
+                std::copy(rowBegin, rowBegin + updateStride, cacheForDataUpdate.begin() + row * updateStride);
+            }
+        }
+
+        for (const auto& quadData : targetQuadsWithData)
+        {
+            const Quad& targetQuad = quadData.first;
+            uint8_t* target = cacheForDataUpdate.data() + (targetQuad.getOrigin().y - minY) * updateStride + targetQuad.getOrigin().x - minX;
+            copyPaddingToCache(targetQuad.getSize(), target, updateStride);
+            copyUpdateDataWithoutPaddingToCache(targetQuad.getSize(), quadData.second, target, updateStride);
+        }
+
+        updateTextureResource(updateQuad, cacheForDataUpdate);
+    }
+
     const TextureSampler& GlyphTexturePage::getSampler() const
     {
         return m_textureSampler;
@@ -147,6 +200,17 @@ namespace ramses
         m_freeQuads.push_back(box);
     }
 
+    void GlyphTexturePage::releaseAllSpace()
+    {
+        m_freeQuads.clear();
+        m_freeQuads.push_back(Quad(QuadOffset(0, 0), m_size));
+    }
+
+    void GlyphTexturePage::restoreFreeSpace(const Quads& freeSpace)
+    {
+        m_freeQuads = freeSpace;
+    }
+
     // TODO Violin fix this, make it not have an "in and out" parameter
     bool GlyphTexturePage::mergeFreeQuad(Quad& freeQuadInAndOut)
     {
@@ -163,40 +227,40 @@ namespace ramses
         return false;
     }
 
-    void GlyphTexturePage::copyPaddingToCache(const Quad& updateQuad, GlyphPageData& cacheForDataUpdate)
+    void GlyphTexturePage::copyPaddingToCache(const QuadSize& updateSize, uint8_t* target, uint32_t targetStride)
     {
-        const uint32_t targetRowCount = updateQuad.getSize().y;
-        const uint32_t targetColumnCount = updateQuad.getSize().x;
+        const uint32_t targetRowCount = updateSize.y;
+        const uint32_t targetColumnCount = updateSize.x;
 
         for (uint32_t i = 0u; i < targetRowCount; ++i)
         {
-            cacheForDataUpdate[i * targetColumnCount] = 0; //first column
-            cacheForDataUpdate[i * targetColumnCount + targetColumnCount - 1] = 0; //last column
+            target[i * targetStride] = 0; //first column
+            target[i * targetStride + targetColumnCount - 1] = 0; //last column
         }
 
         for (uint32_t i = 0u; i < targetColumnCount; ++i)
         {
-            cacheForDataUpdate[i] = 0; //first row
-            cacheForDataUpdate[i + (targetRowCount - 1) * targetColumnCount] = 0; // last row
+            target[i] = 0; //first row
+            target[i + (targetRowCount - 1) * targetStride] = 0; // last row
         }
     }
 
-    void GlyphTexturePage::copyUpdateDataWithoutPaddingToCache(const Quad& updateQuad, const uint8_t* data, GlyphPageData& cacheForDataUpdate)
+    void GlyphTexturePage::copyUpdateDataWithoutPaddingToCache(const QuadSize& updateSize, const uint8_t* data, uint8_t* target, uint32_t targetStride)
     {
-        const uint32_t targetRowCount = updateQuad.getSize().y;
-        const uint32_t targetColumnCount = updateQuad.getSize().x;
+        const uint32_t targetRowCount = updateSize.y;
+        const uint32_t targetColumnCount = updateSize.x;
         const uint32_t sourceColumnCount = targetColumnCount - 2;
         for (uint32_t targetRow = 1u; targetRow < targetRowCount - 1u; ++targetRow)
         {
             for (uint32_t targetCol = 1u; targetCol < targetColumnCount - 1u; ++targetCol)
             {
-                const uint32_t targetOffset = targetRow*(targetColumnCount)+targetCol;
+                const uint32_t targetOffset = targetRow*targetStride + targetCol;
 
                 // Exclude the padding
                 const uint32_t sourceRow = targetRow - 1;
                 const uint32_t sourceCol = targetCol - 1;
 
-                cacheForDataUpdate[targetOffset] = data[sourceColumnCount * sourceRow + sourceCol];
+                target[targetOffset] = data[sourceColumnCount * sourceRow + sourceCol];
             }
         }
     }
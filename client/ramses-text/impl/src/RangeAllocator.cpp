@@ -0,0 +1,96 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-text/RangeAllocator.h"
+#include <assert.h>
+#include <iterator>
+
+namespace ramses
+{
+    const uint32_t RangeAllocator::InvalidOffset;
+
+    RangeAllocator::RangeAllocator(uint32_t capacity)
+        : m_capacity(capacity)
+    {
+        if (capacity > 0u)
+            m_freeRanges[0u] = capacity;
+    }
+
+    uint32_t RangeAllocator::allocate(uint32_t size)
+    {
+        assert(size > 0u);
+        for (auto it = m_freeRanges.begin(); it != m_freeRanges.end(); ++it)
+        {
+            if (it->second >= size)
+            {
+                const uint32_t offset = it->first;
+                const uint32_t remainingSize = it->second - size;
+                m_freeRanges.erase(it);
+                if (remainingSize > 0u)
+                    m_freeRanges[offset + size] = remainingSize;
+                return offset;
+            }
+        }
+
+        return InvalidOffset;
+    }
+
+    void RangeAllocator::release(uint32_t offset, uint32_t size)
+    {
+        assert(size > 0u && offset + size <= m_capacity);
+        auto it = m_freeRanges.emplace(offset, size).first;
+        assert(it->second == size);
+
+        const auto nextIt = std::next(it);
+        assert(nextIt == m_freeRanges.end() || offset + size <= nextIt->first);
+        if (nextIt != m_freeRanges.end() && offset + size == nextIt->first)
+        {
+            it->second += nextIt->second;
+            m_freeRanges.erase(nextIt);
+        }
+
+        if (it != m_freeRanges.begin())
+        {
+            const auto prevIt = std::prev(it);
+            assert(prevIt->first + prevIt->second <= offset);
+            if (prevIt->first + prevIt->second == offset)
+            {
+                prevIt->second += it->second;
+                m_freeRanges.erase(it);
+            }
+        }
+    }
+
+    void RangeAllocator::grow(uint32_t newCapacity)
+    {
+        assert(newCapacity >= m_capacity);
+        if (newCapacity == m_capacity)
+            return;
+
+        const uint32_t oldCapacity = m_capacity;
+        m_capacity = newCapacity;
+        release(oldCapacity, newCapacity - oldCapacity);
+    }
+
+    uint32_t RangeAllocator::getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    uint32_t RangeAllocator::getUsedEnd() const
+    {
+        if (!m_freeRanges.empty())
+        {
+            const auto& lastFreeRange = *m_freeRanges.rbegin();
+            if (lastFreeRange.first + lastFreeRange.second == m_capacity)
+                return lastFreeRange.first;
+        }
+
+        return m_capacity;
+    }
+}
@@ -0,0 +1,74 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-text/SDFFontInstance.h"
+#include "ramses-text/Freetype2FontInstance.h"
+#include <assert.h>
+#include <cmath>
+
+namespace ramses
+{
+    SDFFontInstance::SDFFontInstance(Freetype2FontInstance& referenceInstance, uint32_t referenceSize, uint32_t pixelSize)
+        : m_referenceInstance(referenceInstance)
+        , m_scale(static_cast<float>(pixelSize) / referenceSize)
+    {
+        assert(referenceSize > 0u);
+    }
+
+    bool SDFFontInstance::supportsCharacter(char32_t character) const
+    {
+        return m_referenceInstance.supportsCharacter(character);
+    }
+
+    int SDFFontInstance::getHeight() const
+    {
+        return scale(m_referenceInstance.getHeight());
+    }
+
+    int SDFFontInstance::getAscender() const
+    {
+        return scale(m_referenceInstance.getAscender());
+    }
+
+    int SDFFontInstance::getDescender() const
+    {
+        return scale(m_referenceInstance.getDescender());
+    }
+
+    void SDFFontInstance::loadAndAppendGlyphMetrics(std::u32string::const_iterator charsBegin, std::u32string::const_iterator charsEnd, GlyphMetricsVector& positionedGlyphs)
+    {
+        const size_t firstNewGlyph = positionedGlyphs.size();
+        m_referenceInstance.loadAndAppendGlyphMetrics(charsBegin, charsEnd, positionedGlyphs);
+
+        for (size_t i = firstNewGlyph; i < positionedGlyphs.size(); ++i)
+        {
+            GlyphMetrics& glyph = positionedGlyphs[i];
+            glyph.width = static_cast<uint32_t>(scale(static_cast<int32_t>(glyph.width)));
+            glyph.height = static_cast<uint32_t>(scale(static_cast<int32_t>(glyph.height)));
+            glyph.posX = scale(glyph.posX);
+            glyph.posY = scale(glyph.posY);
+            glyph.advance = scale(glyph.advance);
+        }
+    }
+
+    GlyphData SDFFontInstance::loadGlyphBitmapData(GlyphId glyphId, uint32_t& sizeX, uint32_t& sizeY)
+    {
+        // the field is stored once in reference size, it is scaled when rendered
+        return m_referenceInstance.loadGlyphBitmapData(glyphId, sizeX, sizeY);
+    }
+
+    void SDFFontInstance::loadGlyphBitmaps(const std::vector<GlyphId>& glyphIds, uint32_t maxThreads, GlyphBitmaps& bitmaps)
+    {
+        m_referenceInstance.loadGlyphBitmaps(glyphIds, maxThreads, bitmaps);
+    }
+
+    int32_t SDFFontInstance::scale(int32_t value) const
+    {
+        return static_cast<int32_t>(std::lround(value * m_scale));
+    }
+}
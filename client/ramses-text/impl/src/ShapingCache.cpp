@@ -0,0 +1,129 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-text/ShapingCache.h"
+#include <functional>
+#include <algorithm>
+#include <assert.h>
+
+namespace ramses
+{
+    ShapingCache::ShapingCache(uint32_t capacity)
+        : m_capacity(capacity)
+    {
+    }
+
+    const GlyphMetricsVector* ShapingCache::find(const std::u32string& str, const FontInstanceOffsets& fontOffsets)
+    {
+        if (m_capacity == 0u)
+            return nullptr;
+
+        const auto it = m_entries.find({ str, fontOffsets });
+        if (it == m_entries.end())
+        {
+            ++m_misses;
+            return nullptr;
+        }
+
+        ++m_hits;
+        m_usageOrder.splice(m_usageOrder.begin(), m_usageOrder, it->second.usage);
+        return &it->second.glyphs;
+    }
+
+    void ShapingCache::add(const std::u32string& str, const FontInstanceOffsets& fontOffsets, const GlyphMetricsVector& glyphs)
+    {
+        if (m_capacity == 0u)
+            return;
+
+        auto insertResult = m_entries.insert({ Key{ str, fontOffsets }, Entry{ glyphs, m_usageOrder.end() } });
+        auto& entry = *insertResult.first;
+        if (!insertResult.second)
+        {
+            entry.second.glyphs = glyphs;
+            m_usageOrder.splice(m_usageOrder.begin(), m_usageOrder, entry.second.usage);
+            return;
+        }
+
+        m_usageOrder.push_front(&entry.first);
+        entry.second.usage = m_usageOrder.begin();
+
+        if (m_entries.size() > m_capacity)
+            evictLeastRecentlyUsed();
+    }
+
+    void ShapingCache::removeEntriesOfFontInstance(FontInstanceId fontInstance)
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+        {
+            const auto& fontOffsets = it->first.fontOffsets;
+            const bool usesFontInstance = std::any_of(fontOffsets.cbegin(), fontOffsets.cend(), [fontInstance](const FontInstanceOffset& fontOffset)
+            {
+                return fontOffset.fontInstance == fontInstance;
+            });
+
+            if (usesFontInstance)
+            {
+                m_usageOrder.erase(it->second.usage);
+                it = m_entries.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+
+    void ShapingCache::setCapacity(uint32_t capacity)
+    {
+        m_capacity = capacity;
+        while (m_entries.size() > m_capacity)
+            evictLeastRecentlyUsed();
+    }
+
+    void ShapingCache::clear()
+    {
+        m_entries.clear();
+        m_usageOrder.clear();
+    }
+
+    ShapingCacheStatistics ShapingCache::getStatistics() const
+    {
+        ShapingCacheStatistics statistics;
+        statistics.hits = m_hits;
+        statistics.misses = m_misses;
+        statistics.entries = static_cast<uint32_t>(m_entries.size());
+        statistics.capacity = m_capacity;
+        return statistics;
+    }
+
+    void ShapingCache::evictLeastRecentlyUsed()
+    {
+        assert(!m_usageOrder.empty());
+        const Key* leastRecentlyUsed = m_usageOrder.back();
+        m_usageOrder.pop_back();
+        m_entries.erase(*leastRecentlyUsed);
+    }
+
+    size_t ShapingCache::KeyHash::operator()(const Key& key) const
+    {
+        size_t hash = std::hash<std::u32string>()(key.str);
+        for (const auto& fontOffset : key.fontOffsets)
+        {
+            hash ^= std::hash<FontInstanceId>()(fontOffset.fontInstance) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<size_t>()(fontOffset.beginOffset) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+        return hash;
+    }
+
+    bool ShapingCache::KeyEqual::operator()(const Key& a, const Key& b) const
+    {
+        return a.str == b.str && std::equal(a.fontOffsets.cbegin(), a.fontOffsets.cend(), b.fontOffsets.cbegin(), b.fontOffsets.cend(),
+            [](const FontInstanceOffset& offsetA, const FontInstanceOffset& offsetB)
+            {
+                return offsetA.fontInstance == offsetB.fontInstance && offsetA.beginOffset == offsetB.beginOffset;
+            });
+    }
+}
@@ -0,0 +1,126 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-text/SignedDistanceField.h"
+#include <assert.h>
+#include <cmath>
+#include <algorithm>
+
+namespace ramses
+{
+    namespace
+    {
+        // large but finite, squared distances are added to it
+        const float FarAway = 1e20f;
+    }
+
+    GlyphData SignedDistanceField::CreateFromCoverage(const uint8_t* coverage, uint32_t width, uint32_t height, uint32_t spread)
+    {
+        assert(spread > 0u);
+        if (width == 0u || height == 0u)
+            return {};
+
+        const uint32_t fieldWidth = width + 2u * spread;
+        const uint32_t fieldHeight = height + 2u * spread;
+        const size_t fieldSize = size_t(fieldWidth) * fieldHeight;
+
+        // squared distance of every pixel to the glyph (0 inside) and to the background (0 outside),
+        // partially covered pixels are assumed to be crossed by the outline at sub-pixel distance
+        std::vector<float> distanceToInside(fieldSize, FarAway);
+        std::vector<float> distanceToOutside(fieldSize, 0.f);
+        for (uint32_t y = 0u; y < height; ++y)
+        {
+            for (uint32_t x = 0u; x < width; ++x)
+            {
+                const uint8_t value = coverage[y * width + x];
+                if (value == 0u)
+                    continue;
+
+                const size_t fieldIdx = (y + spread) * fieldWidth + x + spread;
+                if (value == 255u)
+                {
+                    distanceToInside[fieldIdx] = 0.f;
+                    distanceToOutside[fieldIdx] = FarAway;
+                }
+                else
+                {
+                    const float alpha = value / 255.f;
+                    const float insideDist = std::max(0.f, 0.5f - alpha);
+                    const float outsideDist = std::max(0.f, alpha - 0.5f);
+                    distanceToInside[fieldIdx] = insideDist * insideDist;
+                    distanceToOutside[fieldIdx] = outsideDist * outsideDist;
+                }
+            }
+        }
+
+        TransformGrid(distanceToInside, fieldWidth, fieldHeight);
+        TransformGrid(distanceToOutside, fieldWidth, fieldHeight);
+
+        GlyphData field(fieldSize);
+        const float valuePerPixel = 127.f / spread;
+        for (size_t i = 0u; i < fieldSize; ++i)
+        {
+            const float signedDistance = std::sqrt(distanceToOutside[i]) - std::sqrt(distanceToInside[i]);
+            const float value = 128.f + signedDistance * valuePerPixel;
+            field[i] = static_cast<uint8_t>(std::min(255.f, std::max(0.f, std::round(value))));
+        }
+
+        return field;
+    }
+
+    void SignedDistanceField::TransformGrid(std::vector<float>& grid, uint32_t width, uint32_t height)
+    {
+        for (uint32_t x = 0u; x < width; ++x)
+            TransformRowOrColumn(grid, x, width, height);
+        for (uint32_t y = 0u; y < height; ++y)
+            TransformRowOrColumn(grid, size_t(y) * width, 1u, width);
+    }
+
+    // 1D squared euclidean distance transform (lower envelope of parabolas, Felzenszwalb & Huttenlocher)
+    void SignedDistanceField::TransformRowOrColumn(std::vector<float>& grid, size_t offset, size_t stride, size_t length)
+    {
+        std::vector<float> values(length);
+        for (size_t q = 0u; q < length; ++q)
+            values[q] = grid[offset + q * stride];
+
+        std::vector<size_t> parabolaVertices(length);
+        std::vector<float> parabolaBounds(length + 1u);
+        size_t k = 0u;
+        parabolaVertices[0] = 0u;
+        parabolaBounds[0] = -FarAway;
+        parabolaBounds[1] = FarAway;
+
+        for (size_t q = 1u; q < length; ++q)
+        {
+            const float fq = values[q] + float(q * q);
+            float s = 0.f;
+            for (;;)
+            {
+                const size_t r = parabolaVertices[k];
+                s = (fq - values[r] - float(r * r)) / (2.f * float(q - r));
+                if (s > parabolaBounds[k] || k == 0u)
+                    break;
+                --k;
+            }
+            ++k;
+            parabolaVertices[k] = q;
+            parabolaBounds[k] = s;
+            parabolaBounds[k + 1u] = FarAway;
+        }
+
+        k = 0u;
+        for (size_t q = 0u; q < length; ++q)
+        {
+            while (parabolaBounds[k + 1u] < float(q))
+                ++k;
+            const size_t r = parabolaVertices[k];
+            const float delta = float(q) - float(r);
+            grid[offset + q * stride] = values[r] + delta * delta;
+        }
+    }
+}
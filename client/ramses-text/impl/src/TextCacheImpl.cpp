@@ -24,6 +24,24 @@
 
 #include <iostream>
 #include <limits>
+#include <unordered_set>
+#include <algorithm>
+#include <assert.h>
+
+namespace
+{
+    // every glyph quad consists of 4 vertices with 2 components each and 2 triangles
+    const uint32_t VertexComponentsPerQuad = 8u;
+    const uint32_t VerticesPerQuad = 4u;
+    const uint32_t IndicesPerQuad = 6u;
+    const uint32_t InitialTextBatchPageCapacity = 64u;
+
+    uint32_t GetQuadCount(const ramses::GlyphGeometry& geometry)
+    {
+        assert(geometry.positions.size() % VertexComponentsPerQuad == 0u);
+        return static_cast<uint32_t>(geometry.positions.size() / VertexComponentsPerQuad);
+    }
+}
 
 namespace ramses
 {
@@ -36,8 +54,27 @@ namespace ramses
 
     GlyphMetricsVector TextCacheImpl::getPositionedGlyphs(const std::u32string& str, const FontInstanceOffsets& fontOffsets)
     {
+        // cached entries of font instances deleted at the font accessor in the meantime are outdated
+        bool allCachedFontInstancesAvailable = true;
+        for (const auto& fontOffset : fontOffsets)
+        {
+            if (m_fontAccessor.getFontInstance(fontOffset.fontInstance) == nullptr)
+            {
+                m_shapingCache.removeEntriesOfFontInstance(fontOffset.fontInstance);
+                allCachedFontInstancesAvailable = false;
+            }
+        }
+
+        if (allCachedFontInstancesAvailable)
+        {
+            const GlyphMetricsVector* cachedGlyphs = m_shapingCache.find(str, fontOffsets);
+            if (cachedGlyphs != nullptr)
+                return *cachedGlyphs;
+        }
+
         GlyphMetricsVector positionedGlyphs;
         positionedGlyphs.reserve(str.size());
+        bool allFontInstancesFound = true;
 
         for (auto fontIt = fontOffsets.cbegin(); fontIt != fontOffsets.cend(); ++fontIt)
         {
@@ -50,9 +87,16 @@ namespace ramses
             if (fontInstance != nullptr)
                 fontInstance->loadAndAppendGlyphMetrics(substrBeginIt, substrEndIt, positionedGlyphs);
             else
+            {
                 LOG_TEXT_ERROR("TextCache::getPositionedGlyphs: Could not find font instance " << fontIt->fontInstance.getValue());
+                allFontInstancesFound = false;
+            }
         }
 
+        // incomplete results are not cached, the font instance might be added later
+        if (allFontInstancesFound)
+            m_shapingCache.add(str, fontOffsets, positionedGlyphs);
+
         return positionedGlyphs;
     }
 
@@ -61,6 +105,79 @@ namespace ramses
         return getPositionedGlyphs(str, { { font, 0u } });
     }
 
+    void TextCacheImpl::setShapingCacheCapacity(uint32_t capacity)
+    {
+        m_shapingCache.setCapacity(capacity);
+    }
+
+    void TextCacheImpl::clearShapingCache()
+    {
+        m_shapingCache.clear();
+    }
+
+    ShapingCacheStatistics TextCacheImpl::getShapingCacheStatistics() const
+    {
+        return m_shapingCache.getStatistics();
+    }
+
+    bool TextCacheImpl::registerGlyphs(const GlyphMetricsVector& glyphs)
+    {
+        for (const auto& glyph : glyphs)
+        {
+            if (!m_textureAtlas.isGlyphRegistered(glyph.key))
+            {
+                IFontInstance* fontInstance = m_fontAccessor.getFontInstance(glyph.key.fontInstanceId);
+                if (fontInstance == nullptr)
+                {
+                    LOG_TEXT_ERROR("TextCache: Could not find font instance " << glyph.key.fontInstanceId.getValue() << " to load glyph");
+                    return false;
+                }
+                QuadSize glyphSize;
+                GlyphData data = fontInstance->loadGlyphBitmapData(glyph.key.identifier, glyphSize.x, glyphSize.y);
+                m_textureAtlas.registerGlyph(glyph.key, glyphSize, std::move(data));
+            }
+        }
+
+        return true;
+    }
+
+    bool TextCacheImpl::preloadGlyphs(const GlyphMetricsVector& glyphs, uint32_t maxThreads)
+    {
+        std::unordered_map<FontInstanceId, std::vector<GlyphId>> glyphsToLoad;
+        std::unordered_set<GlyphKey> uniqueGlyphs;
+        for (const auto& glyph : glyphs)
+        {
+            if (!m_textureAtlas.isGlyphRegistered(glyph.key) && uniqueGlyphs.insert(glyph.key).second)
+                glyphsToLoad[glyph.key.fontInstanceId].push_back(glyph.key.identifier);
+        }
+
+        for (const auto& fontGlyphs : glyphsToLoad)
+        {
+            if (m_fontAccessor.getFontInstance(fontGlyphs.first) == nullptr)
+            {
+                LOG_TEXT_ERROR("TextCache::preloadGlyphs: Could not find font instance " << fontGlyphs.first.getValue() << " to load glyphs");
+                return false;
+            }
+        }
+
+        for (const auto& fontGlyphs : glyphsToLoad)
+        {
+            GlyphBitmaps bitmaps;
+            m_fontAccessor.getFontInstance(fontGlyphs.first)->loadGlyphBitmaps(fontGlyphs.second, maxThreads, bitmaps);
+            assert(bitmaps.size() == fontGlyphs.second.size());
+            for (size_t i = 0u; i < bitmaps.size(); ++i)
+                m_textureAtlas.registerGlyph(GlyphKey(fontGlyphs.second[i], fontGlyphs.first), { bitmaps[i].width, bitmaps[i].height }, std::move(bitmaps[i].data));
+        }
+
+        GlyphKeyVector glyphKeys;
+        glyphKeys.reserve(glyphs.size());
+        for (const auto& glyph : glyphs)
+            glyphKeys.push_back(glyph.key);
+        m_textureAtlas.mapGlyphs(glyphKeys);
+
+        return true;
+    }
+
     TextLineId TextCacheImpl::createTextLine(const GlyphMetricsVector& glyphs, const Effect& effect)
     {
         if (glyphs.empty())
@@ -81,21 +198,8 @@ namespace ramses
             return InvalidTextLineId;
         }
 
-        for (const auto& glyph : glyphs)
-        {
-            if (!m_textureAtlas.isGlyphRegistered(glyph.key))
-            {
-                IFontInstance* fontInstance = m_fontAccessor.getFontInstance(glyph.key.fontInstanceId);
-                if (fontInstance == nullptr)
-                {
-                    LOG_TEXT_ERROR("TextCache::createTextLine: Could not find font instance " << glyph.key.fontInstanceId.getValue());
-                    return InvalidTextLineId;
-                }
-                QuadSize glyphSize;
-                GlyphData data = fontInstance->loadGlyphBitmapData(glyph.key.identifier, glyphSize.x, glyphSize.y);
-                m_textureAtlas.registerGlyph(glyph.key, glyphSize, std::move(data));
-            }
-        }
+        if (!registerGlyphs(glyphs))
+            return InvalidTextLineId;
 
         const GlyphGeometry geometry = m_textureAtlas.mapGlyphsAndCreateGeometry(glyphs);
         if (geometry.atlasPage == std::numeric_limits<decltype(geometry.atlasPage)>::max() || geometry.indices.empty())
@@ -171,6 +275,14 @@ namespace ramses
         }
 
         TextLine& textLine = m_textLines[textId];
+        if (m_batchedTextLines.count(textId) != 0)
+        {
+            releaseBatchedTextLine(textId);
+            m_textureAtlas.unmapGlyphsFromPage(textLine.glyphs, textLine.atlasPage);
+            m_textLines.erase(textId);
+            return true;
+        }
+
         auto geometry = textLine.meshNode->getGeometryBinding();
         auto appearance = textLine.meshNode->getAppearance();
         m_scene.destroy(*textLine.meshNode);
@@ -185,4 +297,728 @@ namespace ramses
         m_textLines.erase(textId);
         return true;
     }
+
+    bool TextCacheImpl::updateTextLine(TextLineId textId, const GlyphMetricsVector& glyphs)
+    {
+        const auto textLineIt = m_textLines.find(textId);
+        if (textLineIt == m_textLines.end())
+        {
+            LOG_TEXT_ERROR("TextCache::updateTextLine failed - there is no text line " << textId.getValue());
+            return false;
+        }
+
+        if (glyphs.empty())
+        {
+            LOG_TEXT_ERROR("TextCache::updateTextLine failed - cannot create text geometry for empty string");
+            return false;
+        }
+
+        if (!registerGlyphs(glyphs))
+            return false;
+
+        // new glyphs are mapped before the current ones are unmapped, so glyphs used before and after the update
+        // stay on their page and do not have to be uploaded again
+        TextLine& textLine = textLineIt->second;
+        const GlyphGeometry geometry = m_textureAtlas.mapGlyphsAndCreateGeometry(glyphs, textLine.atlasPage);
+        if (geometry.atlasPage == std::numeric_limits<decltype(geometry.atlasPage)>::max() || geometry.indices.empty())
+        {
+            LOG_TEXT_ERROR("TextCache::updateTextLine failed - glyphs could not be mapped in atlas");
+            return false;
+        }
+
+        const bool updated = (m_batchedTextLines.count(textId) != 0) ? updateBatchedTextLine(textId, textLine, geometry) : updateTextLineMesh(textLine, geometry);
+        if (!updated)
+        {
+            m_textureAtlas.unmapGlyphsFromPage(glyphs, geometry.atlasPage);
+            return false;
+        }
+
+        m_textureAtlas.unmapGlyphsFromPage(textLine.glyphs, textLine.atlasPage);
+        textLine.glyphs = glyphs;
+        textLine.atlasPage = geometry.atlasPage;
+        return true;
+    }
+
+    bool TextCacheImpl::updateTextLineMesh(TextLine& textLine, const GlyphGeometry& geometry)
+    {
+        const GlyphGeometry currentGeometry = m_textureAtlas.createGlyphsGeometry(textLine.atlasPage, textLine.glyphs);
+        const uint32_t currentQuadCount = GetQuadCount(currentGeometry);
+        const uint32_t quadCount = GetQuadCount(geometry);
+        const uint32_t capacity = textLine.positions->getMaximumSizeInBytes() / (VertexComponentsPerQuad * sizeof(float));
+        Appearance& appearance = *textLine.meshNode->getAppearance();
+        const Effect& effect = appearance.getEffect();
+
+        if (quadCount > capacity)
+        {
+            // replace buffers by larger ones, leaving space for further growth
+            const uint32_t newCapacity = std::max(quadCount, capacity * 2u);
+            VertexDataBuffer* positions = m_scene.createVertexDataBuffer(newCapacity * VertexComponentsPerQuad * sizeof(float), ramses::EDataType_Vector2F, "");
+            VertexDataBuffer* textureCoordinates = m_scene.createVertexDataBuffer(newCapacity * VertexComponentsPerQuad * sizeof(float), ramses::EDataType_Vector2F, "");
+            IndexDataBuffer* indices = m_scene.createIndexDataBuffer(newCapacity * IndicesPerQuad * sizeof(uint16_t), ramses::EDataType_UInt16, "");
+            if (positions == nullptr || textureCoordinates == nullptr || indices == nullptr)
+            {
+                LOG_TEXT_ERROR("TextCache::updateTextLine failed - failed to create data buffers, check Ramses logs for more details");
+                if (positions != nullptr)
+                    m_scene.destroy(*positions);
+                if (textureCoordinates != nullptr)
+                    m_scene.destroy(*textureCoordinates);
+                if (indices != nullptr)
+                    m_scene.destroy(*indices);
+                return false;
+            }
+
+            positions->setData(reinterpret_cast<const char*>(geometry.positions.data()), static_cast<uint32_t>(geometry.positions.size() * sizeof(float)));
+            textureCoordinates->setData(reinterpret_cast<const char*>(geometry.texcoords.data()), static_cast<uint32_t>(geometry.texcoords.size() * sizeof(float)));
+            indices->setData(reinterpret_cast<const char*>(geometry.indices.data()), static_cast<uint32_t>(geometry.indices.size() * sizeof(uint16_t)));
+
+            AttributeInput posInput;
+            AttributeInput texCoordInput;
+            effect.findAttributeInput(EEffectAttributeSemantic_TextPositions, posInput);
+            effect.findAttributeInput(EEffectAttributeSemantic_TextTextureCoordinates, texCoordInput);
+            GeometryBinding& geometryBinding = *textLine.meshNode->getGeometryBinding();
+            geometryBinding.setIndices(*indices);
+            geometryBinding.setInputBuffer(posInput, *positions);
+            geometryBinding.setInputBuffer(texCoordInput, *textureCoordinates);
+
+            m_scene.destroy(*textLine.positions);
+            m_scene.destroy(*textLine.textureCoordinates);
+            m_scene.destroy(*textLine.indices);
+            textLine.positions = positions;
+            textLine.textureCoordinates = textureCoordinates;
+            textLine.indices = indices;
+        }
+        else
+        {
+            // upload only the range from first to last quad which differs from current geometry
+            uint32_t firstChangedQuad = quadCount;
+            uint32_t changedQuadsEnd = 0u;
+            for (uint32_t quad = 0u; quad < quadCount; ++quad)
+            {
+                const auto componentOffset = quad * VertexComponentsPerQuad;
+                const bool changed = quad >= currentQuadCount
+                    || !std::equal(geometry.positions.cbegin() + componentOffset, geometry.positions.cbegin() + componentOffset + VertexComponentsPerQuad, currentGeometry.positions.cbegin() + componentOffset)
+                    || !std::equal(geometry.texcoords.cbegin() + componentOffset, geometry.texcoords.cbegin() + componentOffset + VertexComponentsPerQuad, currentGeometry.texcoords.cbegin() + componentOffset);
+                if (changed)
+                {
+                    firstChangedQuad = std::min(firstChangedQuad, quad);
+                    changedQuadsEnd = quad + 1u;
+                }
+            }
+
+            if (firstChangedQuad < changedQuadsEnd)
+            {
+                const uint32_t componentOffset = firstChangedQuad * VertexComponentsPerQuad;
+                const uint32_t componentCount = (changedQuadsEnd - firstChangedQuad) * VertexComponentsPerQuad;
+                textLine.positions->setData(reinterpret_cast<const char*>(&geometry.positions[componentOffset]), componentCount * sizeof(float), componentOffset * sizeof(float));
+                textLine.textureCoordinates->setData(reinterpret_cast<const char*>(&geometry.texcoords[componentOffset]), componentCount * sizeof(float), componentOffset * sizeof(float));
+            }
+
+            // indices of a quad depend only on its position in the text line
+            if (quadCount > currentQuadCount)
+            {
+                const uint32_t indexOffset = currentQuadCount * IndicesPerQuad;
+                const uint32_t indexCount = (quadCount - currentQuadCount) * IndicesPerQuad;
+                textLine.indices->setData(reinterpret_cast<const char*>(&geometry.indices[indexOffset]), indexCount * sizeof(uint16_t), indexOffset * sizeof(uint16_t));
+            }
+        }
+
+        if (geometry.atlasPage != textLine.atlasPage)
+        {
+            UniformInput texInput;
+            effect.findUniformInput(EEffectUniformSemantic_TextTexture, texInput);
+            appearance.setInputTexture(texInput, m_textureAtlas.getTextureSampler(geometry.atlasPage));
+        }
+
+        textLine.meshNode->setIndexCount(quadCount * IndicesPerQuad);
+        return true;
+    }
+
+    bool TextCacheImpl::updateBatchedTextLine(TextLineId textId, TextLine& textLine, const GlyphGeometry& geometry)
+    {
+        uint32_t quadOffset = RangeAllocator::InvalidOffset;
+        if (!reserveBatchedTextLineQuads(textId, textLine, geometry, quadOffset))
+            return false;
+
+        writeBatchedTextLineQuads(textId, textLine, geometry, quadOffset);
+        return true;
+    }
+
+    bool TextCacheImpl::reserveBatchedTextLineQuads(TextLineId textId, const TextLine& textLine, const GlyphGeometry& geometry, uint32_t& quadOffset)
+    {
+        const BatchedTextLine& batchedTextLine = m_batchedTextLines.find(textId)->second;
+        if (geometry.atlasPage == textLine.atlasPage && GetQuadCount(geometry) <= batchedTextLine.quadCount)
+        {
+            quadOffset = batchedTextLine.quadOffset;
+            return true;
+        }
+
+        TextBatchPage* page = getOrCreateBatchPage(batchedTextLine.batch, geometry.atlasPage);
+        if (page == nullptr)
+            return false;
+        quadOffset = allocateBatchPageQuads(batchedTextLine.batch, *page, GetQuadCount(geometry));
+        return quadOffset != RangeAllocator::InvalidOffset;
+    }
+
+    void TextCacheImpl::releaseReservedBatchedTextLineQuads(TextLineId textId, const TextLine& textLine, const GlyphGeometry& geometry, uint32_t quadOffset)
+    {
+        if (isBatchedTextLineUpdatedInPlace(textId, textLine, geometry, quadOffset))
+            return;
+
+        const BatchedTextLine& batchedTextLine = m_batchedTextLines.find(textId)->second;
+        TextBatchPage& page = m_textBatches.find(batchedTextLine.batch)->second.pages.find(geometry.atlasPage)->second;
+        releaseBatchPageQuads(page, quadOffset, GetQuadCount(geometry));
+    }
+
+    void TextCacheImpl::writeBatchedTextLineQuads(TextLineId textId, TextLine& textLine, const GlyphGeometry& geometry, uint32_t quadOffset)
+    {
+        BatchedTextLine& batchedTextLine = m_batchedTextLines.find(textId)->second;
+        TextBatchData& batchData = m_textBatches.find(batchedTextLine.batch)->second;
+        TextBatchPage& currentPage = batchData.pages.find(textLine.atlasPage)->second;
+        const uint32_t quadCount = GetQuadCount(geometry);
+
+        if (isBatchedTextLineUpdatedInPlace(textId, textLine, geometry, quadOffset))
+        {
+            if (quadCount < batchedTextLine.quadCount)
+                releaseBatchPageQuads(currentPage, batchedTextLine.quadOffset + quadCount, batchedTextLine.quadCount - quadCount);
+            writeBatchPageQuads(currentPage, batchedTextLine.quadOffset, geometry, batchedTextLine.offsetX, batchedTextLine.offsetY);
+            batchedTextLine.quadCount = quadCount;
+            return;
+        }
+
+        TextBatchPage& page = batchData.pages.find(geometry.atlasPage)->second;
+        releaseBatchPageQuads(currentPage, batchedTextLine.quadOffset, batchedTextLine.quadCount);
+        writeBatchPageQuads(page, quadOffset, geometry, batchedTextLine.offsetX, batchedTextLine.offsetY);
+        batchedTextLine.quadOffset = quadOffset;
+        batchedTextLine.quadCount = quadCount;
+
+        textLine.meshNode = page.meshNode;
+        textLine.indices = page.indices;
+        textLine.positions = page.positions;
+        textLine.textureCoordinates = page.textureCoordinates;
+    }
+
+    bool TextCacheImpl::isBatchedTextLineUpdatedInPlace(TextLineId textId, const TextLine& textLine, const GlyphGeometry& geometry, uint32_t quadOffset) const
+    {
+        // quads newly reserved on the same page never start where the still allocated quads of the text line do
+        return geometry.atlasPage == textLine.atlasPage && quadOffset == m_batchedTextLines.find(textId)->second.quadOffset;
+    }
+
+    TextBatchId TextCacheImpl::createTextBatch(const Effect& effect)
+    {
+        UniformInput texInput;
+        AttributeInput posInput;
+        AttributeInput texCoordInput;
+        effect.findUniformInput(EEffectUniformSemantic_TextTexture, texInput);
+        effect.findAttributeInput(EEffectAttributeSemantic_TextPositions, posInput);
+        effect.findAttributeInput(EEffectAttributeSemantic_TextTextureCoordinates, texCoordInput);
+        if (!texInput.isValid() || !posInput.isValid() || !texCoordInput.isValid())
+        {
+            LOG_TEXT_ERROR("TextCache::createTextBatch failed - text appearance effect must provide inputs for positions and coordinates attributes and a texture uniform");
+            return InvalidTextBatchId;
+        }
+
+        Node* rootNode = m_scene.createNode();
+        if (rootNode == nullptr)
+        {
+            LOG_TEXT_ERROR("TextCache::createTextBatch failed - failed to create root node, check Ramses logs for more details");
+            return InvalidTextBatchId;
+        }
+
+        auto batchId = m_batchIdCounter;
+        m_batchIdCounter.getReference()++;
+
+        TextBatchData& batchData = m_textBatches[batchId];
+        batchData.effect = &effect;
+        batchData.batch.rootNode = rootNode;
+
+        return batchId;
+    }
+
+    TextBatch const* TextCacheImpl::getTextBatch(TextBatchId batchId) const
+    {
+        const auto it = m_textBatches.find(batchId);
+        return it != m_textBatches.cend() ? &it->second.batch : nullptr;
+    }
+
+    bool TextCacheImpl::deleteTextBatch(TextBatchId batchId)
+    {
+        const auto batchIt = m_textBatches.find(batchId);
+        if (batchIt == m_textBatches.end())
+        {
+            LOG_TEXT_ERROR("TextCache::deleteTextBatch: Cannot delete text batch " << batchId.getValue() << ", no such entry");
+            return false;
+        }
+
+        for (auto lineIt = m_textLines.begin(); lineIt != m_textLines.end();)
+        {
+            const auto batchedLineIt = m_batchedTextLines.find(lineIt->first);
+            if (batchedLineIt != m_batchedTextLines.end() && batchedLineIt->second.batch == batchId)
+            {
+                m_textureAtlas.unmapGlyphsFromPage(lineIt->second.glyphs, lineIt->second.atlasPage);
+                m_batchedTextLines.erase(batchedLineIt);
+                lineIt = m_textLines.erase(lineIt);
+            }
+            else
+                ++lineIt;
+        }
+
+        for (auto& pageIt : batchIt->second.pages)
+            destroyBatchPage(pageIt.second);
+        m_scene.destroy(*batchIt->second.batch.rootNode);
+
+        m_textBatches.erase(batchIt);
+        return true;
+    }
+
+    TextLineId TextCacheImpl::createTextLine(const GlyphMetricsVector& glyphs, TextBatchId batchId, float offsetX, float offsetY)
+    {
+        if (m_textBatches.count(batchId) != 1)
+        {
+            LOG_TEXT_ERROR("TextCache::createTextLine failed - there is no text batch " << batchId.getValue());
+            return InvalidTextLineId;
+        }
+
+        if (glyphs.empty())
+        {
+            LOG_TEXT_ERROR("TextCache::createTextLine failed - cannot create text geometry for empty string");
+            return InvalidTextLineId;
+        }
+
+        if (!registerGlyphs(glyphs))
+            return InvalidTextLineId;
+
+        const GlyphGeometry geometry = m_textureAtlas.mapGlyphsAndCreateGeometry(glyphs);
+        if (geometry.atlasPage == std::numeric_limits<decltype(geometry.atlasPage)>::max() || geometry.indices.empty())
+        {
+            LOG_TEXT_ERROR("TextCache::createTextLine failed - glyphs could not be mapped in atlas");
+            return InvalidTextLineId;
+        }
+
+        TextBatchPage* page = getOrCreateBatchPage(batchId, geometry.atlasPage);
+        if (page == nullptr)
+        {
+            m_textureAtlas.unmapGlyphsFromPage(glyphs, geometry.atlasPage);
+            return InvalidTextLineId;
+        }
+
+        const uint32_t quadCount = GetQuadCount(geometry);
+        const uint32_t quadOffset = allocateBatchPageQuads(batchId, *page, quadCount);
+        if (quadOffset == RangeAllocator::InvalidOffset)
+        {
+            m_textureAtlas.unmapGlyphsFromPage(glyphs, geometry.atlasPage);
+            return InvalidTextLineId;
+        }
+
+        writeBatchPageQuads(*page, quadOffset, geometry, offsetX, offsetY);
+
+        auto textLineId = m_textIdCounter;
+        m_textIdCounter.getReference()++;
+
+        TextLine& textLine = m_textLines[textLineId];
+        textLine.atlasPage = geometry.atlasPage;
+        textLine.glyphs = glyphs;
+        textLine.meshNode = page->meshNode;
+        textLine.indices = page->indices;
+        textLine.positions = page->positions;
+        textLine.textureCoordinates = page->textureCoordinates;
+
+        BatchedTextLine& batchedTextLine = m_batchedTextLines[textLineId];
+        batchedTextLine.batch = batchId;
+        batchedTextLine.quadOffset = quadOffset;
+        batchedTextLine.quadCount = quadCount;
+        batchedTextLine.offsetX = offsetX;
+        batchedTextLine.offsetY = offsetY;
+
+        return textLineId;
+    }
+
+    bool TextCacheImpl::setTextLineOffset(TextLineId textId, float offsetX, float offsetY)
+    {
+        const auto batchedLineIt = m_batchedTextLines.find(textId);
+        if (batchedLineIt == m_batchedTextLines.end())
+        {
+            LOG_TEXT_ERROR("TextCache::setTextLineOffset failed - text line " << textId.getValue() << " does not exist or is not part of a text batch");
+            return false;
+        }
+
+        BatchedTextLine& batchedTextLine = batchedLineIt->second;
+        const TextLine& textLine = m_textLines.find(textId)->second;
+        TextBatchPage& page = m_textBatches.find(batchedTextLine.batch)->second.pages.find(textLine.atlasPage)->second;
+
+        const float deltaX = offsetX - batchedTextLine.offsetX;
+        const float deltaY = offsetY - batchedTextLine.offsetY;
+        const uint32_t componentOffset = batchedTextLine.quadOffset * VertexComponentsPerQuad;
+        const uint32_t componentCount = batchedTextLine.quadCount * VertexComponentsPerQuad;
+        for (uint32_t i = componentOffset; i < componentOffset + componentCount; i += 2u)
+        {
+            page.positionsData[i] += deltaX;
+            page.positionsData[i + 1u] += deltaY;
+        }
+        page.positions->setData(reinterpret_cast<const char*>(&page.positionsData[componentOffset]), componentCount * sizeof(float), componentOffset * sizeof(float));
+
+        batchedTextLine.offsetX = offsetX;
+        batchedTextLine.offsetY = offsetY;
+        return true;
+    }
+
+    void TextCacheImpl::setMaximumAtlasPageCount(uint32_t maximumPageCount)
+    {
+        m_textureAtlas.setMaximumPageCount(maximumPageCount);
+    }
+
+    uint32_t TextCacheImpl::getAtlasPageCount() const
+    {
+        return static_cast<uint32_t>(m_textureAtlas.getPageCount());
+    }
+
+    uint32_t TextCacheImpl::getAtlasGlyphCount() const
+    {
+        return static_cast<uint32_t>(m_textureAtlas.getMappedGlyphCount());
+    }
+
+    bool TextCacheImpl::compactAtlas()
+    {
+        // glyphs of a text line must be on one page, text lines with most glyphs are placed first to fill pages best
+        std::vector<TextLineId> textIds;
+        textIds.reserve(m_textLines.size());
+        for (const auto& textLine : m_textLines)
+            textIds.push_back(textLine.first);
+        std::sort(textIds.begin(), textIds.end(), [this](TextLineId a, TextLineId b)
+        {
+            const size_t glyphCountA = m_textLines.find(a)->second.glyphs.size();
+            const size_t glyphCountB = m_textLines.find(b)->second.glyphs.size();
+            return glyphCountA != glyphCountB ? glyphCountA > glyphCountB : a.getValue() < b.getValue();
+        });
+
+        const GlyphTextureAtlas::MappingState previousMappingState = m_textureAtlas.getMappingState();
+        const size_t previousPageCount = m_textureAtlas.getPageCount();
+
+        // every text line fits on an empty page, but packing might need more pages than before
+        const size_t maximumPageCount = m_textureAtlas.getMaximumPageCount();
+        m_textureAtlas.setMaximumPageCount(std::numeric_limits<size_t>::max());
+        m_textureAtlas.unmapAllGlyphs();
+
+        // new geometry of all text lines is created and quads of batched text lines are reserved on their new pages
+        // before any text line is changed, so that text lines stay as they are if one of them cannot be moved
+        std::vector<GlyphGeometry> geometries;
+        std::vector<uint32_t> quadOffsets;
+        geometries.reserve(textIds.size());
+        quadOffsets.reserve(textIds.size());
+        bool prepared = true;
+        for (const auto textId : textIds)
+        {
+            const TextLine& textLine = m_textLines.find(textId)->second;
+            geometries.push_back(m_textureAtlas.mapGlyphsAndCreateGeometry(textLine.glyphs));
+            quadOffsets.push_back(RangeAllocator::InvalidOffset);
+            if (geometries.back().atlasPage == std::numeric_limits<size_t>::max())
+            {
+                LOG_TEXT_ERROR("TextCache::compactAtlas: failed to map glyphs of text line " << textId.getValue() << ", atlas is left unchanged");
+                geometries.pop_back();
+                quadOffsets.pop_back();
+                prepared = false;
+                break;
+            }
+            if (m_batchedTextLines.count(textId) != 0 && !reserveBatchedTextLineQuads(textId, textLine, geometries.back(), quadOffsets.back()))
+            {
+                LOG_TEXT_ERROR("TextCache::compactAtlas: failed to move text line " << textId.getValue() << " to atlas page " << geometries.back().atlasPage << ", atlas is left unchanged");
+                geometries.pop_back();
+                quadOffsets.pop_back();
+                prepared = false;
+                break;
+            }
+        }
+        m_textureAtlas.setMaximumPageCount(maximumPageCount);
+
+        if (!prepared)
+        {
+            for (size_t i = 0u; i < geometries.size(); ++i)
+            {
+                if (m_batchedTextLines.count(textIds[i]) != 0)
+                    releaseReservedBatchedTextLineQuads(textIds[i], m_textLines.find(textIds[i])->second, geometries[i], quadOffsets[i]);
+            }
+            destroyBatchPagesFrom(previousPageCount);
+            m_textureAtlas.restoreMappingState(previousMappingState);
+            return false;
+        }
+
+        for (size_t i = 0u; i < textIds.size(); ++i)
+        {
+            TextLine& textLine = m_textLines.find(textIds[i])->second;
+            if (m_batchedTextLines.count(textIds[i]) != 0)
+                writeBatchedTextLineQuads(textIds[i], textLine, geometries[i], quadOffsets[i]);
+            else
+                updateTextLineTextureCoordinates(textLine, geometries[i]);
+            textLine.atlasPage = geometries[i].atlasPage;
+        }
+
+        // meshes of text batches on removed pages are empty now, they use the page textures
+        const size_t usedPageCount = m_textureAtlas.getUsedPageCount();
+        destroyBatchPagesFrom(usedPageCount);
+        m_textureAtlas.removePagesAtEnd(usedPageCount);
+
+        return true;
+    }
+
+    void TextCacheImpl::destroyBatchPagesFrom(size_t atlasPage)
+    {
+        for (auto& batchData : m_textBatches)
+        {
+            auto& pages = batchData.second.pages;
+            for (auto pageIt = pages.begin(); pageIt != pages.end();)
+            {
+                if (pageIt->first < atlasPage)
+                {
+                    ++pageIt;
+                    continue;
+                }
+
+                auto& meshNodes = batchData.second.batch.meshNodes;
+                meshNodes.erase(std::find(meshNodes.begin(), meshNodes.end(), pageIt->second.meshNode));
+                destroyBatchPage(pageIt->second);
+                pageIt = pages.erase(pageIt);
+            }
+        }
+    }
+
+    void TextCacheImpl::updateTextLineTextureCoordinates(TextLine& textLine, const GlyphGeometry& geometry)
+    {
+        // glyphs and so their positions stay the same
+        textLine.textureCoordinates->setData(reinterpret_cast<const char*>(geometry.texcoords.data()), static_cast<uint32_t>(geometry.texcoords.size() * sizeof(float)));
+
+        if (geometry.atlasPage != textLine.atlasPage)
+        {
+            Appearance& appearance = *textLine.meshNode->getAppearance();
+            UniformInput texInput;
+            appearance.getEffect().findUniformInput(EEffectUniformSemantic_TextTexture, texInput);
+            appearance.setInputTexture(texInput, m_textureAtlas.getTextureSampler(geometry.atlasPage));
+        }
+    }
+
+    TextCacheImpl::TextBatchPage* TextCacheImpl::getOrCreateBatchPage(TextBatchId batchId, size_t atlasPage)
+    {
+        TextBatchData& batchData = m_textBatches.find(batchId)->second;
+        const auto pageIt = batchData.pages.find(atlasPage);
+        if (pageIt != batchData.pages.end())
+            return &pageIt->second;
+
+        GeometryBinding* geometryBinding = m_scene.createGeometryBinding(*batchData.effect);
+        Appearance* appearance = m_scene.createAppearance(*batchData.effect);
+        if (geometryBinding == nullptr || appearance == nullptr)
+        {
+            LOG_TEXT_ERROR("TextCache::createTextLine failed - failed to create geometry binding and/or appearance, check Ramses logs for more details");
+            if (geometryBinding != nullptr)
+                m_scene.destroy(*geometryBinding);
+            if (appearance != nullptr)
+                m_scene.destroy(*appearance);
+            return nullptr;
+        }
+
+        UniformInput texInput;
+        batchData.effect->findUniformInput(EEffectUniformSemantic_TextTexture, texInput);
+        appearance->setInputTexture(texInput, m_textureAtlas.getTextureSampler(atlasPage));
+
+        TextBatchPage& page = batchData.pages[atlasPage];
+        page.geometryBinding = geometryBinding;
+        page.appearance = appearance;
+        if (!growBatchPage(batchId, page, InitialTextBatchPageCapacity))
+        {
+            m_scene.destroy(*geometryBinding);
+            m_scene.destroy(*appearance);
+            batchData.pages.erase(atlasPage);
+            return nullptr;
+        }
+
+        page.meshNode = m_scene.createMeshNode();
+        if (page.meshNode == nullptr)
+        {
+            LOG_TEXT_ERROR("TextCache::createTextLine failed - failed to create mesh node for text batch, check Ramses logs for more details");
+            m_scene.destroy(*geometryBinding);
+            m_scene.destroy(*appearance);
+            destroyBatchPageBuffers(page);
+            batchData.pages.erase(atlasPage);
+            return nullptr;
+        }
+        page.meshNode->setAppearance(*appearance);
+        page.meshNode->setGeometryBinding(*geometryBinding);
+        page.meshNode->setStartIndex(0);
+        page.meshNode->setIndexCount(0);
+        batchData.batch.rootNode->addChild(*page.meshNode);
+        batchData.batch.meshNodes.push_back(page.meshNode);
+
+        return &page;
+    }
+
+    bool TextCacheImpl::growBatchPage(TextBatchId batchId, TextBatchPage& page, uint32_t minimumCapacity)
+    {
+        const uint32_t capacity = std::max(page.quads.getCapacity() * 2u, minimumCapacity);
+        VertexDataBuffer* positions = m_scene.createVertexDataBuffer(capacity * VertexComponentsPerQuad * sizeof(float), ramses::EDataType_Vector2F, "");
+        VertexDataBuffer* textureCoordinates = m_scene.createVertexDataBuffer(capacity * VertexComponentsPerQuad * sizeof(float), ramses::EDataType_Vector2F, "");
+        IndexDataBuffer* indices = m_scene.createIndexDataBuffer(capacity * IndicesPerQuad * sizeof(uint32_t), ramses::EDataType_UInt32, "");
+        if (positions == nullptr || textureCoordinates == nullptr || indices == nullptr)
+        {
+            LOG_TEXT_ERROR("TextCache::createTextLine failed - failed to create data buffers for text batch, check Ramses logs for more details");
+            if (positions != nullptr)
+                m_scene.destroy(*positions);
+            if (textureCoordinates != nullptr)
+                m_scene.destroy(*textureCoordinates);
+            if (indices != nullptr)
+                m_scene.destroy(*indices);
+            return false;
+        }
+
+        page.positionsData.resize(capacity * VertexComponentsPerQuad, 0.f);
+        page.textureCoordinatesData.resize(capacity * VertexComponentsPerQuad, 0.f);
+        page.indicesData.resize(capacity * IndicesPerQuad, 0u);
+
+        // fill new buffers with all previous contents, also free ranges, so that buffers and
+        // client side copy are equal and only changed quads have to be uploaded later
+        const uint32_t previousCapacity = page.quads.getCapacity();
+        if (previousCapacity > 0u)
+        {
+            positions->setData(reinterpret_cast<const char*>(page.positionsData.data()), previousCapacity * VertexComponentsPerQuad * sizeof(float));
+            textureCoordinates->setData(reinterpret_cast<const char*>(page.textureCoordinatesData.data()), previousCapacity * VertexComponentsPerQuad * sizeof(float));
+            indices->setData(reinterpret_cast<const char*>(page.indicesData.data()), previousCapacity * IndicesPerQuad * sizeof(uint32_t));
+        }
+
+        const Effect& effect = *m_textBatches.find(batchId)->second.effect;
+        AttributeInput posInput;
+        AttributeInput texCoordInput;
+        effect.findAttributeInput(EEffectAttributeSemantic_TextPositions, posInput);
+        effect.findAttributeInput(EEffectAttributeSemantic_TextTextureCoordinates, texCoordInput);
+        page.geometryBinding->setIndices(*indices);
+        page.geometryBinding->setInputBuffer(posInput, *positions);
+        page.geometryBinding->setInputBuffer(texCoordInput, *textureCoordinates);
+
+        destroyBatchPageBuffers(page);
+        page.positions = positions;
+        page.textureCoordinates = textureCoordinates;
+        page.indices = indices;
+        page.quads.grow(capacity);
+
+        // text lines on this page refer to the shared buffers
+        if (page.meshNode != nullptr)
+        {
+            for (auto& textLine : m_textLines)
+            {
+                if (textLine.second.meshNode == page.meshNode)
+                {
+                    textLine.second.positions = positions;
+                    textLine.second.textureCoordinates = textureCoordinates;
+                    textLine.second.indices = indices;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    uint32_t TextCacheImpl::allocateBatchPageQuads(TextBatchId batchId, TextBatchPage& page, uint32_t quadCount)
+    {
+        uint32_t quadOffset = page.quads.allocate(quadCount);
+        if (quadOffset == RangeAllocator::InvalidOffset && growBatchPage(batchId, page, page.quads.getCapacity() + quadCount))
+        {
+            quadOffset = page.quads.allocate(quadCount);
+            assert(quadOffset != RangeAllocator::InvalidOffset);
+        }
+
+        return quadOffset;
+    }
+
+    void TextCacheImpl::writeBatchPageQuads(TextBatchPage& page, uint32_t quadOffset, const GlyphGeometry& geometry, float offsetX, float offsetY)
+    {
+        // only the range from first to last quad which differs from current data is uploaded,
+        // e.g. when few characters of a text line change
+        const uint32_t quadCount = GetQuadCount(geometry);
+        const uint32_t firstVertex = quadOffset * VerticesPerQuad;
+        uint32_t firstChangedQuad = quadCount;
+        uint32_t changedQuadsEnd = 0u;
+        for (uint32_t quad = 0u; quad < quadCount; ++quad)
+        {
+            bool changed = false;
+            for (uint32_t i = 0u; i < VertexComponentsPerQuad; ++i)
+            {
+                const uint32_t srcIndex = quad * VertexComponentsPerQuad + i;
+                const uint32_t dstIndex = quadOffset * VertexComponentsPerQuad + srcIndex;
+                const float position = geometry.positions[srcIndex] + (i % 2u == 0u ? offsetX : offsetY);
+                changed |= (page.positionsData[dstIndex] != position) || (page.textureCoordinatesData[dstIndex] != geometry.texcoords[srcIndex]);
+                page.positionsData[dstIndex] = position;
+                page.textureCoordinatesData[dstIndex] = geometry.texcoords[srcIndex];
+            }
+            for (uint32_t i = 0u; i < IndicesPerQuad; ++i)
+            {
+                const uint32_t srcIndex = quad * IndicesPerQuad + i;
+                const uint32_t dstIndex = quadOffset * IndicesPerQuad + srcIndex;
+                const uint32_t index = firstVertex + geometry.indices[srcIndex];
+                changed |= (page.indicesData[dstIndex] != index);
+                page.indicesData[dstIndex] = index;
+            }
+
+            if (changed)
+            {
+                firstChangedQuad = std::min(firstChangedQuad, quad);
+                changedQuadsEnd = quad + 1u;
+            }
+        }
+
+        if (firstChangedQuad < changedQuadsEnd)
+            uploadBatchPageQuads(page, quadOffset + firstChangedQuad, changedQuadsEnd - firstChangedQuad);
+        page.meshNode->setIndexCount(page.quads.getUsedEnd() * IndicesPerQuad);
+    }
+
+    void TextCacheImpl::releaseBatchPageQuads(TextBatchPage& page, uint32_t quadOffset, uint32_t quadCount)
+    {
+        // released quads become degenerate triangles, they are not drawn until the range is reused
+        const uint32_t indexOffset = quadOffset * IndicesPerQuad;
+        const uint32_t indexCount = quadCount * IndicesPerQuad;
+        std::fill_n(page.indicesData.begin() + indexOffset, indexCount, 0u);
+        page.indices->setData(reinterpret_cast<const char*>(&page.indicesData[indexOffset]), indexCount * sizeof(uint32_t), indexOffset * sizeof(uint32_t));
+
+        page.quads.release(quadOffset, quadCount);
+        page.meshNode->setIndexCount(page.quads.getUsedEnd() * IndicesPerQuad);
+    }
+
+    void TextCacheImpl::uploadBatchPageQuads(TextBatchPage& page, uint32_t quadOffset, uint32_t quadCount)
+    {
+        const uint32_t componentOffset = quadOffset * VertexComponentsPerQuad;
+        const uint32_t componentCount = quadCount * VertexComponentsPerQuad;
+        page.positions->setData(reinterpret_cast<const char*>(&page.positionsData[componentOffset]), componentCount * sizeof(float), componentOffset * sizeof(float));
+        page.textureCoordinates->setData(reinterpret_cast<const char*>(&page.textureCoordinatesData[componentOffset]), componentCount * sizeof(float), componentOffset * sizeof(float));
+
+        const uint32_t indexOffset = quadOffset * IndicesPerQuad;
+        const uint32_t indexCount = quadCount * IndicesPerQuad;
+        page.indices->setData(reinterpret_cast<const char*>(&page.indicesData[indexOffset]), indexCount * sizeof(uint32_t), indexOffset * sizeof(uint32_t));
+    }
+
+    void TextCacheImpl::releaseBatchedTextLine(TextLineId textId)
+    {
+        const auto batchedLineIt = m_batchedTextLines.find(textId);
+        assert(batchedLineIt != m_batchedTextLines.end());
+        const BatchedTextLine& batchedTextLine = batchedLineIt->second;
+        const size_t atlasPage = m_textLines.find(textId)->second.atlasPage;
+        TextBatchPage& page = m_textBatches.find(batchedTextLine.batch)->second.pages.find(atlasPage)->second;
+        releaseBatchPageQuads(page, batchedTextLine.quadOffset, batchedTextLine.quadCount);
+
+        m_batchedTextLines.erase(batchedLineIt);
+    }
+
+    void TextCacheImpl::destroyBatchPage(TextBatchPage& page)
+    {
+        m_scene.destroy(*page.meshNode);
+        m_scene.destroy(*page.geometryBinding);
+        m_scene.destroy(*page.appearance);
+        destroyBatchPageBuffers(page);
+    }
+
+    void TextCacheImpl::destroyBatchPageBuffers(TextBatchPage& page)
+    {
+        if (page.positions != nullptr)
+            m_scene.destroy(*page.positions);
+        if (page.textureCoordinates != nullptr)
+            m_scene.destroy(*page.textureCoordinates);
+        if (page.indices != nullptr)
+            m_scene.destroy(*page.indices);
+        page.positions = nullptr;
+        page.textureCoordinates = nullptr;
+        page.indices = nullptr;
+    }
 }
@@ -50,6 +50,11 @@ namespace ramses
         return impl.createFreetype2FontInstanceWithHarfBuzz(fontId, size, forceAutohinting);
     }
 
+    FontInstanceId FontRegistry::createFreetype2FontInstanceSDF(FontId fontId, uint32_t size)
+    {
+        return impl.createFreetype2FontInstanceSDF(fontId, size);
+    }
+
     bool FontRegistry::deleteFontInstance(FontInstanceId fontInstance)
     {
         return impl.deleteFontInstance(fontInstance);
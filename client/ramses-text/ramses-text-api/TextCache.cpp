@@ -31,6 +31,26 @@ namespace ramses
         return impl->getPositionedGlyphs(str, font);
     }
 
+    void TextCache::setShapingCacheCapacity(uint32_t capacity)
+    {
+        impl->setShapingCacheCapacity(capacity);
+    }
+
+    void TextCache::clearShapingCache()
+    {
+        impl->clearShapingCache();
+    }
+
+    ShapingCacheStatistics TextCache::getShapingCacheStatistics() const
+    {
+        return impl->getShapingCacheStatistics();
+    }
+
+    bool TextCache::preloadGlyphs(const GlyphMetricsVector& glyphs, uint32_t maxThreads)
+    {
+        return impl->preloadGlyphs(glyphs, maxThreads);
+    }
+
     TextLineId TextCache::createTextLine(const GlyphMetricsVector& glyphs, const Effect& effect)
     {
         return impl->createTextLine(glyphs, effect);
@@ -50,4 +70,49 @@ namespace ramses
     {
         return impl->deleteTextLine(textId);
     }
+
+    bool TextCache::updateTextLine(TextLineId textId, const GlyphMetricsVector& glyphs)
+    {
+        return impl->updateTextLine(textId, glyphs);
+    }
+
+    TextBatchId TextCache::createTextBatch(const Effect& effect)
+    {
+        return impl->createTextBatch(effect);
+    }
+
+    TextBatch const* TextCache::getTextBatch(TextBatchId batchId) const
+    {
+        return impl->getTextBatch(batchId);
+    }
+
+    bool TextCache::deleteTextBatch(TextBatchId batchId)
+    {
+        return impl->deleteTextBatch(batchId);
+    }
+
+    TextLineId TextCache::createTextLine(const GlyphMetricsVector& glyphs, TextBatchId batchId, float offsetX, float offsetY)
+    {
+        return impl->createTextLine(glyphs, batchId, offsetX, offsetY);
+    }
+
+    bool TextCache::setTextLineOffset(TextLineId textId, float offsetX, float offsetY)
+    {
+        return impl->setTextLineOffset(textId, offsetX, offsetY);
+    }
+
+    void TextCache::setMaximumAtlasPageCount(uint32_t maximumPageCount)
+    {
+        impl->setMaximumAtlasPageCount(maximumPageCount);
+    }
+
+    uint32_t TextCache::getAtlasPageCount() const
+    {
+        return impl->getAtlasPageCount();
+    }
+
+    bool TextCache::compactAtlas()
+    {
+        return impl->compactAtlas();
+    }
 }
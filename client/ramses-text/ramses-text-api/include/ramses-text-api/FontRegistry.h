@@ -67,8 +67,26 @@ namespace ramses
         */
         FontInstanceId          createFreetype2FontInstanceWithHarfBuzz(FontId fontId, uint32_t size, bool forceAutohinting = false);
 
+        /**
+        * @brief Create Freetype2 font instance providing signed distance field (SDF) glyphs
+        *
+        * All SDF font instances of a font share the same glyphs: these are rasterized once in a reference size
+        * and stored as signed distance fields, which are scaled to the size of the font instance when rendered.
+        * Text lines of any number of sizes thus need only one atlas entry per glyph.
+        * The text lines must be rendered with an effect which evaluates the distance field,
+        * see RamsesUtils::CreateSDFTextEffect. The glyph keys of SDF font instances reference the font instance
+        * holding the shared glyphs, it is owned by FontRegistry and deleted together with the font.
+        * Therefore the font cannot be deleted as long as any of its SDF font instances exists.
+        *
+        * @param[in] fontId The id of the font from which to create a font instance
+        * @param[in] size Size (height in texels of the text line) of the font
+        * @return The font instance id, InvalidFontInstanceId on error
+        */
+        FontInstanceId          createFreetype2FontInstanceSDF(FontId fontId, uint32_t size);
+
         /**
         * @brief Delete an existing font
+        *        Fails if SDF font instances created from the font still exist, they have to be deleted first.
         *
         * @param[in] fontId The id of the font to be deleted
         * @return True on success, false otherwise
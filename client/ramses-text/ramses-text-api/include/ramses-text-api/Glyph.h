@@ -22,6 +22,22 @@ namespace ramses
     */
     using GlyphData = std::vector<uint8_t>;
 
+    /**
+    * @brief Glyph pixel data together with its dimensions
+    */
+    struct GlyphBitmap
+    {
+        /// Pixel data, one byte per pixel
+        GlyphData data;
+        /// Width of the pixel data
+        uint32_t width = 0u;
+        /// Height of the pixel data
+        uint32_t height = 0u;
+    };
+
+    /// Vector of GlyphBitmap elements
+    using GlyphBitmaps = std::vector<GlyphBitmap>;
+
     /**
     * @brief An empty struct to make GlyphId a strong type
     */
@@ -67,6 +67,24 @@ namespace ramses
         * @return The glyph data if glyphId is found, or empty glyph data otherwise
         */
         virtual GlyphData loadGlyphBitmapData(GlyphId glyphId, uint32_t& sizeX, uint32_t& sizeY) = 0;
+
+        /**
+        * @brief Load the glyph data of many glyphs at once
+        *
+        * The default implementation loads the glyphs one after another using loadGlyphBitmapData,
+        * font instances can override it to load the glyphs concurrently.
+        *
+        * @param[in] glyphIds Ids of glyphs for which to load data
+        * @param[in] maxThreads Maximum number of threads the font instance may use for loading
+        * @param[out] bitmaps The glyph data in order of glyphIds, empty glyph data for glyph ids which are not found
+        */
+        virtual void loadGlyphBitmaps(const std::vector<GlyphId>& glyphIds, uint32_t maxThreads, GlyphBitmaps& bitmaps)
+        {
+            (void)maxThreads;
+            bitmaps.resize(glyphIds.size());
+            for (size_t i = 0u; i < glyphIds.size(); ++i)
+                bitmaps[i].data = loadGlyphBitmapData(glyphIds[i], bitmaps[i].width, bitmaps[i].height);
+        }
     };
 }
 
@@ -0,0 +1,32 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SHAPINGCACHESTATISTICS_H
+#define RAMSES_SHAPINGCACHESTATISTICS_H
+
+#include <stdint.h>
+
+namespace ramses
+{
+    /**
+    * @brief Usage statistics of the cache of positioned glyphs in TextCache (see TextCache::setShapingCacheCapacity)
+    */
+    struct ShapingCacheStatistics
+    {
+        /// Number of requests for positioned glyphs answered from the cache
+        uint64_t hits = 0u;
+        /// Number of requests for positioned glyphs which had to be shaped by the font instances
+        uint64_t misses = 0u;
+        /// Number of strings currently stored in the cache
+        uint32_t entries = 0u;
+        /// Maximum number of strings stored in the cache
+        uint32_t capacity = 0u;
+    };
+}
+
+#endif
@@ -0,0 +1,53 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TEXTBATCH_H
+#define RAMSES_TEXTBATCH_H
+
+#include "ramses-framework-api/StronglyTypedValue.h"
+#include <vector>
+#include <limits>
+
+namespace ramses
+{
+    /**
+    * @brief An empty struct to make TextBatchId a strong type
+    */
+    struct TextBatchIdTag {};
+
+    /**
+    * @brief A strongly typed integer to distinguish between different text batches
+    */
+    using TextBatchId = StronglyTypedValue<uint32_t, TextBatchIdTag>;
+
+    /**
+    * @brief A constant value representing an invalid TextBatchId
+    */
+    static const TextBatchId InvalidTextBatchId(std::numeric_limits<TextBatchId::BaseType>::max());
+
+    class Node;
+    class MeshNode;
+
+    /**
+    * @brief Groups the scene objects needed to render all text lines of a text batch.
+    *
+    * All text lines of a batch which are mapped to the same atlas page share one mesh node
+    * and its data buffers, so a batch is rendered with one draw call per used atlas page.
+    */
+    struct TextBatch
+    {
+        /// Parent node of all mesh nodes of the batch, use it to place the batch in the scene
+        Node*                    rootNode = nullptr;
+        /// Mesh nodes of the batch, one per atlas page used by its text lines. A mesh node is added
+        /// when a text line is the first one of the batch on an atlas page, it is kept until the batch is deleted
+        /// or the atlas page is removed by TextCache::compactAtlas().
+        std::vector<MeshNode*>   meshNodes;
+    };
+}
+
+#endif
@@ -10,7 +10,9 @@
 #define RAMSES_TEXTCACHE_H
 
 #include "ramses-text-api/TextLine.h"
+#include "ramses-text-api/TextBatch.h"
 #include "ramses-text-api/FontInstanceOffsets.h"
+#include "ramses-text-api/ShapingCacheStatistics.h"
 #include <string>
 
 namespace ramses
@@ -68,6 +70,47 @@ namespace ramses
         */
         GlyphMetricsVector      getPositionedGlyphs(const std::u32string& str, const FontInstanceOffsets& fontOffsets);
 
+        /**
+        * @brief Set the number of strings for which positioned glyphs are cached
+        *
+        * getPositionedGlyphs returns the glyph metrics of a string laid out before with the same font instances
+        * (and offsets) from the cache, without shaping it again. When the cache is full, the least recently
+        * requested string is removed. The cache is disabled by default (capacity 0), setting capacity 0 clears it.
+        * Entries of a font instance are removed when the font instance is requested and is not available
+        * at the font accessor anymore, e.g. after FontRegistry::deleteFontInstance.
+        * The cache must be cleared (see clearShapingCache) when a font instance used before is replaced
+        * by a different one with the same id at the font accessor.
+        *
+        * @param[in] capacity Maximum number of cached strings
+        */
+        void                    setShapingCacheCapacity(uint32_t capacity);
+
+        /**
+        * @brief Remove all strings from the cache of positioned glyphs, the statistics are kept
+        */
+        void                    clearShapingCache();
+
+        /**
+        * @brief Get hit/miss statistics and current size of the cache of positioned glyphs
+        * @return The cache statistics
+        */
+        ShapingCacheStatistics  getShapingCacheStatistics() const;
+
+        /**
+        * @brief Rasterize glyphs and store them in the texture atlas in advance, e.g. all glyphs of a newly selected language
+        *
+        * Glyphs which were not loaded before are rasterized by their font instances in one call per font instance,
+        * which may use multiple threads (see IFontInstance::loadGlyphBitmaps). The glyphs are then put on atlas pages,
+        * the texture of every page is updated only once for all glyphs. Preloaded glyphs stay in the atlas until they are evicted
+        * (see setMaximumAtlasPageCount), creating text lines using them later needs no rasterization and texture update if all
+        * glyphs of a text line are on the same page. No new pages are created beyond the maximum atlas page count.
+        *
+        * @param[in] glyphs The glyph metrics of the glyphs to preload (e.g. from getPositionedGlyphs), duplicates are ignored
+        * @param[in] maxThreads Maximum number of threads a font instance may use for rasterization
+        * @return True on success, false if a font instance of the glyphs is not found (no glyphs are loaded then)
+        */
+        bool                    preloadGlyphs(const GlyphMetricsVector& glyphs, uint32_t maxThreads);
+
         /**
         * @brief Create the scene objects, e.g., mesh and appearance...etc, needed for rendering a text line (represented by glyph metrics)
         * @param[in] glyphs The glyph metrics for which to create a text line
@@ -97,6 +140,109 @@ namespace ramses
         */
         bool                    deleteTextLine(TextLineId textId);
 
+        /**
+        * @brief Update an existing text line with new glyphs (e.g. changed string) reusing its scene objects
+        *
+        * Mesh node, appearance and geometry binding of the text line stay the same, only quads which changed
+        * are written to its data buffers. The data buffers are replaced by larger ones only if the new glyphs
+        * do not fit, new buffers leave space for further growth. The glyphs are mapped to the atlas page of the
+        * text line if possible, otherwise the texture of the text line appearance is changed.
+        * A text line of a text batch keeps its offset within the batch.
+        * If the update fails, the text line stays unchanged.
+        *
+        * @param[in] textId Id of the text line object to update
+        * @param[in] glyphs The new glyph metrics of the text line
+        * @return True on success, false otherwise
+        */
+        bool                    updateTextLine(TextLineId textId, const GlyphMetricsVector& glyphs);
+
+        /**
+        * @brief Create a text batch which renders many text lines using the same effect with only few scene objects.
+        *
+        * Every text line created in the batch does not get own mesh, appearance and data buffers, instead its
+        * quads are stored in data buffers shared by all text lines of the batch on the same atlas page.
+        * This way all text lines of a batch are rendered with one draw call per atlas page. The data buffers
+        * are enlarged when needed, creating or deleting a text line updates only its own part of the buffers.
+        * Use text batches for many short lived or static labels, text lines which have to be
+        * transformed individually need their own mesh (see createTextLine(const GlyphMetricsVector&, const Effect&)).
+        *
+        * @param[in] effect The effect used for creating the appearances of the batch meshes, it must stay valid
+        *                   until the batch is deleted
+        * @return Id of the text batch created, InvalidTextBatchId on failure
+        */
+        TextBatchId             createTextBatch(const Effect& effect);
+
+        /**
+        * @brief Get a const pointer to a (previously created) text batch object
+        * @param[in] batchId Id of the text batch object to get
+        * @return A pointer to the text batch object, or nullptr on failure
+        */
+        TextBatch const*        getTextBatch(TextBatchId batchId) const;
+
+        /**
+        * @brief Delete an existing text batch object together with all its text lines
+        * @param[in] batchId Id of the text batch object to delete
+        * @return True on success, false otherwise
+        */
+        bool                    deleteTextBatch(TextBatchId batchId);
+
+        /**
+        * @brief Create a text line (represented by glyph metrics) in a text batch
+        *
+        * The text line is placed at the given offset within the text batch, it can be deleted
+        * using deleteTextLine() like any other text line.
+        *
+        * @param[in] glyphs The glyph metrics for which to create a text line
+        * @param[in] batchId Id of the text batch to add the text line to
+        * @param[in] offsetX Offset of the text line origin on x-axis relative to the batch root node
+        * @param[in] offsetY Offset of the text line origin on y-axis relative to the batch root node
+        * @return Id of the text line created
+        */
+        TextLineId              createTextLine(const GlyphMetricsVector& glyphs, TextBatchId batchId, float offsetX, float offsetY);
+
+        /**
+        * @brief Move a text line within its text batch, only the vertex data of that text line is updated
+        * @param[in] textId Id of the text line, it must be part of a text batch
+        * @param[in] offsetX New offset of the text line origin on x-axis relative to the batch root node
+        * @param[in] offsetY New offset of the text line origin on y-axis relative to the batch root node
+        * @return True on success, false otherwise
+        */
+        bool                    setTextLineOffset(TextLineId textId, float offsetX, float offsetY);
+
+        /**
+        * @brief Limit the number of texture atlas pages, e.g. to keep texture memory bounded in long running applications
+        *
+        * Glyphs stay on their atlas page when no text line uses them anymore, so that text lines created later can reuse them.
+        * When new glyphs fit on no page and the limit is reached, such unused glyphs are evicted, least recently used first,
+        * until the glyphs fit. Creating or updating a text line fails if they do not fit even then.
+        * By default the number of pages is not limited. Lowering the limit does not remove existing pages, see compactAtlas.
+        *
+        * @param[in] maximumPageCount Maximum number of atlas pages
+        */
+        void                    setMaximumAtlasPageCount(uint32_t maximumPageCount);
+
+        /**
+        * @brief Get the number of texture atlas pages, every page is one texture
+        * @return Number of atlas pages
+        */
+        uint32_t                getAtlasPageCount() const;
+
+        /**
+        * @brief Repack the glyphs of all text lines into as few atlas pages as possible
+        *
+        * Deleting and updating text lines fragments atlas pages over time, so new text lines need new pages, i.e. more
+        * textures and draw calls. Compaction evicts all glyphs not used by any text line, puts the glyphs of all text lines
+        * on the pages again and removes the pages at the end which are not needed anymore. Atlas page and texture coordinates
+        * of text lines are updated, text lines of text batches may move to another mesh node of their batch and mesh nodes
+        * of text batches on removed pages are destroyed. All glyphs are uploaded again, so compaction should be done rarely.
+        *
+        * All text lines are placed before any of them is changed. If one cannot be moved, e.g. because creating a mesh node
+        * of its text batch fails, compaction is abandoned and atlas and text lines stay as they were.
+        *
+        * @return True on success, false if a text line could not be moved and nothing was changed
+        */
+        bool                    compactAtlas();
+
         /**
         * Stores internal data for implementation specifics of TextCache.
         */
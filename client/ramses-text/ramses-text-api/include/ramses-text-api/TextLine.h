@@ -35,6 +35,10 @@ namespace ramses
 
     /**
     * @brief Groups the scene objects needed to render a text line
+    *
+    * For a text line created in a text batch the mesh node and data buffers are shared with all other
+    * text lines of the batch on the same atlas page. They must not be modified directly and they are
+    * replaced by larger ones when the batch grows, so they should not be stored.
     */
     struct TextLine
     {
@@ -16,6 +16,8 @@
 #include "ramses-text-api/GlyphMetrics.h"
 #include "ramses-text-api/IFontAccessor.h"
 #include "ramses-text-api/IFontInstance.h"
+#include "ramses-text-api/ShapingCacheStatistics.h"
+#include "ramses-text-api/TextBatch.h"
 #include "ramses-text-api/TextCache.h"
 #include "ramses-text-api/TextLine.h"
 #include "ramses-text-api/UtfUtils.h"
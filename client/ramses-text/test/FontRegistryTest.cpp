@@ -178,4 +178,60 @@ namespace ramses
         const FontInstanceId fontInstanceId = m_fontRegistry.createFreetype2FontInstanceWithHarfBuzz(fontId, 12u);
         EXPECT_EQ(InvalidFontInstanceId, fontInstanceId);
     }
+
+    TEST_F(AFontRegistry, CreatesAndDestroysSDFFontInstancesFromFile)
+    {
+        const FontId fontId = m_fontRegistry.createFreetype2Font("./res/ramses-text-Roboto-Bold.ttf");
+        ASSERT_NE(InvalidFontId, fontId);
+        const FontInstanceId fontInstanceId1 = m_fontRegistry.createFreetype2FontInstanceSDF(fontId, 12u);
+        const FontInstanceId fontInstanceId2 = m_fontRegistry.createFreetype2FontInstanceSDF(fontId, 40u);
+        ASSERT_NE(InvalidFontInstanceId, fontInstanceId1);
+        ASSERT_NE(InvalidFontInstanceId, fontInstanceId2);
+        EXPECT_NE(fontInstanceId1, fontInstanceId2);
+        EXPECT_TRUE(nullptr != m_fontAccessor.getFontInstance(fontInstanceId1));
+        EXPECT_TRUE(nullptr != m_fontAccessor.getFontInstance(fontInstanceId2));
+
+        EXPECT_TRUE(m_fontRegistry.deleteFontInstance(fontInstanceId1));
+        EXPECT_TRUE(m_fontRegistry.deleteFontInstance(fontInstanceId2));
+        EXPECT_TRUE(m_fontRegistry.deleteFont(fontId));
+    }
+
+    TEST_F(AFontRegistry, DeletesFontInstanceProvidingSDFGlyphsOnlyWithFont)
+    {
+        const FontId fontId = m_fontRegistry.createFreetype2Font("./res/ramses-text-Roboto-Bold.ttf");
+        ASSERT_NE(InvalidFontId, fontId);
+        const FontInstanceId fontInstanceId = m_fontRegistry.createFreetype2FontInstanceSDF(fontId, 12u);
+        ASSERT_NE(InvalidFontInstanceId, fontInstanceId);
+
+        std::u32string str = U"a";
+        GlyphMetricsVector glyphs;
+        m_fontAccessor.getFontInstance(fontInstanceId)->loadAndAppendGlyphMetrics(str.cbegin(), str.cend(), glyphs);
+        ASSERT_EQ(1u, glyphs.size());
+        const FontInstanceId referenceInstanceId = glyphs.front().key.fontInstanceId;
+        EXPECT_NE(fontInstanceId, referenceInstanceId);
+        EXPECT_TRUE(nullptr != m_fontAccessor.getFontInstance(referenceInstanceId));
+
+        EXPECT_FALSE(m_fontRegistry.deleteFontInstance(referenceInstanceId));
+        EXPECT_FALSE(m_fontRegistry.deleteFont(fontId));
+        EXPECT_TRUE(nullptr != m_fontAccessor.getFontInstance(referenceInstanceId));
+        EXPECT_TRUE(m_fontRegistry.deleteFontInstance(fontInstanceId));
+        EXPECT_TRUE(nullptr != m_fontAccessor.getFontInstance(referenceInstanceId));
+
+        EXPECT_TRUE(m_fontRegistry.deleteFont(fontId));
+        EXPECT_TRUE(nullptr == m_fontAccessor.getFontInstance(referenceInstanceId));
+    }
+
+    TEST_F(AFontRegistry, FailsToCreateSDFFontInstanceFromInvalidFont)
+    {
+        const FontInstanceId fontInstanceId = m_fontRegistry.createFreetype2FontInstanceSDF(FontId(15u), 12u);
+        EXPECT_EQ(InvalidFontInstanceId, fontInstanceId);
+    }
+
+    TEST_F(AFontRegistry, FailsToCreateSDFFontInstanceWithZeroSize)
+    {
+        const FontId fontId = m_fontRegistry.createFreetype2Font("./res/ramses-text-Roboto-Bold.ttf");
+        ASSERT_NE(InvalidFontId, fontId);
+        EXPECT_EQ(InvalidFontInstanceId, m_fontRegistry.createFreetype2FontInstanceSDF(fontId, 0u));
+        EXPECT_TRUE(m_fontRegistry.deleteFont(fontId));
+    }
 }
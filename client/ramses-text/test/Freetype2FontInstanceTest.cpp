@@ -205,4 +205,32 @@ namespace ramses
     {
         EXPECT_FALSE(FontInstance10->supportsCharacter(0x19aa));
     }
+
+    TEST_F(AFreetype2FontInstance, LoadsGlyphBitmapsConcurrentlyIdenticalToLoadingThemOneByOne)
+    {
+        const auto fontId = FRegistry->createFreetype2Font("res/ramses-text-Roboto-Bold.ttf");
+        auto& concurrentInstance = static_cast<Freetype2FontInstance&>(*FRegistry->getFontInstance(FRegistry->createFreetype2FontInstance(fontId, 14)));
+        auto& serialInstance = static_cast<Freetype2FontInstance&>(*FRegistry->getFontInstance(FRegistry->createFreetype2FontInstance(fontId, 14)));
+
+        const GlyphMetricsVector glyphs = getPositionedGlyphs(U"abcdefgh12345!a", serialInstance);
+        std::vector<GlyphId> glyphIds;
+        for (const auto& glyph : glyphs)
+            glyphIds.push_back(glyph.key.identifier);
+        glyphIds.push_back(GlyphId(0x7fffffff));
+
+        GlyphBitmaps bitmaps;
+        concurrentInstance.loadGlyphBitmaps(glyphIds, 4u, bitmaps);
+        ASSERT_EQ(glyphIds.size(), bitmaps.size());
+
+        for (size_t i = 0u; i < glyphs.size(); ++i)
+        {
+            uint32_t width = 0u;
+            uint32_t height = 0u;
+            const GlyphData data = serialInstance.loadGlyphBitmapData(glyphIds[i], width, height);
+            EXPECT_EQ(width, bitmaps[i].width);
+            EXPECT_EQ(height, bitmaps[i].height);
+            EXPECT_EQ(data, bitmaps[i].data);
+        }
+        EXPECT_TRUE(bitmaps.back().data.empty());
+    }
 }
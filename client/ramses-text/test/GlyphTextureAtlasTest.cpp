@@ -446,4 +446,250 @@ namespace ramses
         // TODO(Violin) does not work yet
         //EXPECT_EQ(0u, geometry4.atlasPage);
     }
+
+    TEST_F(AGlyphTextureAtlas, MapsGlyphsToPreferredPageIfTheyFit)
+    {
+        const GlyphMetricsVector glyphsA = { { GlyphKey(GlyphId('a'), FakeFontId), 10, 3, 0, 0, 0 } };
+        const GlyphMetricsVector glyphsB = { { GlyphKey(GlyphId('b'), FakeFontId), 10, 13, 0, 0, 0 } };
+        const GlyphMetricsVector glyphsC = { { GlyphKey(GlyphId('c'), FakeFontId), 10, 3, 0, 0, 0 } };
+        EXPECT_EQ(0u, createTestGlyphGeometry(glyphsA).atlasPage);
+        EXPECT_EQ(0u, createTestGlyphGeometry(glyphsB).atlasPage);
+        EXPECT_EQ(1u, createTestGlyphGeometry(glyphsC).atlasPage);
+
+        // 'a' is mapped to page 0 already, but preferred page has space for it as well
+        EXPECT_EQ(1u, m_atlas.mapGlyphsAndCreateGeometry(glyphsA, 1u).atlasPage);
+        EXPECT_EQ(0u, m_atlas.mapGlyphsAndCreateGeometry(glyphsA).atlasPage);
+    }
+
+    TEST_F(AGlyphTextureAtlas, MapsGlyphsToOtherPageIfTheyDoNotFitPreferredPage)
+    {
+        const GlyphMetricsVector glyphsAB =
+        {
+            { GlyphKey(GlyphId('a'), FakeFontId), 10, 8, 0, 0, 0 },
+            { GlyphKey(GlyphId('b'), FakeFontId), 10, 8, 0, 0, 0 }
+        };
+        const GlyphMetricsVector glyphsC = { { GlyphKey(GlyphId('c'), FakeFontId), 10, 8, 0, 0, 0 } };
+        EXPECT_EQ(0u, createTestGlyphGeometry(glyphsAB).atlasPage);
+
+        GlyphData forgedGlyphData(10 * 8);
+        m_atlas.registerGlyph(glyphsC.front().key, QuadSize(10, 8), std::move(forgedGlyphData));
+        EXPECT_EQ(1u, m_atlas.mapGlyphsAndCreateGeometry(glyphsC, 0u).atlasPage);
+    }
+
+    TEST_F(AGlyphTextureAtlas, RestoresMappingStateTakenBeforeUnmappingAllGlyphs)
+    {
+        const GlyphMetricsVector glyphsAB =
+        {
+            { GlyphKey(GlyphId('a'), FakeFontId), 10, 8, 0, 0, 0 },
+            { GlyphKey(GlyphId('b'), FakeFontId), 10, 8, 0, 0, 0 }
+        };
+        const GlyphMetricsVector glyphsC = { { GlyphKey(GlyphId('c'), FakeFontId), 10, 8, 0, 0, 0 } };
+        const GlyphMetricsVector glyphsDE =
+        {
+            { GlyphKey(GlyphId('d'), FakeFontId), 10, 8, 0, 0, 0 },
+            { GlyphKey(GlyphId('e'), FakeFontId), 10, 8, 0, 0, 0 }
+        };
+        const GlyphMetricsVector glyphsFG =
+        {
+            { GlyphKey(GlyphId('f'), FakeFontId), 10, 8, 0, 0, 0 },
+            { GlyphKey(GlyphId('g'), FakeFontId), 10, 8, 0, 0, 0 }
+        };
+        const GlyphGeometry geometryAB = createTestGlyphGeometry(glyphsAB);
+        const GlyphGeometry geometryC = createTestGlyphGeometry(glyphsC);
+        EXPECT_EQ(1u, geometryC.atlasPage);
+        const GlyphTextureAtlas::MappingState state = m_atlas.getMappingState();
+
+        m_atlas.unmapAllGlyphs();
+        EXPECT_EQ(0u, m_atlas.mapGlyphsAndCreateGeometry(glyphsC).atlasPage);
+        EXPECT_EQ(1u, createTestGlyphGeometry(glyphsDE).atlasPage);
+        EXPECT_EQ(2u, createTestGlyphGeometry(glyphsFG).atlasPage);
+        EXPECT_EQ(3u, m_atlas.getPageCount());
+
+        m_atlas.restoreMappingState(state);
+        EXPECT_EQ(2u, m_atlas.getPageCount());
+        EXPECT_EQ(3u, m_atlas.getMappedGlyphCount());
+        EXPECT_EQ(geometryAB.texcoords, m_atlas.createGlyphsGeometry(0u, glyphsAB).texcoords);
+        EXPECT_EQ(geometryC.texcoords, m_atlas.createGlyphsGeometry(1u, glyphsC).texcoords);
+
+        // free space is restored too, page 1 has space for one more glyph only
+        EXPECT_EQ(2u, m_atlas.mapGlyphsAndCreateGeometry(glyphsDE).atlasPage);
+    }
+
+    TEST_F(AGlyphTextureAtlas, CreatesSameGeometryForAlreadyMappedGlyphsAsWhenMappingThem)
+    {
+        const GlyphMetricsVector glyphs =
+        {
+            { GlyphKey(GlyphId('a'), FakeFontId), 5, 8, 0, 0, 6 },
+            { GlyphKey(GlyphId('b'), FakeFontId), 4, 7, 1, 0, 5 }
+        };
+        const auto geometry = createTestGlyphGeometry(glyphs);
+        const auto recreatedGeometry = m_atlas.createGlyphsGeometry(geometry.atlasPage, glyphs);
+
+        EXPECT_EQ(geometry.atlasPage, recreatedGeometry.atlasPage);
+        EXPECT_EQ(geometry.positions, recreatedGeometry.positions);
+        EXPECT_EQ(geometry.texcoords, recreatedGeometry.texcoords);
+        EXPECT_EQ(geometry.indices, recreatedGeometry.indices);
+    }
+
+    TEST_F(AGlyphTextureAtlas, MapsGlyphsInAdvanceFillingPagesOneAfterAnother)
+    {
+        const GlyphMetricsVector glyphs =
+        {
+            { GlyphKey(GlyphId('a'), FakeFontId), 10, 8, 0, 0, 0 },
+            { GlyphKey(GlyphId('b'), FakeFontId), 10, 8, 0, 0, 0 },
+            { GlyphKey(GlyphId(' '), FakeFontId), 0, 0, 0, 0, 0 },
+            { GlyphKey(GlyphId('c'), FakeFontId), 10, 8, 0, 0, 0 }
+        };
+        GlyphKeyVector glyphKeys;
+        for (const auto& glyph : glyphs)
+        {
+            m_atlas.registerGlyph(glyph.key, QuadSize(glyph.width, glyph.height), GlyphData(glyph.width * glyph.height));
+            glyphKeys.push_back(glyph.key);
+        }
+        glyphKeys.push_back(glyphs.front().key);
+
+        m_atlas.mapGlyphs(glyphKeys);
+
+        // glyphs are found on the pages they were mapped to, no other page is created
+        const GlyphGeometry geometryAB = m_atlas.mapGlyphsAndCreateGeometry({ glyphs[0], glyphs[1] });
+        const GlyphGeometry geometryC = m_atlas.mapGlyphsAndCreateGeometry({ glyphs[3] });
+        EXPECT_EQ(0u, geometryAB.atlasPage);
+        EXPECT_EQ(1u, geometryC.atlasPage);
+        EXPECT_EQ(geometryAB.texcoords, m_atlas.createGlyphsGeometry(0u, { glyphs[0], glyphs[1] }).texcoords);
+
+        const GlyphMetricsVector glyphsD = { { GlyphKey(GlyphId('d'), FakeFontId), 10, 8, 0, 0, 0 } };
+        EXPECT_EQ(1u, createTestGlyphGeometry(glyphsD).atlasPage);
+    }
+
+    TEST_F(AGlyphTextureAtlas, DoesNotMapGlyphsInAdvanceWhichAreMappedAlready)
+    {
+        const GlyphMetricsVector glyphsA = { { GlyphKey(GlyphId('a'), FakeFontId), 10, 8, 0, 0, 0 } };
+        const GlyphMetricsVector glyphsB = { { GlyphKey(GlyphId('b'), FakeFontId), 10, 8, 0, 0, 0 } };
+        EXPECT_EQ(0u, createTestGlyphGeometry(glyphsA).atlasPage);
+        m_atlas.registerGlyph(glyphsB.front().key, QuadSize(10, 8), GlyphData(10 * 8));
+
+        m_atlas.mapGlyphs({ glyphsA.front().key, glyphsB.front().key });
+
+        // 'a' is not mapped second time, so 'b' fits on first page
+        EXPECT_EQ(0u, m_atlas.mapGlyphsAndCreateGeometry(glyphsB).atlasPage);
+        const GlyphMetricsVector glyphsC = { { GlyphKey(GlyphId('c'), FakeFontId), 10, 8, 0, 0, 0 } };
+        EXPECT_EQ(1u, createTestGlyphGeometry(glyphsC).atlasPage);
+    }
+
+    TEST_F(AGlyphTextureAtlas, EvictsLeastRecentlyUsedUnusedGlyphWhenMaximumPageCountIsReached)
+    {
+        m_atlas.setMaximumPageCount(1u);
+        const GlyphMetricsVector glyphsA = { { GlyphKey(GlyphId('a'), FakeFontId), 10, 8, 0, 0, 0 } };
+        const GlyphMetricsVector glyphsB = { { GlyphKey(GlyphId('b'), FakeFontId), 10, 8, 0, 0, 0 } };
+        const GlyphMetricsVector glyphsC = { { GlyphKey(GlyphId('c'), FakeFontId), 10, 8, 0, 0, 0 } };
+        const GlyphGeometry geometryA = createTestGlyphGeometry(glyphsA);
+        const GlyphGeometry geometryB = createTestGlyphGeometry(glyphsB);
+        m_atlas.unmapGlyphsFromPage(glyphsA, 0u);
+        m_atlas.unmapGlyphsFromPage(glyphsB, 0u);
+
+        // 'a' became unused first, so it is evicted and 'c' takes its place
+        const GlyphGeometry geometryC = createTestGlyphGeometry(glyphsC);
+        EXPECT_EQ(0u, geometryC.atlasPage);
+        EXPECT_EQ(geometryA.texcoords, geometryC.texcoords);
+        EXPECT_EQ(1u, m_atlas.getPageCount());
+
+        // unused 'b' is still on its place
+        EXPECT_EQ(geometryB.texcoords, m_atlas.mapGlyphsAndCreateGeometry(glyphsB).texcoords);
+
+        // all glyphs on the page are used, nothing to evict
+        const GlyphGeometry geometryA2 = m_atlas.mapGlyphsAndCreateGeometry(glyphsA);
+        EXPECT_EQ(std::numeric_limits<size_t>::max(), geometryA2.atlasPage);
+        EXPECT_EQ(1u, m_atlas.getPageCount());
+    }
+
+    TEST_F(AGlyphTextureAtlas, EvictsUnusedGlyphsOnlyFromPageWhereRequestedGlyphsFitAfterwards)
+    {
+        m_atlas.setMaximumPageCount(2u);
+        const GlyphMetricsVector glyphsA = { { GlyphKey(GlyphId('a'), FakeFontId), 10, 8, 0, 0, 0 } };
+        const GlyphMetricsVector glyphsB = { { GlyphKey(GlyphId('b'), FakeFontId), 10, 8, 0, 0, 0 } };
+        const GlyphMetricsVector glyphsCD =
+        {
+            { GlyphKey(GlyphId('c'), FakeFontId), 10, 8, 0, 0, 0 },
+            { GlyphKey(GlyphId('d'), FakeFontId), 10, 8, 0, 0, 0 }
+        };
+        const GlyphMetricsVector glyphsEF =
+        {
+            { GlyphKey(GlyphId('e'), FakeFontId), 10, 8, 0, 0, 0 },
+            { GlyphKey(GlyphId('f'), FakeFontId), 10, 8, 0, 0, 0 }
+        };
+        EXPECT_EQ(0u, createTestGlyphGeometry(glyphsA).atlasPage);
+        EXPECT_EQ(0u, createTestGlyphGeometry(glyphsB).atlasPage);
+        EXPECT_EQ(1u, createTestGlyphGeometry(glyphsCD).atlasPage);
+        // 'a' is least recently used, but 'b' stays used on its page
+        m_atlas.unmapGlyphsFromPage(glyphsA, 0u);
+        m_atlas.unmapGlyphsFromPage(glyphsCD, 1u);
+        EXPECT_EQ(4u, m_atlas.getMappedGlyphCount());
+
+        EXPECT_EQ(1u, createTestGlyphGeometry(glyphsEF).atlasPage);
+        // 'a' is kept, evicting it would not have made space for both glyphs
+        EXPECT_EQ(4u, m_atlas.getMappedGlyphCount());
+        EXPECT_EQ(0u, m_atlas.mapGlyphsAndCreateGeometry(glyphsA).atlasPage);
+    }
+
+    TEST_F(AGlyphTextureAtlas, DoesNotEvictAnyGlyphIfRequestedGlyphsCannotFit)
+    {
+        m_atlas.setMaximumPageCount(1u);
+        const GlyphMetricsVector glyphsA = { { GlyphKey(GlyphId('a'), FakeFontId), 10, 8, 0, 0, 0 } };
+        const GlyphMetricsVector glyphsB = { { GlyphKey(GlyphId('b'), FakeFontId), 10, 8, 0, 0, 0 } };
+        const GlyphMetricsVector glyphsCD =
+        {
+            { GlyphKey(GlyphId('c'), FakeFontId), 10, 8, 0, 0, 0 },
+            { GlyphKey(GlyphId('d'), FakeFontId), 10, 8, 0, 0, 0 }
+        };
+        createTestGlyphGeometry(glyphsA);
+        createTestGlyphGeometry(glyphsB);
+        m_atlas.unmapGlyphsFromPage(glyphsA, 0u);
+
+        EXPECT_EQ(std::numeric_limits<size_t>::max(), createTestGlyphGeometry(glyphsCD).atlasPage);
+        EXPECT_EQ(2u, m_atlas.getMappedGlyphCount());
+    }
+
+    TEST_F(AGlyphTextureAtlas, DoesNotMapGlyphsInAdvanceBeyondMaximumPageCount)
+    {
+        m_atlas.setMaximumPageCount(1u);
+        const GlyphMetricsVector glyphs =
+        {
+            { GlyphKey(GlyphId('a'), FakeFontId), 10, 8, 0, 0, 0 },
+            { GlyphKey(GlyphId('b'), FakeFontId), 10, 8, 0, 0, 0 },
+            { GlyphKey(GlyphId('c'), FakeFontId), 10, 8, 0, 0, 0 }
+        };
+        for (const auto& glyph : glyphs)
+            m_atlas.registerGlyph(glyph.key, QuadSize(glyph.width, glyph.height), GlyphData(glyph.width * glyph.height));
+
+        m_atlas.mapGlyphs({ glyphs[0].key, glyphs[1].key, glyphs[2].key });
+        EXPECT_EQ(1u, m_atlas.getPageCount());
+        EXPECT_EQ(1u, m_atlas.getUsedPageCount());
+
+        // preloaded glyphs are unused and can be evicted
+        EXPECT_EQ(0u, m_atlas.mapGlyphsAndCreateGeometry({ glyphs[2] }).atlasPage);
+    }
+
+    TEST_F(AGlyphTextureAtlas, MapsGlyphsAgainAfterUnmappingAllAndRemovesPagesNotNeededAnymore)
+    {
+        const GlyphMetricsVector glyphsA = { { GlyphKey(GlyphId('a'), FakeFontId), 10, 8, 0, 0, 0 } };
+        const GlyphMetricsVector glyphsB = { { GlyphKey(GlyphId('b'), FakeFontId), 10, 8, 0, 0, 0 } };
+        const GlyphMetricsVector glyphsC = { { GlyphKey(GlyphId('c'), FakeFontId), 10, 8, 0, 0, 0 } };
+        const GlyphGeometry geometryA = createTestGlyphGeometry(glyphsA);
+        createTestGlyphGeometry(glyphsB);
+        EXPECT_EQ(1u, createTestGlyphGeometry(glyphsC).atlasPage);
+        EXPECT_EQ(2u, m_atlas.getUsedPageCount());
+
+        m_atlas.unmapAllGlyphs();
+        EXPECT_EQ(0u, m_atlas.getUsedPageCount());
+        EXPECT_EQ(2u, m_atlas.getPageCount());
+
+        const GlyphGeometry geometryC = m_atlas.mapGlyphsAndCreateGeometry(glyphsC);
+        EXPECT_EQ(0u, geometryC.atlasPage);
+        EXPECT_EQ(geometryA.texcoords, geometryC.texcoords);
+        EXPECT_EQ(1u, m_atlas.getUsedPageCount());
+
+        m_atlas.removePagesAtEnd(m_atlas.getUsedPageCount());
+        EXPECT_EQ(1u, m_atlas.getPageCount());
+        EXPECT_EQ(geometryC.texcoords, m_atlas.createGlyphsGeometry(0u, glyphsC).texcoords);
+    }
 }
@@ -246,6 +246,37 @@ namespace ramses
         }
     }
 
+    TEST_F(AGlyphTexturePage, CopiesSourceDataOfMultipleGlyphsWithOneUpdateAndKeepsDataBetweenThem)
+    {
+        const uint8_t existingTexel = 0xAB;
+        const GlyphTexturePage::GlyphPageData existingData(3 * 3, existingTexel);
+        GlyphTexturePage::GlyphPageData tempCache;
+        // glyph between the other two which must not be overwritten
+        m_glyphPage->updateDataWithPadding(Quad(QuadOffset(4, 4), QuadSize(5, 5)), existingData.data(), tempCache);
+
+        const GlyphTexturePage::GlyphPageData texelData1(2 * 2, 1u);
+        const GlyphTexturePage::GlyphPageData texelData2(3 * 1, 2u);
+        const std::vector<GlyphTexturePage::QuadData> quadsWithData =
+        {
+            { Quad(QuadOffset(0, 0), QuadSize(4, 4)), texelData1.data() },
+            { Quad(QuadOffset(9, 9), QuadSize(3, 5)), texelData2.data() }
+        };
+        m_glyphPage->updateDataWithPadding(quadsWithData, tempCache);
+
+        uint8_t databuffer[PageWidth * PageHeight];
+        m_glyphPage->getTextureBuffer().getMipLevelData(0, reinterpret_cast<char*>(databuffer), PageWidth * PageHeight);
+        EXPECT_EQ(0u, databuffer[0]);
+        EXPECT_EQ(1u, databuffer[1 * PageWidth + 1]);
+        EXPECT_EQ(1u, databuffer[2 * PageWidth + 2]);
+        EXPECT_EQ(0u, databuffer[3 * PageWidth + 3]);
+        EXPECT_EQ(existingTexel, databuffer[5 * PageWidth + 5]);
+        EXPECT_EQ(existingTexel, databuffer[7 * PageWidth + 7]);
+        EXPECT_EQ(0u, databuffer[9 * PageWidth + 10]);
+        EXPECT_EQ(2u, databuffer[10 * PageWidth + 10]);
+        EXPECT_EQ(2u, databuffer[12 * PageWidth + 10]);
+        EXPECT_EQ(0u, databuffer[13 * PageWidth + 10]);
+    }
+
     TEST_F(AGlyphTexturePage, NewGlyphPageHasOneFreeAreaWithWidthTimesHeightArea)
     {
         uint32_t fullArea = PageWidth * PageHeight;
@@ -0,0 +1,110 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "ramses-text/RangeAllocator.h"
+
+namespace ramses
+{
+    TEST(ARangeAllocator, isEmptyWithoutCapacity)
+    {
+        RangeAllocator allocator;
+        EXPECT_EQ(0u, allocator.getCapacity());
+        EXPECT_EQ(0u, allocator.getUsedEnd());
+        EXPECT_EQ(RangeAllocator::InvalidOffset, allocator.allocate(1u));
+    }
+
+    TEST(ARangeAllocator, allocatesRangesOneAfterAnother)
+    {
+        RangeAllocator allocator(10u);
+        EXPECT_EQ(0u, allocator.allocate(3u));
+        EXPECT_EQ(3u, allocator.getUsedEnd());
+        EXPECT_EQ(3u, allocator.allocate(5u));
+        EXPECT_EQ(8u, allocator.getUsedEnd());
+        EXPECT_EQ(8u, allocator.allocate(2u));
+        EXPECT_EQ(10u, allocator.getUsedEnd());
+        EXPECT_EQ(RangeAllocator::InvalidOffset, allocator.allocate(1u));
+    }
+
+    TEST(ARangeAllocator, failsToAllocateRangeLargerThanAnyFreeRange)
+    {
+        RangeAllocator allocator(10u);
+        EXPECT_EQ(0u, allocator.allocate(4u));
+        EXPECT_EQ(4u, allocator.allocate(2u));
+        allocator.release(0u, 4u);
+
+        EXPECT_EQ(RangeAllocator::InvalidOffset, allocator.allocate(5u));
+        EXPECT_EQ(6u, allocator.getUsedEnd());
+    }
+
+    TEST(ARangeAllocator, reusesFirstReleasedRangeWhichFits)
+    {
+        RangeAllocator allocator(10u);
+        EXPECT_EQ(0u, allocator.allocate(2u));
+        EXPECT_EQ(2u, allocator.allocate(4u));
+        EXPECT_EQ(6u, allocator.allocate(2u));
+        allocator.release(0u, 2u);
+        allocator.release(2u, 4u);
+
+        EXPECT_EQ(0u, allocator.allocate(5u));
+        EXPECT_EQ(8u, allocator.getUsedEnd());
+    }
+
+    TEST(ARangeAllocator, mergesReleasedRangeWithNeighbours)
+    {
+        RangeAllocator allocator(9u);
+        EXPECT_EQ(0u, allocator.allocate(3u));
+        EXPECT_EQ(3u, allocator.allocate(3u));
+        EXPECT_EQ(6u, allocator.allocate(3u));
+
+        allocator.release(0u, 3u);
+        allocator.release(6u, 3u);
+        EXPECT_EQ(6u, allocator.getUsedEnd());
+        allocator.release(3u, 3u);
+        EXPECT_EQ(0u, allocator.getUsedEnd());
+
+        EXPECT_EQ(0u, allocator.allocate(9u));
+    }
+
+    TEST(ARangeAllocator, reducesUsedEndWhenLastRangeIsReleased)
+    {
+        RangeAllocator allocator(10u);
+        EXPECT_EQ(0u, allocator.allocate(2u));
+        EXPECT_EQ(2u, allocator.allocate(2u));
+        EXPECT_EQ(4u, allocator.allocate(2u));
+
+        allocator.release(2u, 2u);
+        EXPECT_EQ(6u, allocator.getUsedEnd());
+        allocator.release(4u, 2u);
+        EXPECT_EQ(2u, allocator.getUsedEnd());
+    }
+
+    TEST(ARangeAllocator, growsCapacityAndMergesWithFreeRangeAtEnd)
+    {
+        RangeAllocator allocator(4u);
+        EXPECT_EQ(0u, allocator.allocate(3u));
+        EXPECT_EQ(RangeAllocator::InvalidOffset, allocator.allocate(3u));
+
+        allocator.grow(8u);
+        EXPECT_EQ(8u, allocator.getCapacity());
+        EXPECT_EQ(3u, allocator.getUsedEnd());
+        EXPECT_EQ(3u, allocator.allocate(5u));
+        EXPECT_EQ(8u, allocator.getUsedEnd());
+    }
+
+    TEST(ARangeAllocator, growsFullCapacity)
+    {
+        RangeAllocator allocator(4u);
+        EXPECT_EQ(0u, allocator.allocate(4u));
+
+        allocator.grow(6u);
+        EXPECT_EQ(4u, allocator.getUsedEnd());
+        EXPECT_EQ(4u, allocator.allocate(2u));
+        EXPECT_EQ(6u, allocator.getUsedEnd());
+    }
+}
@@ -0,0 +1,116 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include "ramses-text-api/FontRegistry.h"
+
+namespace ramses
+{
+    class ASDFFontInstance : public testing::Test
+    {
+    public:
+        static void SetUpTestCase()
+        {
+            FRegistry = new FontRegistry;
+            const auto fontId = FRegistry->createFreetype2Font("res/ramses-text-Roboto-Bold.ttf");
+
+            FontInstance16 = FRegistry->getFontInstance(FRegistry->createFreetype2FontInstanceSDF(fontId, 16u));
+            FontInstance32 = FRegistry->getFontInstance(FRegistry->createFreetype2FontInstanceSDF(fontId, 32u));
+            FontInstance64 = FRegistry->getFontInstance(FRegistry->createFreetype2FontInstanceSDF(fontId, 64u));
+        }
+
+        static void TearDownTestCase()
+        {
+            delete FRegistry;
+        }
+
+    protected:
+        static GlyphMetricsVector GetPositionedGlyphs(const std::u32string& str, IFontInstance& fontInstance)
+        {
+            GlyphMetricsVector ret;
+            fontInstance.loadAndAppendGlyphMetrics(str.cbegin(), str.cend(), ret);
+            return ret;
+        }
+
+        static FontRegistry*  FRegistry;
+        static IFontInstance* FontInstance16;
+        static IFontInstance* FontInstance32;
+        static IFontInstance* FontInstance64;
+    };
+
+    FontRegistry*  ASDFFontInstance::FRegistry(nullptr);
+    IFontInstance* ASDFFontInstance::FontInstance16(nullptr);
+    IFontInstance* ASDFFontInstance::FontInstance32(nullptr);
+    IFontInstance* ASDFFontInstance::FontInstance64(nullptr);
+
+    TEST_F(ASDFFontInstance, ScalesLineMetricsWithSize)
+    {
+        EXPECT_NEAR(2 * FontInstance32->getHeight(), FontInstance64->getHeight(), 1);
+        EXPECT_NEAR(2 * FontInstance32->getAscender(), FontInstance64->getAscender(), 1);
+        EXPECT_NEAR(2 * FontInstance32->getDescender(), FontInstance64->getDescender(), 1);
+        EXPECT_NEAR(FontInstance32->getHeight(), 2 * FontInstance16->getHeight(), 1);
+    }
+
+    TEST_F(ASDFFontInstance, ScalesGlyphMetricsWithSizeAndSharesGlyphKeys)
+    {
+        const auto glyphs16 = GetPositionedGlyphs(U"Ab c", *FontInstance16);
+        const auto glyphs64 = GetPositionedGlyphs(U"Ab c", *FontInstance64);
+        ASSERT_EQ(4u, glyphs16.size());
+        ASSERT_EQ(4u, glyphs64.size());
+
+        for (size_t i = 0u; i < glyphs16.size(); ++i)
+        {
+            EXPECT_EQ(glyphs16[i].key, glyphs64[i].key);
+            EXPECT_NEAR(4 * glyphs16[i].advance, glyphs64[i].advance, 2);
+            EXPECT_NEAR(4 * static_cast<int>(glyphs16[i].width), static_cast<int>(glyphs64[i].width), 2);
+            EXPECT_NEAR(4 * static_cast<int>(glyphs16[i].height), static_cast<int>(glyphs64[i].height), 2);
+            EXPECT_NEAR(4 * glyphs16[i].posX, glyphs64[i].posX, 2);
+            EXPECT_NEAR(4 * glyphs16[i].posY, glyphs64[i].posY, 2);
+        }
+
+        // space has no glyph bitmap
+        EXPECT_EQ(0u, glyphs64[2].width);
+        EXPECT_EQ(0u, glyphs64[2].height);
+    }
+
+    TEST_F(ASDFFontInstance, ProvidesGlyphBitmapOfReferenceSizeExtendedBySpread)
+    {
+        const auto glyphs = GetPositionedGlyphs(U"A", *FontInstance16);
+        ASSERT_EQ(1u, glyphs.size());
+        IFontInstance* referenceInstance = FRegistry->getFontInstance(glyphs.front().key.fontInstanceId);
+        ASSERT_TRUE(referenceInstance != nullptr);
+
+        // reference instance metrics match its bitmap, which is shared by all sizes
+        const auto referenceGlyphs = GetPositionedGlyphs(U"A", *referenceInstance);
+        ASSERT_EQ(1u, referenceGlyphs.size());
+        const auto glyphs32 = GetPositionedGlyphs(U"A", *FontInstance32);
+        EXPECT_EQ(referenceGlyphs.front().width, glyphs32.front().width);
+        EXPECT_EQ(referenceGlyphs.front().height, glyphs32.front().height);
+
+        uint32_t sizeX = 0u;
+        uint32_t sizeY = 0u;
+        const GlyphData data = referenceInstance->loadGlyphBitmapData(glyphs.front().key.identifier, sizeX, sizeY);
+        EXPECT_EQ(sizeX * sizeY, data.size());
+
+        uint32_t sizeX16 = 0u;
+        uint32_t sizeY16 = 0u;
+        EXPECT_EQ(data, FontInstance16->loadGlyphBitmapData(glyphs.front().key.identifier, sizeX16, sizeY16));
+        EXPECT_EQ(sizeX, sizeX16);
+        EXPECT_EQ(sizeY, sizeY16);
+
+        // distance field is outside of glyph at the border of its extended bitmap
+        EXPECT_EQ(0u, data.front());
+        EXPECT_EQ(0u, data.back());
+    }
+
+    TEST_F(ASDFFontInstance, ReportsSupportedCharCodes)
+    {
+        EXPECT_TRUE(FontInstance16->supportsCharacter(U'a'));
+        EXPECT_FALSE(FontInstance16->supportsCharacter(0x19aa));
+    }
+}
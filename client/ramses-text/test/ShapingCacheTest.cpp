@@ -0,0 +1,153 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "ramses-text/ShapingCache.h"
+
+namespace ramses
+{
+    class AShapingCache : public testing::Test
+    {
+    protected:
+        static GlyphMetricsVector CreateGlyphs(uint32_t glyphId)
+        {
+            GlyphMetrics glyph;
+            glyph.key = GlyphKey(GlyphId(glyphId), FontInstanceId(1u));
+            glyph.width = 1u;
+            glyph.height = 2u;
+            glyph.posX = 3;
+            glyph.posY = 4;
+            glyph.advance = 5;
+            return { glyph };
+        }
+
+        const FontInstanceOffsets m_font1{ { FontInstanceId(1u), 0u } };
+        const FontInstanceOffsets m_font2{ { FontInstanceId(2u), 0u } };
+    };
+
+    TEST_F(AShapingCache, isDisabledWithZeroCapacity)
+    {
+        ShapingCache cache;
+        cache.add(U"abc", m_font1, CreateGlyphs(1u));
+        EXPECT_EQ(nullptr, cache.find(U"abc", m_font1));
+
+        const ShapingCacheStatistics statistics = cache.getStatistics();
+        EXPECT_EQ(0u, statistics.entries);
+        EXPECT_EQ(0u, statistics.hits);
+        EXPECT_EQ(0u, statistics.misses);
+    }
+
+    TEST_F(AShapingCache, findsAddedGlyphsAndCountsHitsAndMisses)
+    {
+        ShapingCache cache(2u);
+        EXPECT_EQ(nullptr, cache.find(U"abc", m_font1));
+        cache.add(U"abc", m_font1, CreateGlyphs(1u));
+
+        const GlyphMetricsVector* glyphs = cache.find(U"abc", m_font1);
+        ASSERT_TRUE(glyphs != nullptr);
+        ASSERT_EQ(1u, glyphs->size());
+        EXPECT_EQ(GlyphId(1u), glyphs->front().key.identifier);
+        EXPECT_EQ(5, glyphs->front().advance);
+
+        const ShapingCacheStatistics statistics = cache.getStatistics();
+        EXPECT_EQ(1u, statistics.entries);
+        EXPECT_EQ(2u, statistics.capacity);
+        EXPECT_EQ(1u, statistics.hits);
+        EXPECT_EQ(1u, statistics.misses);
+    }
+
+    TEST_F(AShapingCache, distinguishesEntriesByStringAndFontOffsets)
+    {
+        ShapingCache cache(4u);
+        cache.add(U"abc", m_font1, CreateGlyphs(1u));
+        cache.add(U"abc", m_font2, CreateGlyphs(2u));
+        cache.add(U"abc", { { FontInstanceId(1u), 0u }, { FontInstanceId(2u), 1u } }, CreateGlyphs(3u));
+
+        EXPECT_EQ(nullptr, cache.find(U"ab", m_font1));
+        EXPECT_EQ(nullptr, cache.find(U"abc", { { FontInstanceId(1u), 0u }, { FontInstanceId(2u), 2u } }));
+        EXPECT_EQ(GlyphId(1u), cache.find(U"abc", m_font1)->front().key.identifier);
+        EXPECT_EQ(GlyphId(2u), cache.find(U"abc", m_font2)->front().key.identifier);
+        EXPECT_EQ(GlyphId(3u), cache.find(U"abc", { { FontInstanceId(1u), 0u }, { FontInstanceId(2u), 1u } })->front().key.identifier);
+    }
+
+    TEST_F(AShapingCache, evictsLeastRecentlyUsedEntryWhenFull)
+    {
+        ShapingCache cache(2u);
+        cache.add(U"a", m_font1, CreateGlyphs(1u));
+        cache.add(U"b", m_font1, CreateGlyphs(2u));
+        EXPECT_NE(nullptr, cache.find(U"a", m_font1));
+
+        cache.add(U"c", m_font1, CreateGlyphs(3u));
+        EXPECT_EQ(2u, cache.getStatistics().entries);
+        EXPECT_NE(nullptr, cache.find(U"a", m_font1));
+        EXPECT_EQ(nullptr, cache.find(U"b", m_font1));
+        EXPECT_NE(nullptr, cache.find(U"c", m_font1));
+    }
+
+    TEST_F(AShapingCache, replacesGlyphsOfExistingEntry)
+    {
+        ShapingCache cache(2u);
+        cache.add(U"a", m_font1, CreateGlyphs(1u));
+        cache.add(U"a", m_font1, CreateGlyphs(2u));
+        EXPECT_EQ(1u, cache.getStatistics().entries);
+        EXPECT_EQ(GlyphId(2u), cache.find(U"a", m_font1)->front().key.identifier);
+    }
+
+    TEST_F(AShapingCache, evictsEntriesWhenCapacityIsReduced)
+    {
+        ShapingCache cache(3u);
+        cache.add(U"a", m_font1, CreateGlyphs(1u));
+        cache.add(U"b", m_font1, CreateGlyphs(2u));
+        cache.add(U"c", m_font1, CreateGlyphs(3u));
+
+        cache.setCapacity(1u);
+        EXPECT_EQ(1u, cache.getStatistics().entries);
+        EXPECT_NE(nullptr, cache.find(U"c", m_font1));
+
+        cache.setCapacity(0u);
+        EXPECT_EQ(0u, cache.getStatistics().entries);
+    }
+
+    TEST_F(AShapingCache, removesEntriesOfFontInstance)
+    {
+        ShapingCache cache(4u);
+        const FontInstanceOffsets font1And2{ { FontInstanceId(1u), 0u }, { FontInstanceId(2u), 1u } };
+        cache.add(U"a", m_font1, CreateGlyphs(1u));
+        cache.add(U"ab", font1And2, CreateGlyphs(2u));
+        cache.add(U"a", m_font2, CreateGlyphs(3u));
+
+        cache.removeEntriesOfFontInstance(FontInstanceId(2u));
+        EXPECT_EQ(1u, cache.getStatistics().entries);
+        EXPECT_NE(nullptr, cache.find(U"a", m_font1));
+        EXPECT_EQ(nullptr, cache.find(U"ab", font1And2));
+        EXPECT_EQ(nullptr, cache.find(U"a", m_font2));
+
+        // usage order stays consistent with remaining entries
+        cache.add(U"b", m_font1, CreateGlyphs(4u));
+        cache.add(U"c", m_font1, CreateGlyphs(5u));
+        cache.add(U"d", m_font1, CreateGlyphs(6u));
+        cache.add(U"e", m_font1, CreateGlyphs(7u));
+        EXPECT_EQ(4u, cache.getStatistics().entries);
+        EXPECT_EQ(nullptr, cache.find(U"a", m_font1));
+    }
+
+    TEST_F(AShapingCache, clearsEntriesAndKeepsStatistics)
+    {
+        ShapingCache cache(2u);
+        cache.add(U"a", m_font1, CreateGlyphs(1u));
+        EXPECT_NE(nullptr, cache.find(U"a", m_font1));
+
+        cache.clear();
+        EXPECT_EQ(0u, cache.getStatistics().entries);
+        EXPECT_EQ(1u, cache.getStatistics().hits);
+        EXPECT_EQ(nullptr, cache.find(U"a", m_font1));
+
+        cache.add(U"a", m_font1, CreateGlyphs(1u));
+        EXPECT_NE(nullptr, cache.find(U"a", m_font1));
+    }
+}
@@ -0,0 +1,62 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "ramses-text/SignedDistanceField.h"
+
+namespace ramses
+{
+    TEST(ASignedDistanceField, isEmptyForEmptyCoverage)
+    {
+        EXPECT_TRUE(SignedDistanceField::CreateFromCoverage(nullptr, 0u, 3u, 2u).empty());
+        EXPECT_TRUE(SignedDistanceField::CreateFromCoverage(nullptr, 3u, 0u, 2u).empty());
+    }
+
+    TEST(ASignedDistanceField, extendsCoverageBySpreadOnEachSide)
+    {
+        const std::vector<uint8_t> coverage(3u * 2u, 255u);
+        const GlyphData field = SignedDistanceField::CreateFromCoverage(coverage.data(), 3u, 2u, 2u);
+        EXPECT_EQ(7u * 6u, field.size());
+    }
+
+    TEST(ASignedDistanceField, encodesDistanceToOutline)
+    {
+        // single row of 5 pixels covered in the middle
+        const std::vector<uint8_t> coverage{ 0u, 255u, 255u, 255u, 0u };
+        const uint32_t spread = 4u;
+        const GlyphData field = SignedDistanceField::CreateFromCoverage(coverage.data(), 5u, 1u, spread);
+        ASSERT_EQ(13u * 9u, field.size());
+
+        const uint8_t* row = &field[spread * 13u];
+        // symmetric around the covered pixels
+        for (uint32_t x = 0u; x < 13u; ++x)
+            EXPECT_EQ(row[x], row[12u - x]);
+
+        // inside above the edge value, outside below it, decreasing with distance
+        EXPECT_GT(row[6], 128u);
+        EXPECT_LE(row[4], 128u);
+        EXPECT_GT(row[4], row[3]);
+        EXPECT_GT(row[3], row[2]);
+
+        // clamped beyond spread
+        EXPECT_EQ(0u, row[0]);
+        EXPECT_EQ(0u, field[0]);
+    }
+
+    TEST(ASignedDistanceField, placesOutlineWithinPartiallyCoveredPixels)
+    {
+        const std::vector<uint8_t> coverage{ 0u, 64u, 255u, 191u, 0u };
+        const GlyphData field = SignedDistanceField::CreateFromCoverage(coverage.data(), 5u, 1u, 1u);
+        const uint8_t* row = &field[1u * 7u];
+
+        // less than half covered pixel is outside, more than half covered pixel is inside
+        EXPECT_LT(row[2], 128u);
+        EXPECT_GT(row[4], 128u);
+        EXPECT_GT(row[3], row[4]);
+    }
+}
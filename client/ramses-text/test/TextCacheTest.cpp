@@ -12,6 +12,7 @@
 #include "ramses-text-api/TextLine.h"
 #include "ramses-text-api/FontRegistry.h"
 #include "ramses-text-api/IFontInstance.h"
+#include "ramses-text/TextCacheImpl.h"
 #include "ramses-client-api/Scene.h"
 #include "ramses-client-api/RamsesClient.h"
 #include "ramses-client-api/UniformInput.h"
@@ -512,4 +513,547 @@ namespace ramses
 
         EXPECT_EQ(InvalidTextLineId, m_textCache.createTextLine(positionedGlyphs, *textEffect));
     }
+
+    TEST_F(ATextCache, getsNullTextBatchForNonExistingTextBatchId)
+    {
+        EXPECT_EQ(nullptr, m_textCache.getTextBatch(InvalidTextBatchId));
+        EXPECT_EQ(nullptr, m_textCache.getTextBatch(TextBatchId(3u)));
+    }
+
+    TEST_F(ATextCache, failsToDeleteNonExistingTextBatch)
+    {
+        EXPECT_FALSE(m_textCache.deleteTextBatch(InvalidTextBatchId));
+        EXPECT_FALSE(m_textCache.deleteTextBatch(TextBatchId(3u)));
+    }
+
+    TEST_F(ATextCache, createsTextBatch)
+    {
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect);
+        EXPECT_NE(InvalidTextBatchId, batchId);
+        const TextBatch* batch = m_textCache.getTextBatch(batchId);
+        ASSERT_TRUE(batch != nullptr);
+        EXPECT_NE(nullptr, batch->rootNode);
+        EXPECT_TRUE(batch->meshNodes.empty());
+    }
+
+    TEST_F(ATextCache, failsToCreateTextBatchUsingNonTextEffect)
+    {
+        EffectDescription effectDesc;
+        effectDesc.setVertexShader("void main() { gl_Position = vec4(1.0, 0.0, 0.0, 1.0); }\n");
+        effectDesc.setFragmentShader("void main() { gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0); }\n");
+        Effect* effect = m_client.createEffect(effectDesc);
+        ASSERT_TRUE(effect != nullptr);
+
+        EXPECT_EQ(InvalidTextBatchId, m_textCache.createTextBatch(*effect));
+    }
+
+    TEST_F(ATextCache, failsToCreateTextLineInNonExistingTextBatch)
+    {
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+        EXPECT_EQ(InvalidTextLineId, m_textCache.createTextLine(positionedGlyphs, TextBatchId(3u), 0.f, 0.f));
+    }
+
+    TEST_F(ATextCache, failsToCreateTextLineInTextBatchFromEmptyString)
+    {
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect);
+
+        EXPECT_EQ(InvalidTextLineId, m_textCache.createTextLine({}, batchId, 0.f, 0.f));
+        EXPECT_TRUE(m_textCache.getTextBatch(batchId)->meshNodes.empty());
+    }
+
+    TEST_F(ATextCache, createsTextLinesInTextBatchSharingOneMesh)
+    {
+        const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+        const auto positionedGlyphs2 = m_textCache.getPositionedGlyphs(U"123abc", LatinFontInstance20);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect);
+
+        const TextLineId textLineId1 = m_textCache.createTextLine(positionedGlyphs1, batchId, 0.f, 0.f);
+        const TextLineId textLineId2 = m_textCache.createTextLine(positionedGlyphs2, batchId, 0.f, 20.f);
+        EXPECT_NE(InvalidTextLineId, textLineId1);
+        EXPECT_NE(InvalidTextLineId, textLineId2);
+        const TextLine* textLine1 = m_textCache.getTextLine(textLineId1);
+        const TextLine* textLine2 = m_textCache.getTextLine(textLineId2);
+        ASSERT_TRUE(textLine1 != nullptr);
+        ASSERT_TRUE(textLine2 != nullptr);
+        EXPECT_EQ(positionedGlyphs1, textLine1->glyphs);
+        EXPECT_EQ(positionedGlyphs2, textLine2->glyphs);
+        EXPECT_EQ(textLine1->atlasPage, textLine2->atlasPage);
+
+        const TextBatch* batch = m_textCache.getTextBatch(batchId);
+        ASSERT_TRUE(batch != nullptr);
+        ASSERT_EQ(1u, batch->meshNodes.size());
+        const MeshNode* meshNode = batch->meshNodes.front();
+        EXPECT_EQ(meshNode, textLine1->meshNode);
+        EXPECT_EQ(meshNode, textLine2->meshNode);
+        EXPECT_EQ(batch->rootNode, meshNode->getParent());
+        EXPECT_NE(nullptr, meshNode->getAppearance());
+        EXPECT_NE(nullptr, meshNode->getGeometryBinding());
+        EXPECT_EQ(60u, meshNode->getIndexCount());
+
+        ASSERT_TRUE(textLine1->indices != nullptr);
+        EXPECT_EQ(textLine1->indices, textLine2->indices);
+        EXPECT_EQ(textLine1->positions, textLine2->positions);
+        EXPECT_EQ(textLine1->textureCoordinates, textLine2->textureCoordinates);
+        EXPECT_EQ(240u, textLine1->indices->getUsedSizeInBytes());
+        EXPECT_EQ(320u, textLine1->positions->getUsedSizeInBytes());
+        EXPECT_EQ(320u, textLine1->textureCoordinates->getUsedSizeInBytes());
+    }
+
+    TEST_F(ATextCache, reducesIndexCountOfTextBatchMeshOnlyWhenLastTextLineIsDeleted)
+    {
+        const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+        const auto positionedGlyphs2 = m_textCache.getPositionedGlyphs(U"123abc", LatinFontInstance20);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect);
+
+        const TextLineId textLineId1 = m_textCache.createTextLine(positionedGlyphs1, batchId, 0.f, 0.f);
+        const TextLineId textLineId2 = m_textCache.createTextLine(positionedGlyphs2, batchId, 0.f, 20.f);
+        const MeshNode* meshNode = m_textCache.getTextBatch(batchId)->meshNodes.front();
+
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId1));
+        EXPECT_EQ(nullptr, m_textCache.getTextLine(textLineId1));
+        EXPECT_EQ(60u, meshNode->getIndexCount());
+
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId2));
+        EXPECT_EQ(nullptr, m_textCache.getTextLine(textLineId2));
+        EXPECT_EQ(0u, meshNode->getIndexCount());
+        EXPECT_FALSE(m_textCache.deleteTextLine(textLineId2));
+    }
+
+    TEST_F(ATextCache, reusesRangeOfDeletedTextLineInTextBatch)
+    {
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect);
+
+        const TextLineId textLineId1 = m_textCache.createTextLine(positionedGlyphs, batchId, 0.f, 0.f);
+        m_textCache.createTextLine(positionedGlyphs, batchId, 0.f, 20.f);
+        const MeshNode* meshNode = m_textCache.getTextBatch(batchId)->meshNodes.front();
+        EXPECT_EQ(48u, meshNode->getIndexCount());
+
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId1));
+        EXPECT_NE(InvalidTextLineId, m_textCache.createTextLine(positionedGlyphs, batchId, 0.f, 40.f));
+        EXPECT_EQ(48u, meshNode->getIndexCount());
+    }
+
+    TEST_F(ATextCache, growsDataBuffersOfTextBatchKeepingItsMesh)
+    {
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect);
+
+        const TextLineId firstTextLineId = m_textCache.createTextLine(positionedGlyphs, batchId, 0.f, 0.f);
+        const MeshNode* meshNode = m_textCache.getTextBatch(batchId)->meshNodes.front();
+        const uint32_t initialIndicesSize = m_textCache.getTextLine(firstTextLineId)->indices->getMaximumSizeInBytes();
+
+        // every line has 4 visible glyphs
+        const uint32_t lineCount = initialIndicesSize / (4u * 6u * sizeof(uint32_t)) + 1u;
+        TextLineId lastTextLineId = firstTextLineId;
+        for (uint32_t i = 1u; i < lineCount; ++i)
+        {
+            lastTextLineId = m_textCache.createTextLine(positionedGlyphs, batchId, 0.f, 20.f * i);
+            ASSERT_NE(InvalidTextLineId, lastTextLineId);
+        }
+
+        const TextBatch* batch = m_textCache.getTextBatch(batchId);
+        ASSERT_EQ(1u, batch->meshNodes.size());
+        EXPECT_EQ(meshNode, batch->meshNodes.front());
+        EXPECT_EQ(lineCount * 24u, meshNode->getIndexCount());
+
+        const TextLine* firstTextLine = m_textCache.getTextLine(firstTextLineId);
+        const TextLine* lastTextLine = m_textCache.getTextLine(lastTextLineId);
+        EXPECT_EQ(firstTextLine->indices, lastTextLine->indices);
+        EXPECT_EQ(firstTextLine->positions, lastTextLine->positions);
+        EXPECT_EQ(firstTextLine->textureCoordinates, lastTextLine->textureCoordinates);
+        EXPECT_LT(initialIndicesSize, lastTextLine->indices->getMaximumSizeInBytes());
+        EXPECT_EQ(lineCount * 24u * sizeof(uint32_t), lastTextLine->indices->getUsedSizeInBytes());
+        EXPECT_EQ(lineCount * 128u, lastTextLine->positions->getUsedSizeInBytes());
+    }
+
+    TEST_F(ATextCache, setsOffsetOfTextLineInTextBatch)
+    {
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect);
+
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs, batchId, 0.f, 0.f);
+        EXPECT_TRUE(m_textCache.setTextLineOffset(textLineId, 10.f, 20.f));
+        EXPECT_EQ(24u, m_textCache.getTextLine(textLineId)->meshNode->getIndexCount());
+    }
+
+    TEST_F(ATextCache, failsToSetOffsetOfTextLineNotInTextBatch)
+    {
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+        EXPECT_FALSE(m_textCache.setTextLineOffset(textLineId, 10.f, 20.f));
+        EXPECT_FALSE(m_textCache.setTextLineOffset(TextLineId(999u), 10.f, 20.f));
+    }
+
+    TEST_F(ATextCache, deletesTextBatchWithAllItsTextLines)
+    {
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect);
+
+        const TextLineId batchedTextLineId = m_textCache.createTextLine(positionedGlyphs, batchId, 0.f, 0.f);
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+
+        EXPECT_TRUE(m_textCache.deleteTextBatch(batchId));
+        EXPECT_EQ(nullptr, m_textCache.getTextBatch(batchId));
+        EXPECT_EQ(nullptr, m_textCache.getTextLine(batchedTextLineId));
+        EXPECT_NE(nullptr, m_textCache.getTextLine(textLineId));
+        EXPECT_FALSE(m_textCache.deleteTextBatch(batchId));
+    }
+
+    TEST_F(ATextCache, failsToUpdateNonExistingTextLine)
+    {
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+        EXPECT_FALSE(m_textCache.updateTextLine(InvalidTextLineId, positionedGlyphs));
+        EXPECT_FALSE(m_textCache.updateTextLine(TextLineId(3u), positionedGlyphs));
+    }
+
+    TEST_F(ATextCache, updatesTextLineReusingItsSceneObjects)
+    {
+        const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U"12:34", LatinFontInstance12);
+        const auto positionedGlyphs2 = m_textCache.getPositionedGlyphs(U"12:35", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs1, *textEffect);
+        const TextLine textLineBefore = *m_textCache.getTextLine(textLineId);
+        const Appearance* appearance = textLineBefore.meshNode->getAppearance();
+        const GeometryBinding* geometryBinding = textLineBefore.meshNode->getGeometryBinding();
+
+        EXPECT_TRUE(m_textCache.updateTextLine(textLineId, positionedGlyphs2));
+        const TextLine* textLine = m_textCache.getTextLine(textLineId);
+        ASSERT_TRUE(textLine != nullptr);
+        EXPECT_EQ(positionedGlyphs2, textLine->glyphs);
+        EXPECT_EQ(textLineBefore.atlasPage, textLine->atlasPage);
+        EXPECT_EQ(textLineBefore.meshNode, textLine->meshNode);
+        EXPECT_EQ(appearance, textLine->meshNode->getAppearance());
+        EXPECT_EQ(geometryBinding, textLine->meshNode->getGeometryBinding());
+        EXPECT_EQ(textLineBefore.indices, textLine->indices);
+        EXPECT_EQ(textLineBefore.positions, textLine->positions);
+        EXPECT_EQ(textLineBefore.textureCoordinates, textLine->textureCoordinates);
+        EXPECT_EQ(30u, textLine->meshNode->getIndexCount());
+    }
+
+    TEST_F(ATextCache, updatesTextLineWithShorterString)
+    {
+        const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U"123", LatinFontInstance12);
+        const auto positionedGlyphs2 = m_textCache.getPositionedGlyphs(U"9", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs1, *textEffect);
+        const VertexDataBuffer* positions = m_textCache.getTextLine(textLineId)->positions;
+
+        EXPECT_TRUE(m_textCache.updateTextLine(textLineId, positionedGlyphs2));
+        const TextLine* textLine = m_textCache.getTextLine(textLineId);
+        EXPECT_EQ(positions, textLine->positions);
+        EXPECT_EQ(6u, textLine->meshNode->getIndexCount());
+    }
+
+    TEST_F(ATextCache, replacesDataBuffersWithLargerOnesWhenUpdatingTextLineWithLongerString)
+    {
+        const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U"12", LatinFontInstance12);
+        const auto positionedGlyphs2 = m_textCache.getPositionedGlyphs(U"12345", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs1, *textEffect);
+        const MeshNode* meshNode = m_textCache.getTextLine(textLineId)->meshNode;
+        const GeometryBinding* geometryBinding = meshNode->getGeometryBinding();
+
+        EXPECT_TRUE(m_textCache.updateTextLine(textLineId, positionedGlyphs2));
+        const TextLine* textLine = m_textCache.getTextLine(textLineId);
+        EXPECT_EQ(meshNode, textLine->meshNode);
+        EXPECT_EQ(geometryBinding, textLine->meshNode->getGeometryBinding());
+        EXPECT_EQ(30u, textLine->meshNode->getIndexCount());
+        EXPECT_EQ(160u, textLine->positions->getUsedSizeInBytes());
+        EXPECT_EQ(160u, textLine->textureCoordinates->getUsedSizeInBytes());
+        EXPECT_EQ(60u, textLine->indices->getUsedSizeInBytes());
+    }
+
+    TEST_F(ATextCache, keepsTextLineUnchangedIfUpdateFails)
+    {
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+        auto invalidGlyphs = positionedGlyphs;
+        invalidGlyphs.back().key.fontInstanceId = FontInstanceId(999u);
+
+        EXPECT_FALSE(m_textCache.updateTextLine(textLineId, {}));
+        EXPECT_FALSE(m_textCache.updateTextLine(textLineId, invalidGlyphs));
+        EXPECT_FALSE(m_textCache.updateTextLine(textLineId, m_textCache.getPositionedGlyphs(U"ABCDEFGHIJKLMNOPQRSTUVWXYZ", LatinFontInstance20)));
+        const TextLine* textLine = m_textCache.getTextLine(textLineId);
+        EXPECT_EQ(positionedGlyphs, textLine->glyphs);
+        EXPECT_EQ(24u, textLine->meshNode->getIndexCount());
+    }
+
+    TEST_F(ATextCache, updatesTextLineInTextBatchInPlace)
+    {
+        const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U"12:34", LatinFontInstance12);
+        const auto positionedGlyphs2 = m_textCache.getPositionedGlyphs(U"12:5", LatinFontInstance12);
+        const auto positionedGlyphs3 = m_textCache.getPositionedGlyphs(U"abc", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect);
+
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs1, batchId, 0.f, 0.f);
+        m_textCache.createTextLine(positionedGlyphs3, batchId, 0.f, 20.f);
+        const MeshNode* meshNode = m_textCache.getTextBatch(batchId)->meshNodes.front();
+        EXPECT_EQ(48u, meshNode->getIndexCount());
+
+        EXPECT_TRUE(m_textCache.updateTextLine(textLineId, positionedGlyphs2));
+        EXPECT_EQ(positionedGlyphs2, m_textCache.getTextLine(textLineId)->glyphs);
+        EXPECT_EQ(meshNode, m_textCache.getTextLine(textLineId)->meshNode);
+        // range of removed quad is still allocated before range of second text line
+        EXPECT_EQ(48u, meshNode->getIndexCount());
+    }
+
+    TEST_F(ATextCache, updatesTextLineInTextBatchWithLongerString)
+    {
+        const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U"12", LatinFontInstance12);
+        const auto positionedGlyphs2 = m_textCache.getPositionedGlyphs(U"12345", LatinFontInstance12);
+        const auto positionedGlyphs3 = m_textCache.getPositionedGlyphs(U"abc", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect);
+
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs1, batchId, 0.f, 0.f);
+        m_textCache.createTextLine(positionedGlyphs3, batchId, 0.f, 20.f);
+        const MeshNode* meshNode = m_textCache.getTextBatch(batchId)->meshNodes.front();
+        EXPECT_EQ(30u, meshNode->getIndexCount());
+
+        // text line is moved behind second text line
+        EXPECT_TRUE(m_textCache.updateTextLine(textLineId, positionedGlyphs2));
+        EXPECT_EQ(positionedGlyphs2, m_textCache.getTextLine(textLineId)->glyphs);
+        EXPECT_EQ(meshNode, m_textCache.getTextLine(textLineId)->meshNode);
+        EXPECT_EQ(60u, meshNode->getIndexCount());
+
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId));
+        EXPECT_EQ(30u, meshNode->getIndexCount());
+    }
+
+    TEST_F(ATextCache, sharesGlyphsOfSDFTextLinesWithDifferentSizes)
+    {
+        const FontInstanceId sdfFontInstance12 = FRegistry->createFreetype2FontInstanceSDF(LatinFont, 12u);
+        const FontInstanceId sdfFontInstance48 = FRegistry->createFreetype2FontInstanceSDF(LatinFont, 48u);
+        const auto positionedGlyphs12 = m_textCache.getPositionedGlyphs(U"ab", sdfFontInstance12);
+        const auto positionedGlyphs48 = m_textCache.getPositionedGlyphs(U"ab", sdfFontInstance48);
+        ASSERT_EQ(2u, positionedGlyphs12.size());
+        ASSERT_EQ(2u, positionedGlyphs48.size());
+        EXPECT_EQ(positionedGlyphs12[0].key, positionedGlyphs48[0].key);
+        EXPECT_EQ(positionedGlyphs12[1].key, positionedGlyphs48[1].key);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateSDFTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId12 = m_textCache.createTextLine(positionedGlyphs12, *textEffect);
+        const TextLineId textLineId48 = m_textCache.createTextLine(positionedGlyphs48, *textEffect);
+        ASSERT_NE(InvalidTextLineId, textLineId12);
+        ASSERT_NE(InvalidTextLineId, textLineId48);
+
+        // glyphs of both sizes fit on first page only because they are stored once
+        EXPECT_EQ(0u, m_textCache.getTextLine(textLineId12)->atlasPage);
+        EXPECT_EQ(0u, m_textCache.getTextLine(textLineId48)->atlasPage);
+        EXPECT_EQ(2u, m_textCache.impl->getAtlasGlyphCount());
+
+        EXPECT_TRUE(FRegistry->deleteFontInstance(sdfFontInstance12));
+        EXPECT_TRUE(FRegistry->deleteFontInstance(sdfFontInstance48));
+    }
+
+    TEST_F(ATextCache, doesNotCachePositionedGlyphsByDefault)
+    {
+        m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12);
+        m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12);
+
+        const ShapingCacheStatistics statistics = m_textCache.getShapingCacheStatistics();
+        EXPECT_EQ(0u, statistics.capacity);
+        EXPECT_EQ(0u, statistics.entries);
+        EXPECT_EQ(0u, statistics.hits);
+    }
+
+    TEST_F(ATextCache, returnsCachedPositionedGlyphsOfRepeatedString)
+    {
+        m_textCache.setShapingCacheCapacity(8u);
+
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12);
+        EXPECT_EQ(positionedGlyphs, m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12));
+        EXPECT_EQ(positionedGlyphs, m_textCache.getPositionedGlyphs(U"test", { { LatinFontInstance12, 0u } }));
+        EXPECT_NE(positionedGlyphs, m_textCache.getPositionedGlyphs(U"test", LatinFontInstance20));
+
+        ShapingCacheStatistics statistics = m_textCache.getShapingCacheStatistics();
+        EXPECT_EQ(8u, statistics.capacity);
+        EXPECT_EQ(2u, statistics.entries);
+        EXPECT_EQ(2u, statistics.hits);
+        EXPECT_EQ(2u, statistics.misses);
+
+        m_textCache.clearShapingCache();
+        EXPECT_EQ(positionedGlyphs, m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12));
+        statistics = m_textCache.getShapingCacheStatistics();
+        EXPECT_EQ(1u, statistics.entries);
+        EXPECT_EQ(3u, statistics.misses);
+    }
+
+    TEST_F(ATextCache, doesNotCachePositionedGlyphsWithUnknownFontInstance)
+    {
+        m_textCache.setShapingCacheCapacity(8u);
+        m_textCache.getPositionedGlyphs(U"test", { { LatinFontInstance12, 0u }, { FontInstanceId(999u), 2u } });
+        EXPECT_EQ(0u, m_textCache.getShapingCacheStatistics().entries);
+    }
+
+    TEST_F(ATextCache, removesCachedPositionedGlyphsOfDeletedFontInstance)
+    {
+        m_textCache.setShapingCacheCapacity(8u);
+        const FontInstanceId fontInstance = FRegistry->createFreetype2FontInstance(LatinFont, 16u);
+        EXPECT_FALSE(m_textCache.getPositionedGlyphs(U"test", fontInstance).empty());
+        m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12);
+        EXPECT_EQ(2u, m_textCache.getShapingCacheStatistics().entries);
+
+        EXPECT_TRUE(FRegistry->deleteFontInstance(fontInstance));
+        EXPECT_TRUE(m_textCache.getPositionedGlyphs(U"test", fontInstance).empty());
+        EXPECT_EQ(1u, m_textCache.getShapingCacheStatistics().entries);
+    }
+
+    TEST_F(ATextCache, preloadsGlyphsAndCreatesTextLineFromThem)
+    {
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U"preloaded text", LatinFontInstance20);
+        EXPECT_TRUE(m_textCache.preloadGlyphs(positionedGlyphs, 4u));
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+        ASSERT_NE(InvalidTextLineId, textLineId);
+        const TextLine* textLine = m_textCache.getTextLine(textLineId);
+        ASSERT_TRUE(textLine != nullptr);
+        EXPECT_EQ(positionedGlyphs, textLine->glyphs);
+    }
+
+    TEST_F(ATextCache, failsToPreloadGlyphsOfNonExistingFontInstance)
+    {
+        auto positionedGlyphs = m_textCache.getPositionedGlyphs(U"abc", LatinFontInstance20);
+        positionedGlyphs.back().key.fontInstanceId = FontInstanceId(999u);
+        EXPECT_FALSE(m_textCache.preloadGlyphs(positionedGlyphs, 2u));
+        EXPECT_TRUE(m_textCache.preloadGlyphs({}, 2u));
+    }
+
+    TEST_F(ATextCache, evictsUnusedGlyphsInsteadOfCreatingPagesBeyondMaximumPageCount)
+    {
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        m_textCache.setMaximumAtlasPageCount(1u);
+        const std::u32string chars = U"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+        for (size_t i = 0u; i + 6u <= chars.size(); i += 6u)
+        {
+            const auto positionedGlyphs = m_textCache.getPositionedGlyphs(chars.substr(i, 6u), LatinFontInstance20);
+            const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+            ASSERT_NE(InvalidTextLineId, textLineId);
+            EXPECT_EQ(0u, m_textCache.getTextLine(textLineId)->atlasPage);
+            EXPECT_TRUE(m_textCache.deleteTextLine(textLineId));
+        }
+        EXPECT_EQ(1u, m_textCache.getAtlasPageCount());
+    }
+
+    TEST_F(ATextCache, compactsAtlasMovingRemainingTextLinesToFirstPage)
+    {
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect);
+
+        // alternate single and batched text lines until there are several pages
+        const std::u32string chars = U"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+        std::vector<TextLineId> textLineIds;
+        for (size_t i = 0u; i + 6u <= chars.size() && m_textCache.getAtlasPageCount() < 3u; i += 6u)
+        {
+            const auto positionedGlyphs = m_textCache.getPositionedGlyphs(chars.substr(i, 6u), LatinFontInstance20);
+            const TextLineId textLineId = (textLineIds.size() % 2u == 0u) ?
+                m_textCache.createTextLine(positionedGlyphs, *textEffect) :
+                m_textCache.createTextLine(positionedGlyphs, batchId, 0.f, 0.f);
+            ASSERT_NE(InvalidTextLineId, textLineId);
+            textLineIds.push_back(textLineId);
+        }
+        ASSERT_EQ(3u, m_textCache.getAtlasPageCount());
+        ASSERT_GE(textLineIds.size(), 3u);
+
+        // keep last single and last batched text line
+        const TextLineId lastTextLineId = textLineIds.back();
+        const TextLineId secondLastTextLineId = textLineIds[textLineIds.size() - 2u];
+        for (size_t i = 0u; i + 2u < textLineIds.size(); ++i)
+            EXPECT_TRUE(m_textCache.deleteTextLine(textLineIds[i]));
+        const GlyphMetricsVector lastGlyphs = m_textCache.getTextLine(lastTextLineId)->glyphs;
+        EXPECT_NE(0u, m_textCache.getTextLine(lastTextLineId)->atlasPage);
+
+        EXPECT_TRUE(m_textCache.compactAtlas());
+        EXPECT_EQ(1u, m_textCache.getAtlasPageCount());
+        for (const auto textLineId : { lastTextLineId, secondLastTextLineId })
+        {
+            const TextLine* textLine = m_textCache.getTextLine(textLineId);
+            ASSERT_TRUE(textLine != nullptr);
+            EXPECT_EQ(0u, textLine->atlasPage);
+            EXPECT_NE(nullptr, textLine->meshNode);
+        }
+        EXPECT_EQ(lastGlyphs, m_textCache.getTextLine(lastTextLineId)->glyphs);
+
+        const TextBatch* batch = m_textCache.getTextBatch(batchId);
+        ASSERT_EQ(1u, batch->meshNodes.size());
+
+        // text lines can be updated and deleted after compaction
+        EXPECT_TRUE(m_textCache.updateTextLine(lastTextLineId, m_textCache.getPositionedGlyphs(U"xyz", LatinFontInstance20)));
+        EXPECT_TRUE(m_textCache.deleteTextLine(lastTextLineId));
+        EXPECT_TRUE(m_textCache.deleteTextLine(secondLastTextLineId));
+        EXPECT_TRUE(m_textCache.deleteTextBatch(batchId));
+    }
 }
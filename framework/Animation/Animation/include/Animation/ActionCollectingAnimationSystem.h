@@ -12,6 +12,7 @@
 #include "Animation/AnimationSystem.h"
 #include "SceneAPI/SceneId.h"
 #include "Scene/SceneActionCollectionCreator.h"
+#include "Scene/SceneLockGuard.h"
 
 namespace ramses_internal
 {
@@ -20,7 +21,7 @@ namespace ramses_internal
     class ActionCollectingAnimationSystem final : public AnimationSystem
     {
     public:
-        ActionCollectingAnimationSystem(UInt32 flags, SceneActionCollection& actionCollector, const AnimationSystemSizeInformation& sizeInfo);
+        ActionCollectingAnimationSystem(UInt32 flags, SceneActionCollection& actionCollector, const AnimationSystemSizeInformation& sizeInfo, PlatformLock* sceneLock = nullptr);
 
         virtual void                        setTime(const AnimationTime& globalTime) override;
 
@@ -63,6 +64,7 @@ namespace ramses_internal
     protected:
         SceneActionCollection&               m_sceneActionsCollector;
         SceneActionCollectionCreator         m_creator;
+        PlatformLock*                        m_sceneLock;
     };
 }
 
@@ -15,6 +15,7 @@
 namespace ramses_internal
 {
     class SceneActionCollection;
+    class PlatformLock;
     class IAnimationSystem;
     struct AnimationSystemSizeInformation;
 
@@ -28,13 +29,14 @@ namespace ramses_internal
     class AnimationSystemFactory
     {
     public:
-        AnimationSystemFactory(EAnimationSystemOwner ownerType, SceneActionCollection* actionCollector = 0);
+        AnimationSystemFactory(EAnimationSystemOwner ownerType, SceneActionCollection* actionCollector = 0, PlatformLock* sceneLock = nullptr);
 
         IAnimationSystem* createAnimationSystem(UInt32 flags, const AnimationSystemSizeInformation& sizeInfo);
 
     protected:
         EAnimationSystemOwner m_ownerType;
         SceneActionCollection* m_actionCollector;
+        PlatformLock* m_sceneLock;
     };
 }
 
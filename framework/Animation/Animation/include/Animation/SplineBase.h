@@ -13,6 +13,7 @@
 #include "Utils/DataTypeUtils.h"
 #include "Animation/AnimationCommon.h"
 #include "Animation/AnimationCollectionTypes.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
@@ -31,6 +32,10 @@ namespace ramses_internal
         UInt32 getNumKeys() const;
         SplineTimeStamp getTimeStamp(const SplineKeyIndex keyIndex) const;
 
+        // Returns index of last key with time stamp less or equal to given time stamp or InvalidSplineKeyIndex if there is none.
+        // Keys following the hint key are probed first (amortized O(1) for continuous playback), binary search is used otherwise.
+        SplineKeyIndex getIndexOfKeyBeforeOrEqual(const SplineTimeStamp timeStamp, const SplineKeyIndex hintKeyIndex = InvalidSplineKeyIndex) const;
+
     protected:
         SplineTimeStampVector m_timeStamps;
 
@@ -51,15 +56,43 @@ namespace ramses_internal
 
     inline SplineKeyIndex SplineBase::getIndexOfKeyAfterOrEqual(const SplineTimeStamp timeStamp) const
     {
-        for (SplineKeyIndex index = 0; index < getNumKeys(); ++index)
+        const auto it = std::lower_bound(m_timeStamps.cbegin(), m_timeStamps.cend(), timeStamp);
+        if (it == m_timeStamps.cend())
+        {
+            return InvalidSplineKeyIndex;
+        }
+
+        return static_cast<SplineKeyIndex>(it - m_timeStamps.cbegin());
+    }
+
+    inline SplineKeyIndex SplineBase::getIndexOfKeyBeforeOrEqual(const SplineTimeStamp timeStamp, const SplineKeyIndex hintKeyIndex) const
+    {
+        const UInt32 numKeys = getNumKeys();
+        if (numKeys == 0u || timeStamp < m_timeStamps.front())
         {
-            if (m_timeStamps[index] >= timeStamp)
+            return InvalidSplineKeyIndex;
+        }
+
+        if (hintKeyIndex < numKeys && m_timeStamps[hintKeyIndex] <= timeStamp)
+        {
+            const UInt32 MaxForwardSteps = 4u;
+            const SplineKeyIndex lastProbedIndex = std::min(hintKeyIndex + MaxForwardSteps, numKeys - 1u);
+            for (SplineKeyIndex index = hintKeyIndex; index < lastProbedIndex; ++index)
+            {
+                if (m_timeStamps[index + 1u] > timeStamp)
+                {
+                    return index;
+                }
+            }
+
+            if (lastProbedIndex == numKeys - 1u)
             {
-                return index;
+                return lastProbedIndex;
             }
         }
 
-        return InvalidSplineKeyIndex;
+        const auto it = std::upper_bound(m_timeStamps.cbegin(), m_timeStamps.cend(), timeStamp);
+        return static_cast<SplineKeyIndex>(it - m_timeStamps.cbegin()) - 1u;
     }
 }
 
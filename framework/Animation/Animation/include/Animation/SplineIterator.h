@@ -33,7 +33,6 @@ namespace ramses_internal
 
     private:
         void setCurrentSegment();
-        SplineSegment findSegmentInRange(SplineTimeStamp timeStamp, SplineKeyIndex keyIndexFrom, SplineKeyIndex keyIndexTo) const;
         SplineSegment getSegmentClampedToValidRange(SplineTimeStamp timeStamp);
         void setSegmentLocalTime();
         void resetForSplineChange(const SplineBase* spline);
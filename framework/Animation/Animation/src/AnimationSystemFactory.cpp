@@ -12,9 +12,10 @@
 
 namespace ramses_internal
 {
-    AnimationSystemFactory::AnimationSystemFactory(EAnimationSystemOwner ownerType, SceneActionCollection* actionCollector)
+    AnimationSystemFactory::AnimationSystemFactory(EAnimationSystemOwner ownerType, SceneActionCollection* actionCollector, PlatformLock* sceneLock)
         : m_ownerType(ownerType)
         , m_actionCollector(actionCollector)
+        , m_sceneLock(sceneLock)
     {
     }
 
@@ -32,7 +33,7 @@ namespace ramses_internal
             return new AnimationSystem(flags, sizeInfo);
         case EAnimationSystemOwner_Client:
             assert(m_actionCollector != nullptr);
-            return new ActionCollectingAnimationSystem(flags, *m_actionCollector, sizeInfo);
+            return new ActionCollectingAnimationSystem(flags, *m_actionCollector, sizeInfo, m_sceneLock);
         default:
             return nullptr;
         }
@@ -66,49 +66,20 @@ namespace ramses_internal
     void SplineIterator::setCurrentSegment()
     {
         const UInt32 numKeys = m_spline->getNumKeys();
-        const SplineKeyIndex currSegmentStart = m_segment.m_startIndex;
-        if (currSegmentStart != InvalidSplineKeyIndex)
+        const SplineKeyIndex keyStartIndex = m_spline->getIndexOfKeyBeforeOrEqual(m_timeStamp, m_segment.m_startIndex);
+        if (keyStartIndex != InvalidSplineKeyIndex && keyStartIndex + 1u < numKeys)
         {
-            m_segment = findSegmentInRange(m_timeStamp, m_segment.m_endIndex, numKeys - 1u);
+            const SplineKeyIndex keyEndIndex = keyStartIndex + 1u;
+            m_segment = SplineSegment(keyStartIndex, keyEndIndex, m_spline->getTimeStamp(keyStartIndex), m_spline->getTimeStamp(keyEndIndex));
         }
-
-        if (!m_segment.IsValid())
+        else
         {
-            m_segment = findSegmentInRange(m_timeStamp, 0, min(currSegmentStart, numKeys - 1u));
-            if (!m_segment.IsValid())
-            {
-                m_segment = getSegmentClampedToValidRange(m_timeStamp);
-            }
+            m_segment = getSegmentClampedToValidRange(m_timeStamp);
         }
 
         assert(m_segment.IsValid());
     }
 
-    SplineSegment SplineIterator::findSegmentInRange(SplineTimeStamp timeStamp, SplineKeyIndex keyIndexFrom, SplineKeyIndex keyIndexTo) const
-    {
-        SplineKeyIndex keyStartIndex = keyIndexFrom;
-        SplineTimeStamp keyStartTime = m_spline->getTimeStamp(keyStartIndex);
-        if (keyStartTime <= timeStamp)
-        {
-            for (SplineKeyIndex i = keyStartIndex + 1; i <= keyIndexTo; ++i)
-            {
-                const SplineKeyIndex keyEndIndex = i;
-                const SplineTimeStamp keyEndTime = m_spline->getTimeStamp(i);
-
-                const SplineSegment currentSegment(keyStartIndex, keyEndIndex, keyStartTime, keyEndTime);
-                if (currentSegment.IsTimeInSegment(timeStamp))
-                {
-                    return currentSegment;
-                }
-
-                keyStartIndex = keyEndIndex;
-                keyStartTime = keyEndTime;
-            }
-        }
-
-        return SplineSegment();
-    }
-
     SplineSegment SplineIterator::getSegmentClampedToValidRange(SplineTimeStamp timeStamp)
     {
         const SplineKeyIndex firstKeyIndex = 0;
@@ -130,6 +130,55 @@ namespace ramses_internal
         EXPECT_EQ(0u, iter.getTimeStamp());
     }
 
+    TEST_F(ASplineIterator, FindsCorrectSegmentInLongSplineForContinuousAndRandomAccess)
+    {
+        SplineVec3 spline;
+        const UInt32 numKeys = 5000u;
+        for (UInt32 i = 0u; i < numKeys; ++i)
+        {
+            spline.setKey(100u + i * 10u, SplineKeyVec3());
+        }
+
+        SplineIterator iter;
+        const auto expectSegmentFor = [&](SplineTimeStamp timeStamp)
+        {
+            iter.setTimeStamp(timeStamp, &spline);
+            const SplineKeyIndex expectedStartIdx = (timeStamp - 100u) / 10u;
+            EXPECT_EQ(expectedStartIdx, iter.getSegment().m_startIndex);
+            EXPECT_EQ(expectedStartIdx + 1u, iter.getSegment().m_endIndex);
+            EXPECT_TRUE(iter.getSegment().IsTimeInSegment(timeStamp));
+        };
+
+        for (SplineTimeStamp timeStamp = 100u; timeStamp < 100u + (numKeys - 1u) * 10u; timeStamp += 7u)
+        {
+            expectSegmentFor(timeStamp);
+        }
+
+        for (UInt32 i = 0u; i < 1000u; ++i)
+        {
+            expectSegmentFor(TestRandom::Get(100u, 100u + (numKeys - 1u) * 10u - 1u));
+        }
+    }
+
+    TEST_F(ASplineIterator, ReturnsIndexOfKeyBeforeOrEqualRegardlessOfHint)
+    {
+        SplineVec3 spline;
+        spline.setKey(100u, SplineKeyVec3());
+        spline.setKey(200u, SplineKeyVec3());
+        spline.setKey(300u, SplineKeyVec3());
+
+        EXPECT_EQ(InvalidSplineKeyIndex, spline.getIndexOfKeyBeforeOrEqual(99u));
+        EXPECT_EQ(InvalidSplineKeyIndex, spline.getIndexOfKeyBeforeOrEqual(99u, 2u));
+        EXPECT_EQ(0u, spline.getIndexOfKeyBeforeOrEqual(100u));
+        EXPECT_EQ(0u, spline.getIndexOfKeyBeforeOrEqual(199u, 0u));
+        EXPECT_EQ(1u, spline.getIndexOfKeyBeforeOrEqual(250u, 0u));
+        EXPECT_EQ(1u, spline.getIndexOfKeyBeforeOrEqual(250u, 2u));
+        EXPECT_EQ(1u, spline.getIndexOfKeyBeforeOrEqual(250u, 7u));
+        EXPECT_EQ(2u, spline.getIndexOfKeyBeforeOrEqual(300u, 1u));
+        EXPECT_EQ(2u, spline.getIndexOfKeyBeforeOrEqual(1000u, 2u));
+        EXPECT_EQ(2u, spline.getIndexOfKeyBeforeOrEqual(1000u));
+    }
+
     void ASplineIterator::stateBeforeSplineStart()
     {
         m_splineInit.setTimeStamp(0u);
@@ -189,6 +189,11 @@ namespace ramses_internal
 
         ESceneActionId_Incomplete,
 
+        // new actions are appended to keep the ids of existing actions stable
+        ESceneActionId_SetRenderableBoundingSphere,
+        ESceneActionId_SetRenderablesVisibility,
+        ESceneActionId_SetDataArrayForInstances,
+
         ESceneActionId_NUMBER_OF_TYPES
     };
 
@@ -380,6 +385,10 @@ case ENUMVALUE: return #ENUMVALUE
 
             CreateNameForEnumID(ESceneActionId_Incomplete);
 
+            CreateNameForEnumID(ESceneActionId_SetRenderableBoundingSphere);
+            CreateNameForEnumID(ESceneActionId_SetRenderablesVisibility);
+            CreateNameForEnumID(ESceneActionId_SetDataArrayForInstances);
+
         case ESceneActionId_NUMBER_OF_TYPES:
             break;
         }
@@ -15,6 +15,7 @@
 #include "Utils/BinaryInputStream.h"
 #include "Utils/RawBinaryOutputStream.h"
 #include "Utils/StatisticCollection.h"
+#include "Utils/TraceEventRecorder.h"
 #include <thread>
 
 namespace ramses_internal
@@ -359,8 +360,11 @@ namespace ramses_internal
         const uint32_t remainingSize = fullSize - sizeof(pp->lengthReceiveBuffer);
         s << remainingSize;
 
+        const UInt64 sendStartTime = GetTraceEventRecorder().isEnabled() ? PlatformTime::GetMicrosecondsMonotonic() : 0u;
         asio::async_write(pp->socket, asio::const_buffer(pp->currentOutBuffer.data(), pp->currentOutBuffer.size()),
-                          [this, pp](asio::error_code e, std::size_t sentBytes) {
+                          [this, pp, sendStartTime](asio::error_code e, std::size_t sentBytes) {
+                              if (sendStartTime != 0u)
+                                  GetTraceEventRecorder().recordEvent("communication", "SendMessage", sendStartTime, PlatformTime::GetMicrosecondsMonotonic() - sendStartTime, sentBytes);
                               if (e)
                               {
                                   LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendMessageToParticipant: Send to "
@@ -621,6 +625,7 @@ namespace ramses_internal
         uint32_t messageTypeTmp = 0;
         stream >> messageTypeTmp;
         EMessageId messageType = static_cast<EMessageId>(messageTypeTmp);
+        TRACE_SCOPE_WITH_ID("communication", "HandleReceivedMessage", messageType);
 
         LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleReceivedMessage: From " <<
                  pp->address.getParticipantId() << ", type " << GetNameForMessageId(messageType) << "/" << messageType);
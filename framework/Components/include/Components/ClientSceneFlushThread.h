@@ -0,0 +1,65 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_CLIENTSCENEFLUSHTHREAD_H
+#define RAMSES_CLIENTSCENEFLUSHTHREAD_H
+
+#include "Components/ClientSceneLogicShadowCopy.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include "PlatformAbstraction/PlatformLock.h"
+#include "PlatformAbstraction/PlatformConditionVariable.h"
+#include <deque>
+
+namespace ramses_internal
+{
+    // Applies prepared flushes of client scenes to their shadow copy and sends them on a separate thread,
+    // so that the thread modifying the scenes only needs to hand over the collected scene actions.
+    // All flushes are processed in the order they were queued, regardless of the scene they belong to.
+    // Applying a flush only needs the processing lock, the framework lock is taken just for sending it afterwards.
+    // Lock order is always framework lock before processing lock, this way any other thread holding the framework lock
+    // can process pending flushes itself and is guaranteed that no flush is in progress once it holds the processing lock.
+    class ClientSceneFlushThread : public Runnable
+    {
+    public:
+        static const UInt32 MaxNumberOfPendingFlushes = 16u;
+
+        explicit ClientSceneFlushThread(PlatformLock& frameworkLock);
+        virtual ~ClientSceneFlushThread() override;
+
+        // framework lock must be held for all following calls
+        void queueFlush(ClientSceneLogicShadowCopy& sceneLogic, ClientSceneLogicShadowCopy::PreparedFlush&& flush);
+        void processPendingFlushes();
+        UInt32 getNumberOfPendingFlushes() const;
+
+    private:
+        virtual void run() override final;
+        // processing lock must be held
+        Bool applyNextPendingFlush();
+        // framework lock and processing lock must be held
+        void sendAppliedFlush();
+
+        struct PendingFlush
+        {
+            ClientSceneLogicShadowCopy* sceneLogic = nullptr;
+            ClientSceneLogicShadowCopy::PreparedFlush flush;
+        };
+
+        PlatformLock& m_frameworkLock;
+        PlatformThread m_thread;
+        Bool m_threadStarted = false;
+
+        mutable PlatformLightweightLock m_queueLock;
+        PlatformConditionVariable m_queueCondVar;
+        std::deque<PendingFlush> m_pendingFlushes;
+
+        PlatformLightweightLock m_processingLock;
+        PendingFlush m_appliedFlush;
+    };
+}
+
+#endif
@@ -14,6 +14,7 @@
 #include "Scene/ClientScene.h"
 #include "Animation/AnimationSystemFactory.h"
 #include "Scene/Scene.h"
+#include <memory>
 
 namespace ramses_internal
 {
@@ -39,9 +40,15 @@ namespace ramses_internal
 
         const char* getSceneStateString() const;
 
+        // described scene larger than limit is not kept for subscribers arriving later
+        void setSceneSnapshotSizeLimit(UInt32 sizeInBytes);
+
+        static const UInt32 DefaultSceneSnapshotSizeLimit = 16u * 1024u * 1024u;
+
     protected:
         virtual void postAddSubscriber() {};
         void sendSceneToWaitingSubscribers(const IScene& scene, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag);
+        void releaseSceneSnapshot();
         void printFlushInfo(StringOutputStream& sos, const char* name, const SceneActionCollection& collection, ESceneFlushMode flushMode) const;
 
         ISceneGraphSender&     m_scenegraphSender;
@@ -56,6 +63,21 @@ namespace ramses_internal
 
         UInt64                 m_flushCounter = 0u;
         AnimationSystemFactory m_animationSystemFactory;
+
+    private:
+        // Described scene is the same for all subscribers arriving before next flush,
+        // it is kept to avoid describing the scene again for each of them (e.g. when many renderers reconnect at once).
+        struct SceneSnapshot
+        {
+            SceneActionCollection collection;
+            UInt64 flushCounter = 0u;
+            UInt32 creationTimeInMicroseconds = 0u;
+            UInt32 numClientResources = 0u;
+            UInt32 numSceneResourceActions = 0u;
+            size_t sceneResourcesSize = 0u;
+        };
+        std::unique_ptr<SceneSnapshot> m_sceneSnapshot;
+        UInt32 m_sceneSnapshotSizeLimit = DefaultSceneSnapshotSizeLimit;
     };
 }
 
@@ -10,9 +10,13 @@
 #define RAMSES_CLIENTSCENELOGICDIRECT_H
 
 #include "Components/ClientSceneLogicBase.h"
+#include "Components/FlushTimeInformation.h"
 
 namespace ramses_internal
 {
+    // Scene logic without scene shadow copy, new subscribers get the scene described from the client scene itself.
+    // Client scene is modified by client thread, it is described under scene lock and only if it has no unflushed changes,
+    // i.e. it is consistent snapshot of last flushed state, otherwise subscriber waits for next flush.
     class ClientSceneLogicDirect final : public ClientSceneLogicBase
     {
     public:
@@ -21,7 +25,11 @@ namespace ramses_internal
         virtual void flushSceneActions(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) override;
 
     private:
+        virtual void postAddSubscriber() override;
+
         SceneSizeInformation   m_previousSceneSizes;
+        FlushTimeInformation   m_flushTimeInfoOfLastFlush;
+        SceneVersionTag        m_lastVersionTag = InvalidSceneVersionTag;
     };
 }
 
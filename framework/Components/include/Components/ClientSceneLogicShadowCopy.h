@@ -11,6 +11,7 @@
 
 #include "Components/ClientSceneLogicBase.h"
 #include "Components/FlushTimeInformation.h"
+#include "Scene/SceneResourceChanges.h"
 
 namespace ramses_internal
 {
@@ -21,6 +22,24 @@ namespace ramses_internal
 
         virtual void flushSceneActions(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) override;
 
+        // Flush is split into phases to allow applying and sending on another thread than the one modifying the ClientScene.
+        // Preparing only takes over all pending data from ClientScene. Applying a prepared flush updates the shadow copy
+        // and serializes the flush without touching subscribers, so it does not need the framework lock.
+        // Sending an applied flush does need the framework lock. Flushes have to be applied in the same order as they
+        // were prepared and each applied flush has to be sent before the next one is applied.
+        struct PreparedFlush
+        {
+            SceneActionCollection collection;
+            ESceneFlushMode flushMode;
+            SceneSizeInformation sceneSizes;
+            SceneResourceChanges resourceChanges;
+            FlushTimeInformation flushTimeInfo;
+            SceneVersionTag versionTag;
+        };
+        PreparedFlush prepareFlush(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag);
+        void applyPreparedFlush(PreparedFlush& flush);
+        void sendAppliedFlush(PreparedFlush&& flush);
+
     private:
         virtual void postAddSubscriber() override;
         void sendShadowCopySceneToWaitingSubscribers();
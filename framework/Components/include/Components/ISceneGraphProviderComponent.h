@@ -26,7 +26,7 @@ namespace ramses_internal
     public:
         virtual ~ISceneGraphProviderComponent() {}
         virtual void setSceneProviderServiceHandler(ISceneProviderServiceHandler* handler) = 0;
-        virtual void handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization) = 0;
+        virtual void handleCreateScene(ClientScene& scene, bool disableSceneShadowCopy, bool enableAsynchronousFlush) = 0;
         virtual void handlePublishScene(SceneId sceneId, EScenePublicationMode publicationMode) = 0;
         virtual void handleUnpublishScene(SceneId sceneId) = 0;
         virtual void handleFlush(SceneId sceneId, ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) = 0;
@@ -21,11 +21,14 @@
 #include "Collections/HashSet.h"
 #include "SceneAPI/SceneSizeInformation.h"
 #include "Utils/IPeriodicLogSupplier.h"
+#include <memory>
 
 namespace ramses_internal
 {
     class Guid;
     class ClientSceneLogicBase;
+    class ClientSceneLogicShadowCopy;
+    class ClientSceneFlushThread;
     class IConnectionStatusUpdateNotifier;
     class ICommunicationSystem;
     class SceneActionCollection;
@@ -50,7 +53,7 @@ namespace ramses_internal
         virtual void newParticipantHasConnected(const Guid& guid) override;
         virtual void participantHasDisconnected(const Guid& guid) override;
 
-        virtual void handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization) override;
+        virtual void handleCreateScene(ClientScene& scene, bool disableSceneShadowCopy, bool enableAsynchronousFlush) override;
         virtual void handlePublishScene(SceneId sceneId, EScenePublicationMode publicationMode) override;
         virtual void handleUnpublishScene(SceneId sceneId) override;
         virtual void handleFlush(SceneId sceneId, ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) override;
@@ -91,6 +94,10 @@ namespace ramses_internal
         typedef HashMap<SceneId, ClientSceneLogicBase*> ClientSceneLogicMap;
         ClientSceneLogicMap m_clientSceneLogicMap;
 
+        void processPendingAsynchronousFlushes(SceneId sceneId);
+        HashMap<SceneId, ClientSceneLogicShadowCopy*> m_asynchronousFlushSceneLogics;
+        std::unique_ptr<ClientSceneFlushThread> m_flushThread;
+
         typedef std::pair<Guid, SceneId> Subscription;
         typedef HashMap<Subscription, uint64_t > SceneActionListCountPerSubscription;
         SceneActionListCountPerSubscription m_subscriptions;
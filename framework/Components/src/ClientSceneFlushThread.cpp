@@ -0,0 +1,128 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Components/ClientSceneFlushThread.h"
+#include "PlatformAbstraction/PlatformGuard.h"
+#include "Utils/LogMacros.h"
+#include "Utils/TraceEventRecorder.h"
+#include <cassert>
+
+namespace ramses_internal
+{
+    ClientSceneFlushThread::ClientSceneFlushThread(PlatformLock& frameworkLock)
+        : m_frameworkLock(frameworkLock)
+        , m_thread("R_SceneFlush")
+    {
+    }
+
+    ClientSceneFlushThread::~ClientSceneFlushThread()
+    {
+        if (m_threadStarted)
+        {
+            m_thread.cancel();
+            {
+                PlatformLightweightGuard guard(m_queueLock);
+                m_queueCondVar.broadcast();
+            }
+            m_thread.join();
+        }
+
+        if (!m_pendingFlushes.empty() || m_appliedFlush.sceneLogic != nullptr)
+            LOG_WARN(CONTEXT_CLIENT, "ClientSceneFlushThread::~ClientSceneFlushThread: discarding " << m_pendingFlushes.size() << " pending flushes"
+                << (m_appliedFlush.sceneLogic != nullptr ? " and one applied flush not sent yet" : ""));
+    }
+
+    void ClientSceneFlushThread::queueFlush(ClientSceneLogicShadowCopy& sceneLogic, ClientSceneLogicShadowCopy::PreparedFlush&& flush)
+    {
+        // if flush thread cannot keep up, process in calling thread instead of queueing up unlimited amount of data
+        if (getNumberOfPendingFlushes() >= MaxNumberOfPendingFlushes)
+        {
+            LOG_DEBUG(CONTEXT_CLIENT, "ClientSceneFlushThread::queueFlush: too many pending flushes, processing them synchronously");
+            processPendingFlushes();
+        }
+
+        {
+            PlatformLightweightGuard guard(m_queueLock);
+            m_pendingFlushes.push_back({ &sceneLogic, std::move(flush) });
+            m_queueCondVar.signal();
+        }
+
+        if (!m_threadStarted)
+        {
+            m_thread.start(*this);
+            m_threadStarted = true;
+        }
+    }
+
+    void ClientSceneFlushThread::processPendingFlushes()
+    {
+        PlatformLightweightGuard processingGuard(m_processingLock);
+        // flush thread might have applied a flush but not sent it yet
+        sendAppliedFlush();
+        while (applyNextPendingFlush())
+            sendAppliedFlush();
+    }
+
+    UInt32 ClientSceneFlushThread::getNumberOfPendingFlushes() const
+    {
+        PlatformLightweightGuard guard(m_queueLock);
+        return static_cast<UInt32>(m_pendingFlushes.size());
+    }
+
+    Bool ClientSceneFlushThread::applyNextPendingFlush()
+    {
+        assert(m_appliedFlush.sceneLogic == nullptr);
+        {
+            PlatformLightweightGuard guard(m_queueLock);
+            if (m_pendingFlushes.empty())
+                return false;
+            m_appliedFlush = std::move(m_pendingFlushes.front());
+            m_pendingFlushes.pop_front();
+        }
+
+        TRACE_SCOPE("client", "ApplyFlushAsync");
+        m_appliedFlush.sceneLogic->applyPreparedFlush(m_appliedFlush.flush);
+        return true;
+    }
+
+    void ClientSceneFlushThread::sendAppliedFlush()
+    {
+        if (m_appliedFlush.sceneLogic == nullptr)
+            return;
+
+        TRACE_SCOPE("client", "SendFlushAsync");
+        m_appliedFlush.sceneLogic->sendAppliedFlush(std::move(m_appliedFlush.flush));
+        m_appliedFlush = PendingFlush();
+    }
+
+    void ClientSceneFlushThread::run()
+    {
+        while (!isCancelRequested())
+        {
+            {
+                PlatformLightweightGuard guard(m_queueLock);
+                if (m_pendingFlushes.empty())
+                    m_queueCondVar.wait(&m_queueLock, 100u);
+            }
+
+            Bool hasAppliedFlush = false;
+            {
+                PlatformLightweightGuard processingGuard(m_processingLock);
+                hasAppliedFlush = applyNextPendingFlush();
+            }
+
+            if (hasAppliedFlush)
+            {
+                // framework lock has to be taken before processing lock, see class description
+                PlatformGuard guard(m_frameworkLock);
+                PlatformLightweightGuard processingGuard(m_processingLock);
+                sendAppliedFlush();
+            }
+        }
+    }
+}
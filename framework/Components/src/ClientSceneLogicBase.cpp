@@ -56,6 +56,7 @@ namespace ramses_internal
         // reset to initial state
         m_subscribersActive.clear();
         m_subscribersWaitingForScene.clear();
+        releaseSceneSnapshot();
     }
 
     Bool ClientSceneLogicBase::isPublished() const
@@ -110,28 +111,67 @@ namespace ramses_internal
             return;
         }
 
-        SceneActionCollection collection;
-        SceneActionCollectionCreator creator(collection);
-        SceneDescriber::describeScene<IScene>(scene, creator);
-
-        SceneResourceChanges resourceChanges;
-        size_t sceneResourcesSize = 0u;
-        SceneResourceUtils::GetSceneResourceChangesFromScene(resourceChanges, scene, sceneResourcesSize);
-
-        // flush asynchronously & check if there already was a named flush
-        creator.flush(
-            m_flushCounter,
-            false,
-            true,
-            scene.getSceneSizeInformation(),
-            resourceChanges,
-            flushTimeInfo,
-            versionTag);
+        StatisticCollectionScene& statistics = m_scene.getStatisticCollection();
+        std::unique_ptr<SceneSnapshot> createdSnapshot;
+        if (m_sceneSnapshot && m_sceneSnapshot->flushCounter == m_flushCounter)
+        {
+            statistics.statSceneSnapshotsReused.incCounter(1u);
+            statistics.statSceneSnapshotsReusedSize.incCounter(static_cast<UInt32>(m_sceneSnapshot->collection.collectionData().size()));
+            statistics.statSceneSnapshotsReusedTime.incCounter(m_sceneSnapshot->creationTimeInMicroseconds);
+        }
+        else
+        {
+            const UInt64 creationStartTime = PlatformTime::GetMicrosecondsMonotonic();
+
+            createdSnapshot.reset(new SceneSnapshot);
+            createdSnapshot->flushCounter = m_flushCounter;
+
+            SceneActionCollectionCreator creator(createdSnapshot->collection);
+            SceneDescriber::describeScene<IScene>(scene, creator);
+
+            SceneResourceChanges resourceChanges;
+            SceneResourceUtils::GetSceneResourceChangesFromScene(resourceChanges, scene, createdSnapshot->sceneResourcesSize);
+            createdSnapshot->numClientResources = static_cast<UInt32>(resourceChanges.m_addedClientResourceRefs.size());
+            createdSnapshot->numSceneResourceActions = static_cast<UInt32>(resourceChanges.m_sceneResourceActions.size());
+
+            // flush asynchronously & check if there already was a named flush
+            creator.flush(
+                m_flushCounter,
+                false,
+                true,
+                scene.getSceneSizeInformation(),
+                resourceChanges,
+                flushTimeInfo,
+                versionTag);
+
+            createdSnapshot->creationTimeInMicroseconds = static_cast<UInt32>(PlatformTime::GetMicrosecondsMonotonic() - creationStartTime);
+            statistics.statSceneSnapshotsCreated.incCounter(1u);
+        }
+        statistics.statSceneSnapshotsSent.incCounter(static_cast<UInt32>(m_subscribersWaitingForScene.size()));
 
+        const SceneSnapshot& snapshot = (createdSnapshot ? *createdSnapshot : *m_sceneSnapshot);
         LOG_INFO(CONTEXT_CLIENT, "Sending scene " << scene.getSceneId() << " to " << m_subscribersWaitingForScene.size() << " subscribers, " <<
-            collection.numberOfActions() << " scene actions (" << collection.collectionData().size() << " bytes)" <<
-            resourceChanges.m_addedClientResourceRefs.size() << " client resources, " <<
-            resourceChanges.m_sceneResourceActions.size() << " scene resource actions (" << sceneResourcesSize << " bytes in total used by scene resources)");
+            snapshot.collection.numberOfActions() << " scene actions (" << snapshot.collection.collectionData().size() << " bytes)" <<
+            snapshot.numClientResources << " client resources, " <<
+            snapshot.numSceneResourceActions << " scene resource actions (" << snapshot.sceneResourcesSize << " bytes in total used by scene resources), " <<
+            "flushCounter " << m_flushCounter << " (snapshot " << (createdSnapshot ? "created" : "reused") << ", created in " << snapshot.creationTimeInMicroseconds << " us)");
+
+        // snapshot is kept until next flush unless it is too large to be held in memory in addition to the scene
+        SceneActionCollection collection;
+        if (!createdSnapshot)
+        {
+            collection = m_sceneSnapshot->collection.copy();
+        }
+        else if (createdSnapshot->collection.collectionData().size() <= m_sceneSnapshotSizeLimit)
+        {
+            collection = createdSnapshot->collection.copy();
+            m_sceneSnapshot = std::move(createdSnapshot);
+        }
+        else
+        {
+            collection = std::move(createdSnapshot->collection);
+            releaseSceneSnapshot();
+        }
 
         for(const auto& subscriber : m_subscribersWaitingForScene)
         {
@@ -144,6 +184,16 @@ namespace ramses_internal
         m_subscribersWaitingForScene.clear();
     }
 
+    void ClientSceneLogicBase::releaseSceneSnapshot()
+    {
+        m_sceneSnapshot.reset();
+    }
+
+    void ClientSceneLogicBase::setSceneSnapshotSizeLimit(UInt32 sizeInBytes)
+    {
+        m_sceneSnapshotSizeLimit = sizeInBytes;
+    }
+
     void ClientSceneLogicBase::printFlushInfo(StringOutputStream& sos, const char* name, const SceneActionCollection& collection, ESceneFlushMode flushMode) const
     {
         sos << name << ": SceneID " << m_sceneId.getValue() << ", flushIdx " << m_flushCounter << ", mode " << EnumToString(flushMode)
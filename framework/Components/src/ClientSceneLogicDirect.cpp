@@ -25,6 +25,29 @@ namespace ramses_internal
         : ClientSceneLogicBase(sceneGraphSender, scene, clientAddress)
         , m_previousSceneSizes(m_scene.getSceneSizeInformation())
     {
+        // new subscribers are handled by another thread than the one modifying client scene
+        m_scene.enableSceneLock();
+    }
+
+    void ClientSceneLogicDirect::postAddSubscriber()
+    {
+        if (m_flushCounter == 0u || !isPublished())
+        {
+            LOG_DEBUG(CONTEXT_CLIENT, "ClientSceneLogicDirect::postAddSubscriber: delay sending of scene " << m_sceneId.getValue() << " until next flush (numWaiting " <<
+                m_subscribersWaitingForScene.size() << ", flushCnt " << m_flushCounter << ", published " << isPublished() << ")");
+            return;
+        }
+
+        SceneLockGuard guard(m_scene.getSceneLock());
+        if (!m_scene.getSceneActionCollection().empty() || !m_scene.getResourceChanges().empty())
+        {
+            LOG_DEBUG(CONTEXT_CLIENT, "ClientSceneLogicDirect::postAddSubscriber: delay sending of scene " << m_sceneId.getValue() << " with unflushed changes until next flush (numWaiting " <<
+                m_subscribersWaitingForScene.size() << ", flushCnt " << m_flushCounter << ")");
+            return;
+        }
+
+        // no changes since last flush and none can be made while holding scene lock, client scene is consistent snapshot of last flushed state
+        sendSceneToWaitingSubscribers(m_scene, m_flushTimeInfoOfLastFlush, m_lastVersionTag);
     }
 
     void ClientSceneLogicDirect::flushSceneActions(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
@@ -40,7 +63,7 @@ namespace ramses_internal
         if (m_flushCounter == 0)
         {
             LOG_INFO_F(CONTEXT_CLIENT, ([&](StringOutputStream& sos) {
-                            sos << "ClientSceneLogicShadowCopy::flushSceneActions: first flush, sceneId " << m_sceneId
+                            sos << "ClientSceneLogicDirect::flushSceneActions: first flush, sceneId " << m_sceneId
                                 << ", numActions " << collection.numberOfActions() << ", published " << isPublished()
                                 << ", subsActive [";
                             for (const auto& sub : m_subscribersActive)
@@ -53,6 +76,7 @@ namespace ramses_internal
         }
 
         ++m_flushCounter;
+        releaseSceneSnapshot();
 
         if (isPublished())
         {
@@ -88,6 +112,10 @@ namespace ramses_internal
 
         m_scene.clearResourceChanges();
 
+        m_flushTimeInfoOfLastFlush = flushTimeInfo;
+        if (versionTag != InvalidSceneVersionTag)
+            m_lastVersionTag = versionTag;
+
         if (isPublished())
         {
             sendSceneToWaitingSubscribers(m_scene, flushTimeInfo, versionTag);
@@ -35,45 +35,50 @@ namespace ramses_internal
 
     void ClientSceneLogicShadowCopy::flushSceneActions(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
     {
-        const SceneSizeInformation sceneSizes(m_scene.getSceneSizeInformation());
+        PreparedFlush flush = prepareFlush(flushMode, flushTimeInfo, versionTag);
+        applyPreparedFlush(flush);
+        sendAppliedFlush(std::move(flush));
+    }
+
+    ClientSceneLogicShadowCopy::PreparedFlush ClientSceneLogicShadowCopy::prepareFlush(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
+    {
+        PreparedFlush flush;
+        flush.flushMode = flushMode;
+        flush.sceneSizes = m_scene.getSceneSizeInformation();
+        flush.resourceChanges = m_scene.getResourceChanges();
+        flush.flushTimeInfo = flushTimeInfo;
+        flush.versionTag = versionTag;
 
         // swap out of ClientScene and reserve new memory there
-        SceneActionCollection collection;
-        collection.swap(m_scene.getSceneActionCollection());
+        flush.collection.swap(m_scene.getSceneActionCollection());
+        m_scene.getSceneActionCollection().reserveAdditionalCapacity(flush.collection.collectionData().size(), flush.collection.numberOfActions());
+        m_scene.clearResourceChanges();
 
-        const bool hasNewActions = !collection.empty();
+        return flush;
+    }
 
-        if (m_flushCounter == 0)
-        {
-            LOG_INFO_F(CONTEXT_CLIENT, ([&](StringOutputStream& sos) {
-                        sos << "ClientSceneLogicShadowCopy::flushSceneActions: first flush, sceneId " << m_sceneId << ", numActions " << collection.numberOfActions() << ", published " << isPublished() << ", subsActive [";
-                        for (const auto& sub : m_subscribersActive)
-                            sos << sub << " ";
-                        sos << "], subsWaiting [";
-                        for (const auto& sub : m_subscribersWaitingForScene)
-                            sos << sub << " ";
-                        sos << "]";
-                    }));
-        }
+    void ClientSceneLogicShadowCopy::applyPreparedFlush(PreparedFlush& flush)
+    {
+        SceneActionCollection& collection = flush.collection;
+        const SceneSizeInformation& sceneSizes = flush.sceneSizes;
+        const bool hasNewActions = !collection.empty();
 
         ++m_flushCounter;
+        releaseSceneSnapshot();
 
         if (isPublished())
         {
             SceneActionCollectionCreator creator(collection);
             creator.flush(
                 m_flushCounter,
-                flushMode == ESceneFlushMode_Synchronous,
+                flush.flushMode == ESceneFlushMode_Synchronous,
                 sceneSizes > m_sceneShadowCopy.getSceneSizeInformation(),
                 sceneSizes,
-                m_scene.getResourceChanges(),
-                flushTimeInfo,
-                versionTag);
+                flush.resourceChanges,
+                flush.flushTimeInfo,
+                flush.versionTag);
         }
 
-        // reserve memory in ClientScene after flush because flush might add a lot of data
-        m_scene.getSceneActionCollection().reserveAdditionalCapacity(collection.collectionData().size(), collection.numberOfActions());
-
         if (hasNewActions)
         {
             m_sceneShadowCopy.preallocateSceneSize(sceneSizes);
@@ -82,7 +87,25 @@ namespace ramses_internal
             m_scene.getStatisticCollection().statSceneActionsGeneratedSize.incCounter(static_cast<UInt32>(collection.collectionData().size()));
         }
 
-        LOG_DEBUG_F(CONTEXT_CLIENT, ([&](StringOutputStream& sos) { printFlushInfo(sos, "ClientSceneLogicShadowCopy::flushSceneActions", collection, flushMode); }));
+        LOG_DEBUG_F(CONTEXT_CLIENT, ([&](StringOutputStream& sos) { printFlushInfo(sos, "ClientSceneLogicShadowCopy::flushSceneActions", collection, flush.flushMode); }));
+    }
+
+    void ClientSceneLogicShadowCopy::sendAppliedFlush(PreparedFlush&& flush)
+    {
+        SceneActionCollection& collection = flush.collection;
+
+        if (m_flushCounter == 1u)
+        {
+            LOG_INFO_F(CONTEXT_CLIENT, ([&](StringOutputStream& sos) {
+                        sos << "ClientSceneLogicShadowCopy::flushSceneActions: first flush, sceneId " << m_sceneId << ", numActions " << collection.numberOfActions() << ", published " << isPublished() << ", subsActive [";
+                        for (const auto& sub : m_subscribersActive)
+                            sos << sub << " ";
+                        sos << "], subsWaiting [";
+                        for (const auto& sub : m_subscribersWaitingForScene)
+                            sos << sub << " ";
+                        sos << "]";
+                    }));
+        }
 
         if (isPublished() && !m_subscribersActive.empty())
         {
@@ -90,12 +113,10 @@ namespace ramses_internal
             m_scenegraphSender.sendSceneActionList(m_subscribersActive, std::move(collection), m_sceneId, m_scenePublicationMode);
         }
 
-        m_scene.clearResourceChanges();
-
         // store flush time info and version for async new subscribers, scene validity must also be guaranteed for them
-        m_flushTimeInfoOfLastFlush = flushTimeInfo;
-        if (versionTag != InvalidSceneVersionTag)
-            m_lastVersionTag = versionTag;
+        m_flushTimeInfoOfLastFlush = flush.flushTimeInfo;
+        if (flush.versionTag != InvalidSceneVersionTag)
+            m_lastVersionTag = flush.versionTag;
 
         // send to subscribers if flushed for first time
         if (m_flushCounter == 1u)
@@ -15,6 +15,7 @@
 #include "PlatformAbstraction/PlatformMath.h"
 #include "Utils/StringUtils.h"
 #include "Utils/LogMacros.h"
+#include "Utils/TraceEventRecorder.h"
 #include "Utils/BinaryInputStream.h"
 #include "TransportCommon/IConnectionStatusUpdateNotifier.h"
 #include "TransportCommon/ICommunicationSystem.h"
@@ -423,6 +424,7 @@ namespace ramses_internal
 
     void ResourceComponent::LoadResourcesFromFileTask::execute()
     {
+        TRACE_SCOPE_WITH_ID("framework", "LoadResourcesFromFile", m_resourcesToLoad.size());
         LOG_DEBUG(CONTEXT_FRAMEWORK, "ResourceComponent::LoadResourcesFromFileTask::execute: Loading resource data asynchronous from file");
 
         std::sort(m_resourcesToLoad.begin(), m_resourcesToLoad.end());
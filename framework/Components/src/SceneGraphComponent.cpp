@@ -9,6 +9,7 @@
 #include "Components/SceneGraphComponent.h"
 #include "Components/ClientSceneLogicShadowCopy.h"
 #include "Components/ClientSceneLogicDirect.h"
+#include "Components/ClientSceneFlushThread.h"
 #include "Scene/ClientScene.h"
 #include "Scene/SceneActionUtils.h"
 #include "TransportCommon/IConnectionStatusUpdateNotifier.h"
@@ -34,6 +35,9 @@ namespace ramses_internal
     {
         m_connectionStatusUpdateNotifier.unregisterForConnectionUpdates(this);
 
+        // stop flush thread before scene logics it might be using get destroyed
+        m_flushThread.reset();
+
         for (auto logic : m_clientSceneLogicMap)
         {
             delete logic.value;
@@ -288,20 +292,30 @@ namespace ramses_internal
         }
     }
 
-    void SceneGraphComponent::handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization)
+    void SceneGraphComponent::handleCreateScene(ClientScene& scene, bool disableSceneShadowCopy, bool enableAsynchronousFlush)
     {
         const SceneId sceneId = scene.getSceneId();
         assert(!m_clientSceneLogicMap.contains(sceneId));
         ClientSceneLogicBase* sceneLogic = nullptr;
-        if (enableLocalOnlyOptimization)
+        if (disableSceneShadowCopy)
         {
+            // direct scene logic sends snapshot of the client scene itself to new subscribers, it can therefore not be flushed asynchronously
+            if (enableAsynchronousFlush)
+                LOG_WARN(CONTEXT_CLIENT, "SceneGraphComponent::handleCreateScene: asynchronous flush not supported for scene without shadow copy " << scene.getSceneId().getValue() << ", scene will be flushed synchronously");
             LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleCreateScene: creating scene " << scene.getSceneId().getValue() << " (direct)");
             sceneLogic = new ClientSceneLogicDirect(*this, scene, m_myID);
         }
         else
         {
-            LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleCreateScene: creating scene " << scene.getSceneId().getValue() << " (shadow copy)");
-            sceneLogic = new ClientSceneLogicShadowCopy(*this, scene, m_myID);
+            LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleCreateScene: creating scene " << scene.getSceneId().getValue() << " (shadow copy" << (enableAsynchronousFlush ? ", asynchronous flush)" : ")"));
+            ClientSceneLogicShadowCopy* shadowCopySceneLogic = new ClientSceneLogicShadowCopy(*this, scene, m_myID);
+            if (enableAsynchronousFlush)
+            {
+                m_asynchronousFlushSceneLogics.put(sceneId, shadowCopySceneLogic);
+                if (!m_flushThread)
+                    m_flushThread.reset(new ClientSceneFlushThread(m_frameworkLock));
+            }
+            sceneLogic = shadowCopySceneLogic;
         }
         m_clientSceneLogicMap.put(sceneId, sceneLogic);
     }
@@ -312,6 +326,7 @@ namespace ramses_internal
         ClientSceneLogicBase& sceneLogic = **m_clientSceneLogicMap.get(sceneId);
 
         LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handlePublishScene:  " << sceneId.getValue() << " in mode " << EnumToString(publicationMode));
+        processPendingAsynchronousFlushes(sceneId);
         sceneLogic.publish(publicationMode);
     }
 
@@ -321,6 +336,7 @@ namespace ramses_internal
         ClientSceneLogicBase& sceneLogic = **m_clientSceneLogicMap.get(sceneId);
 
         LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleUnpublishScene:  unpublishing scene " << sceneId.getValue());
+        processPendingAsynchronousFlushes(sceneId);
         sceneLogic.unpublish();
     }
 
@@ -328,16 +344,32 @@ namespace ramses_internal
     {
         assert(m_clientSceneLogicMap.contains(sceneId));
 
+        ClientSceneLogicShadowCopy** asyncSceneLogic = m_asynchronousFlushSceneLogics.get(sceneId);
+        if (asyncSceneLogic != nullptr)
+        {
+            m_flushThread->queueFlush(**asyncSceneLogic, (*asyncSceneLogic)->prepareFlush(flushMode, flushTimeInfo, versionTag));
+            return;
+        }
+
         ClientSceneLogicBase& sceneLogic = **m_clientSceneLogicMap.get(sceneId);
 
         sceneLogic.flushSceneActions(flushMode, flushTimeInfo, versionTag);
     }
 
+    void SceneGraphComponent::processPendingAsynchronousFlushes(SceneId sceneId)
+    {
+        // queue is processed in order for all scenes, flushes of other scenes get processed too
+        if (m_asynchronousFlushSceneLogics.contains(sceneId))
+            m_flushThread->processPendingFlushes();
+    }
+
     void SceneGraphComponent::handleRemoveScene(SceneId sceneId)
     {
         LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleRemoveScene: " << sceneId.getValue());
         ClientSceneLogicBase* sceneLogic = *m_clientSceneLogicMap.get(sceneId);
         assert(sceneLogic != nullptr);
+        processPendingAsynchronousFlushes(sceneId);
+        m_asynchronousFlushSceneLogics.remove(sceneId);
         m_clientSceneLogicMap.remove(sceneId);
         delete sceneLogic;
     }
@@ -348,6 +380,8 @@ namespace ramses_internal
         if (sceneLogic != nullptr)
         {
             LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleSceneSubscription: received scene subscription for scene " << sceneId.getValue() << " from " << subscriber);
+            // shadow copy must not be modified by flush thread while it is described for new subscriber
+            processPendingAsynchronousFlushes(sceneId);
             (*sceneLogic)->addSubscriber(subscriber);
         }
         else
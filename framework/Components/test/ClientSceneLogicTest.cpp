@@ -395,7 +395,8 @@ TEST_F(AClientSceneLogic_Direct, doesNotClearPendingActionsIfSubscriberRemovedIs
 
     const ramses_internal::Guid newRendererID("12345678-1234-5678-0000-123456789012");
     const SceneInfo sceneInfo(this->m_sceneId, this->m_scene.getName());
-
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _));
+    this->expectFlushSceneActionList();
     this->m_sceneLogic.addSubscriber(newRendererID);
     this->m_scene.allocateNode();
     this->m_sceneLogic.removeSubscriber(newRendererID);
@@ -426,7 +427,6 @@ TEST_F(AClientSceneLogic_Direct, willSendSceneAgainToSubscriberThatUnsubscribedA
     expectSceneSend();
     this->expectFlushSceneActionList();
     this->m_sceneLogic.addSubscriber(this->m_rendererID);
-    flush();
 
     this->expectSceneUnpublish();
 }
@@ -550,7 +550,6 @@ TEST_F(AClientSceneLogic_Direct, resendsSceneAfterRepublishToReaddedSubscriber)
     this->expectSceneSend();
     this->expectFlushSceneActionList();
     addSubscriber();
-    this->flush();
 
     this->expectSceneUnpublish();
 }
@@ -589,7 +588,6 @@ TEST_F(AClientSceneLogic_Direct, sendsOutDistributedSceneToNewlySubscribedRender
     this->expectFlushSceneActionList();
     this->flush();
     this->m_sceneLogic.addSubscriber(this->m_rendererID);
-    this->flush();
 
     this->expectSceneUnpublish();
 }
@@ -692,14 +690,11 @@ TEST_F(AClientSceneLogic_Direct, SendCleanSceneToNewSubscriber)
 
     const ramses_internal::Guid newRendererID("12345678-1234-5678-0000-123456789012");
 
-    // expect direct scene send to new renderer
+    // expect direct scene send to new renderer, there are no pending actions
     const SceneInfo sceneInfo(this->m_sceneId, this->m_scene.getName());
     EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _));
-
+    EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{newRendererID}, IsSceneActionCollection(createFlushSceneActionList(true, 1)), _, _));
     this->m_sceneLogic.addSubscriber(newRendererID);
-    EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{this->m_rendererID}, IsSceneActionCollection(createFlushSceneActionList(false, 2)), _, _));
-    EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{newRendererID}, IsSceneActionCollection(createFlushSceneActionList(true, 2)), _, _));
-    this->flush();
 
     this->expectSceneUnpublish();
 }
@@ -722,6 +717,126 @@ TYPED_TEST(AClientSceneLogic_All, doesAppendFlushActionIfOtherSceneActionsAreFlu
     this->expectSceneUnpublish();
 }
 
+TYPED_TEST(AClientSceneLogic_All, reusesSceneSnapshotForSubscribersArrivingBetweenFlushes)
+{
+    this->publishAndAddSubscriberWithoutPendingActions();
+    EXPECT_EQ(1u, this->m_scene.getStatisticCollection().statSceneSnapshotsCreated.getCounterValue());
+    EXPECT_EQ(1u, this->m_scene.getStatisticCollection().statSceneSnapshotsSent.getCounterValue());
+
+    const Guid newRendererID1(true);
+    const Guid newRendererID2(true);
+    SceneActionCollection actionsFromSendScene1;
+    SceneActionCollection actionsFromSendScene2;
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID1, _, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID2, _, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{ newRendererID1 }, _, this->m_sceneId, _)).WillOnce(WithArgs<1>(INVOKE_SAVE_SCENEACTIONCOLLECTION(actionsFromSendScene1)));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{ newRendererID2 }, _, this->m_sceneId, _)).WillOnce(WithArgs<1>(INVOKE_SAVE_SCENEACTIONCOLLECTION(actionsFromSendScene2)));
+    this->m_sceneLogic.addSubscriber(newRendererID1);
+    this->m_sceneLogic.addSubscriber(newRendererID2);
+
+    EXPECT_EQ(actionsFromSendScene1, actionsFromSendScene2);
+    EXPECT_EQ(1u, this->m_scene.getStatisticCollection().statSceneSnapshotsCreated.getCounterValue());
+    EXPECT_EQ(2u, this->m_scene.getStatisticCollection().statSceneSnapshotsReused.getCounterValue());
+    EXPECT_EQ(2u * actionsFromSendScene1.collectionData().size(), this->m_scene.getStatisticCollection().statSceneSnapshotsReusedSize.getCounterValue());
+    EXPECT_EQ(3u, this->m_scene.getStatisticCollection().statSceneSnapshotsSent.getCounterValue());
+
+    this->expectSceneUnpublish();
+}
+
+TYPED_TEST(AClientSceneLogic_All, createsNewSceneSnapshotForSubscriberArrivingAfterNextFlush)
+{
+    this->publishAndAddSubscriberWithoutPendingActions();
+    this->m_sceneLogic.removeSubscriber(this->m_rendererID);
+
+    this->m_scene.allocateNode(0u, NodeHandle(1));
+    this->flush();
+
+    SceneActionCollection actionsFromSendScene;
+    this->expectSceneSend();
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _)).WillOnce(WithArgs<1>(INVOKE_SAVE_SCENEACTIONCOLLECTION(actionsFromSendScene)));
+    this->addSubscriber();
+
+    ASSERT_EQ(2u, actionsFromSendScene.numberOfActions());
+    EXPECT_EQ(ESceneActionId_AllocateNode, actionsFromSendScene[0].type());
+    EXPECT_EQ(2u, this->m_scene.getStatisticCollection().statSceneSnapshotsCreated.getCounterValue());
+    EXPECT_EQ(0u, this->m_scene.getStatisticCollection().statSceneSnapshotsReused.getCounterValue());
+
+    this->expectSceneUnpublish();
+}
+
+TYPED_TEST(AClientSceneLogic_All, doesNotKeepSceneSnapshotExceedingSizeLimit)
+{
+    this->m_sceneLogic.setSceneSnapshotSizeLimit(0u);
+    this->publishAndAddSubscriberWithoutPendingActions();
+
+    const Guid newRendererID(true);
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, _, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{ newRendererID }, _, this->m_sceneId, _));
+    this->m_sceneLogic.addSubscriber(newRendererID);
+
+    EXPECT_EQ(2u, this->m_scene.getStatisticCollection().statSceneSnapshotsCreated.getCounterValue());
+    EXPECT_EQ(0u, this->m_scene.getStatisticCollection().statSceneSnapshotsReused.getCounterValue());
+
+    this->expectSceneUnpublish();
+}
+
+TEST_F(AClientSceneLogic_Direct, sendsOneSceneSnapshotCreatedInFlushToAllSubscribersArrivingBeforeIt)
+{
+    this->publishAndAddSubscriberWithoutPendingActions();
+    EXPECT_EQ(1u, this->m_scene.getStatisticCollection().statSceneSnapshotsCreated.getCounterValue());
+    EXPECT_EQ(1u, this->m_scene.getStatisticCollection().statSceneSnapshotsSent.getCounterValue());
+
+    // subscribers arriving with unflushed changes wait for next flush
+    this->m_scene.allocateNode(0u, NodeHandle(1));
+    const Guid newRendererID1(true);
+    const Guid newRendererID2(true);
+    this->m_sceneLogic.addSubscriber(newRendererID1);
+    this->m_sceneLogic.addSubscriber(newRendererID2);
+    Mock::VerifyAndClearExpectations(&this->m_sceneGraphProviderComponent);
+
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID1, _, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID2, _, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr((std::vector<Guid>{ newRendererID1, newRendererID2 }), _, this->m_sceneId, _));
+    this->flush();
+
+    EXPECT_EQ(2u, this->m_scene.getStatisticCollection().statSceneSnapshotsCreated.getCounterValue());
+    EXPECT_EQ(3u, this->m_scene.getStatisticCollection().statSceneSnapshotsSent.getCounterValue());
+
+    this->expectSceneUnpublish();
+}
+
+TEST_F(AClientSceneLogic_Direct, sendsSceneToSubscriberArrivingAfterLastFlushWithoutFurtherFlush)
+{
+    this->publish();
+    this->m_scene.allocateNode(0u, NodeHandle(1));
+    this->flush();
+
+    // scene is not flushed anymore, it is described from client scene on subscription
+    SceneActionCollection actionsFromSendScene;
+    this->expectSceneSend();
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _)).WillOnce(WithArgs<1>(INVOKE_SAVE_SCENEACTIONCOLLECTION(actionsFromSendScene)));
+    this->addSubscriber();
+    Mock::VerifyAndClearExpectations(&this->m_sceneGraphProviderComponent);
+
+    ASSERT_EQ(2u, actionsFromSendScene.numberOfActions());
+    EXPECT_EQ(ESceneActionId_AllocateNode, actionsFromSendScene[0].type());
+    EXPECT_EQ(ESceneActionId_Flush, actionsFromSendScene[1].type());
+    EXPECT_THAT(this->m_sceneLogic.getWaitingAndActiveSubscribers(), UnorderedElementsAre(this->m_rendererID));
+
+    this->expectSceneUnpublish();
+}
+
+TEST_F(AClientSceneLogic_Direct, enablesSceneLockOfClientScene)
+{
+    EXPECT_TRUE(this->m_scene.getSceneLock() != nullptr);
+}
+
+TEST_F(AClientSceneLogic_ShadowCopy, doesNotEnableSceneLockOfClientScene)
+{
+    EXPECT_TRUE(this->m_scene.getSceneLock() == nullptr);
+}
+
 TYPED_TEST(AClientSceneLogic_All, flushAfterNoChangeStillProducesSceneActionsSentToSubscriber)
 {
     // add some active subscriber so actions are queued
@@ -782,6 +897,9 @@ TEST_F(AClientSceneLogic_Direct, appendsDefaultFlushInfoWhenSendingSceneToNewSub
     const SceneVersionTag versionTagIn{ 333 };
     this->m_sceneLogic.flushSceneActions(ESceneFlushMode_Asynchronous, ftiInIgnored, versionTagIn);
 
+    // pending change, scene can only be sent with next flush
+    this->m_scene.allocateNode(0u, NodeHandle(2));
+
     this->expectSceneSend();
     SceneActionCollection actionsFromSendScene;
     EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _)).WillOnce(WithArgs<1>(INVOKE_SAVE_SCENEACTIONCOLLECTION(actionsFromSendScene)));
@@ -791,9 +909,10 @@ TEST_F(AClientSceneLogic_Direct, appendsDefaultFlushInfoWhenSendingSceneToNewSub
     const SceneVersionTag versionTagUsed{ 666 };
     this->flush(ftiInUsed, versionTagUsed);
 
-    ASSERT_EQ(2u, actionsFromSendScene.numberOfActions());
+    ASSERT_EQ(3u, actionsFromSendScene.numberOfActions());
     EXPECT_EQ(ESceneActionId_AllocateNode, actionsFromSendScene[0].type());
-    ASSERT_EQ(ESceneActionId_Flush, actionsFromSendScene[1].type());
+    EXPECT_EQ(ESceneActionId_AllocateNode, actionsFromSendScene[1].type());
+    ASSERT_EQ(ESceneActionId_Flush, actionsFromSendScene[2].type());
 
     bool isSync;
     bool hasSizeInfo;
@@ -803,7 +922,7 @@ TEST_F(AClientSceneLogic_Direct, appendsDefaultFlushInfoWhenSendingSceneToNewSub
     SceneVersionTag versionTag;
     TimeStampVector timestamps;
     UInt64 flushIndex = 0u;
-    SceneActionApplier::ReadParameterForFlushAction(actionsFromSendScene[1], flushIndex, isSync, hasSizeInfo, sizeInfo, resourceChanges, timeInfo, versionTag, &timestamps);
+    SceneActionApplier::ReadParameterForFlushAction(actionsFromSendScene[2], flushIndex, isSync, hasSizeInfo, sizeInfo, resourceChanges, timeInfo, versionTag, &timestamps);
     EXPECT_FALSE(isSync);
     EXPECT_TRUE(hasSizeInfo);
     EXPECT_EQ(ftiInUsed, timeInfo);
@@ -813,6 +932,42 @@ TEST_F(AClientSceneLogic_Direct, appendsDefaultFlushInfoWhenSendingSceneToNewSub
     this->expectSceneUnpublish();
 }
 
+TEST_F(AClientSceneLogic_Direct, appendsLastFlushInfoWhenSendingSceneWithoutPendingChangesToNewSubscriber)
+{
+    this->publish();
+
+    this->m_scene.allocateNode(0u, NodeHandle(1));
+
+    const FlushTimeInformation ftiIn{ FlushTime::Clock::time_point(std::chrono::milliseconds(2)), FlushTime::Clock::time_point(std::chrono::milliseconds(3)) };
+    const SceneVersionTag versionTagIn{ 333 };
+    this->m_sceneLogic.flushSceneActions(ESceneFlushMode_Asynchronous, ftiIn, versionTagIn);
+
+    // no pending changes, scene is sent right away
+    this->expectSceneSend();
+    SceneActionCollection actionsFromSendScene;
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _)).WillOnce(WithArgs<1>(INVOKE_SAVE_SCENEACTIONCOLLECTION(actionsFromSendScene)));
+    this->addSubscriber();
+
+    ASSERT_EQ(2u, actionsFromSendScene.numberOfActions());
+    EXPECT_EQ(ESceneActionId_AllocateNode, actionsFromSendScene[0].type());
+    ASSERT_EQ(ESceneActionId_Flush, actionsFromSendScene[1].type());
+
+    bool isSync;
+    bool hasSizeInfo;
+    SceneResourceChanges resourceChanges;
+    SceneSizeInformation sizeInfo;
+    FlushTimeInformation timeInfo;
+    SceneVersionTag versionTag;
+    TimeStampVector timestamps;
+    UInt64 flushIndex = 0u;
+    SceneActionApplier::ReadParameterForFlushAction(actionsFromSendScene[1], flushIndex, isSync, hasSizeInfo, sizeInfo, resourceChanges, timeInfo, versionTag, &timestamps);
+    EXPECT_EQ(1u, flushIndex);
+    EXPECT_EQ(ftiIn, timeInfo);
+    EXPECT_EQ(versionTagIn, versionTag);
+
+    this->expectSceneUnpublish();
+}
+
 TYPED_TEST(AClientSceneLogic_All, sendSceneSizesTogetherWithFlushIfSceneSizeIncreased)
 {
     this->publishAndAddSubscriberWithoutPendingActions();
@@ -1371,11 +1526,9 @@ TEST_F(AClientSceneLogic_Direct, doesSendSceneAfterFlushToLateSubscribers)
     // so far no expectations except scene publishing
     Mock::VerifyAndClearExpectations(&this->m_sceneGraphProviderComponent);
 
-    this->addSubscriber();
     this->expectSceneSend();
     this->expectSendOnActionList(expectedActions);
-
-    this->flush();
+    this->addSubscriber();
 
     this->unpublish();
 }
@@ -1426,6 +1579,8 @@ TEST_F(AClientSceneLogic_Direct, sceneActionsAreNotModifiedWhenLastRendererUnsub
     this->m_sceneLogic.flushSceneActions(ESceneFlushMode_Asynchronous, {}, {});
     EXPECT_EQ(0u, this->m_scene.getSceneActionCollection().numberOfActions());
 
+    this->expectSceneSend();
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _));
     this->addSubscriber();
     EXPECT_EQ(0u, this->m_scene.getSceneActionCollection().numberOfActions());
 
@@ -1474,6 +1629,8 @@ TEST_F(AClientSceneLogic_Direct, getWaitingAndActiveSubscribersDoesWhatItSays)
     EXPECT_THAT(this->m_sceneLogic.getWaitingAndActiveSubscribers(), UnorderedElementsAre(this->m_rendererID));
 
     const Guid newRendererID(true);
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, _, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{ newRendererID }, _, this->m_sceneId, _));
     this->m_sceneLogic.addSubscriber(newRendererID);
     EXPECT_THAT(this->m_sceneLogic.getWaitingAndActiveSubscribers(), UnorderedElementsAre(this->m_rendererID, newRendererID));
 
@@ -1484,6 +1641,8 @@ TEST_F(AClientSceneLogic_Direct, removeSubscriberRemoveOnlyGivenSubscriber)
 {
     const Guid newRendererID(true);
     this->publishAndAddSubscriberWithoutPendingActions();
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, _, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(std::vector<Guid>{ newRendererID }, _, this->m_sceneId, _));
     this->m_sceneLogic.addSubscriber(newRendererID);
     EXPECT_THAT(this->m_sceneLogic.getWaitingAndActiveSubscribers(), UnorderedElementsAre(this->m_rendererID, newRendererID));
 
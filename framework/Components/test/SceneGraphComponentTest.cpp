@@ -12,6 +12,9 @@
 #include "MockConnectionStatusUpdateNotifier.h"
 #include "ServiceHandlerMocks.h"
 #include "Components/FlushTimeInformation.h"
+#include "PlatformAbstraction/PlatformGuard.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include <atomic>
 
 using namespace ramses_internal;
 
@@ -470,7 +473,7 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
     ClientScene scene(sceneInfo);
 
     sceneGraphComponent.setSceneRendererServiceHandler(&consumer);
-    sceneGraphComponent.handleCreateScene(scene, false);
+    sceneGraphComponent.handleCreateScene(scene, false, false);
 
     // subscribe local and remote
     EXPECT_CALL(consumer, handleNewScenesAvailable(SceneInfoVector{ sceneInfo }, _, _));
@@ -517,3 +520,149 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
     EXPECT_CALL(consumer, handleScenesBecameUnavailable(SceneInfoVector{ sceneInfo }, _));
     sceneGraphComponent.handleRemoveScene(SceneId(1));
 }
+
+TEST_F(ASceneGraphComponent, asynchronouslyFlushedSceneIsSentInFlushOrderLatestWhenSceneIsRemoved)
+{
+    SceneInfo sceneInfo(SceneInfo(SceneId(1), "foo"));
+    ClientScene scene(sceneInfo);
+
+    sceneGraphComponent.setSceneRendererServiceHandler(&consumer);
+    sceneGraphComponent.handleCreateScene(scene, false, true);
+
+    EXPECT_CALL(consumer, handleNewScenesAvailable(SceneInfoVector{ sceneInfo }, _, _));
+    EXPECT_CALL(communicationSystem, broadcastNewScenesAvailable(SceneInfoVector{ sceneInfo }));
+    sceneGraphComponent.handlePublishScene(SceneId(1), EScenePublicationMode_LocalAndRemote);
+
+    EXPECT_CALL(communicationSystem, sendScenesAvailable(remoteParticipantID, SceneInfoVector{ sceneInfo }));
+    sceneGraphComponent.newParticipantHasConnected(remoteParticipantID);
+    sceneGraphComponent.handleSceneSubscription(SceneId(1), remoteParticipantID);
+
+    {
+        InSequence seq;
+        EXPECT_CALL(communicationSystem, sendInitializeScene(_, _));
+        EXPECT_CALL(communicationSystem, sendSceneActionList(remoteParticipantID, SceneId(1), _, 1)).WillOnce(Return(1));
+        EXPECT_CALL(communicationSystem, sendSceneActionList(remoteParticipantID, SceneId(1), _, 2)).WillOnce(Return(1));
+        EXPECT_CALL(communicationSystem, sendSceneActionList(remoteParticipantID, SceneId(1), _, 3)).WillOnce(Return(1));
+    }
+
+    // framework lock is held by caller same as in client, flush thread can process flushes only in between
+    PlatformGuard guard(frameworkLock);
+    sceneGraphComponent.handleFlush(SceneId(1), ESceneFlushMode_Synchronous, {}, {});
+    sceneGraphComponent.handleFlush(SceneId(1), ESceneFlushMode_Synchronous, {}, {});
+    sceneGraphComponent.handleFlush(SceneId(1), ESceneFlushMode_Synchronous, {}, {});
+
+    // removing scene processes all pending flushes before scene becomes unavailable
+    EXPECT_CALL(communicationSystem, broadcastScenesBecameUnavailable(SceneInfoVector{ sceneInfo }));
+    EXPECT_CALL(consumer, handleScenesBecameUnavailable(SceneInfoVector{ sceneInfo }, _));
+    sceneGraphComponent.handleRemoveScene(SceneId(1));
+}
+
+TEST_F(ASceneGraphComponent, appliesAsynchronousFlushWhileFrameworkLockIsHeldAndSendsItAfterwards)
+{
+    SceneInfo sceneInfo(SceneInfo(SceneId(1), "foo"));
+    ClientScene scene(sceneInfo);
+
+    sceneGraphComponent.setSceneRendererServiceHandler(&consumer);
+    sceneGraphComponent.handleCreateScene(scene, false, true);
+
+    EXPECT_CALL(consumer, handleNewScenesAvailable(SceneInfoVector{ sceneInfo }, _, _));
+    EXPECT_CALL(communicationSystem, broadcastNewScenesAvailable(SceneInfoVector{ sceneInfo }));
+    sceneGraphComponent.handlePublishScene(SceneId(1), EScenePublicationMode_LocalAndRemote);
+
+    EXPECT_CALL(communicationSystem, sendScenesAvailable(remoteParticipantID, SceneInfoVector{ sceneInfo }));
+    sceneGraphComponent.newParticipantHasConnected(remoteParticipantID);
+    sceneGraphComponent.handleSceneSubscription(SceneId(1), remoteParticipantID);
+
+    std::atomic<bool> sent(false);
+    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _));
+    EXPECT_CALL(communicationSystem, sendSceneActionList(remoteParticipantID, SceneId(1), _, 1)).WillOnce(InvokeWithoutArgs([&sent]() { sent = true; return 1u; }));
+
+    {
+        PlatformGuard guard(frameworkLock);
+        scene.allocateNode();
+        sceneGraphComponent.handleFlush(SceneId(1), ESceneFlushMode_Synchronous, {}, {});
+
+        // flush thread applies the flush to the shadow copy without framework lock, but cannot send it yet
+        for (UInt32 i = 0u; i < 1000u && scene.getStatisticCollection().statSceneActionsGenerated.getCounterValue() == 0u; ++i)
+            PlatformThread::Sleep(10u);
+        EXPECT_NE(0u, scene.getStatisticCollection().statSceneActionsGenerated.getCounterValue());
+        EXPECT_FALSE(sent);
+    }
+
+    for (UInt32 i = 0u; i < 1000u && !sent; ++i)
+        PlatformThread::Sleep(10u);
+    EXPECT_TRUE(sent);
+
+    EXPECT_CALL(communicationSystem, broadcastScenesBecameUnavailable(SceneInfoVector{ sceneInfo }));
+    EXPECT_CALL(consumer, handleScenesBecameUnavailable(SceneInfoVector{ sceneInfo }, _));
+    sceneGraphComponent.handleRemoveScene(SceneId(1));
+}
+
+TEST_F(ASceneGraphComponent, asynchronouslyFlushedSceneIsSentToLocalSubscriberWhenFlushedBeforePublish)
+{
+    SceneInfo sceneInfo(SceneInfo(SceneId(1), "foo"));
+    ClientScene scene(sceneInfo);
+
+    sceneGraphComponent.setSceneRendererServiceHandler(&consumer);
+    sceneGraphComponent.handleCreateScene(scene, false, true);
+
+    PlatformGuard guard(frameworkLock);
+    sceneGraphComponent.handleFlush(SceneId(1), ESceneFlushMode_Synchronous, {}, {});
+
+    // publish processes pending flushes first, so subscriber gets latest scene state
+    EXPECT_CALL(consumer, handleNewScenesAvailable(SceneInfoVector{ sceneInfo }, _, _));
+    sceneGraphComponent.handlePublishScene(SceneId(1), EScenePublicationMode_LocalOnly);
+
+    EXPECT_CALL(consumer, handleInitializeScene(sceneInfo, _));
+    EXPECT_CALL(consumer, handleSceneActionList_rvr(SceneId(1), _, 0, _));
+    sceneGraphComponent.handleSceneSubscription(SceneId(1), localParticipantID);
+
+    EXPECT_CALL(consumer, handleScenesBecameUnavailable(SceneInfoVector{ sceneInfo }, _));
+    sceneGraphComponent.handleRemoveScene(SceneId(1));
+}
+
+TEST_F(ASceneGraphComponent, flushesLocalOnlyOptimizedSceneSynchronouslyEvenIfAsynchronousFlushRequested)
+{
+    SceneInfo sceneInfo(SceneInfo(SceneId(1), "foo"));
+    ClientScene scene(sceneInfo);
+
+    sceneGraphComponent.setSceneRendererServiceHandler(&consumer);
+    sceneGraphComponent.handleCreateScene(scene, true, true);
+
+    EXPECT_CALL(consumer, handleNewScenesAvailable(SceneInfoVector{ sceneInfo }, _, _));
+    sceneGraphComponent.handlePublishScene(SceneId(1), EScenePublicationMode_LocalOnly);
+    sceneGraphComponent.handleSceneSubscription(SceneId(1), localParticipantID);
+
+    EXPECT_CALL(consumer, handleInitializeScene(sceneInfo, _));
+    EXPECT_CALL(consumer, handleSceneActionList_rvr(SceneId(1), _, 0, _));
+    sceneGraphComponent.handleFlush(SceneId(1), ESceneFlushMode_Synchronous, {}, {});
+    Mock::VerifyAndClearExpectations(&consumer);
+
+    EXPECT_CALL(consumer, handleScenesBecameUnavailable(SceneInfoVector{ sceneInfo }, _));
+    sceneGraphComponent.handleRemoveScene(SceneId(1));
+}
+
+TEST_F(ASceneGraphComponent, sendsSceneWithoutShadowCopyToRemoteSubscriberRightAwayIfNoChangesPending)
+{
+    SceneInfo sceneInfo(SceneInfo(SceneId(1), "foo"));
+    ClientScene scene(sceneInfo);
+
+    sceneGraphComponent.setSceneRendererServiceHandler(&consumer);
+    sceneGraphComponent.handleCreateScene(scene, true, false);
+
+    EXPECT_CALL(consumer, handleNewScenesAvailable(SceneInfoVector{ sceneInfo }, _, _));
+    EXPECT_CALL(communicationSystem, broadcastNewScenesAvailable(SceneInfoVector{ sceneInfo }));
+    sceneGraphComponent.handlePublishScene(SceneId(1), EScenePublicationMode_LocalAndRemote);
+    sceneGraphComponent.handleFlush(SceneId(1), ESceneFlushMode_Synchronous, {}, {});
+
+    EXPECT_CALL(communicationSystem, sendScenesAvailable(remoteParticipantID, SceneInfoVector{ sceneInfo }));
+    sceneGraphComponent.newParticipantHasConnected(remoteParticipantID);
+
+    EXPECT_CALL(communicationSystem, sendInitializeScene(remoteParticipantID, _));
+    EXPECT_CALL(communicationSystem, sendSceneActionList(remoteParticipantID, SceneId(1), _, 1)).WillOnce(Return(1));
+    sceneGraphComponent.handleSceneSubscription(SceneId(1), remoteParticipantID);
+
+    EXPECT_CALL(communicationSystem, broadcastScenesBecameUnavailable(SceneInfoVector{ sceneInfo }));
+    EXPECT_CALL(consumer, handleScenesBecameUnavailable(SceneInfoVector{ sceneInfo }, _));
+    sceneGraphComponent.handleRemoveScene(SceneId(1));
+}
@@ -76,7 +76,7 @@ namespace ramses_internal
          *  Copy constructor
          * @param other Vector3 to copy from
          */
-        Vector3(const Vector3& other);
+        Vector3(const Vector3& other) = default;
 
         /**
          *  Constructor to initialize the vector with single values
@@ -119,7 +119,7 @@ namespace ramses_internal
          *  Assignment operator to overwrite vector data with other vector data
          * @param other Vector3 to copy from
          */
-        Vector3& operator=(const Vector3& other);
+        Vector3& operator=(const Vector3& other) = default;
 
         /**
          *  Add operator to add two Vector3 by elements
@@ -280,11 +280,6 @@ namespace ramses_internal
     {
     }
 
-    inline Vector3::Vector3(const Vector3& other)
-    {
-        PlatformMemory::Copy(data, other.data, sizeof(data));
-    }
-
     inline void Vector3::set(const Float _x, const Float _y, const Float _z)
     {
         x = _x;
@@ -302,12 +297,6 @@ namespace ramses_internal
         return PlatformMath::Sqrt(PlatformMath::Pow2(x) + PlatformMath::Pow2(y) + PlatformMath::Pow2(z));
     }
 
-    inline Vector3& Vector3::operator=(const Vector3& other)
-    {
-        PlatformMemory::Copy(data, other.data, sizeof(data));
-        return *this;
-    }
-
     inline Vector3 Vector3::operator+(const Vector3& other) const
     {
         return Vector3( x + other.x
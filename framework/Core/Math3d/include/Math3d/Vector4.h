@@ -82,7 +82,7 @@ namespace ramses_internal
         *   Copy constructor
         * @param other Vector4 to copy from
         */
-        Vector4(const Vector4& other);
+        Vector4(const Vector4& other) = default;
 
         /**
         *   Constructor to initialize the vector with single values
@@ -127,7 +127,7 @@ namespace ramses_internal
         *   Assignment operator to overwrite vector data with other vector data
         * @param other Vector4 to copy from
         */
-        Vector4& operator=(const Vector4& other);
+        Vector4& operator=(const Vector4& other) = default;
 
         /**
         *   Add operator to add two Vector4 by elements
@@ -251,11 +251,6 @@ namespace ramses_internal
     {
     }
 
-    inline Vector4::Vector4(const Vector4& other)
-    {
-        PlatformMemory::Copy(data, other.data, sizeof(data));
-    }
-
     inline
         Vector4::Vector4(const Float value)
         : x(value)
@@ -289,15 +284,6 @@ namespace ramses_internal
         return PlatformMath::Sqrt(PlatformMath::Pow2(x) + PlatformMath::Pow2(y) + PlatformMath::Pow2(z) + PlatformMath::Pow2(w));
     }
 
-    inline Vector4& Vector4::operator=(const Vector4& other)
-    {
-        if (&other != this)
-        {
-            PlatformMemory::Copy(data, other.data, sizeof(data));
-        }
-        return *this;
-    }
-
     inline Vector4 Vector4::operator+(const Vector4& other) const
     {
         return Vector4(x + other.x
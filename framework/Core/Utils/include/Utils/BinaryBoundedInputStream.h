@@ -0,0 +1,70 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_BINARYBOUNDEDINPUTSTREAM_H
+#define RAMSES_BINARYBOUNDEDINPUTSTREAM_H
+
+#include "Collections/IInputStream.h"
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "PlatformAbstraction/PlatformError.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+
+namespace ramses_internal
+{
+    // Reads from memory of given size, read beyond its end puts stream in EOF state and yields zeroes
+    // (so that data read from a corrupt source cannot make reader access memory outside of it)
+    class BinaryBoundedInputStream : public IInputStream
+    {
+    public:
+        BinaryBoundedInputStream(const Char* input, UInt size);
+
+        virtual IInputStream& read(Char* buffer, UInt32 size) override;
+
+        virtual EStatus getState() const override;
+
+        UInt getRemainingSize() const;
+
+    private:
+        const Char* m_current;
+        const Char* const m_end;
+        EStatus m_state = EStatus_RAMSES_OK;
+    };
+
+    inline BinaryBoundedInputStream::BinaryBoundedInputStream(const Char* input, UInt size)
+        : m_current(input)
+        , m_end(input + size)
+    {
+    }
+
+    inline IInputStream& BinaryBoundedInputStream::read(Char* buffer, UInt32 size)
+    {
+        if (m_state == EStatus_RAMSES_OK && size <= getRemainingSize())
+        {
+            PlatformMemory::Copy(buffer, m_current, size);
+            m_current += size;
+        }
+        else
+        {
+            PlatformMemory::Set(buffer, 0, size);
+            m_state = EStatus_RAMSES_EOF;
+        }
+        return *this;
+    }
+
+    inline EStatus BinaryBoundedInputStream::getState() const
+    {
+        return m_state;
+    }
+
+    inline UInt BinaryBoundedInputStream::getRemainingSize() const
+    {
+        return static_cast<UInt>(m_end - m_current);
+    }
+}
+
+#endif
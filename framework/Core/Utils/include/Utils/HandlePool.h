@@ -12,6 +12,7 @@
 #include "Common/TypedMemoryHandle.h"
 #include "Collections/Vector.h"
 #include <limits>
+#include <algorithm>
 
 namespace ramses_internal
 {
@@ -32,6 +33,10 @@ namespace ramses_internal
         UInt32                          size() const;
         void                            resize(UInt32 size);
 
+        // Raw handle table (non-zero entry is acquired), used to store and restore handle pool in memory layout
+        const std::vector<UInt8>&       getRawHandleTable() const;
+        void                            setRawHandleTable(std::vector<UInt8>&& handleTable);
+
         static HANDLE                   InvalidMemoryHandle();
 
     protected:
@@ -139,6 +144,20 @@ namespace ramses_internal
         m_handlePool.resize(size);
     }
 
+    template <typename HANDLE>
+    const std::vector<UInt8>& HandlePool<HANDLE>::getRawHandleTable() const
+    {
+        return m_handlePool;
+    }
+
+    template <typename HANDLE>
+    void HandlePool<HANDLE>::setRawHandleTable(std::vector<UInt8>&& handleTable)
+    {
+        m_handlePool = std::move(handleTable);
+        m_nextAvailableHint = 0u;
+        m_numberOfAcquired = static_cast<UInt32>(m_handlePool.size() - std::count(m_handlePool.cbegin(), m_handlePool.cend(), UInt8(0u)));
+    }
+
     template <typename HANDLE>
     HANDLE HandlePool<HANDLE>::InvalidMemoryHandle()
     {
@@ -38,6 +38,11 @@ namespace ramses_internal
 
         void                            preallocateSize(UInt32 size);
 
+        // Raw memory (including objects of released handles) and handle table, used to store and restore pool in memory layout
+        const std::vector<OBJECTTYPE>&  getRawMemory() const;
+        const std::vector<UInt8>&       getRawHandleTable() const;
+        void                            setRawContent(std::vector<OBJECTTYPE>&& memory, std::vector<UInt8>&& handleTable);
+
         static HANDLE                   InvalidMemoryHandle();
 
         static_assert(std::is_move_constructible<OBJECTTYPE>::value && std::is_move_assignable<OBJECTTYPE>::value, "OBJECTTYPE must be movable");
@@ -57,6 +62,26 @@ namespace ramses_internal
         }
     }
 
+    template <typename OBJECTTYPE, typename HANDLE>
+    const std::vector<OBJECTTYPE>& MemoryPool<OBJECTTYPE, HANDLE>::getRawMemory() const
+    {
+        return m_memoryPool;
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    const std::vector<UInt8>& MemoryPool<OBJECTTYPE, HANDLE>::getRawHandleTable() const
+    {
+        return m_handlePool.getRawHandleTable();
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    void MemoryPool<OBJECTTYPE, HANDLE>::setRawContent(std::vector<OBJECTTYPE>&& memory, std::vector<UInt8>&& handleTable)
+    {
+        assert(memory.size() == handleTable.size());
+        m_memoryPool = std::move(memory);
+        m_handlePool.setRawHandleTable(std::move(handleTable));
+    }
+
     template <typename OBJECTTYPE, typename HANDLE>
     MemoryPool<OBJECTTYPE, HANDLE>::MemoryPool(UInt32 size /*= 0*/)
         : m_memoryPool(size)
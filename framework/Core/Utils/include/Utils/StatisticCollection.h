@@ -177,6 +177,11 @@ namespace ramses_internal
         StatisticEntry<UInt32> statSceneActionsSent;
         StatisticEntry<UInt32> statSceneActionsGenerated;
         StatisticEntry<UInt32> statSceneActionsGeneratedSize;
+        StatisticEntry<UInt32> statSceneSnapshotsCreated;
+        StatisticEntry<UInt32> statSceneSnapshotsSent; // number of subscribers snapshots were sent to
+        StatisticEntry<UInt32> statSceneSnapshotsReused;
+        StatisticEntry<UInt32> statSceneSnapshotsReusedSize;
+        StatisticEntry<UInt32> statSceneSnapshotsReusedTime; // time in microseconds it took to create the reused snapshots
     };
 }
 
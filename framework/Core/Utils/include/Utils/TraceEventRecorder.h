@@ -0,0 +1,114 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TRACEEVENTRECORDER_H
+#define RAMSES_TRACEEVENTRECORDER_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include "Collections/String.h"
+#include <atomic>
+#include <memory>
+#include <limits>
+
+namespace ramses_internal
+{
+    class StringOutputStream;
+
+    /* Records timed events from any thread into a fixed size ring buffer, oldest events get overwritten.
+       Recording is lock-free and only costs a check of an atomic flag when disabled.
+       Recorded events can be written in Chrome trace event format (JSON) and inspected
+       in chrome://tracing or any other viewer supporting the format.
+
+       Event category and name are stored as pointers, they must be string literals or have static lifetime.
+    */
+    class TraceEventRecorder
+    {
+    public:
+        static const UInt32 DefaultCapacity = 1u << 16;
+        static const UInt64 NoArgument = std::numeric_limits<UInt64>::max();
+
+        explicit TraceEventRecorder(UInt32 capacity = DefaultCapacity);
+        ~TraceEventRecorder();
+
+        void enable();
+        void disable();
+        Bool isEnabled() const
+        {
+            return m_enabled.load(std::memory_order_relaxed);
+        }
+        void clear();
+
+        void recordEvent(const char* category, const char* name, UInt64 startTimeInMicroseconds, UInt64 durationInMicroseconds, UInt64 argument = NoArgument);
+
+        UInt32 getNumberOfRecordedEvents() const;
+        void writeToStream(StringOutputStream& str) const;
+        Bool writeToFile(const String& filename) const;
+
+    private:
+        struct Event;
+        struct EventData
+        {
+            const char* category;
+            const char* name;
+            UInt64 startTime;
+            UInt64 duration;
+            UInt64 argument;
+            UInt32 threadId;
+        };
+
+        Bool readEvent(const Event& event, EventData& eventData) const;
+        static UInt32 GetCurrentThreadId();
+
+        const UInt32 m_capacity;
+        std::unique_ptr<Event[]> m_events;
+        std::atomic<bool> m_enabled;
+        std::atomic<UInt64> m_nextEventIdx;
+    };
+
+    inline TraceEventRecorder& GetTraceEventRecorder()
+    {
+        static TraceEventRecorder recorder;
+        return recorder;
+    }
+
+    class ScopedTraceEvent
+    {
+    public:
+        ScopedTraceEvent(const char* category, const char* name, UInt64 argument = TraceEventRecorder::NoArgument)
+            : m_category(category)
+            , m_name(name)
+            , m_argument(argument)
+            , m_startTime(GetTraceEventRecorder().isEnabled() ? PlatformTime::GetMicrosecondsMonotonic() : 0u)
+        {
+        }
+
+        ~ScopedTraceEvent()
+        {
+            if (m_startTime != 0u)
+                GetTraceEventRecorder().recordEvent(m_category, m_name, m_startTime, PlatformTime::GetMicrosecondsMonotonic() - m_startTime, m_argument);
+        }
+
+    private:
+        const char* m_category;
+        const char* m_name;
+        UInt64 m_argument;
+        UInt64 m_startTime;
+    };
+}
+
+#define TRACE_EVENT_CONCAT_INTERNAL(a, b) a##b
+#define TRACE_EVENT_CONCAT(a, b) TRACE_EVENT_CONCAT_INTERNAL(a, b)
+
+#define TRACE_SCOPE(category, name) \
+    ::ramses_internal::ScopedTraceEvent TRACE_EVENT_CONCAT(scopedTraceEvent, __LINE__)(category, name)
+
+#define TRACE_SCOPE_WITH_ID(category, name, id) \
+    ::ramses_internal::ScopedTraceEvent TRACE_EVENT_CONCAT(scopedTraceEvent, __LINE__)(category, name, static_cast<::ramses_internal::UInt64>(id))
+
+#endif
@@ -184,6 +184,16 @@ namespace ramses_internal
                             logStatisticSummaryEntry(output, entry.value->statSceneActionsGeneratedSize.getSummary(), numberTimeIntervals);
                             output << " actO ";
                             logStatisticSummaryEntry(output, entry.value->statSceneActionsSent.getSummary(), numberTimeIntervals);
+                            output << " snapC ";
+                            logStatisticSummaryEntry(output, entry.value->statSceneSnapshotsCreated.getSummary(), numberTimeIntervals);
+                            output << " snapS ";
+                            logStatisticSummaryEntry(output, entry.value->statSceneSnapshotsSent.getSummary(), numberTimeIntervals);
+                            output << " snapR ";
+                            logStatisticSummaryEntry(output, entry.value->statSceneSnapshotsReused.getSummary(), numberTimeIntervals);
+                            output << " snapRS ";
+                            logStatisticSummaryEntry(output, entry.value->statSceneSnapshotsReusedSize.getSummary(), numberTimeIntervals);
+                            output << " snapRT ";
+                            logStatisticSummaryEntry(output, entry.value->statSceneSnapshotsReusedTime.getSummary(), numberTimeIntervals);
                             output << " ";
 
                             entry.value->resetSummaries();
@@ -93,6 +93,11 @@ namespace ramses_internal
         statSceneActionsSent.reset();
         statSceneActionsGenerated.reset();
         statSceneActionsGeneratedSize.reset();
+        statSceneSnapshotsCreated.reset();
+        statSceneSnapshotsSent.reset();
+        statSceneSnapshotsReused.reset();
+        statSceneSnapshotsReusedSize.reset();
+        statSceneSnapshotsReusedTime.reset();
     }
 
     void StatisticCollectionScene::resetSummaries()
@@ -106,6 +111,11 @@ namespace ramses_internal
         statSceneActionsSent.getSummary().reset();
         statSceneActionsGenerated.getSummary().reset();
         statSceneActionsGeneratedSize.getSummary().reset();
+        statSceneSnapshotsCreated.getSummary().reset();
+        statSceneSnapshotsSent.getSummary().reset();
+        statSceneSnapshotsReused.getSummary().reset();
+        statSceneSnapshotsReusedSize.getSummary().reset();
+        statSceneSnapshotsReusedTime.getSummary().reset();
     }
 
     void StatisticCollectionScene::nextTimeInterval()
@@ -118,6 +128,11 @@ namespace ramses_internal
         statSceneActionsSent.updateSummaryAndResetCounter();
         statSceneActionsGenerated.updateSummaryAndResetCounter();
         statSceneActionsGeneratedSize.updateSummaryAndResetCounter();
+        statSceneSnapshotsCreated.updateSummaryAndResetCounter();
+        statSceneSnapshotsSent.updateSummaryAndResetCounter();
+        statSceneSnapshotsReused.updateSummaryAndResetCounter();
+        statSceneSnapshotsReusedSize.updateSummaryAndResetCounter();
+        statSceneSnapshotsReusedTime.updateSummaryAndResetCounter();
 
         statObjectsNumber.incCounter(objectsCreated);
         statObjectsNumber.decCounter(objectsDestroyed);
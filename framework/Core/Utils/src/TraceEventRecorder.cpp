@@ -0,0 +1,167 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/TraceEventRecorder.h"
+#include "Utils/File.h"
+#include "Utils/LogMacros.h"
+#include "Collections/StringOutputStream.h"
+#include <vector>
+#include <algorithm>
+
+namespace ramses_internal
+{
+    // Every field is atomic so that an event can be read while it is being overwritten by another thread.
+    // Sequence is zero while event is written and set to (event index + 1) once complete,
+    // reader accepts event only if sequence is unchanged before and after reading the other fields.
+    struct TraceEventRecorder::Event
+    {
+        std::atomic<UInt64> sequence{ 0u };
+        std::atomic<const char*> category{ nullptr };
+        std::atomic<const char*> name{ nullptr };
+        std::atomic<UInt64> startTime{ 0u };
+        std::atomic<UInt64> duration{ 0u };
+        std::atomic<UInt64> argument{ 0u };
+        std::atomic<UInt32> threadId{ 0u };
+    };
+
+    TraceEventRecorder::TraceEventRecorder(UInt32 capacity)
+        : m_capacity(capacity)
+        , m_enabled(false)
+        , m_nextEventIdx(0u)
+    {
+        assert(m_capacity > 0u);
+    }
+
+    TraceEventRecorder::~TraceEventRecorder() = default;
+
+    void TraceEventRecorder::enable()
+    {
+        // buffer is allocated on first use and kept until destruction, so that recording threads never see it released
+        if (!m_events)
+            m_events.reset(new Event[m_capacity]);
+        m_enabled.store(true, std::memory_order_release);
+    }
+
+    void TraceEventRecorder::disable()
+    {
+        m_enabled.store(false, std::memory_order_release);
+    }
+
+    void TraceEventRecorder::clear()
+    {
+        if (!m_events)
+            return;
+
+        for (UInt32 i = 0u; i < m_capacity; ++i)
+            m_events[i].sequence.store(0u, std::memory_order_relaxed);
+        m_nextEventIdx.store(0u, std::memory_order_release);
+    }
+
+    void TraceEventRecorder::recordEvent(const char* category, const char* name, UInt64 startTimeInMicroseconds, UInt64 durationInMicroseconds, UInt64 argument)
+    {
+        if (!m_enabled.load(std::memory_order_acquire))
+            return;
+
+        const UInt64 eventIdx = m_nextEventIdx.fetch_add(1u, std::memory_order_relaxed);
+        Event& event = m_events[eventIdx % m_capacity];
+
+        event.sequence.store(0u, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        event.category.store(category, std::memory_order_relaxed);
+        event.name.store(name, std::memory_order_relaxed);
+        event.startTime.store(startTimeInMicroseconds, std::memory_order_relaxed);
+        event.duration.store(durationInMicroseconds, std::memory_order_relaxed);
+        event.argument.store(argument, std::memory_order_relaxed);
+        event.threadId.store(GetCurrentThreadId(), std::memory_order_relaxed);
+        event.sequence.store(eventIdx + 1u, std::memory_order_release);
+    }
+
+    Bool TraceEventRecorder::readEvent(const Event& event, EventData& eventData) const
+    {
+        const UInt64 sequence = event.sequence.load(std::memory_order_acquire);
+        if (sequence == 0u)
+            return false;
+
+        eventData.category = event.category.load(std::memory_order_relaxed);
+        eventData.name = event.name.load(std::memory_order_relaxed);
+        eventData.startTime = event.startTime.load(std::memory_order_relaxed);
+        eventData.duration = event.duration.load(std::memory_order_relaxed);
+        eventData.argument = event.argument.load(std::memory_order_relaxed);
+        eventData.threadId = event.threadId.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        return event.sequence.load(std::memory_order_relaxed) == sequence;
+    }
+
+    UInt32 TraceEventRecorder::GetCurrentThreadId()
+    {
+        // small consecutive ids are easier to read in trace viewer than platform thread ids
+        static std::atomic<UInt32> nextThreadId(1u);
+        static thread_local UInt32 threadId = 0u;
+        if (threadId == 0u)
+            threadId = nextThreadId.fetch_add(1u, std::memory_order_relaxed);
+        return threadId;
+    }
+
+    UInt32 TraceEventRecorder::getNumberOfRecordedEvents() const
+    {
+        return static_cast<UInt32>(std::min<UInt64>(m_nextEventIdx.load(std::memory_order_acquire), m_capacity));
+    }
+
+    void TraceEventRecorder::writeToStream(StringOutputStream& str) const
+    {
+        std::vector<EventData> events;
+        if (m_events)
+        {
+            events.reserve(getNumberOfRecordedEvents());
+            EventData eventData;
+            for (UInt32 i = 0u; i < m_capacity; ++i)
+            {
+                if (readEvent(m_events[i], eventData))
+                    events.push_back(eventData);
+            }
+        }
+        std::sort(events.begin(), events.end(), [](const EventData& e1, const EventData& e2) { return e1.startTime < e2.startTime; });
+
+        str << "{\"traceEvents\":[";
+        Bool first = true;
+        for (const auto& event : events)
+        {
+            if (!first)
+                str << ",";
+            first = false;
+
+            str << "\n{\"cat\":\"" << event.category << "\",\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.threadId
+                << ",\"ts\":" << event.startTime << ",\"dur\":" << event.duration;
+            if (event.argument != NoArgument)
+                str << ",\"args\":{\"id\":" << event.argument << "}";
+            str << "}";
+        }
+        str << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    Bool TraceEventRecorder::writeToFile(const String& filename) const
+    {
+        StringOutputStream str;
+        writeToStream(str);
+
+        File file(filename);
+        if (file.open(EFileMode_WriteOverWriteOld) != EStatus_RAMSES_OK)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "TraceEventRecorder::writeToFile: failed to open file " << filename);
+            return false;
+        }
+
+        const Bool success = (file.write(str.c_str(), str.length()) == EStatus_RAMSES_OK);
+        file.close();
+        if (!success)
+            LOG_ERROR(CONTEXT_FRAMEWORK, "TraceEventRecorder::writeToFile: failed to write file " << filename);
+
+        return success;
+    }
+}
@@ -0,0 +1,63 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include "Utils/BinaryBoundedInputStream.h"
+#include "Utils/BinaryOutputStream.h"
+
+namespace ramses_internal
+{
+    TEST(BinaryBoundedInputStreamTest, ReadsValuesWithinBounds)
+    {
+        BinaryOutputStream outStream;
+        outStream << UInt32(5u) << UInt64(6u);
+
+        BinaryBoundedInputStream inStream(outStream.getData(), outStream.getSize());
+        UInt32 value1 = 0u;
+        UInt64 value2 = 0u;
+        inStream >> value1 >> value2;
+
+        EXPECT_EQ(5u, value1);
+        EXPECT_EQ(6u, value2);
+        EXPECT_EQ(EStatus_RAMSES_OK, inStream.getState());
+        EXPECT_EQ(0u, inStream.getRemainingSize());
+    }
+
+    TEST(BinaryBoundedInputStreamTest, FailsToReadBeyondBoundsAndYieldsZero)
+    {
+        BinaryOutputStream outStream;
+        outStream << UInt32(5u) << UInt32(6u);
+
+        // bound excludes second value
+        BinaryBoundedInputStream inStream(outStream.getData(), sizeof(UInt32));
+        UInt32 value1 = 0u;
+        UInt64 value2 = 7u;
+        inStream >> value1 >> value2;
+
+        EXPECT_EQ(5u, value1);
+        EXPECT_EQ(0u, value2);
+        EXPECT_EQ(EStatus_RAMSES_EOF, inStream.getState());
+        EXPECT_EQ(0u, inStream.getRemainingSize());
+    }
+
+    TEST(BinaryBoundedInputStreamTest, StaysInErrorStateAfterFailedRead)
+    {
+        BinaryOutputStream outStream;
+        outStream << UInt32(5u);
+
+        BinaryBoundedInputStream inStream(outStream.getData(), outStream.getSize());
+        UInt64 value1 = 0u;
+        UInt32 value2 = 7u;
+        inStream >> value1 >> value2;
+
+        EXPECT_EQ(0u, value2);
+        EXPECT_EQ(EStatus_RAMSES_EOF, inStream.getState());
+        EXPECT_EQ(sizeof(UInt32), inStream.getRemainingSize());
+    }
+}
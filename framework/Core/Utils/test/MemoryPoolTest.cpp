@@ -170,4 +170,29 @@ namespace ramses_internal
         EXPECT_EQ(6u, pool.getTotalCount());
         EXPECT_EQ(2u, pool.getActualCount());
     }
+
+    TYPED_TEST(AMemoryPool, canRestoreRawContentOfOtherPool)
+    {
+        TypeParam pool;
+        pool.allocate(1);
+        pool.allocate(3);
+        pool.getMemory(3)->integer = 7u;
+
+        TypeParam restoredPool;
+        std::vector<ComparableObject> memory = pool.getRawMemory();
+        std::vector<UInt8> handleTable = pool.getRawHandleTable();
+        restoredPool.setRawContent(std::move(memory), std::move(handleTable));
+
+        EXPECT_EQ(4u, restoredPool.getTotalCount());
+        EXPECT_EQ(2u, restoredPool.getActualCount());
+        EXPECT_FALSE(restoredPool.isAllocated(0));
+        EXPECT_TRUE(restoredPool.isAllocated(1));
+        EXPECT_FALSE(restoredPool.isAllocated(2));
+        EXPECT_TRUE(restoredPool.isAllocated(3));
+        EXPECT_EQ(7u, restoredPool.getMemory(3)->integer);
+
+        // released handles are reused after restore
+        EXPECT_EQ(0u, restoredPool.allocate());
+        EXPECT_EQ(2u, restoredPool.allocate());
+    }
 }
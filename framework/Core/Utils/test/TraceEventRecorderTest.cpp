@@ -0,0 +1,145 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include "Utils/TraceEventRecorder.h"
+#include "Collections/StringOutputStream.h"
+#include <thread>
+
+using namespace testing;
+
+namespace ramses_internal
+{
+    class ATraceEventRecorder : public testing::Test
+    {
+    protected:
+        ATraceEventRecorder()
+            : m_recorder(4u)
+        {
+        }
+
+        String getRecordedTrace() const
+        {
+            StringOutputStream str;
+            m_recorder.writeToStream(str);
+            return str.release();
+        }
+
+        TraceEventRecorder m_recorder;
+    };
+
+    TEST_F(ATraceEventRecorder, isDisabledInitially)
+    {
+        EXPECT_FALSE(m_recorder.isEnabled());
+        m_recorder.recordEvent("cat", "ev", 1u, 2u);
+        EXPECT_EQ(0u, m_recorder.getNumberOfRecordedEvents());
+        EXPECT_EQ(-1, getRecordedTrace().find("\"name\""));
+    }
+
+    TEST_F(ATraceEventRecorder, writesRecordedEventsInChromeTraceFormat)
+    {
+        m_recorder.enable();
+        EXPECT_TRUE(m_recorder.isEnabled());
+        m_recorder.recordEvent("cat", "ev", 10u, 5u);
+        m_recorder.recordEvent("cat2", "ev2", 20u, 7u, 33u);
+        EXPECT_EQ(2u, m_recorder.getNumberOfRecordedEvents());
+
+        const String trace = getRecordedTrace();
+        EXPECT_EQ(0, trace.find("{\"traceEvents\":["));
+        EXPECT_GE(trace.find("\"cat\":\"cat\",\"name\":\"ev\",\"ph\":\"X\""), 0);
+        EXPECT_GE(trace.find("\"ts\":10,\"dur\":5}"), 0);
+        EXPECT_GE(trace.find("\"cat\":\"cat2\",\"name\":\"ev2\",\"ph\":\"X\""), 0);
+        EXPECT_GE(trace.find("\"ts\":20,\"dur\":7,\"args\":{\"id\":33}}"), 0);
+    }
+
+    TEST_F(ATraceEventRecorder, sortsEventsByStartTime)
+    {
+        m_recorder.enable();
+        m_recorder.recordEvent("cat", "late", 20u, 1u);
+        m_recorder.recordEvent("cat", "early", 10u, 1u);
+
+        const String trace = getRecordedTrace();
+        EXPECT_LT(trace.find("early"), trace.find("late"));
+    }
+
+    TEST_F(ATraceEventRecorder, stopsRecordingWhenDisabled)
+    {
+        m_recorder.enable();
+        m_recorder.recordEvent("cat", "ev", 1u, 1u);
+        m_recorder.disable();
+        m_recorder.recordEvent("cat", "ignored", 2u, 1u);
+
+        EXPECT_EQ(1u, m_recorder.getNumberOfRecordedEvents());
+        EXPECT_EQ(-1, getRecordedTrace().find("ignored"));
+    }
+
+    TEST_F(ATraceEventRecorder, overwritesOldestEventsWhenBufferFull)
+    {
+        m_recorder.enable();
+        const char* names[] = { "ev0", "ev1", "ev2", "ev3", "ev4", "ev5" };
+        for (UInt64 i = 0u; i < 6u; ++i)
+            m_recorder.recordEvent("cat", names[i], i, 1u);
+
+        EXPECT_EQ(4u, m_recorder.getNumberOfRecordedEvents());
+        const String trace = getRecordedTrace();
+        EXPECT_EQ(-1, trace.find("ev0"));
+        EXPECT_EQ(-1, trace.find("ev1"));
+        for (UInt i = 2u; i < 6u; ++i)
+            EXPECT_GE(trace.find(names[i]), 0);
+    }
+
+    TEST_F(ATraceEventRecorder, discardsAllEventsOnClear)
+    {
+        m_recorder.enable();
+        m_recorder.recordEvent("cat", "ev", 1u, 1u);
+        m_recorder.clear();
+
+        EXPECT_EQ(0u, m_recorder.getNumberOfRecordedEvents());
+        EXPECT_EQ(-1, getRecordedTrace().find("\"name\""));
+    }
+
+    TEST_F(ATraceEventRecorder, assignsDifferentIdsToDifferentThreads)
+    {
+        m_recorder.enable();
+        m_recorder.recordEvent("cat", "ev", 1u, 1u);
+        std::thread thread([&]() { m_recorder.recordEvent("cat", "ev", 2u, 1u); });
+        thread.join();
+
+        const String trace = getRecordedTrace();
+        const Int firstTid = trace.find("\"tid\":");
+        ASSERT_GE(firstTid, 0);
+        const Int secondTid = trace.find("\"tid\":", firstTid + 1);
+        ASSERT_GE(secondTid, 0);
+        EXPECT_NE(trace.substr(firstTid, 8), trace.substr(secondTid, 8));
+    }
+
+    TEST(AScopedTraceEvent, recordsEventOnlyIfGlobalRecorderEnabled)
+    {
+        TraceEventRecorder& recorder = GetTraceEventRecorder();
+        recorder.clear();
+        {
+            TRACE_SCOPE("test", "notRecorded");
+        }
+        EXPECT_EQ(0u, recorder.getNumberOfRecordedEvents());
+
+        recorder.enable();
+        {
+            TRACE_SCOPE_WITH_ID("test", "recorded", 7u);
+        }
+        recorder.disable();
+
+        StringOutputStream str;
+        recorder.writeToStream(str);
+        const String trace = str.release();
+        EXPECT_EQ(1u, recorder.getNumberOfRecordedEvents());
+        EXPECT_GE(trace.find("\"cat\":\"test\",\"name\":\"recorded\""), 0);
+        EXPECT_GE(trace.find("\"args\":{\"id\":7}"), 0);
+        recorder.clear();
+    }
+}
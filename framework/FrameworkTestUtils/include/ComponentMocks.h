@@ -67,7 +67,7 @@ namespace ramses_internal
         ~SceneGraphProviderComponentMock() override;
 
         MOCK_METHOD1(setSceneProviderServiceHandler, void(ISceneProviderServiceHandler* handler));
-        MOCK_METHOD2(handleCreateScene, void(ClientScene& scene, bool enableLocalOnlyOptimization));
+        MOCK_METHOD3(handleCreateScene, void(ClientScene& scene, bool disableSceneShadowCopy, bool enableAsynchronousFlush));
         MOCK_METHOD2(handlePublishScene, void(SceneId sceneId, EScenePublicationMode publicationMode));
         MOCK_METHOD1(handleUnpublishScene, void(SceneId sceneId));
         MOCK_METHOD4(handleFlush, void(SceneId sceneId, ESceneFlushMode flushMode, const FlushTimeInformation&, SceneVersionTag));
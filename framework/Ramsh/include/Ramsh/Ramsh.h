@@ -19,6 +19,7 @@
 #include "Ramsh/RamshCommandSetContextLogLevel.h"
 #include "Ramsh/RamshCommandSetContextLogLevelFilter.h"
 #include "Ramsh/RamshCommandPrintLogLevels.h"
+#include "Ramsh/RamshCommandTraceEvents.h"
 
 namespace ramses_internal
 {
@@ -56,6 +57,7 @@ namespace ramses_internal
         RamshCommandSetContextLogLevel* m_pCmdSetContextLogLevel;
         RamshCommandSetContextLogLevelFilter* m_pCmdSetContextLogLevelFilter;
         RamshCommandPrintLogLevels* m_pCmdPrintLogLevels;
+        RamshCommandTraceEvents m_cmdTraceEvents;
 
     private:
         Ramsh(const Ramsh& ramsh);
@@ -0,0 +1,30 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RAMSHCOMMANDTRACEEVENTS_H
+#define RAMSES_RAMSHCOMMANDTRACEEVENTS_H
+
+#include "Ramsh/RamshCommand.h"
+
+namespace ramses_internal
+{
+    class TraceEventRecorder;
+
+    class RamshCommandTraceEvents : public RamshCommand
+    {
+    public:
+        explicit RamshCommandTraceEvents(TraceEventRecorder& recorder);
+        virtual Bool executeInput(const RamshInput& input) override;
+
+    private:
+        TraceEventRecorder& m_recorder;
+    };
+
+}// namespace ramses_internal
+
+#endif
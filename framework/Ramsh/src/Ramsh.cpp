@@ -10,6 +10,7 @@
 #include "ramses-sdk-build-config.h"
 #include "Utils/LogMacros.h"
 #include "Ramsh/RamshCommandSetContextLogLevelFilter.h"
+#include "Utils/TraceEventRecorder.h"
 
 namespace ramses_internal
 {
@@ -17,6 +18,7 @@ namespace ramses_internal
     : m_prompt(prompt.append(">"))
     , m_cmdPrintBuildConfig(::ramses_sdk::RAMSES_SDK_BUILD_CONFIG)
     , m_cmdPrintRamsesVersion(::ramses_sdk::RAMSES_SDK_PROJECT_VERSION_STRING)
+    , m_cmdTraceEvents(GetTraceEventRecorder())
     {
         add(m_cmdPrintBuildConfig);
         add(m_cmdPrintRamsesVersion);
@@ -35,6 +37,8 @@ namespace ramses_internal
 
         m_pCmdPrintLogLevels = new RamshCommandPrintLogLevels(*this);
         add(*m_pCmdPrintLogLevels);
+
+        add(m_cmdTraceEvents);
     }
 
     Ramsh::~Ramsh()
@@ -0,0 +1,53 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Ramsh/RamshCommandTraceEvents.h"
+#include "Ramsh/RamshInput.h"
+#include "Utils/TraceEventRecorder.h"
+#include "Utils/LogMacros.h"
+
+namespace ramses_internal
+{
+    RamshCommandTraceEvents::RamshCommandTraceEvents(TraceEventRecorder& recorder)
+        : m_recorder(recorder)
+    {
+        registerKeyword("trace");
+        description = "record timeline of internal events of all threads. Usage: trace start|stop|clear|dump <file>, dumped file is in Chrome trace event format";
+    }
+
+    Bool RamshCommandTraceEvents::executeInput(const RamshInput& input)
+    {
+        if (input.size() == 2 && input[1] == "start")
+        {
+            m_recorder.enable();
+            LOG_INFO(CONTEXT_RAMSH, "RamshCommandTraceEvents: trace event recording started");
+            return true;
+        }
+        if (input.size() == 2 && input[1] == "stop")
+        {
+            m_recorder.disable();
+            LOG_INFO(CONTEXT_RAMSH, "RamshCommandTraceEvents: trace event recording stopped, " << m_recorder.getNumberOfRecordedEvents() << " events in buffer");
+            return true;
+        }
+        if (input.size() == 2 && input[1] == "clear")
+        {
+            m_recorder.clear();
+            return true;
+        }
+        if (input.size() == 3 && input[1] == "dump")
+        {
+            if (!m_recorder.writeToFile(input[2]))
+                return false;
+            LOG_INFO(CONTEXT_RAMSH, "RamshCommandTraceEvents: " << m_recorder.getNumberOfRecordedEvents() << " trace events written to " << input[2]);
+            return true;
+        }
+
+        LOG_ERROR(CONTEXT_RAMSH, "RamshCommandTraceEvents: Wrong usage, trace start|stop|clear|dump <file>");
+        return false;
+    }
+}
@@ -11,6 +11,8 @@
 
 #include "Scene/ResourceChangeCollectingScene.h"
 #include "Scene/SceneActionCollectionCreator.h"
+#include "Scene/SceneLockGuard.h"
+#include <memory>
 
 namespace ramses_internal
 {
@@ -33,7 +35,10 @@ namespace ramses_internal
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, Bool visibility) override;
         virtual void                        setRenderableRenderState        (RenderableHandle renderableHandle, RenderStateHandle stateHandle) override;
         virtual void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, UInt32 instanceCount) override;
+        virtual void                        setRenderableBoundingSphere     (RenderableHandle renderableHandle, const Vector4& boundingSphere) override;
         void                                setRenderableDataInstanceAndStateAndEffect (RenderableHandle renderableHandle, DataInstanceHandle newDataInstance, RenderStateHandle stateHandle, const ResourceContentHash& effectHash);
+        // sets same visibility to many renderables using a single scene action
+        void                                setRenderablesVisibility        (const std::vector<RenderableHandle>& renderableHandles, Bool visibility);
 
         // Render state
         virtual RenderStateHandle           allocateRenderState             (RenderStateHandle stateHandle = RenderStateHandle::Invalid()) override;
@@ -91,6 +96,8 @@ namespace ramses_internal
         virtual void                        setDataResource                 (DataInstanceHandle containerHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, UInt32 instancingDivisor) override;
         virtual void                        setDataTextureSamplerHandle     (DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle) override;
         virtual void                        setDataReference                (DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef) override;
+        // sets same field of many data instances using a single scene action, data holds elementCount values for each instance consecutively
+        void                                setDataArrayForInstances        (const DataInstanceHandle* containerHandles, UInt32 containerCount, DataFieldHandle field, EDataType dataType, UInt32 elementCount, const Byte* data);
 
         // Texture sampler description
         virtual TextureSamplerHandle        allocateTextureSampler          (const TextureSampler& sampler, TextureSamplerHandle handle = TextureSamplerHandle::Invalid()) override;
@@ -156,9 +163,19 @@ namespace ramses_internal
         const SceneActionCollection& getSceneActionCollection() const;
         SceneActionCollection& getSceneActionCollection();
 
+        // Scene lock is held during every modification of scene (including recording of its scene action), so that another thread
+        // can read a consistent scene while holding it. It must be enabled before scene is accessed by another thread.
+        void enableSceneLock();
+        PlatformLock* getSceneLock() const;
+
+    protected:
+        virtual void                        onRestoredFromSceneImage() override;
+
     private:
+        std::unique_ptr<PlatformLock> m_sceneLock;
         SceneActionCollection m_collection;
         SceneActionCollectionCreator m_creator;
+        std::vector<RenderableHandle> m_renderablesWithChangedVisibility;
     };
 }
 
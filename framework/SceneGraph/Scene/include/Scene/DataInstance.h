@@ -54,6 +54,22 @@ namespace ramses_internal
             return m_dataLayoutHandle;
         }
 
+        // data of all fields in memory layout of data layout
+        UInt32 getRawDataSize() const
+        {
+            return static_cast<UInt32>(m_data.size());
+        }
+
+        const Byte* getRawData() const
+        {
+            return m_data.data();
+        }
+
+        Byte* getRawData()
+        {
+            return m_data.data();
+        }
+
     private:
         DataLayoutHandle m_dataLayoutHandle;
         std::vector<Byte> m_data;
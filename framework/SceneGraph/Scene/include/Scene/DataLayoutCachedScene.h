@@ -25,6 +25,10 @@ namespace ramses_internal
 
         UInt32                              getNumDataLayoutReferences(DataLayoutHandle handle) const;
 
+    protected:
+        // restored data layouts are cached with one reference, further references are added by allocating them again
+        virtual void                        onRestoredFromSceneImage() override;
+
     private:
         struct DataLayoutCacheEntry
         {
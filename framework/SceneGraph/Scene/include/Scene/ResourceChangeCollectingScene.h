@@ -57,6 +57,9 @@ namespace ramses_internal
         virtual void                        releaseTextureBuffer(TextureBufferHandle handle) override;
         virtual void                        updateTextureBuffer(TextureBufferHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 width, UInt32 height, const Byte* data) override;
 
+    protected:
+        virtual void                        onRestoredFromSceneImage() override;
+
     private:
         void handleClientResourceReferenceChange(const ResourceContentHash& currentHash, const ResourceContentHash& newHash);
         void incrementClientResourceUsageCount(const ResourceContentHash& hash);
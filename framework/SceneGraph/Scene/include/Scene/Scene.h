@@ -35,6 +35,8 @@
 
 namespace ramses_internal
 {
+    class SceneImage;
+
     template <template<typename, typename> class MEMORYPOOL>
     class SceneT;
 
@@ -65,6 +67,7 @@ namespace ramses_internal
         virtual void                        setRenderableRenderState        (RenderableHandle renderableHandle, RenderStateHandle stateHandle) override;
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, Bool visibility) override;
         virtual void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, UInt32 instanceCount) override;
+        virtual void                        setRenderableBoundingSphere     (RenderableHandle renderableHandle, const Vector4& boundingSphere) override;
         virtual const Renderable&           getRenderable                   (RenderableHandle renderableHandle) const override final;
 
         // Render state
@@ -292,7 +295,12 @@ namespace ramses_internal
         RenderPass&                     getRenderPassInternal           (RenderPassHandle handle);
         RenderGroup&                    getRenderGroupInternal          (RenderGroupHandle handle);
 
+        // Called after pools were restored from scene image, derived scenes rebuild state they keep beside the pools
+        virtual void                    onRestoredFromSceneImage        ();
+
     private:
+        friend class SceneImage;
+
         template <typename TYPE>
         const TYPE* getInstanceDataInternal(DataInstanceHandle dataInstanceHandle, DataFieldHandle fieldId) const;
         template <typename TYPE>
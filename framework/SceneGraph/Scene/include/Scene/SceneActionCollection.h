@@ -129,6 +129,10 @@ namespace ramses_internal
             void readWithoutCopy(const Byte*& data, UInt32& size);
 
             bool isFullyRead() const;
+            // bytes of action not read yet, used to validate counts read from action before reading that many elements
+            UInt32 remainingSize() const;
+            // moves reader position to end of action, used when rejecting malformed action
+            void skipRemaining();
 
         private:
             friend SceneActionCollection;
@@ -568,6 +572,17 @@ namespace ramses_internal
         return m_readPosition == offsetForIndex(m_actionIndex + 1);
     }
 
+    inline UInt32 SceneActionCollection::SceneActionReader::remainingSize() const
+    {
+        assert(m_readPosition <= offsetForIndex(m_actionIndex + 1));
+        return static_cast<UInt32>(offsetForIndex(m_actionIndex + 1) - m_readPosition);
+    }
+
+    inline void SceneActionCollection::SceneActionReader::skipRemaining()
+    {
+        m_readPosition = offsetForIndex(m_actionIndex + 1);
+    }
+
     inline UInt32 SceneActionCollection::SceneActionReader::offsetForIndex(UInt idx) const
     {
         return (idx >= m_collection->m_actionInfo.size()) ? // is > last index?
@@ -59,7 +59,9 @@ namespace ramses_internal
         void setRenderableIndexCount(RenderableHandle renderableHandle, UInt32 indexCount);
         void setRenderableRenderState(RenderableHandle renderableHandle, RenderStateHandle stateHandle);
         void setRenderableVisibility(RenderableHandle renderableHandle, Bool visible);
+        void setRenderablesVisibility(const RenderableHandle* renderableHandles, UInt32 renderableCount, Bool visible);
         void setRenderableInstanceCount(RenderableHandle renderableHandle, UInt32 instanceCount);
+        void setRenderableBoundingSphere(RenderableHandle renderableHandle, const Vector4& boundingSphere);
 
         // Render state allocation
         void allocateRenderState(RenderStateHandle stateHandle);
@@ -117,6 +119,7 @@ namespace ramses_internal
         void setDataResource(DataInstanceHandle containerHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, UInt32 instancingDivisor);
         void setDataTextureSamplerHandle(DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle);
         void setDataReference(DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef);
+        void setDataArrayForInstances(const DataInstanceHandle* containerHandles, UInt32 containerCount, DataFieldHandle field, EDataType dataType, UInt32 elementCount, const Byte* data);
 
         // Texture sampler description
         void allocateTextureSampler(const TextureSampler& sampler, TextureSamplerHandle handle);
@@ -24,6 +24,7 @@ namespace ramses_internal
     public:
         template <typename T>
         static void describeScene(const T& source, SceneActionCollectionCreator& collector);
+        static void describeAnimationSystems(const IScene& source, SceneActionCollectionCreator& collector);
 
     private:
         static void RecreateNodes(const IScene& source, SceneActionCollectionCreator& collector);
@@ -0,0 +1,34 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENEIMAGE_H
+#define RAMSES_SCENEIMAGE_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+
+namespace ramses_internal
+{
+    class ClientScene;
+    class IOutputStream;
+    class AnimationSystemFactory;
+
+    // Scene image stores memory pools of a client scene together with their handle tables in memory layout, so that
+    // loading restores pools with bulk reads instead of recreating the scene object by object. Pools of trivially
+    // copyable objects are stored as one block, objects owning memory are stored one by one and animation systems
+    // as scene actions. Image can only be read on a machine with same endianness and object sizes, its content
+    // is protected by a hash which is checked together with the header before the scene is modified.
+    class SceneImage
+    {
+    public:
+        static void WriteToStream(IOutputStream& outStream, const ClientScene& scene);
+        // scene must be empty (only preallocated), returns false if image is not valid
+        static Bool ReadFromMemory(const Char* image, UInt imageSize, ClientScene& scene, AnimationSystemFactory* animSystemFactory = nullptr);
+    };
+}
+
+#endif
@@ -0,0 +1,41 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENELOCKGUARD_H
+#define RAMSES_SCENELOCKGUARD_H
+
+#include "PlatformAbstraction/PlatformLock.h"
+
+namespace ramses_internal
+{
+    // Acquires scene lock if scene has one, scenes which are only accessed by the thread modifying them have none
+    class SceneLockGuard
+    {
+    public:
+        explicit SceneLockGuard(PlatformLock* sceneLock)
+            : m_sceneLock(sceneLock)
+        {
+            if (m_sceneLock)
+                m_sceneLock->lock();
+        }
+
+        ~SceneLockGuard()
+        {
+            if (m_sceneLock)
+                m_sceneLock->unlock();
+        }
+
+        SceneLockGuard(const SceneLockGuard&) = delete;
+        SceneLockGuard& operator=(const SceneLockGuard&) = delete;
+
+    private:
+        PlatformLock* m_sceneLock;
+    };
+}
+
+#endif
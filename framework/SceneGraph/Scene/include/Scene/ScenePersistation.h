@@ -15,6 +15,7 @@
 namespace ramses_internal
 {
     class ClientScene;
+    class SceneActionCollection;
     class String;
     class IOutputStream;
     class IInputStream;
@@ -26,10 +27,12 @@ namespace ramses_internal
     public:
         static void WriteSceneMetadataToStream(IOutputStream& outStream, const IScene& scene);
         static void WriteSceneToStream(IOutputStream& outStream, const ClientScene& scene);
+        static void WriteSceneActionsToStream(IOutputStream& outStream, const SceneActionCollection& collection);
         static void WriteSceneToFile(const String& filename, const ClientScene& scene);
 
         static void ReadSceneMetadataFromStream(IInputStream& inStream, SceneCreationInformation& createInfo);
-        static void ReadSceneFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory = nullptr);
+        // returns false if stream is not a valid scene, scene is unchanged then
+        static bool ReadSceneFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory = nullptr);
         static void ReadSceneFromFile(const String& filename, IScene& scene, AnimationSystemFactory* animSystemFactory = nullptr);
     };
 }
@@ -49,6 +49,8 @@ namespace ramses_internal
         Bool                            isMatrixCacheDirty(ETransformationMatrixType matrixType, NodeHandle node) const;
 
     protected:
+        virtual void                onRestoredFromSceneImage() override;
+
         MatrixCacheEntry&           getMatrixCacheEntry(NodeHandle nodeHandle) const;
         Bool                        markDirty(NodeHandle node) const;
 
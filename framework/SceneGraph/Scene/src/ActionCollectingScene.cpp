@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "Scene/ActionCollectingScene.h"
+#include "Scene/SceneDescriber.h"
 
 namespace ramses_internal
 {
@@ -19,102 +20,171 @@ namespace ramses_internal
 
     void ActionCollectingScene::preallocateSceneSize(const SceneSizeInformation& sizeInfo)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::preallocateSceneSize(sizeInfo);
         m_creator.preallocateSceneSize(sizeInfo);
     }
 
     void ActionCollectingScene::setDataResource(DataInstanceHandle containerHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, UInt32 instancingDivisor)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataResource(containerHandle, field, hash, dataBuffer, instancingDivisor);
         m_creator.setDataResource(containerHandle, field, hash, dataBuffer, instancingDivisor);
     }
 
     void ActionCollectingScene::setDataTextureSamplerHandle(DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataTextureSamplerHandle(containerHandle, field, samplerHandle);
         m_creator.setDataTextureSamplerHandle(containerHandle, field, samplerHandle);
     }
 
     void ActionCollectingScene::setDataReference(DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataReference(containerHandle, field, dataRef);
         m_creator.setDataReference(containerHandle, field, dataRef);
     }
 
+    void ActionCollectingScene::setDataArrayForInstances(const DataInstanceHandle* containerHandles, UInt32 containerCount, DataFieldHandle field, EDataType dataType, UInt32 elementCount, const Byte* data)
+    {
+        SceneLockGuard guard(m_sceneLock.get());
+        const UInt32 dataSizePerInstance = elementCount * EnumToSize(dataType);
+        for (UInt32 i = 0u; i < containerCount; ++i)
+        {
+            const Byte* instanceData = data + i * dataSizePerInstance;
+            switch (dataType)
+            {
+            case EDataType_Float:
+                ResourceChangeCollectingScene::setDataFloatArray(containerHandles[i], field, elementCount, reinterpret_cast<const Float*>(instanceData));
+                break;
+            case EDataType_Vector2F:
+                ResourceChangeCollectingScene::setDataVector2fArray(containerHandles[i], field, elementCount, reinterpret_cast<const Vector2*>(instanceData));
+                break;
+            case EDataType_Vector3F:
+                ResourceChangeCollectingScene::setDataVector3fArray(containerHandles[i], field, elementCount, reinterpret_cast<const Vector3*>(instanceData));
+                break;
+            case EDataType_Vector4F:
+                ResourceChangeCollectingScene::setDataVector4fArray(containerHandles[i], field, elementCount, reinterpret_cast<const Vector4*>(instanceData));
+                break;
+            case EDataType_Int32:
+                ResourceChangeCollectingScene::setDataIntegerArray(containerHandles[i], field, elementCount, reinterpret_cast<const Int32*>(instanceData));
+                break;
+            case EDataType_Vector2I:
+                ResourceChangeCollectingScene::setDataVector2iArray(containerHandles[i], field, elementCount, reinterpret_cast<const Vector2i*>(instanceData));
+                break;
+            case EDataType_Vector3I:
+                ResourceChangeCollectingScene::setDataVector3iArray(containerHandles[i], field, elementCount, reinterpret_cast<const Vector3i*>(instanceData));
+                break;
+            case EDataType_Vector4I:
+                ResourceChangeCollectingScene::setDataVector4iArray(containerHandles[i], field, elementCount, reinterpret_cast<const Vector4i*>(instanceData));
+                break;
+            case EDataType_Matrix22F:
+                ResourceChangeCollectingScene::setDataMatrix22fArray(containerHandles[i], field, elementCount, reinterpret_cast<const Matrix22f*>(instanceData));
+                break;
+            case EDataType_Matrix33F:
+                ResourceChangeCollectingScene::setDataMatrix33fArray(containerHandles[i], field, elementCount, reinterpret_cast<const Matrix33f*>(instanceData));
+                break;
+            case EDataType_Matrix44F:
+                ResourceChangeCollectingScene::setDataMatrix44fArray(containerHandles[i], field, elementCount, reinterpret_cast<const Matrix44f*>(instanceData));
+                break;
+            default:
+                assert(false && "ActionCollectingScene::setDataArrayForInstances: unsupported data type");
+                return;
+            }
+        }
+
+        if (containerCount > 0u)
+            m_creator.setDataArrayForInstances(containerHandles, containerCount, field, dataType, elementCount, data);
+    }
+
     void ActionCollectingScene::setDataVector4iArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector4i* data)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataVector4iArray(containerHandle, field, elementCount, data);
         m_creator.setDataVector4iArray(containerHandle, field, elementCount, data);
     }
 
     void ActionCollectingScene::setDataMatrix22fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix22f* data)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataMatrix22fArray(containerHandle, field, elementCount, data);
         m_creator.setDataMatrix22fArray(containerHandle, field, elementCount, data);
     }
 
     void ActionCollectingScene::setDataMatrix33fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix33f* data)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataMatrix33fArray(containerHandle, field, elementCount, data);
         m_creator.setDataMatrix33fArray(containerHandle, field, elementCount, data);
     }
 
     void ActionCollectingScene::setDataMatrix44fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix44f* data)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataMatrix44fArray(containerHandle, field, elementCount, data);
         m_creator.setDataMatrix44fArray(containerHandle, field, elementCount, data);
     }
 
     void ActionCollectingScene::setDataVector3iArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector3i* data)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataVector3iArray(containerHandle, field, elementCount, data);
         m_creator.setDataVector3iArray(containerHandle, field, elementCount, data);
     }
 
     void ActionCollectingScene::setDataVector2iArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector2i* data)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataVector2iArray(containerHandle, field, elementCount, data);
         m_creator.setDataVector2iArray(containerHandle, field, elementCount, data);
     }
 
     void ActionCollectingScene::setDataIntegerArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Int32* data)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataIntegerArray(containerHandle, field, elementCount, data);
         m_creator.setDataIntegerArray(containerHandle, field, elementCount, data);
     }
 
     void ActionCollectingScene::setDataVector4fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector4* data)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataVector4fArray(containerHandle, field, elementCount, data);
         m_creator.setDataVector4fArray(containerHandle, field, elementCount, data);
     }
 
     void ActionCollectingScene::setDataVector3fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector3* data)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataVector3fArray(containerHandle, field, elementCount, data);
         m_creator.setDataVector3fArray(containerHandle, field, elementCount, data);
     }
 
     void ActionCollectingScene::setDataVector2fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector2* data)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataVector2fArray(containerHandle, field, elementCount, data);
         m_creator.setDataVector2fArray(containerHandle, field, elementCount, data);
     }
 
     void ActionCollectingScene::setDataFloatArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Float* data)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataFloatArray(containerHandle, field, elementCount, data);
         m_creator.setDataFloatArray(containerHandle, field, elementCount, data);
     }
 
     void ActionCollectingScene::releaseDataInstance(DataInstanceHandle containerHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseDataInstance(containerHandle);
         m_creator.releaseDataInstance(containerHandle);
     }
 
     DataInstanceHandle ActionCollectingScene::allocateDataInstance(DataLayoutHandle finishedLayoutHandle, DataInstanceHandle instanceHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         DataInstanceHandle handle = ResourceChangeCollectingScene::allocateDataInstance(finishedLayoutHandle, instanceHandle);
         m_creator.allocateDataInstance(finishedLayoutHandle, handle);
 
@@ -123,12 +193,14 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseDataLayout(DataLayoutHandle layoutHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseDataLayout(layoutHandle);
         m_creator.releaseDataLayout(layoutHandle);
     }
 
     DataLayoutHandle ActionCollectingScene::allocateDataLayout(const DataFieldInfoVector& dataFields, DataLayoutHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         DataLayoutHandle handleActual = ResourceChangeCollectingScene::allocateDataLayout(dataFields, handle);
         m_creator.allocateDataLayout(dataFields, handleActual);
 
@@ -137,42 +209,49 @@ namespace ramses_internal
 
     void ActionCollectingScene::setScaling(TransformHandle handle, const Vector3& scaling)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setScaling(handle, scaling);
         m_creator.setTransformComponent(ETransformPropertyType_Scaling, handle, scaling);
     }
 
     void ActionCollectingScene::setRotation(TransformHandle handle, const Vector3& rotation)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRotation(handle, rotation);
         m_creator.setTransformComponent(ETransformPropertyType_Rotation, handle, rotation);
     }
 
     void ActionCollectingScene::setTranslation(TransformHandle handle, const Vector3& translation)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setTranslation(handle, translation);
         m_creator.setTransformComponent(ETransformPropertyType_Translation, handle, translation);
     }
 
     void ActionCollectingScene::removeChildFromNode(NodeHandle parent, NodeHandle child)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::removeChildFromNode(parent, child);
         m_creator.removeChildFromNode(parent, child);
     }
 
     void ActionCollectingScene::addChildToNode(NodeHandle parent, NodeHandle child)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::addChildToNode(parent, child);
         m_creator.addChildToNode(parent, child);
     }
 
     void ActionCollectingScene::releaseTransform(TransformHandle transform)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseTransform(transform);
         m_creator.releaseTransform(transform);
     }
 
     TransformHandle ActionCollectingScene::allocateTransform(NodeHandle nodeHandle, TransformHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const TransformHandle handleActual = ResourceChangeCollectingScene::allocateTransform(nodeHandle, handle);
         m_creator.allocateTransform(nodeHandle, handleActual);
 
@@ -181,12 +260,14 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseNode(NodeHandle nodeHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseNode(nodeHandle);
         m_creator.releaseNode(nodeHandle);
     }
 
     NodeHandle ActionCollectingScene::allocateNode(UInt32 childrenCount, NodeHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         NodeHandle handleActual = ResourceChangeCollectingScene::allocateNode(childrenCount, handle);
         m_creator.allocateNode(childrenCount, handleActual);
         return handleActual;
@@ -194,6 +275,7 @@ namespace ramses_internal
 
     CameraHandle ActionCollectingScene::allocateCamera(ECameraProjectionType type, NodeHandle nodeHandle, DataInstanceHandle viewportDataInstance, CameraHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         CameraHandle handleActual = ResourceChangeCollectingScene::allocateCamera(type, nodeHandle, viewportDataInstance, handle);
         m_creator.allocateCamera(type, nodeHandle, viewportDataInstance, handleActual);
 
@@ -202,48 +284,56 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseCamera(CameraHandle cameraHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseCamera(cameraHandle);
         m_creator.releaseCamera(cameraHandle);
     }
 
     void ActionCollectingScene::setCameraFrustum(CameraHandle cameraHandle, const Frustum& frustum)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setCameraFrustum(cameraHandle, frustum);
         m_creator.setCameraFrustum(cameraHandle, frustum);
     }
 
     void ActionCollectingScene::setRenderStateStencilOps(RenderStateHandle stateHandle, EStencilOp sfail, EStencilOp dpfail, EStencilOp dppass)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderStateStencilOps(stateHandle, sfail, dpfail, dppass);
         m_creator.setRenderStateStencilOps(stateHandle, sfail, dpfail, dppass);
     }
 
     void ActionCollectingScene::setRenderStateStencilFunc(RenderStateHandle stateHandle, EStencilFunc func, UInt8 ref, UInt8 mask)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderStateStencilFunc(stateHandle, func, ref, mask);
         m_creator.setRenderStateStencilFunc(stateHandle, func, ref, mask);
     }
 
     void ActionCollectingScene::setRenderStateDepthWrite(RenderStateHandle stateHandle, EDepthWrite flag)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderStateDepthWrite(stateHandle, flag);
         m_creator.setRenderStateDepthWrite(stateHandle, flag);
     }
 
     void ActionCollectingScene::setRenderStateDepthFunc(RenderStateHandle stateHandle, EDepthFunc func)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderStateDepthFunc(stateHandle, func);
         m_creator.setRenderStateDepthFunc(stateHandle, func);
     }
 
     void ActionCollectingScene::setRenderStateScissorTest(RenderStateHandle stateHandle, EScissorTest flag, const RenderState::ScissorRegion& region)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderStateScissorTest(stateHandle, flag, region);
         m_creator.setRenderStateScissorTest(stateHandle, flag, region);
     }
 
     void ActionCollectingScene::setRenderStateCullMode(RenderStateHandle stateHandle, ECullMode cullMode)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         if (ResourceChangeCollectingScene::getRenderState(stateHandle).cullMode != cullMode)
         {
             ResourceChangeCollectingScene::setRenderStateCullMode(stateHandle, cullMode);
@@ -253,6 +343,7 @@ namespace ramses_internal
 
     void ActionCollectingScene::setRenderStateDrawMode(RenderStateHandle stateHandle, EDrawMode drawMode)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         if (ResourceChangeCollectingScene::getRenderState(stateHandle).drawMode != drawMode)
         {
             ResourceChangeCollectingScene::setRenderStateDrawMode(stateHandle, drawMode);
@@ -262,12 +353,14 @@ namespace ramses_internal
 
     void ActionCollectingScene::setRenderStateBlendOperations(RenderStateHandle stateHandle, EBlendOperation operationColor, EBlendOperation operationAlpha)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderStateBlendOperations(stateHandle, operationColor, operationAlpha);
         m_creator.setRenderStateBlendOperations(stateHandle, operationColor, operationAlpha);
     }
 
     void ActionCollectingScene::setRenderStateBlendFactors(RenderStateHandle stateHandle, EBlendFactor srcColor, EBlendFactor destColor, EBlendFactor srcAlpha, EBlendFactor destAlpha)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const RenderState& rs = ResourceChangeCollectingScene::getRenderState(stateHandle);
         const EBlendFactor dstA = rs.blendFactorDstAlpha;
         const EBlendFactor srcA = rs.blendFactorSrcAlpha;
@@ -282,6 +375,7 @@ namespace ramses_internal
 
     void ActionCollectingScene::setRenderStateColorWriteMask(RenderStateHandle stateHandle, ColorWriteMask colorMask)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const ColorWriteMask previousMask = ResourceChangeCollectingScene::getRenderState(stateHandle).colorWriteMask;
         if (colorMask != previousMask)
         {
@@ -292,12 +386,14 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseRenderState(RenderStateHandle stateHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseRenderState(stateHandle);
         m_creator.releaseRenderState(stateHandle);
     }
 
     RenderStateHandle ActionCollectingScene::allocateRenderState(RenderStateHandle stateHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         RenderStateHandle handle = ResourceChangeCollectingScene::allocateRenderState(stateHandle);
         m_creator.allocateRenderState(handle);
 
@@ -306,12 +402,14 @@ namespace ramses_internal
 
     void ActionCollectingScene::setRenderableRenderState(RenderableHandle renderableHandle, RenderStateHandle stateHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderableRenderState(renderableHandle, stateHandle);
         m_creator.setRenderableRenderState(renderableHandle, stateHandle);
     }
 
     void ActionCollectingScene::setRenderableIndexCount(RenderableHandle renderableHandle, UInt32 indexCount)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         if (ResourceChangeCollectingScene::getRenderable(renderableHandle).indexCount != indexCount)
         {
             ResourceChangeCollectingScene::setRenderableIndexCount(renderableHandle, indexCount);
@@ -321,6 +419,7 @@ namespace ramses_internal
 
     void ActionCollectingScene::setRenderableStartIndex(RenderableHandle renderableHandle, UInt32 startIndex)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         if (ResourceChangeCollectingScene::getRenderable(renderableHandle).startIndex != startIndex)
         {
             ResourceChangeCollectingScene::setRenderableStartIndex(renderableHandle, startIndex);
@@ -330,6 +429,7 @@ namespace ramses_internal
 
     void ActionCollectingScene::setRenderableVisibility(RenderableHandle renderableHandle, Bool visibility)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         if (ResourceChangeCollectingScene::getRenderable(renderableHandle).isVisible != visibility)
         {
             ResourceChangeCollectingScene::setRenderableVisibility(renderableHandle, visibility);
@@ -337,14 +437,40 @@ namespace ramses_internal
         }
     }
 
+    void ActionCollectingScene::setRenderablesVisibility(const std::vector<RenderableHandle>& renderableHandles, Bool visibility)
+    {
+        SceneLockGuard guard(m_sceneLock.get());
+        m_renderablesWithChangedVisibility.clear();
+        for (const auto renderableHandle : renderableHandles)
+        {
+            if (ResourceChangeCollectingScene::getRenderable(renderableHandle).isVisible != visibility)
+            {
+                ResourceChangeCollectingScene::setRenderableVisibility(renderableHandle, visibility);
+                m_renderablesWithChangedVisibility.push_back(renderableHandle);
+            }
+        }
+
+        if (!m_renderablesWithChangedVisibility.empty())
+            m_creator.setRenderablesVisibility(m_renderablesWithChangedVisibility.data(), static_cast<UInt32>(m_renderablesWithChangedVisibility.size()), visibility);
+    }
+
     void ActionCollectingScene::setRenderableInstanceCount(RenderableHandle renderableHandle, UInt32 instanceCount)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderableInstanceCount(renderableHandle, instanceCount);
         m_creator.setRenderableInstanceCount(renderableHandle, instanceCount);
     }
 
+    void ActionCollectingScene::setRenderableBoundingSphere(RenderableHandle renderableHandle, const Vector4& boundingSphere)
+    {
+        SceneLockGuard guard(m_sceneLock.get());
+        ResourceChangeCollectingScene::setRenderableBoundingSphere(renderableHandle, boundingSphere);
+        m_creator.setRenderableBoundingSphere(renderableHandle, boundingSphere);
+    }
+
     void ActionCollectingScene::setRenderableDataInstanceAndStateAndEffect(RenderableHandle renderableHandle, DataInstanceHandle newDataInstance, RenderStateHandle stateHandle, const ResourceContentHash& effectHash)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderableDataInstance(renderableHandle, ERenderableDataSlotType_Uniforms, newDataInstance);
         ResourceChangeCollectingScene::setRenderableRenderState(renderableHandle, stateHandle);
         ResourceChangeCollectingScene::setRenderableEffect(renderableHandle, effectHash);
@@ -353,24 +479,28 @@ namespace ramses_internal
 
     void ActionCollectingScene::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderableDataInstance(renderableHandle, slot, newDataInstance);
         m_creator.setRenderableDataInstance(renderableHandle, slot, newDataInstance);
     }
 
     void ActionCollectingScene::setRenderableEffect(RenderableHandle renderableHandle, const ResourceContentHash& effectHash)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderableEffect(renderableHandle, effectHash);
         m_creator.setRenderableEffect(renderableHandle, effectHash);
     }
 
     void ActionCollectingScene::releaseRenderable(RenderableHandle renderableHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseRenderable(renderableHandle);
         m_creator.releaseRenderable(renderableHandle);
     }
 
     RenderableHandle ActionCollectingScene::allocateRenderable(NodeHandle nodeHandle, RenderableHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const RenderableHandle handleActual = ResourceChangeCollectingScene::allocateRenderable(nodeHandle, handle);
         m_creator.allocateRenderable(nodeHandle, handleActual);
 
@@ -379,6 +509,7 @@ namespace ramses_internal
 
     RenderGroupHandle ActionCollectingScene::allocateRenderGroup(UInt32 renderableCount, UInt32 nestedGroupCount, RenderGroupHandle groupHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const RenderGroupHandle handleActual = ResourceChangeCollectingScene::allocateRenderGroup(renderableCount, nestedGroupCount, groupHandle);
         m_creator.allocateRenderGroup(renderableCount, nestedGroupCount, handleActual);
 
@@ -387,36 +518,42 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseRenderGroup(RenderGroupHandle groupHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseRenderGroup(groupHandle);
         m_creator.releaseRenderGroup(groupHandle);
     }
 
     void ActionCollectingScene::addRenderableToRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle, Int32 order)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::addRenderableToRenderGroup(groupHandle, renderableHandle, order);
         m_creator.addRenderableToRenderGroup(groupHandle, renderableHandle, order);
     }
 
     void ActionCollectingScene::addRenderGroupToRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild, Int32 order)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::addRenderGroupToRenderGroup(groupHandleParent, groupHandleChild, order);
         m_creator.addRenderGroupToRenderGroup(groupHandleParent, groupHandleChild, order);
     }
 
     void ActionCollectingScene::removeRenderableFromRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::removeRenderableFromRenderGroup(groupHandle, renderableHandle);
         m_creator.removeRenderableFromRenderGroup(groupHandle, renderableHandle);
     }
 
     void ActionCollectingScene::removeRenderGroupFromRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::removeRenderGroupFromRenderGroup(groupHandleParent, groupHandleChild);
         m_creator.removeRenderGroupFromRenderGroup(groupHandleParent, groupHandleChild);
     }
 
     AnimationSystemHandle ActionCollectingScene::addAnimationSystem(IAnimationSystem* animationSystem, AnimationSystemHandle externalHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         auto handle = ResourceChangeCollectingScene::addAnimationSystem(animationSystem, externalHandle);
         m_creator.addAnimationSystem(handle, animationSystem->getFlags(), animationSystem->getTotalSizeInformation());
         return handle;
@@ -424,6 +561,7 @@ namespace ramses_internal
 
     void ActionCollectingScene::removeAnimationSystem(AnimationSystemHandle animSystemHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         // SceneAction must be created first because animationSystemID is deleted with next call!
         m_creator.removeAnimationSystem(animSystemHandle);
         ResourceChangeCollectingScene::removeAnimationSystem(animSystemHandle);
@@ -431,6 +569,7 @@ namespace ramses_internal
 
     ramses_internal::RenderPassHandle ActionCollectingScene::allocateRenderPass(UInt32 renderGroupCount, RenderPassHandle handle /*= InvalidRenderPassHandle*/)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const RenderPassHandle handleActual = ResourceChangeCollectingScene::allocateRenderPass(renderGroupCount, handle);
         m_creator.allocateRenderPass(renderGroupCount, handleActual);
         return handleActual;
@@ -438,60 +577,70 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseRenderPass(RenderPassHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseRenderPass(handle);
         m_creator.releaseRenderPass(handle);
     }
 
     void ActionCollectingScene::setRenderPassCamera(RenderPassHandle passHandle, CameraHandle cameraHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderPassCamera(passHandle, cameraHandle);
         m_creator.setRenderPassCamera(passHandle, cameraHandle);
     }
 
     void ActionCollectingScene::setRenderPassRenderTarget(RenderPassHandle passHandle, RenderTargetHandle targetHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderPassRenderTarget(passHandle, targetHandle);
         m_creator.setRenderPassRenderTarget(passHandle, targetHandle);
     }
 
     void ActionCollectingScene::setRenderPassRenderOrder(RenderPassHandle passHandle, Int32 renderOrder)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderPassRenderOrder(passHandle, renderOrder);
         m_creator.setRenderPassRenderOrder(passHandle, renderOrder);
     }
 
     void ActionCollectingScene::setRenderPassEnabled(RenderPassHandle passHandle, Bool isEnabled)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderPassEnabled(passHandle, isEnabled);
         m_creator.setRenderPassEnabled(passHandle, isEnabled);
     }
 
     void ActionCollectingScene::setRenderPassRenderOnce(RenderPassHandle passHandle, Bool enable)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderPassRenderOnce(passHandle, enable);
         m_creator.setRenderPassRenderOnce(passHandle, enable);
     }
 
     void ActionCollectingScene::retriggerRenderPassRenderOnce(RenderPassHandle passHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::retriggerRenderPassRenderOnce(passHandle);
         m_creator.retriggerRenderPassRenderOnce(passHandle);
     }
 
     void ActionCollectingScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::addRenderGroupToRenderPass(passHandle, groupHandle, order);
         m_creator.addRenderGroupToRenderPass(passHandle, groupHandle, order);
     }
 
     void ActionCollectingScene::removeRenderGroupFromRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::removeRenderGroupFromRenderPass(passHandle, groupHandle);
         m_creator.removeRenderGroupFromRenderPass(passHandle, groupHandle);
     }
 
     BlitPassHandle ActionCollectingScene::allocateBlitPass(RenderBufferHandle sourceRenderBufferHandle, RenderBufferHandle destinationRenderBufferHandle, BlitPassHandle passHandle /*= BlitPassHandle::Invalid()*/)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const BlitPassHandle handleActual = ResourceChangeCollectingScene::allocateBlitPass(sourceRenderBufferHandle, destinationRenderBufferHandle, passHandle);
         m_creator.allocateBlitPass(sourceRenderBufferHandle, destinationRenderBufferHandle, handleActual);
         return handleActual;
@@ -499,30 +648,35 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseBlitPass(BlitPassHandle passHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseBlitPass(passHandle);
         m_creator.releaseBlitPass(passHandle);
     }
 
     void ActionCollectingScene::setBlitPassRenderOrder(BlitPassHandle passHandle, Int32 renderOrder)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setBlitPassRenderOrder(passHandle, renderOrder);
         m_creator.setBlitPassRenderOrder(passHandle, renderOrder);
     }
 
     void ActionCollectingScene::setBlitPassEnabled(BlitPassHandle passHandle, Bool isEnabled)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setBlitPassEnabled(passHandle, isEnabled);
         m_creator.setBlitPassEnabled(passHandle, isEnabled);
     }
 
     void ActionCollectingScene::setBlitPassRegions(BlitPassHandle passHandle, const PixelRectangle& sourceRegion, const PixelRectangle& destinationRegion)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setBlitPassRegions(passHandle, sourceRegion, destinationRegion);
         m_creator.setBlitPassRegions(passHandle, sourceRegion, destinationRegion);
     }
 
     DataSlotHandle ActionCollectingScene::allocateDataSlot(const DataSlot& dataSlot, DataSlotHandle handle /*= DataSlotHandle::Invalid()*/)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const DataSlotHandle handleActual = ResourceChangeCollectingScene::allocateDataSlot(dataSlot, handle);
         m_creator.allocateDataSlot(dataSlot, handleActual);
         return handleActual;
@@ -530,18 +684,21 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseDataSlot(DataSlotHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseDataSlot(handle);
         m_creator.releaseDataSlot(handle);
     }
 
     void ActionCollectingScene::setDataSlotTexture(DataSlotHandle handle, const ResourceContentHash& texture)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setDataSlotTexture(handle, texture);
         m_creator.setDataSlotTexture(handle, texture);
     }
 
     TextureSamplerHandle ActionCollectingScene::allocateTextureSampler(const TextureSampler& sampler, TextureSamplerHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const TextureSamplerHandle handleActual = ResourceChangeCollectingScene::allocateTextureSampler(sampler, handle);
         m_creator.allocateTextureSampler(sampler, handleActual);
         return handleActual;
@@ -549,6 +706,7 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseTextureSampler(TextureSamplerHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseTextureSampler(handle);
         m_creator.releaseTextureSampler(handle);
     }
@@ -556,6 +714,7 @@ namespace ramses_internal
     // Render targets
     RenderTargetHandle ActionCollectingScene::allocateRenderTarget(RenderTargetHandle targetHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const RenderTargetHandle handleActual = ResourceChangeCollectingScene::allocateRenderTarget(targetHandle);
         m_creator.allocateRenderTarget(handleActual);
         return handleActual;
@@ -563,12 +722,14 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseRenderTarget  (RenderTargetHandle targetHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseRenderTarget( targetHandle );
         m_creator.releaseRenderTarget(targetHandle);
     }
 
     RenderBufferHandle ActionCollectingScene::allocateRenderBuffer(const RenderBuffer& renderBuffer, RenderBufferHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const RenderBufferHandle handleActual = ResourceChangeCollectingScene::allocateRenderBuffer(renderBuffer, handle);
         m_creator.allocateRenderBuffer(renderBuffer, handleActual);
         return handleActual;
@@ -576,30 +737,35 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseRenderBuffer(RenderBufferHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseRenderBuffer(handle);
         m_creator.releaseRenderBuffer(handle);
     }
 
     void ActionCollectingScene::addRenderTargetRenderBuffer(RenderTargetHandle targetHandle, RenderBufferHandle bufferHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::addRenderTargetRenderBuffer(targetHandle, bufferHandle);
         m_creator.addRenderTargetRenderBuffer(targetHandle, bufferHandle);
     }
 
     void ActionCollectingScene::setRenderPassClearColor(RenderPassHandle pass, const Vector4& clearColor)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderPassClearColor(pass, clearColor);
         m_creator.setRenderPassClearColor(pass, clearColor);
     }
 
     void ActionCollectingScene::setRenderPassClearFlag(RenderPassHandle pass, UInt32 clearFlag)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setRenderPassClearFlag(pass, clearFlag);
         m_creator.setRenderPassClearFlag(pass, clearFlag);
     }
 
     StreamTextureHandle ActionCollectingScene::allocateStreamTexture(uint32_t streamSource, const ResourceContentHash& fallbackTextureHash, StreamTextureHandle streamTextureHandle /*= StreamTextureHandle::Invalid()*/)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const StreamTextureHandle handleActual = ResourceChangeCollectingScene::allocateStreamTexture(streamSource, fallbackTextureHash, streamTextureHandle);
         m_creator.allocateStreamTexture(streamSource, fallbackTextureHash, handleActual);
         return handleActual;
@@ -607,18 +773,21 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseStreamTexture(StreamTextureHandle streamTextureHandle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseStreamTexture(streamTextureHandle);
         m_creator.releaseStreamTexture(streamTextureHandle);
     }
 
     void ActionCollectingScene::setForceFallbackImage(StreamTextureHandle streamTextureHandle, Bool forceFallbackImage)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::setForceFallbackImage(streamTextureHandle, forceFallbackImage);
         m_creator.setStreamTextureForceFallback(streamTextureHandle, forceFallbackImage);
     }
 
     DataBufferHandle ActionCollectingScene::allocateDataBuffer(EDataBufferType dataBufferType, EDataType dataType, UInt32 maximumSizeInBytes, DataBufferHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const DataBufferHandle allocatedHandle = ResourceChangeCollectingScene::allocateDataBuffer(dataBufferType, dataType, maximumSizeInBytes, handle);
         m_creator.allocateDataBuffer(dataBufferType, dataType, maximumSizeInBytes, allocatedHandle);
 
@@ -627,18 +796,21 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseDataBuffer(DataBufferHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseDataBuffer(handle);
         m_creator.releaseDataBuffer(handle);
     }
 
     void ActionCollectingScene::updateDataBuffer(DataBufferHandle handle, UInt32 offsetInBytes, UInt32 dataSizeInBytes, const Byte* data)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
         m_creator.updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
     }
 
     TextureBufferHandle ActionCollectingScene::allocateTextureBuffer(ETextureFormat textureFormat, const MipMapDimensions& mipMapDimensions, TextureBufferHandle handle /*= TextureBufferHandle::Invalid()*/)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         const TextureBufferHandle allocatedHandle = ResourceChangeCollectingScene::allocateTextureBuffer(textureFormat, mipMapDimensions, handle);
         m_creator.allocateTextureBuffer(textureFormat, mipMapDimensions, allocatedHandle);
 
@@ -647,17 +819,38 @@ namespace ramses_internal
 
     void ActionCollectingScene::releaseTextureBuffer(TextureBufferHandle handle)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::releaseTextureBuffer(handle);
         m_creator.releaseTextureBuffer(handle);
     }
 
     void ActionCollectingScene::updateTextureBuffer(TextureBufferHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 width, UInt32 height, const Byte* data)
     {
+        SceneLockGuard guard(m_sceneLock.get());
         ResourceChangeCollectingScene::updateTextureBuffer(handle, mipLevel, x, y, width, height, data);
         const UInt32 dataSize = width * height * GetTexelSizeFromFormat(getTextureBuffer(handle).textureFormat);
         m_creator.updateTextureBuffer(handle, mipLevel, x, y, width, height, data, dataSize);
     }
 
+    void ActionCollectingScene::onRestoredFromSceneImage()
+    {
+        SceneLockGuard guard(m_sceneLock.get());
+        ResourceChangeCollectingScene::onRestoredFromSceneImage();
+        // restored content has to reach scene subscribers same way as if it was created action by action
+        SceneDescriber::describeScene<IScene>(*this, m_creator);
+    }
+
+    void ActionCollectingScene::enableSceneLock()
+    {
+        if (!m_sceneLock)
+            m_sceneLock.reset(new PlatformLock);
+    }
+
+    PlatformLock* ActionCollectingScene::getSceneLock() const
+    {
+        return m_sceneLock.get();
+    }
+
     const SceneActionCollection& ActionCollectingScene::getSceneActionCollection() const
     {
         return m_collection;
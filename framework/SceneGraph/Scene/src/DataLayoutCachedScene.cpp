@@ -48,6 +48,29 @@ namespace ramses_internal
         }
     }
 
+    void DataLayoutCachedScene::onRestoredFromSceneImage()
+    {
+        ActionCollectingScene::onRestoredFromSceneImage();
+
+        for (DataLayoutHandle handle(0u); handle < getDataLayoutCount(); ++handle)
+        {
+            if (isDataLayoutAllocated(handle))
+            {
+                const DataFieldInfoVector& dataFields = getDataLayout(handle).getDataFields();
+                const UInt fieldCount = dataFields.size();
+                if (m_dataLayoutCache.size() <= fieldCount)
+                {
+                    m_dataLayoutCache.resize(fieldCount + 1u);
+                }
+
+                DataLayoutCacheEntry newEntry;
+                newEntry.m_dataFields = dataFields;
+                newEntry.m_usageCount = 1u;
+                m_dataLayoutCache[fieldCount].put(handle, newEntry);
+            }
+        }
+    }
+
     DataLayoutHandle DataLayoutCachedScene::allocateAndCacheDataLayout(const DataFieldInfoVector& dataFields, DataLayoutHandle handle)
     {
         const DataLayoutHandle actualHandle = ActionCollectingScene::allocateDataLayout(dataFields, handle);
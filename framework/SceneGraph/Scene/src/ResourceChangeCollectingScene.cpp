@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "Scene/ResourceChangeCollectingScene.h"
+#include "Scene/SceneResourceUtils.h"
 #include "SceneUtils/ResourceChangeUtils.h"
 #include "Utils/MemoryPoolExplicit.h"
 
@@ -78,6 +79,62 @@ namespace ramses_internal
         return TransformationCachedScene::allocateTextureSampler(sampler, handle);
     }
 
+    void ResourceChangeCollectingScene::onRestoredFromSceneImage()
+    {
+        TransformationCachedScene::onRestoredFromSceneImage();
+
+        // collect same references and scene resource changes as if all restored objects were allocated one by one
+        for (RenderableHandle renderable(0u); renderable < getRenderableCount(); ++renderable)
+        {
+            if (isRenderableAllocated(renderable))
+            {
+                this->handleClientResourceReferenceChange(ResourceContentHash::Invalid(), getRenderable(renderable).effectResource);
+            }
+        }
+
+        for (DataInstanceHandle instance(0u); instance < getDataInstanceCount(); ++instance)
+        {
+            if (isDataInstanceAllocated(instance))
+            {
+                const DataLayout& layout = getDataLayout(getLayoutOfDataInstance(instance));
+                for (DataFieldHandle field(0u); field < layout.getFieldCount(); ++field)
+                {
+                    if (IsBufferDataType(layout.getField(field).dataType))
+                    {
+                        this->handleClientResourceReferenceChange(ResourceContentHash::Invalid(), getDataResource(instance, field).hash);
+                    }
+                }
+            }
+        }
+
+        for (TextureSamplerHandle sampler(0u); sampler < getTextureSamplerCount(); ++sampler)
+        {
+            if (isTextureSamplerAllocated(sampler))
+            {
+                this->handleClientResourceReferenceChange(ResourceContentHash::Invalid(), getTextureSampler(sampler).textureResource);
+            }
+        }
+
+        for (StreamTextureHandle streamTexture(0u); streamTexture < getStreamTextureCount(); ++streamTexture)
+        {
+            if (isStreamTextureAllocated(streamTexture))
+            {
+                this->handleClientResourceReferenceChange(ResourceContentHash::Invalid(), getStreamTexture(streamTexture).fallbackTexture);
+            }
+        }
+
+        for (DataSlotHandle slot(0u); slot < getDataSlotCount(); ++slot)
+        {
+            if (isDataSlotAllocated(slot))
+            {
+                this->handleClientResourceReferenceChange(ResourceContentHash::Invalid(), getDataSlot(slot).attachedTexture);
+            }
+        }
+
+        size_t usedDataByteSize = 0u;
+        SceneResourceUtils::GetAllSceneResourcesFromScene(m_changes.m_sceneResourceActions, *this, usedDataByteSize);
+    }
+
     const SceneResourceChanges& ResourceChangeCollectingScene::getResourceChanges() const
     {
         return m_changes;
@@ -653,6 +653,12 @@ namespace ramses_internal
         m_renderables.getMemory(renderableHandle)->instanceCount = instanceCount;
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderableBoundingSphere(RenderableHandle renderableHandle, const Vector4& boundingSphere)
+    {
+        m_renderables.getMemory(renderableHandle)->boundingSphere = boundingSphere;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     const Renderable& SceneT<MEMORYPOOL>::getRenderable(RenderableHandle renderableHandle) const
     {
@@ -1408,6 +1414,11 @@ namespace ramses_internal
         setDataMatrix44fArray(containerHandle, field, elementCount, &data);
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::onRestoredFromSceneImage()
+    {
+    }
+
     template class SceneT < MemoryPool >;
     template class SceneT < MemoryPoolExplicit > ;
 }
@@ -33,6 +33,8 @@
 #include "Resource/IResource.h"
 #include "Utils/BinaryInputStream.h"
 #include "Utils/LogMacros.h"
+#include "SceneUtils/ISceneDataArrayAccessor.h"
+#include "PlatformAbstraction/PlatformMemory.h"
 
 #define ALLOCATE_AND_ASSERT_HANDLE(_allocateExpr, _handleToCheck) \
 { \
@@ -44,6 +46,18 @@
 
 namespace ramses_internal
 {
+    namespace
+    {
+        // copies data into scene memory first like other data actions do, data in collection is not aligned for type
+        template <typename T>
+        void SetDataArrayFromCollectionData(IScene& scene, DataInstanceHandle handle, DataFieldHandle field, UInt32 elementCount, const Byte* data)
+        {
+            T* array = const_cast<T*>(ISceneDataArrayAccessor::GetDataArray<T>(&scene, handle, field));
+            PlatformMemory::Copy(array, data, elementCount * sizeof(T));
+            ISceneDataArrayAccessor::SetDataArray<T>(&scene, handle, field, elementCount, array);
+        }
+    }
+
     void SceneActionApplier::ApplySingleActionOnScene(IScene& scene, SceneActionCollection::SceneActionReader& action, AnimationSystemFactory* animSystemFactory, ResourceVector* resources)
     {
         switch (action.type())
@@ -208,6 +222,84 @@ namespace ramses_internal
             scene.setDataMatrix44fArray(handle, field, elementCount, array);
             break;
         }
+        case ESceneActionId_SetDataArrayForInstances:
+        {
+            DataFieldHandle field;
+            UInt32 dataTypeValue = 0u;
+            UInt32 elementCount = 0u;
+            UInt32 handleCount = 0u;
+            action.read(field);
+            action.read(dataTypeValue);
+            const EDataType dataType = static_cast<EDataType>(dataTypeValue);
+            action.read(elementCount);
+            action.read(handleCount);
+            // handles are followed by at least size of data array
+            if (static_cast<UInt64>(handleCount) * sizeof(MemoryHandle) + sizeof(UInt32) > action.remainingSize())
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneActionApplier::ApplySingleActionOnScene: ignoring SetDataArrayForInstances with " << handleCount
+                    << " instances not fitting into remaining action size " << action.remainingSize());
+                action.skipRemaining();
+                break;
+            }
+            std::vector<DataInstanceHandle> handles(handleCount);
+            for (auto& handle : handles)
+                action.read(handle);
+            const Byte* data = nullptr;
+            UInt32 dataSize = 0u;
+            action.readWithoutCopy(data, dataSize);
+
+            const UInt64 dataSizePerInstance = static_cast<UInt64>(elementCount) * EnumToSize(dataType);
+            if (dataSizePerInstance == 0u || dataSize != handleCount * dataSizePerInstance)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneActionApplier::ApplySingleActionOnScene: ignoring SetDataArrayForInstances with data size " << dataSize
+                    << " not matching " << handleCount << " instances of " << elementCount << " elements of type " << EnumToString(dataType));
+                break;
+            }
+            for (UInt32 i = 0u; i < handleCount; ++i)
+            {
+                const Byte* instanceData = data + i * dataSizePerInstance;
+                switch (dataType)
+                {
+                case EDataType_Float:
+                    SetDataArrayFromCollectionData<Float>(scene, handles[i], field, elementCount, instanceData);
+                    break;
+                case EDataType_Vector2F:
+                    SetDataArrayFromCollectionData<Vector2>(scene, handles[i], field, elementCount, instanceData);
+                    break;
+                case EDataType_Vector3F:
+                    SetDataArrayFromCollectionData<Vector3>(scene, handles[i], field, elementCount, instanceData);
+                    break;
+                case EDataType_Vector4F:
+                    SetDataArrayFromCollectionData<Vector4>(scene, handles[i], field, elementCount, instanceData);
+                    break;
+                case EDataType_Int32:
+                    SetDataArrayFromCollectionData<Int32>(scene, handles[i], field, elementCount, instanceData);
+                    break;
+                case EDataType_Vector2I:
+                    SetDataArrayFromCollectionData<Vector2i>(scene, handles[i], field, elementCount, instanceData);
+                    break;
+                case EDataType_Vector3I:
+                    SetDataArrayFromCollectionData<Vector3i>(scene, handles[i], field, elementCount, instanceData);
+                    break;
+                case EDataType_Vector4I:
+                    SetDataArrayFromCollectionData<Vector4i>(scene, handles[i], field, elementCount, instanceData);
+                    break;
+                case EDataType_Matrix22F:
+                    SetDataArrayFromCollectionData<Matrix22f>(scene, handles[i], field, elementCount, instanceData);
+                    break;
+                case EDataType_Matrix33F:
+                    SetDataArrayFromCollectionData<Matrix33f>(scene, handles[i], field, elementCount, instanceData);
+                    break;
+                case EDataType_Matrix44F:
+                    SetDataArrayFromCollectionData<Matrix44f>(scene, handles[i], field, elementCount, instanceData);
+                    break;
+                default:
+                    assert(false && "SceneActionApplier: unsupported data type in SetDataArrayForInstances");
+                    break;
+                }
+            }
+            break;
+        }
         case ESceneActionId_SetDataIntegerArray:
         {
             DataInstanceHandle handle;
@@ -387,6 +479,27 @@ namespace ramses_internal
             scene.setRenderableVisibility(renderable, visibility);
             break;
         }
+        case ESceneActionId_SetRenderablesVisibility:
+        {
+            Bool visibility = true;
+            UInt32 renderableCount = 0u;
+            action.read(visibility);
+            action.read(renderableCount);
+            if (static_cast<UInt64>(renderableCount) * sizeof(MemoryHandle) != action.remainingSize())
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneActionApplier::ApplySingleActionOnScene: ignoring SetRenderablesVisibility with " << renderableCount
+                    << " renderables not matching remaining action size " << action.remainingSize());
+                action.skipRemaining();
+                break;
+            }
+            for (UInt32 i = 0u; i < renderableCount; ++i)
+            {
+                RenderableHandle renderable;
+                action.read(renderable);
+                scene.setRenderableVisibility(renderable, visibility);
+            }
+            break;
+        }
         case ESceneActionId_SetRenderableDataInstance:
         {
             RenderableHandle renderable;
@@ -407,6 +520,15 @@ namespace ramses_internal
             scene.setRenderableInstanceCount(renderable, numInstances);
             break;
         }
+        case ESceneActionId_SetRenderableBoundingSphere:
+        {
+            RenderableHandle renderable;
+            Vector4 boundingSphere;
+            action.read(renderable);
+            action.read(boundingSphere.data);
+            scene.setRenderableBoundingSphere(renderable, boundingSphere);
+            break;
+        }
         case ESceneActionId_AllocateRenderGroup:
         {
             UInt32 renderableCount = 0u;
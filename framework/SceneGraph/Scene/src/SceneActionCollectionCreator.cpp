@@ -111,6 +111,18 @@ namespace ramses_internal
             collection.write(data[i].data);
     }
 
+    void SceneActionCollectionCreator::setDataArrayForInstances(const DataInstanceHandle* handles, UInt32 handleCount, DataFieldHandle field, EDataType dataType, UInt32 elementCount, const Byte* data)
+    {
+        collection.beginWriteSceneAction(ESceneActionId_SetDataArrayForInstances);
+        collection.write(field);
+        collection.write(static_cast<UInt32>(dataType));
+        collection.write(elementCount);
+        collection.write(handleCount);
+        for (UInt32 i = 0u; i < handleCount; ++i)
+            collection.write(handles[i]);
+        collection.write(data, handleCount * elementCount * EnumToSize(dataType));
+    }
+
     void SceneActionCollectionCreator::setDataVector4fArray(DataInstanceHandle handle, DataFieldHandle field, UInt32 elementCount, const Vector4* data)
     {
         collection.beginWriteSceneAction(ESceneActionId_SetDataVector4fArray);
@@ -261,6 +273,15 @@ namespace ramses_internal
         collection.write(visible);
     }
 
+    void SceneActionCollectionCreator::setRenderablesVisibility(const RenderableHandle* renderableHandles, UInt32 renderableCount, Bool visible)
+    {
+        collection.beginWriteSceneAction(ESceneActionId_SetRenderablesVisibility);
+        collection.write(visible);
+        collection.write(renderableCount);
+        for (UInt32 i = 0u; i < renderableCount; ++i)
+            collection.write(renderableHandles[i]);
+    }
+
     void SceneActionCollectionCreator::setRenderableInstanceCount(RenderableHandle renderableHandle, UInt32 instanceCount)
     {
         collection.beginWriteSceneAction(ESceneActionId_SetRenderableInstanceCount);
@@ -268,6 +289,13 @@ namespace ramses_internal
         collection.write(instanceCount);
     }
 
+    void SceneActionCollectionCreator::setRenderableBoundingSphere(RenderableHandle renderableHandle, const Vector4& boundingSphere)
+    {
+        collection.beginWriteSceneAction(ESceneActionId_SetRenderableBoundingSphere);
+        collection.write(renderableHandle);
+        collection.write(boundingSphere.data);
+    }
+
     void SceneActionCollectionCreator::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
     {
         collection.beginWriteSceneAction(ESceneActionId_SetRenderableDataInstance);
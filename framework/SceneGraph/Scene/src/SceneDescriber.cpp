@@ -136,7 +136,12 @@ namespace ramses_internal
         {
             if (source.isRenderableAllocated(r))
             {
-                collector.compoundRenderable(r, source.getRenderable(r));
+                const Renderable& renderable = source.getRenderable(r);
+                collector.compoundRenderable(r, renderable);
+                if (renderable.boundingSphere.w > 0.f)
+                {
+                    collector.setRenderableBoundingSphere(r, renderable.boundingSphere);
+                }
             }
         }
     }
@@ -337,6 +342,11 @@ namespace ramses_internal
         }
     }
 
+    void SceneDescriber::describeAnimationSystems(const IScene& source, SceneActionCollectionCreator& collector)
+    {
+        RecreateAnimationSystems(source, collector);
+    }
+
     void SceneDescriber::RecreateAnimationSystems(const IScene& source, SceneActionCollectionCreator& collector)
     {
         // send all animation systems
@@ -0,0 +1,485 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Scene/SceneImage.h"
+#include "Scene/ClientScene.h"
+#include "Scene/SceneDescriber.h"
+#include "Scene/ScenePersistation.h"
+#include "Scene/SceneActionCollectionCreator.h"
+#include "Utils/BinaryOutputStream.h"
+#include "Utils/BinaryBoundedInputStream.h"
+#include "Utils/LogMacros.h"
+#include <city.h>
+#include <type_traits>
+
+namespace ramses_internal
+{
+    static const UInt32 gSceneImageMarker = 0x474d4952;  // {'R', 'I', 'M', 'G'}
+    static const UInt32 gSceneImageRevision = 1u;
+    static const UInt32 gSceneImageEndiannessTag = 0x01020304;
+    static const UInt gSceneImageHeaderSize = 3u * sizeof(UInt32) + 2u * sizeof(UInt64);
+
+    namespace
+    {
+        template <typename OBJECTTYPE>
+        struct PoolContent
+        {
+            std::vector<OBJECTTYPE> memory;
+            std::vector<UInt8> handleTable;
+
+            Bool isAllocated(MemoryHandle handle) const
+            {
+                return handle < handleTable.size() && handleTable[handle] != 0u;
+            }
+        };
+
+        template <typename T>
+        void WriteValue(IOutputStream& outStream, const T& value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "value must be stored in memory layout");
+            outStream.write(&value, sizeof(T));
+        }
+
+        template <typename T>
+        Bool ReadValue(BinaryBoundedInputStream& inStream, T& value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "value must be stored in memory layout");
+            inStream.read(reinterpret_cast<Char*>(&value), sizeof(T));
+            return inStream.getState() == EStatus_RAMSES_OK;
+        }
+
+        template <typename T>
+        void WriteVector(IOutputStream& outStream, const std::vector<T>& values)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "vector elements must be stored in memory layout");
+            outStream << static_cast<UInt32>(values.size());
+            if (!values.empty())
+            {
+                outStream.write(values.data(), static_cast<UInt32>(values.size() * sizeof(T)));
+            }
+        }
+
+        template <typename T>
+        Bool ReadVector(BinaryBoundedInputStream& inStream, std::vector<T>& values)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "vector elements must be stored in memory layout");
+            UInt32 count = 0u;
+            inStream >> count;
+            // checked before allocating memory for count read from image
+            if (inStream.getState() != EStatus_RAMSES_OK || UInt64(count) * sizeof(T) > inStream.getRemainingSize())
+            {
+                return false;
+            }
+
+            values.resize(count);
+            if (count > 0u)
+            {
+                inStream.read(reinterpret_cast<Char*>(values.data()), static_cast<UInt32>(count * sizeof(T)));
+            }
+            return inStream.getState() == EStatus_RAMSES_OK;
+        }
+
+        void WriteObject(IOutputStream& outStream, const TopologyNode& node)
+        {
+            WriteVector(outStream, node.children);
+            WriteValue(outStream, node.parent);
+        }
+
+        Bool ReadObject(BinaryBoundedInputStream& inStream, TopologyNode& node)
+        {
+            return ReadVector(inStream, node.children) && ReadValue(inStream, node.parent);
+        }
+
+        void WriteObject(IOutputStream& outStream, const DataLayout& layout)
+        {
+            WriteVector(outStream, layout.getDataFields());
+        }
+
+        Bool ReadObject(BinaryBoundedInputStream& inStream, DataLayout& layout)
+        {
+            DataFieldInfoVector dataFields;
+            if (!ReadVector(inStream, dataFields))
+            {
+                return false;
+            }
+            for (const auto& field : dataFields)
+            {
+                if (field.dataType <= EDataType_Invalid || field.dataType >= EDataType_NUMBER_OF_ELEMENTS)
+                {
+                    return false;
+                }
+            }
+
+            layout.setDataFields(dataFields);
+            return true;
+        }
+
+        void WriteObject(IOutputStream& outStream, const DataInstance& instance)
+        {
+            WriteValue(outStream, instance.getLayoutHandle());
+            WriteValue(outStream, instance.getRawDataSize());
+            if (instance.getRawDataSize() > 0u)
+            {
+                outStream.write(instance.getRawData(), instance.getRawDataSize());
+            }
+        }
+
+        Bool ReadObject(BinaryBoundedInputStream& inStream, DataInstance& instance)
+        {
+            DataLayoutHandle layoutHandle;
+            UInt32 dataSize = 0u;
+            if (!ReadValue(inStream, layoutHandle) || !ReadValue(inStream, dataSize) || dataSize > inStream.getRemainingSize())
+            {
+                return false;
+            }
+
+            instance = DataInstance(layoutHandle, dataSize);
+            if (dataSize > 0u)
+            {
+                inStream.read(reinterpret_cast<Char*>(instance.getRawData()), dataSize);
+            }
+            return inStream.getState() == EStatus_RAMSES_OK;
+        }
+
+        void WriteObject(IOutputStream& outStream, const RenderGroup& renderGroup)
+        {
+            WriteVector(outStream, renderGroup.renderables);
+            WriteVector(outStream, renderGroup.renderGroups);
+        }
+
+        Bool ReadObject(BinaryBoundedInputStream& inStream, RenderGroup& renderGroup)
+        {
+            return ReadVector(inStream, renderGroup.renderables) && ReadVector(inStream, renderGroup.renderGroups);
+        }
+
+        void WriteObject(IOutputStream& outStream, const RenderPass& renderPass)
+        {
+            WriteValue(outStream, renderPass.isEnabled);
+            WriteValue(outStream, renderPass.camera);
+            WriteValue(outStream, renderPass.renderTarget);
+            WriteValue(outStream, renderPass.renderOrder);
+            WriteValue(outStream, renderPass.clearColor);
+            WriteValue(outStream, renderPass.clearFlags);
+            WriteValue(outStream, renderPass.isRenderOnce);
+            WriteVector(outStream, renderPass.renderGroups);
+        }
+
+        Bool ReadObject(BinaryBoundedInputStream& inStream, RenderPass& renderPass)
+        {
+            return ReadValue(inStream, renderPass.isEnabled) &&
+                ReadValue(inStream, renderPass.camera) &&
+                ReadValue(inStream, renderPass.renderTarget) &&
+                ReadValue(inStream, renderPass.renderOrder) &&
+                ReadValue(inStream, renderPass.clearColor) &&
+                ReadValue(inStream, renderPass.clearFlags) &&
+                ReadValue(inStream, renderPass.isRenderOnce) &&
+                ReadVector(inStream, renderPass.renderGroups);
+        }
+
+        void WriteObject(IOutputStream& outStream, const RenderTarget& renderTarget)
+        {
+            WriteVector(outStream, renderTarget.renderBuffers);
+        }
+
+        Bool ReadObject(BinaryBoundedInputStream& inStream, RenderTarget& renderTarget)
+        {
+            return ReadVector(inStream, renderTarget.renderBuffers);
+        }
+
+        void WriteObject(IOutputStream& outStream, const GeometryDataBuffer& dataBuffer)
+        {
+            WriteValue(outStream, dataBuffer.bufferType);
+            WriteValue(outStream, dataBuffer.dataType);
+            WriteValue(outStream, dataBuffer.usedSize);
+            WriteVector(outStream, dataBuffer.data);
+        }
+
+        Bool ReadObject(BinaryBoundedInputStream& inStream, GeometryDataBuffer& dataBuffer)
+        {
+            return ReadValue(inStream, dataBuffer.bufferType) &&
+                ReadValue(inStream, dataBuffer.dataType) &&
+                ReadValue(inStream, dataBuffer.usedSize) &&
+                ReadVector(inStream, dataBuffer.data);
+        }
+
+        void WriteObject(IOutputStream& outStream, const TextureBuffer& textureBuffer)
+        {
+            WriteValue(outStream, textureBuffer.textureFormat);
+            WriteValue(outStream, static_cast<UInt32>(textureBuffer.mipMaps.size()));
+            for (const auto& mipMap : textureBuffer.mipMaps)
+            {
+                WriteValue(outStream, mipMap.width);
+                WriteValue(outStream, mipMap.height);
+                WriteValue(outStream, mipMap.usedRegion);
+                WriteVector(outStream, mipMap.data);
+            }
+        }
+
+        Bool ReadObject(BinaryBoundedInputStream& inStream, TextureBuffer& textureBuffer)
+        {
+            UInt32 mipMapCount = 0u;
+            if (!ReadValue(inStream, textureBuffer.textureFormat) || !ReadValue(inStream, mipMapCount) || mipMapCount > inStream.getRemainingSize())
+            {
+                return false;
+            }
+
+            textureBuffer.mipMaps.resize(mipMapCount);
+            for (auto& mipMap : textureBuffer.mipMaps)
+            {
+                if (!ReadValue(inStream, mipMap.width) ||
+                    !ReadValue(inStream, mipMap.height) ||
+                    !ReadValue(inStream, mipMap.usedRegion) ||
+                    !ReadVector(inStream, mipMap.data))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // pools of trivially copyable objects are stored as one block including objects of released handles
+        template <typename OBJECTTYPE, typename HANDLE>
+        void WriteBulkPool(IOutputStream& outStream, const MemoryPool<OBJECTTYPE, HANDLE>& pool)
+        {
+            outStream << static_cast<UInt32>(sizeof(OBJECTTYPE));
+            WriteVector(outStream, pool.getRawHandleTable());
+            WriteVector(outStream, pool.getRawMemory());
+        }
+
+        template <typename OBJECTTYPE>
+        Bool ReadBulkPool(BinaryBoundedInputStream& inStream, PoolContent<OBJECTTYPE>& content)
+        {
+            UInt32 objectSize = 0u;
+            return ReadValue(inStream, objectSize) && objectSize == sizeof(OBJECTTYPE) &&
+                ReadVector(inStream, content.handleTable) &&
+                ReadVector(inStream, content.memory) &&
+                content.memory.size() == content.handleTable.size();
+        }
+
+        // objects owning memory are stored one by one, only for acquired handles
+        template <typename OBJECTTYPE, typename HANDLE>
+        void WritePool(IOutputStream& outStream, const MemoryPool<OBJECTTYPE, HANDLE>& pool)
+        {
+            const std::vector<UInt8>& handleTable = pool.getRawHandleTable();
+            WriteVector(outStream, handleTable);
+            for (UInt i = 0u; i < handleTable.size(); ++i)
+            {
+                if (handleTable[i] != 0u)
+                {
+                    WriteObject(outStream, pool.getRawMemory()[i]);
+                }
+            }
+        }
+
+        template <typename OBJECTTYPE>
+        Bool ReadPool(BinaryBoundedInputStream& inStream, PoolContent<OBJECTTYPE>& content)
+        {
+            if (!ReadVector(inStream, content.handleTable))
+            {
+                return false;
+            }
+
+            content.memory.resize(content.handleTable.size());
+            for (UInt i = 0u; i < content.handleTable.size(); ++i)
+            {
+                if (content.handleTable[i] != 0u && !ReadObject(inStream, content.memory[i]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    void SceneImage::WriteToStream(IOutputStream& outStream, const ClientScene& scene)
+    {
+        const Scene& pools = scene;
+
+        BinaryOutputStream payload(1024u * 1024u);
+        WritePool(payload, pools.m_nodes);
+        WriteBulkPool(payload, pools.m_cameras);
+        WriteBulkPool(payload, pools.m_renderables);
+        WriteBulkPool(payload, pools.m_states);
+        WriteBulkPool(payload, pools.m_transforms);
+        WritePool(payload, pools.m_dataLayoutMemory);
+        WritePool(payload, pools.m_dataInstanceMemory);
+        WritePool(payload, pools.m_renderGroups);
+        WritePool(payload, pools.m_renderPasses);
+        WriteBulkPool(payload, pools.m_blitPasses);
+        WritePool(payload, pools.m_renderTargets);
+        WriteBulkPool(payload, pools.m_renderBuffers);
+        WriteBulkPool(payload, pools.m_textureSamplers);
+        WriteBulkPool(payload, pools.m_streamTextures);
+        WritePool(payload, pools.m_dataBuffers);
+        WritePool(payload, pools.m_textureBuffers);
+        WriteBulkPool(payload, pools.m_dataSlots);
+
+        // data layouts are shared by client scene, each reference has to be restored
+        for (DataLayoutHandle handle(0u); handle < scene.getDataLayoutCount(); ++handle)
+        {
+            if (scene.isDataLayoutAllocated(handle))
+            {
+                WriteValue(payload, scene.getNumDataLayoutReferences(handle));
+            }
+        }
+
+        SceneActionCollection animationSystemActions;
+        SceneActionCollectionCreator creator(animationSystemActions);
+        SceneDescriber::describeAnimationSystems(scene, creator);
+        ScenePersistation::WriteSceneActionsToStream(payload, animationSystemActions);
+
+        outStream << gSceneImageMarker;
+        outStream << gSceneImageRevision;
+        outStream << gSceneImageEndiannessTag;
+        outStream << static_cast<UInt64>(payload.getSize());
+        outStream << static_cast<UInt64>(cityhash::CityHash64(payload.getData(), payload.getSize()));
+        outStream.write(payload.getData(), payload.getSize());
+    }
+
+    Bool SceneImage::ReadFromMemory(const Char* image, UInt imageSize, ClientScene& scene, AnimationSystemFactory* animSystemFactory)
+    {
+        BinaryBoundedInputStream headerStream(image, imageSize);
+        UInt32 marker = 0u;
+        UInt32 revision = 0u;
+        UInt32 endiannessTag = 0u;
+        UInt64 payloadSize = 0u;
+        UInt64 expectedHash = 0u;
+        headerStream >> marker >> revision >> endiannessTag >> payloadSize >> expectedHash;
+
+        if (headerStream.getState() != EStatus_RAMSES_OK || marker != gSceneImageMarker || revision != gSceneImageRevision)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneImage::ReadFromMemory: not a scene image of supported revision");
+            return false;
+        }
+        if (endiannessTag != gSceneImageEndiannessTag)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneImage::ReadFromMemory: scene image was written on machine with different endianness");
+            return false;
+        }
+
+        const Char* payloadData = image + gSceneImageHeaderSize;
+        if (payloadSize != imageSize - gSceneImageHeaderSize || cityhash::CityHash64(payloadData, payloadSize) != expectedHash)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneImage::ReadFromMemory: scene image is corrupt");
+            return false;
+        }
+
+        // all pools are read and checked before scene is modified
+        BinaryBoundedInputStream payload(payloadData, static_cast<UInt>(payloadSize));
+        PoolContent<TopologyNode> nodes;
+        PoolContent<Camera> cameras;
+        PoolContent<Renderable> renderables;
+        PoolContent<RenderState> states;
+        PoolContent<TopologyTransform> transforms;
+        PoolContent<DataLayout> dataLayouts;
+        PoolContent<DataInstance> dataInstances;
+        PoolContent<RenderGroup> renderGroups;
+        PoolContent<RenderPass> renderPasses;
+        PoolContent<BlitPass> blitPasses;
+        PoolContent<RenderTarget> renderTargets;
+        PoolContent<RenderBuffer> renderBuffers;
+        PoolContent<TextureSampler> textureSamplers;
+        PoolContent<StreamTexture> streamTextures;
+        PoolContent<GeometryDataBuffer> dataBuffers;
+        PoolContent<TextureBuffer> textureBuffers;
+        PoolContent<DataSlot> dataSlots;
+        const Bool poolsRead =
+            ReadPool(payload, nodes) &&
+            ReadBulkPool(payload, cameras) &&
+            ReadBulkPool(payload, renderables) &&
+            ReadBulkPool(payload, states) &&
+            ReadBulkPool(payload, transforms) &&
+            ReadPool(payload, dataLayouts) &&
+            ReadPool(payload, dataInstances) &&
+            ReadPool(payload, renderGroups) &&
+            ReadPool(payload, renderPasses) &&
+            ReadBulkPool(payload, blitPasses) &&
+            ReadPool(payload, renderTargets) &&
+            ReadBulkPool(payload, renderBuffers) &&
+            ReadBulkPool(payload, textureSamplers) &&
+            ReadBulkPool(payload, streamTextures) &&
+            ReadPool(payload, dataBuffers) &&
+            ReadPool(payload, textureBuffers) &&
+            ReadBulkPool(payload, dataSlots);
+        if (!poolsRead)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneImage::ReadFromMemory: failed to read scene pools, scene image does not match this build");
+            return false;
+        }
+
+        // references used when rebuilding state derived from pools must be valid
+        for (MemoryHandle i = 0u; i < transforms.handleTable.size(); ++i)
+        {
+            if (transforms.isAllocated(i) && !nodes.isAllocated(transforms.memory[i].node.asMemoryHandle()))
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneImage::ReadFromMemory: transform " << i << " refers to invalid node");
+                return false;
+            }
+        }
+        for (MemoryHandle i = 0u; i < dataInstances.handleTable.size(); ++i)
+        {
+            if (dataInstances.isAllocated(i))
+            {
+                const DataInstance& instance = dataInstances.memory[i];
+                const MemoryHandle layout = instance.getLayoutHandle().asMemoryHandle();
+                if (!dataLayouts.isAllocated(layout) || dataLayouts.memory[layout].getTotalSize() != instance.getRawDataSize())
+                {
+                    LOG_ERROR(CONTEXT_FRAMEWORK, "SceneImage::ReadFromMemory: data instance " << i << " does not match its data layout");
+                    return false;
+                }
+            }
+        }
+
+        std::vector<UInt32> dataLayoutReferences(dataLayouts.handleTable.size(), 0u);
+        for (MemoryHandle i = 0u; i < dataLayouts.handleTable.size(); ++i)
+        {
+            if (dataLayouts.isAllocated(i) && (!ReadValue(payload, dataLayoutReferences[i]) || dataLayoutReferences[i] == 0u))
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneImage::ReadFromMemory: invalid reference count of data layout " << i);
+                return false;
+            }
+        }
+
+        Scene& pools = scene;
+        pools.m_nodes.setRawContent(std::move(nodes.memory), std::move(nodes.handleTable));
+        pools.m_cameras.setRawContent(std::move(cameras.memory), std::move(cameras.handleTable));
+        pools.m_renderables.setRawContent(std::move(renderables.memory), std::move(renderables.handleTable));
+        pools.m_states.setRawContent(std::move(states.memory), std::move(states.handleTable));
+        pools.m_transforms.setRawContent(std::move(transforms.memory), std::move(transforms.handleTable));
+        pools.m_dataLayoutMemory.setRawContent(std::move(dataLayouts.memory), std::move(dataLayouts.handleTable));
+        pools.m_dataInstanceMemory.setRawContent(std::move(dataInstances.memory), std::move(dataInstances.handleTable));
+        pools.m_renderGroups.setRawContent(std::move(renderGroups.memory), std::move(renderGroups.handleTable));
+        pools.m_renderPasses.setRawContent(std::move(renderPasses.memory), std::move(renderPasses.handleTable));
+        pools.m_blitPasses.setRawContent(std::move(blitPasses.memory), std::move(blitPasses.handleTable));
+        pools.m_renderTargets.setRawContent(std::move(renderTargets.memory), std::move(renderTargets.handleTable));
+        pools.m_renderBuffers.setRawContent(std::move(renderBuffers.memory), std::move(renderBuffers.handleTable));
+        pools.m_textureSamplers.setRawContent(std::move(textureSamplers.memory), std::move(textureSamplers.handleTable));
+        pools.m_streamTextures.setRawContent(std::move(streamTextures.memory), std::move(streamTextures.handleTable));
+        pools.m_dataBuffers.setRawContent(std::move(dataBuffers.memory), std::move(dataBuffers.handleTable));
+        pools.m_textureBuffers.setRawContent(std::move(textureBuffers.memory), std::move(textureBuffers.handleTable));
+        pools.m_dataSlots.setRawContent(std::move(dataSlots.memory), std::move(dataSlots.handleTable));
+        pools.onRestoredFromSceneImage();
+
+        // layouts are cached with one reference after restore, others are added through cache
+        for (MemoryHandle i = 0u; i < dataLayoutReferences.size(); ++i)
+        {
+            for (UInt32 reference = 1u; reference < dataLayoutReferences[i]; ++reference)
+            {
+                scene.allocateDataLayout(scene.getDataLayout(DataLayoutHandle(i)).getDataFields());
+            }
+        }
+
+        if (!ScenePersistation::ReadSceneFromStream(payload, scene, animSystemFactory) || payload.getRemainingSize() != 0u)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneImage::ReadFromMemory: failed to read animation systems of scene image");
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -81,6 +81,11 @@ namespace ramses_internal
         creator.preallocateSceneSize(scene.getSceneSizeInformation());
         SceneDescriber::describeScene<ClientScene>(scene, creator);
 
+        WriteSceneActionsToStream(outStream, collection);
+    }
+
+    void ScenePersistation::WriteSceneActionsToStream(IOutputStream& outStream, const SceneActionCollection& collection)
+    {
         const std::vector<Byte>& actionData = collection.collectionData();
 
         outStream << static_cast<UInt32>(gSceneMarker);
@@ -113,20 +118,25 @@ namespace ramses_internal
         }
     }
 
-    void ScenePersistation::ReadSceneFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory)
+    bool ScenePersistation::ReadSceneFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory)
     {
         UInt32 sceneMarker = 0;
         inStream >> sceneMarker;
         if (sceneMarker != gSceneMarker)
         {
             LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not load scene from file, its not marked as a scene");
-            return;
+            return false;
         }
 
         UInt32 numberOfSceneActionsToRead = 0;
         inStream >> numberOfSceneActionsToRead;
         UInt32 sizeOfAllSceneActions = 0;
         inStream >> sizeOfAllSceneActions;
+        if (inStream.getState() != EStatus_RAMSES_OK)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not read scene actions header");
+            return false;
+        }
 
         SceneActionCollection actions(0, numberOfSceneActionsToRead);
 
@@ -134,18 +144,31 @@ namespace ramses_internal
         std::vector<Byte>& rawActionData = actions.getRawDataForDirectWriting();
         rawActionData.resize(sizeOfAllSceneActions);
         inStream.read(reinterpret_cast<char*>(rawActionData.data()), static_cast<UInt32>(rawActionData.size()));
+        if (inStream.getState() != EStatus_RAMSES_OK)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not read scene actions data of size " << sizeOfAllSceneActions);
+            return false;
+        }
 
         std::array<uint32_t, ESceneActionId_NUMBER_OF_TYPES> objectCounts = {};
 
-        // read types and offsets
+        // read types and offsets, offsets must be ascending within data so that every action is read from its own data only
+        UInt32 previousOffset = 0;
         for (UInt32 i = 0; i < numberOfSceneActionsToRead; ++i)
         {
             UInt32 actionType = 0;
             inStream >> actionType;
             UInt32 offsetInCollection = 0;
             inStream >> offsetInCollection;
+            if (inStream.getState() != EStatus_RAMSES_OK || actionType >= ESceneActionId_NUMBER_OF_TYPES ||
+                offsetInCollection < previousOffset || offsetInCollection > sizeOfAllSceneActions)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  invalid scene action " << i << " (type " << actionType << ", offset " << offsetInCollection << ")");
+                return false;
+            }
             actions.addRawSceneActionInformation(static_cast<ESceneActionId>(actionType), offsetInCollection);
             ++objectCounts[actionType];
+            previousOffset = offsetInCollection;
         }
 
         LOG_DEBUG_F(ramses_internal::CONTEXT_PROFILING, ([&](ramses_internal::StringOutputStream& sos) {
@@ -160,6 +183,7 @@ namespace ramses_internal
                 }));
 
         SceneActionApplier::ApplyActionsOnScene(scene, actions, animSystemFactory);
+        return true;
     }
 
     void ScenePersistation::ReadSceneFromFile(const String& filename, IScene& scene, AnimationSystemFactory* animSystemFactory)
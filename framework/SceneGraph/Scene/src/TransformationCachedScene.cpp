@@ -106,6 +106,37 @@ namespace ramses_internal
         SceneT<MEMORYPOOL>::releaseNode(node);
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::onRestoredFromSceneImage()
+    {
+        SceneT<MEMORYPOOL>::onRestoredFromSceneImage();
+
+        const UInt32 nodeCount = this->getNodeCount();
+        m_matrixCachePool.preallocateSize(nodeCount);
+        for (NodeHandle node(0u); node < nodeCount; ++node)
+        {
+            if (this->isNodeAllocated(node))
+            {
+                m_matrixCachePool.allocate(node);
+            }
+        }
+
+        const UInt32 transformCount = this->getTransformCount();
+        m_nodeToTransformMap.reserve(transformCount);
+        for (TransformHandle transform(0u); transform < transformCount; ++transform)
+        {
+            if (this->isTransformAllocated(transform))
+            {
+                const NodeHandle node = this->getTransformNode(transform);
+                m_nodeToTransformMap.put(node, transform);
+                if (this->getTranslation(transform) != Vector3::Empty || this->getRotation(transform) != Vector3::Empty || this->getScaling(transform) != Vector3::Identity)
+                {
+                    getMatrixCacheEntry(node).m_isIdentity = false;
+                }
+            }
+        }
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     void TransformationCachedSceneT<MEMORYPOOL>::setMatrixCache(ETransformationMatrixType matrixType, MatrixCacheEntry& matrixCache, const Matrix44f& matrix) const
     {
@@ -92,6 +92,12 @@ namespace ramses_internal
         flushPendingSceneActions();
     }
 
+    void ActionTestScene::setRenderableBoundingSphere(RenderableHandle renderableHandle, const Vector4& boundingSphere)
+    {
+        m_actionCollector.setRenderableBoundingSphere(renderableHandle, boundingSphere);
+        flushPendingSceneActions();
+    }
+
     const Renderable& ActionTestScene::getRenderable(RenderableHandle renderableHandle) const
     {
         return m_scene.getRenderable(renderableHandle);
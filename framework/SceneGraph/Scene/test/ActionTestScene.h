@@ -42,6 +42,7 @@ namespace ramses_internal
         virtual void                        setRenderableRenderState        (RenderableHandle renderableHandle, RenderStateHandle stateHandle) override;
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, Bool visible) override;
         virtual void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, UInt32 instanceCount) override;
+        virtual void                        setRenderableBoundingSphere     (RenderableHandle renderableHandle, const Vector4& boundingSphere) override;
         virtual const Renderable&           getRenderable                   (RenderableHandle renderableHandle) const override;
 
         // Render state
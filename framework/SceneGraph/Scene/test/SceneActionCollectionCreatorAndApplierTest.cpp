@@ -9,6 +9,8 @@
 #include "framework_common_gmock_header.h"
 #include "Scene/SceneActionCollectionCreator.h"
 #include "Scene/SceneActionApplier.h"
+#include "Scene/ActionCollectingScene.h"
+#include "Scene/Scene.h"
 #include "Components/FlushTimeInformation.h"
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -165,4 +167,168 @@ namespace ramses_internal
         readFlushByIndex(0);
         EXPECT_EQ(versionTagIn, versionTag);
     }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, appliesVisibilityToAllRenderablesOfBatchAction)
+    {
+        Scene scene;
+        const NodeHandle node = scene.allocateNode();
+        const RenderableHandle renderable1 = scene.allocateRenderable(node);
+        const RenderableHandle renderable2 = scene.allocateRenderable(node);
+        const RenderableHandle renderable3 = scene.allocateRenderable(node);
+
+        const RenderableHandle renderables[] = { renderable1, renderable3 };
+        creator.setRenderablesVisibility(renderables, 2u, false);
+        ASSERT_EQ(1u, collection.numberOfActions());
+        EXPECT_EQ(ESceneActionId_SetRenderablesVisibility, collection[0].type());
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection);
+        EXPECT_FALSE(scene.getRenderable(renderable1).isVisible);
+        EXPECT_TRUE(scene.getRenderable(renderable2).isVisible);
+        EXPECT_FALSE(scene.getRenderable(renderable3).isVisible);
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, ignoresRenderablesVisibilityWithCountNotMatchingActionSize)
+    {
+        Scene scene;
+        const NodeHandle node = scene.allocateNode();
+        const RenderableHandle renderable = scene.allocateRenderable(node);
+
+        collection.beginWriteSceneAction(ESceneActionId_SetRenderablesVisibility);
+        collection.write(false);
+        collection.write(UInt32(1000000u));
+        collection.write(renderable);
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection);
+        EXPECT_TRUE(scene.getRenderable(renderable).isVisible);
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, actionCollectingSceneCreatesSingleActionOnlyForRenderablesWithChangedVisibility)
+    {
+        ActionCollectingScene scene;
+        const NodeHandle node = scene.allocateNode();
+        const RenderableHandle renderable1 = scene.allocateRenderable(node);
+        const RenderableHandle renderable2 = scene.allocateRenderable(node);
+        const RenderableHandle renderable3 = scene.allocateRenderable(node);
+        scene.setRenderableVisibility(renderable2, false);
+        scene.getSceneActionCollection().clear();
+
+        scene.setRenderablesVisibility({ renderable1, renderable2, renderable3 }, false);
+        EXPECT_FALSE(scene.getRenderable(renderable1).isVisible);
+        EXPECT_FALSE(scene.getRenderable(renderable2).isVisible);
+        EXPECT_FALSE(scene.getRenderable(renderable3).isVisible);
+
+        const SceneActionCollection& actions = scene.getSceneActionCollection();
+        ASSERT_EQ(1u, actions.numberOfActions());
+        EXPECT_EQ(ESceneActionId_SetRenderablesVisibility, actions[0].type());
+
+        Scene otherScene;
+        const NodeHandle otherNode = otherScene.allocateNode();
+        otherScene.allocateRenderable(otherNode, renderable1);
+        otherScene.allocateRenderable(otherNode, renderable2);
+        otherScene.allocateRenderable(otherNode, renderable3);
+        SceneActionApplier::ApplyActionsOnScene(otherScene, actions);
+        EXPECT_FALSE(otherScene.getRenderable(renderable1).isVisible);
+        EXPECT_TRUE(otherScene.getRenderable(renderable2).isVisible);
+        EXPECT_FALSE(otherScene.getRenderable(renderable3).isVisible);
+
+        scene.getSceneActionCollection().clear();
+        scene.setRenderablesVisibility({ renderable1, renderable2 }, false);
+        EXPECT_TRUE(scene.getSceneActionCollection().empty());
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, appliesDataArrayToAllDataInstancesOfBatchAction)
+    {
+        Scene scene;
+        const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo(EDataType_Float), DataFieldInfo(EDataType_Vector4F, 2u) });
+        const DataInstanceHandle instance1 = scene.allocateDataInstance(layout);
+        const DataInstanceHandle instance2 = scene.allocateDataInstance(layout);
+        const DataInstanceHandle instance3 = scene.allocateDataInstance(layout);
+
+        const DataInstanceHandle instances[] = { instance1, instance3 };
+        const Vector4 values[] = { Vector4(1.f, 2.f, 3.f, 4.f), Vector4(5.f, 6.f, 7.f, 8.f), Vector4(9.f, 10.f, 11.f, 12.f), Vector4(13.f, 14.f, 15.f, 16.f) };
+        creator.setDataArrayForInstances(instances, 2u, DataFieldHandle(1u), EDataType_Vector4F, 2u, reinterpret_cast<const Byte*>(values));
+        ASSERT_EQ(1u, collection.numberOfActions());
+        EXPECT_EQ(ESceneActionId_SetDataArrayForInstances, collection[0].type());
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection);
+        EXPECT_EQ(values[0], scene.getDataVector4fArray(instance1, DataFieldHandle(1u))[0]);
+        EXPECT_EQ(values[1], scene.getDataVector4fArray(instance1, DataFieldHandle(1u))[1]);
+        EXPECT_EQ(Vector4(0.f), scene.getDataVector4fArray(instance2, DataFieldHandle(1u))[0]);
+        EXPECT_EQ(Vector4(0.f), scene.getDataVector4fArray(instance2, DataFieldHandle(1u))[1]);
+        EXPECT_EQ(values[2], scene.getDataVector4fArray(instance3, DataFieldHandle(1u))[0]);
+        EXPECT_EQ(values[3], scene.getDataVector4fArray(instance3, DataFieldHandle(1u))[1]);
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, ignoresDataArrayForInstancesWithMismatchingDataSize)
+    {
+        Scene scene;
+        const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo(EDataType_Vector4F, 2u) });
+        const DataInstanceHandle instance = scene.allocateDataInstance(layout);
+
+        const Vector4 value(1.f, 2.f, 3.f, 4.f);
+        collection.beginWriteSceneAction(ESceneActionId_SetDataArrayForInstances);
+        collection.write(DataFieldHandle(0u));
+        collection.write(static_cast<UInt32>(EDataType_Vector4F));
+        collection.write(UInt32(2u));
+        collection.write(UInt32(1u));
+        collection.write(instance);
+        collection.write(reinterpret_cast<const Byte*>(&value), UInt32(sizeof(Vector4)));
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection);
+        EXPECT_EQ(Vector4(0.f), scene.getDataVector4fArray(instance, DataFieldHandle(0u))[0]);
+        EXPECT_EQ(Vector4(0.f), scene.getDataVector4fArray(instance, DataFieldHandle(0u))[1]);
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, ignoresDataArrayForInstancesWithInstanceCountExceedingActionSize)
+    {
+        Scene scene;
+        const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo(EDataType_Vector4F) });
+        const DataInstanceHandle instance = scene.allocateDataInstance(layout);
+
+        const Vector4 value(1.f, 2.f, 3.f, 4.f);
+        collection.beginWriteSceneAction(ESceneActionId_SetDataArrayForInstances);
+        collection.write(DataFieldHandle(0u));
+        collection.write(static_cast<UInt32>(EDataType_Vector4F));
+        collection.write(UInt32(1u));
+        collection.write(UInt32(0x40000000u));
+        collection.write(instance);
+        collection.write(reinterpret_cast<const Byte*>(&value), UInt32(sizeof(Vector4)));
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection);
+        EXPECT_EQ(Vector4(0.f), scene.getDataVector4fArray(instance, DataFieldHandle(0u))[0]);
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, actionCollectingSceneSetsDataArrayOfAllDataInstancesWithSingleAction)
+    {
+        ActionCollectingScene scene;
+        const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo(EDataType_Int32) });
+        const DataInstanceHandle instance1 = scene.allocateDataInstance(layout);
+        const DataInstanceHandle instance2 = scene.allocateDataInstance(layout);
+        scene.getSceneActionCollection().clear();
+
+        const DataInstanceHandle instances[] = { instance1, instance2 };
+        const Int32 values[] = { 3, 4 };
+        scene.setDataArrayForInstances(instances, 2u, DataFieldHandle(0u), EDataType_Int32, 1u, reinterpret_cast<const Byte*>(values));
+        EXPECT_EQ(3, scene.getDataSingleInteger(instance1, DataFieldHandle(0u)));
+        EXPECT_EQ(4, scene.getDataSingleInteger(instance2, DataFieldHandle(0u)));
+
+        const SceneActionCollection& actions = scene.getSceneActionCollection();
+        ASSERT_EQ(1u, actions.numberOfActions());
+        EXPECT_EQ(ESceneActionId_SetDataArrayForInstances, actions[0].type());
+
+        Scene otherScene;
+        otherScene.allocateDataLayout({ DataFieldInfo(EDataType_Int32) }, layout);
+        otherScene.allocateDataInstance(layout, instance1);
+        otherScene.allocateDataInstance(layout, instance2);
+        SceneActionApplier::ApplyActionsOnScene(otherScene, actions);
+        EXPECT_EQ(3, otherScene.getDataSingleInteger(instance1, DataFieldHandle(0u)));
+        EXPECT_EQ(4, otherScene.getDataSingleInteger(instance2, DataFieldHandle(0u)));
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, actionCollectingSceneCreatesNoActionForNoDataInstances)
+    {
+        ActionCollectingScene scene;
+        scene.setDataArrayForInstances(nullptr, 0u, DataFieldHandle(0u), EDataType_Float, 1u, nullptr);
+        EXPECT_TRUE(scene.getSceneActionCollection().empty());
+    }
 }
@@ -0,0 +1,171 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "gmock/gmock.h"
+#include "Scene/SceneImage.h"
+#include "Scene/ScenePersistation.h"
+#include "Scene/ClientScene.h"
+#include "Scene/SceneActionApplier.h"
+#include "Animation/AnimationSystem.h"
+#include "Animation/AnimationSystemFactory.h"
+#include "Utils/BinaryOutputStream.h"
+#include "TestingScene.h"
+
+using namespace testing;
+
+namespace ramses_internal
+{
+    class ASceneImage : public testing::Test
+    {
+    protected:
+        std::vector<Char> writeImage(const ClientScene& scene)
+        {
+            BinaryOutputStream outStream;
+            SceneImage::WriteToStream(outStream, scene);
+            return std::vector<Char>(outStream.getData(), outStream.getData() + outStream.getSize());
+        }
+
+        ClientScene loadedScene;
+    };
+
+    TEST_F(ASceneImage, restoresAllSceneObjects)
+    {
+        TestingScene<ClientScene> scene;
+        const std::vector<Char> image = writeImage(scene.getScene());
+
+        EXPECT_TRUE(SceneImage::ReadFromMemory(image.data(), image.size(), loadedScene));
+        scene.CheckEquivalentTo<IScene>(loadedScene);
+    }
+
+    TEST_F(ASceneImage, restoresSceneIntoPreallocatedScene)
+    {
+        TestingScene<ClientScene> scene;
+        const std::vector<Char> image = writeImage(scene.getScene());
+
+        loadedScene.preallocateSceneSize(scene.getScene().getSceneSizeInformation());
+        EXPECT_TRUE(SceneImage::ReadFromMemory(image.data(), image.size(), loadedScene));
+        scene.CheckEquivalentTo<IScene>(loadedScene);
+    }
+
+    TEST_F(ASceneImage, restoresReferencesOfSharedDataLayouts)
+    {
+        ClientScene scene;
+        const DataFieldInfoVector fields{ DataFieldInfo(EDataType_Float) };
+        const DataLayoutHandle layout = scene.allocateDataLayout(fields);
+        scene.allocateDataLayout(fields);
+        scene.allocateDataLayout(fields);
+        const std::vector<Char> image = writeImage(scene);
+
+        EXPECT_TRUE(SceneImage::ReadFromMemory(image.data(), image.size(), loadedScene));
+        EXPECT_EQ(3u, loadedScene.getNumDataLayoutReferences(layout));
+        EXPECT_EQ(layout, loadedScene.allocateDataLayout(fields));
+        EXPECT_EQ(4u, loadedScene.getNumDataLayoutReferences(layout));
+    }
+
+    TEST_F(ASceneImage, restoresTransformationCache)
+    {
+        ClientScene scene;
+        const NodeHandle parent = scene.allocateNode();
+        const NodeHandle child = scene.allocateNode();
+        scene.addChildToNode(parent, child);
+        scene.setTranslation(scene.allocateTransform(parent), Vector3(1.f, 2.f, 3.f));
+        const std::vector<Char> image = writeImage(scene);
+
+        EXPECT_TRUE(SceneImage::ReadFromMemory(image.data(), image.size(), loadedScene));
+        EXPECT_EQ(Matrix44f::Translation(1.f, 2.f, 3.f), loadedScene.updateMatrixCache(ETransformationMatrixType_World, child));
+
+        loadedScene.setTranslation(TransformHandle(0u), Vector3(4.f, 5.f, 6.f));
+        EXPECT_EQ(Matrix44f::Translation(4.f, 5.f, 6.f), loadedScene.updateMatrixCache(ETransformationMatrixType_World, child));
+    }
+
+    TEST_F(ASceneImage, collectsResourcesOfRestoredScene)
+    {
+        TestingScene<ClientScene> scene;
+        const std::vector<Char> image = writeImage(scene.getScene());
+
+        EXPECT_TRUE(SceneImage::ReadFromMemory(image.data(), image.size(), loadedScene));
+        const SceneResourceChanges& changes = loadedScene.getResourceChanges();
+        EXPECT_THAT(changes.m_addedClientResourceRefs, UnorderedElementsAre(scene.indexArrayHash, scene.vertexArrayHash, scene.effectHash, scene.textureHash, ResourceContentHash(234, 0)));
+        EXPECT_TRUE(changes.m_removedClientResourceRefs.empty());
+        EXPECT_THAT(changes.m_sceneResourceActions, Contains(SceneResourceAction(scene.renderTarget.asMemoryHandle(), ESceneResourceAction_CreateRenderTarget)));
+
+        // restored references are counted, resource stays in use until its last user is gone
+        loadedScene.clearResourceChanges();
+        loadedScene.releaseTextureSampler(scene.samplerWithTextureResource);
+        EXPECT_TRUE(loadedScene.getResourceChanges().m_removedClientResourceRefs.empty());
+    }
+
+    TEST_F(ASceneImage, collectsRestoredSceneAsSceneActions)
+    {
+        TestingScene<ClientScene> scene;
+        const std::vector<Char> image = writeImage(scene.getScene());
+
+        EXPECT_TRUE(SceneImage::ReadFromMemory(image.data(), image.size(), loadedScene));
+        Scene sceneFromActions;
+        SceneActionApplier::ApplyActionsOnScene(sceneFromActions, loadedScene.getSceneActionCollection());
+        scene.CheckEquivalentTo<IScene>(sceneFromActions);
+    }
+
+    TEST_F(ASceneImage, restoresAnimationSystems)
+    {
+        ClientScene scene;
+        AnimationSystemFactory factory(EAnimationSystemOwner_Client, &scene.getSceneActionCollection());
+        const AnimationSystemHandle animationSystem = scene.addAnimationSystem(factory.createAnimationSystem(EAnimationSystemFlags_FullProcessing, AnimationSystemSizeInformation()));
+        const std::vector<Char> image = writeImage(scene);
+
+        AnimationSystemFactory loadingFactory(EAnimationSystemOwner_Client, &loadedScene.getSceneActionCollection());
+        EXPECT_TRUE(SceneImage::ReadFromMemory(image.data(), image.size(), loadedScene, &loadingFactory));
+        ASSERT_TRUE(loadedScene.isAnimationSystemAllocated(animationSystem));
+        EXPECT_NE(0u, loadedScene.getAnimationSystem(animationSystem)->getFlags() & EAnimationSystemFlags_FullProcessing);
+    }
+
+    TEST_F(ASceneImage, failsToReadImageWithWrongSize)
+    {
+        ClientScene scene;
+        scene.allocateNode();
+        const std::vector<Char> image = writeImage(scene);
+
+        EXPECT_FALSE(SceneImage::ReadFromMemory(image.data(), image.size() - 1u, loadedScene));
+        EXPECT_EQ(0u, loadedScene.getNodeCount());
+    }
+
+    TEST_F(ASceneImage, failsToReadImageOfOtherEndianness)
+    {
+        ClientScene scene;
+        scene.allocateNode();
+        std::vector<Char> image = writeImage(scene);
+
+        // endianness tag follows marker and revision
+        std::reverse(image.begin() + 8, image.begin() + 12);
+        EXPECT_FALSE(SceneImage::ReadFromMemory(image.data(), image.size(), loadedScene));
+        EXPECT_EQ(0u, loadedScene.getNodeCount());
+    }
+
+    TEST_F(ASceneImage, failsToReadCorruptedImage)
+    {
+        ClientScene scene;
+        scene.allocateNode();
+        std::vector<Char> image = writeImage(scene);
+
+        image.back() = static_cast<Char>(image.back() ^ 0xff);
+        EXPECT_FALSE(SceneImage::ReadFromMemory(image.data(), image.size(), loadedScene));
+        EXPECT_EQ(0u, loadedScene.getNodeCount());
+    }
+
+    TEST_F(ASceneImage, failsToReadSceneActions)
+    {
+        ClientScene scene;
+        scene.allocateNode();
+        BinaryOutputStream outStream;
+        ScenePersistation::WriteSceneToStream(outStream, scene);
+
+        EXPECT_FALSE(SceneImage::ReadFromMemory(outStream.getData(), outStream.getSize(), loadedScene));
+        EXPECT_EQ(0u, loadedScene.getNodeCount());
+    }
+}
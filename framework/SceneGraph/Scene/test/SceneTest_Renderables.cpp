@@ -114,6 +114,21 @@ namespace ramses_internal
         EXPECT_EQ(false, this->m_scene.getRenderable(renderable).isVisible);
     }
 
+    TYPED_TEST(AScene, HasNoBoundingSphereForNewRenderable)
+    {
+        const RenderableHandle renderable = this->m_scene.allocateRenderable(this->m_scene.allocateNode());
+
+        EXPECT_EQ(Vector4(0.f), this->m_scene.getRenderable(renderable).boundingSphere);
+    }
+
+    TYPED_TEST(AScene, SetsBoundingSphereOfRenderable)
+    {
+        const RenderableHandle renderable = this->m_scene.allocateRenderable(this->m_scene.allocateNode());
+        this->m_scene.setRenderableBoundingSphere(renderable, Vector4(1.f, 2.f, 3.f, 4.f));
+
+        EXPECT_EQ(Vector4(1.f, 2.f, 3.f, 4.f), this->m_scene.getRenderable(renderable).boundingSphere);
+    }
+
     TYPED_TEST(AScene, ContainsZeroTotalRenderablesUponCreation)
     {
         EXPECT_EQ(0u, this->m_scene.getRenderableCount());
@@ -71,6 +71,7 @@ namespace ramses_internal
             scene.setRenderableRenderState(renderable, renderState);
             scene.setRenderableVisibility(renderable, false);
             scene.setRenderableInstanceCount(renderable, renderableInstanceCount);
+            scene.setRenderableBoundingSphere(renderable, renderableBoundingSphere);
 
             scene.allocateRenderable(child, renderable2);
 
@@ -256,6 +257,7 @@ namespace ramses_internal
             EXPECT_EQ(renderState, renderableData.renderState);
             EXPECT_FALSE(renderableData.isVisible);
             EXPECT_EQ(renderableInstanceCount, renderableData.instanceCount);
+            EXPECT_EQ(renderableBoundingSphere, renderableData.boundingSphere);
         }
 
         template <typename OTHERSCENE>
@@ -637,6 +639,7 @@ namespace ramses_internal
         const RenderGroupHandle      nestedRenderGroupParent        {61u};
         const RenderGroupHandle      nestedRenderGroupChild         {62u};
         const UInt32                 renderableInstanceCount        = 64u;
+        const Vector4                renderableBoundingSphere       { 1.f, 2.f, 3.f, 4.f };
         const TextureSamplerStates   samplerStates                  { EWrapMethod::Repeat, EWrapMethod::Clamp, EWrapMethod::RepeatMirrored, ESamplingMethod::Nearest, ESamplingMethod::Linear, 32u };
         const PixelRectangle         blitPassSourceRectangle        = PixelRectangle({1u, 2u, 300u, 400u});
         const PixelRectangle         blitPassDestinationRectangle   = PixelRectangle({5u, 6u, 700u, 800u});
@@ -90,6 +90,7 @@ namespace ramses_internal
         virtual void                        setRenderableRenderState        (RenderableHandle renderableHandle, RenderStateHandle stateHandle) = 0;
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, Bool visible) = 0;
         virtual void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, UInt32 instanceCount) = 0;
+        virtual void                        setRenderableBoundingSphere     (RenderableHandle renderableHandle, const Vector4& boundingSphere) = 0;
         virtual const Renderable&           getRenderable                   (RenderableHandle renderableHandle) const = 0;
 
         // Render state
@@ -11,6 +11,7 @@
 
 #include "SceneAPI/ResourceContentHash.h"
 #include "SceneAPI/Handles.h"
+#include "Math3d/Vector4.h"
 
 namespace ramses_internal
 {
@@ -26,6 +27,9 @@ namespace ramses_internal
 
         DataInstanceHandle dataInstances[ERenderableDataSlotType_MAX_SLOTS];
         RenderStateHandle renderState;
+
+        // bounding sphere in local space of renderable's node (xyz center, w radius), zero radius means unknown bounds
+        Vector4 boundingSphere{ 0.f, 0.f, 0.f, 0.f };
     };
 }
 
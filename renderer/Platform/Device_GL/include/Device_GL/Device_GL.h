@@ -13,6 +13,7 @@
 #include "Platform_Base/DeviceResourceMapper.h"
 #include "Types_GL.h"
 #include "DebugOutput.h"
+#include "TimerQueries.h"
 
 namespace ramses_internal
 {
@@ -66,6 +67,13 @@ namespace ramses_internal
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix44f*  value) override;
 
         virtual void readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual DeviceResourceHandle    startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual Bool                    isReadPixelsFinished(DeviceResourceHandle readPixelsHandle) override;
+        virtual Bool                    finishReadPixels(DeviceResourceHandle readPixelsHandle, UInt8* buffer) override;
+        virtual DeviceResourceHandle    issueTimestampQuery() override;
+        virtual Bool                    isTimestampQueryResultAvailable(DeviceResourceHandle queryHandle) override;
+        virtual Bool                    getTimestampQueryResult(DeviceResourceHandle queryHandle, UInt64& timestampNanoseconds) override;
+        virtual void                    releaseTimestampQuery(DeviceResourceHandle queryHandle) override;
 
         virtual DeviceResourceHandle    allocateVertexBuffer  (EDataType dataType, UInt32 sizeInBytes) override;
         virtual void                    uploadVertexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
@@ -142,6 +150,7 @@ namespace ramses_internal
         const UInt8                 m_minorApiVersion;
         const bool                  m_isEmbedded;
         DebugOutput                 m_debugOutput;
+        TimerQueries                m_timerQueries;
         StringSet                   m_apiExtensions;
 
         Bool getUniformLocation(DataFieldHandle field, GLInputLocation& location) const;
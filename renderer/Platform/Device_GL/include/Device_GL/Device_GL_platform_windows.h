@@ -109,6 +109,11 @@
 #define glTexSubImage3D(...)            glTexSubImage3DNative(__VA_ARGS__)
 #define glCompressedTexSubImage2D(...)  glCompressedTexSubImage2DNative(__VA_ARGS__)
 #define glCompressedTexSubImage3D(...)  glCompressedTexSubImage3DNative(__VA_ARGS__)
+#define glMapBufferRange(...)           glMapBufferRangeNative(__VA_ARGS__)
+#define glUnmapBuffer(...)              glUnmapBufferNative(__VA_ARGS__)
+#define glFenceSync(...)                glFenceSyncNative(__VA_ARGS__)
+#define glClientWaitSync(...)           glClientWaitSyncNative(__VA_ARGS__)
+#define glDeleteSync(...)               glDeleteSyncNative(__VA_ARGS__)
 
 #define DECLARE_ALL_API_PROCS                                                                   \
 DECLARE_API_PROC(PFNGLGETSTRINGIPROC, glGetStringi);                                            \
@@ -192,6 +197,11 @@ DECLARE_API_PROC(PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
 DECLARE_API_PROC(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);                                      \
 DECLARE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);                  \
 DECLARE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);                  \
+DECLARE_API_PROC(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);                                    \
+DECLARE_API_PROC(PFNGLUNMAPBUFFERPROC, glUnmapBuffer);                                          \
+DECLARE_API_PROC(PFNGLFENCESYNCPROC, glFenceSync);                                              \
+DECLARE_API_PROC(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);                                    \
+DECLARE_API_PROC(PFNGLDELETESYNCPROC, glDeleteSync);                                            \
 
 #define LOAD_ALL_API_PROCS                                                                          \
 LOAD_API_PROC(m_context, PFNGLGETSTRINGIPROC, glGetStringi);                                        \
@@ -276,6 +286,11 @@ LOAD_API_PROC(m_context, PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
 LOAD_API_PROC(m_context, PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);                                  \
 LOAD_API_PROC(m_context, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);              \
 LOAD_API_PROC(m_context, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);              \
+LOAD_API_PROC(m_context, PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);                                \
+LOAD_API_PROC(m_context, PFNGLUNMAPBUFFERPROC, glUnmapBuffer);                                      \
+LOAD_API_PROC(m_context, PFNGLFENCESYNCPROC, glFenceSync);                                          \
+LOAD_API_PROC(m_context, PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);                                \
+LOAD_API_PROC(m_context, PFNGLDELETESYNCPROC, glDeleteSync);                                        \
 
 //In WGL (Windows), all api procs are static and need explicit definition in a source file
 #define DEFINE_ALL_API_PROCS                                                                   \
@@ -360,5 +375,10 @@ DEFINE_API_PROC(PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
 DEFINE_API_PROC(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);                                      \
 DEFINE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);                  \
 DEFINE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);                  \
+DEFINE_API_PROC(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);                                    \
+DEFINE_API_PROC(PFNGLUNMAPBUFFERPROC, glUnmapBuffer);                                          \
+DEFINE_API_PROC(PFNGLFENCESYNCPROC, glFenceSync);                                              \
+DEFINE_API_PROC(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);                                    \
+DEFINE_API_PROC(PFNGLDELETESYNCPROC, glDeleteSync);                                            \
 
 #endif
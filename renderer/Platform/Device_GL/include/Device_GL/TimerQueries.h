@@ -0,0 +1,57 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TIMERQUERIES_H
+#define RAMSES_TIMERQUERIES_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "Device_GL/Device_GL_platform.h"
+#include "Device_GL/Types_GL.h"
+
+namespace ramses_internal
+{
+    class IContext;
+
+    // GPU timestamp queries, provided by GL_EXT_disjoint_timer_query on ES and by core API (ARB_timer_query) on desktop GL
+    class TimerQueries
+    {
+    public:
+        Bool load(const IContext& context, Bool useExtensionProcs);
+        Bool isAvailable() const;
+
+        GLHandle queryTimestamp() const;
+        Bool isResultAvailable(GLHandle query) const;
+        // deletes query, returns false if result is not valid because GPU timer was disjoint
+        Bool getResultAndDelete(GLHandle query, UInt64& timestampNanoseconds) const;
+        // deletes query without waiting for its result
+        void deleteQuery(GLHandle query) const;
+
+    private:
+        Bool loadExtensionFunctionPointers(const IContext& context, Bool useExtensionProcs);
+
+#if defined(__linux__) || defined(__ghs__)
+        PFNGLGENQUERIESEXTPROC          glGenQueries = 0;
+        PFNGLDELETEQUERIESEXTPROC       glDeleteQueries = 0;
+        PFNGLQUERYCOUNTEREXTPROC        glQueryCounter = 0;
+        PFNGLGETQUERYIVEXTPROC          glGetQueryiv = 0;
+        PFNGLGETQUERYOBJECTUIVEXTPROC   glGetQueryObjectuiv = 0;
+        PFNGLGETQUERYOBJECTUI64VEXTPROC glGetQueryObjectui64v = 0;
+#else
+        PFNGLGENQUERIESPROC             glGenQueries = 0;
+        PFNGLDELETEQUERIESPROC          glDeleteQueries = 0;
+        PFNGLQUERYCOUNTERPROC           glQueryCounter = 0;
+        PFNGLGETQUERYIVPROC             glGetQueryiv = 0;
+        PFNGLGETQUERYOBJECTUIVPROC      glGetQueryObjectuiv = 0;
+        PFNGLGETQUERYOBJECTUI64VPROC    glGetQueryObjectui64v = 0;
+#endif
+        // only disjoint timer query extension can report that timer results became invalid
+        Bool m_canBeDisjoint = false;
+    };
+}
+
+#endif
@@ -38,6 +38,7 @@
 #include "Utils/LogMacros.h"
 #include "Utils/TextureMathUtils.h"
 #include "PlatformAbstraction/PlatformStringUtils.h"
+#include "PlatformAbstraction/PlatformMemory.h"
 
 #include "Platform_Base/GpuResource.h"
 #include "SceneAPI/TextureEnums.h"
@@ -67,6 +68,18 @@ namespace ramses_internal
         const GLTextureInfo m_textureInfo;
     };
 
+    // pixel buffer object receiving pixels read asynchronously, fence signals when read is finished
+    class ReadPixelsGPUResource_GL : public GPUResource
+    {
+    public:
+        ReadPixelsGPUResource_GL(UInt32 gpuAddress, UInt32 dataSizeInBytes, GLsync fence)
+            : GPUResource(gpuAddress, dataSizeInBytes)
+            , m_fence(fence)
+        {
+        }
+        const GLsync m_fence;
+    };
+
     Device_GL::Device_GL(IContext& context, UInt8 majorApiVersion, UInt8 minorApiVersion, bool isEmbedded)
         : Device_Base()
         , m_context(context)
@@ -1291,6 +1304,12 @@ namespace ramses_internal
         {
             LOG_WARN(CONTEXT_RENDERER, "Device_GL::loadExtensionDependentFeatures:  anisotropic filtering not available on this device");
         }
+
+        // timer queries are core since desktop GL 3.3, ES only provides them through extension
+        if (!m_isEmbedded || isApiExtensionAvailable("GL_EXT_disjoint_timer_query"))
+        {
+            m_timerQueries.load(m_context, m_isEmbedded);
+        }
     }
 
     void Device_GL::readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height)
@@ -1298,6 +1317,94 @@ namespace ramses_internal
         glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, static_cast<void*>(buffer));
     }
 
+    DeviceResourceHandle Device_GL::startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height)
+    {
+        const UInt32 dataSize = width * height * 4u;
+
+        GLHandle glAddress = InvalidGLHandle;
+        glGenBuffers(1, &glAddress);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, glAddress);
+        glBufferData(GL_PIXEL_PACK_BUFFER, dataSize, nullptr, GL_STREAM_READ);
+        // with pack buffer bound pixels are copied into the buffer without waiting for rendering to finish
+        glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        const GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        if (nullptr == fence)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::startReadPixels:  failed to create fence, pixels will be read synchronously");
+            glDeleteBuffers(1, &glAddress);
+            return DeviceResourceHandle::Invalid();
+        }
+
+        return m_resourceMapper.registerResource(*new ReadPixelsGPUResource_GL(glAddress, dataSize, fence));
+    }
+
+    Bool Device_GL::isReadPixelsFinished(DeviceResourceHandle readPixelsHandle)
+    {
+        const ReadPixelsGPUResource_GL& resource = m_resourceMapper.getResourceAs<ReadPixelsGPUResource_GL>(readPixelsHandle);
+        const GLenum syncStatus = glClientWaitSync(resource.m_fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0u);
+        return GL_ALREADY_SIGNALED == syncStatus || GL_CONDITION_SATISFIED == syncStatus;
+    }
+
+    Bool Device_GL::finishReadPixels(DeviceResourceHandle readPixelsHandle, UInt8* buffer)
+    {
+        const ReadPixelsGPUResource_GL& resource = m_resourceMapper.getResourceAs<ReadPixelsGPUResource_GL>(readPixelsHandle);
+        const GLHandle glAddress = resource.getGPUAddress();
+        const UInt32 dataSize = resource.getTotalSizeInBytes();
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, glAddress);
+        // maps without stall if read is finished, waits for it otherwise
+        const void* mappedData = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, dataSize, GL_MAP_READ_BIT);
+        const Bool success = (nullptr != mappedData);
+        if (success)
+        {
+            PlatformMemory::Copy(buffer, mappedData, dataSize);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        else
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::finishReadPixels:  failed to map pixel buffer");
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        glDeleteSync(resource.m_fence);
+        glDeleteBuffers(1, &glAddress);
+        m_resourceMapper.deleteResource(readPixelsHandle);
+
+        return success;
+    }
+
+    DeviceResourceHandle Device_GL::issueTimestampQuery()
+    {
+        if (!m_timerQueries.isAvailable())
+        {
+            return DeviceResourceHandle::Invalid();
+        }
+
+        const GLHandle query = m_timerQueries.queryTimestamp();
+        return m_resourceMapper.registerResource(*new GPUResource(query, 0u));
+    }
+
+    Bool Device_GL::isTimestampQueryResultAvailable(DeviceResourceHandle queryHandle)
+    {
+        return m_timerQueries.isResultAvailable(m_resourceMapper.getResource(queryHandle).getGPUAddress());
+    }
+
+    Bool Device_GL::getTimestampQueryResult(DeviceResourceHandle queryHandle, UInt64& timestampNanoseconds)
+    {
+        const GLHandle query = m_resourceMapper.getResource(queryHandle).getGPUAddress();
+        m_resourceMapper.deleteResource(queryHandle);
+        return m_timerQueries.getResultAndDelete(query, timestampNanoseconds);
+    }
+
+    void Device_GL::releaseTimestampQuery(DeviceResourceHandle queryHandle)
+    {
+        const GLHandle query = m_resourceMapper.getResource(queryHandle).getGPUAddress();
+        m_resourceMapper.deleteResource(queryHandle);
+        m_timerQueries.deleteQuery(query);
+    }
+
     UInt32 Device_GL::getTotalGpuMemoryUsageInKB() const
     {
         return m_resourceMapper.getTotalGpuMemoryUsageInKB();
@@ -0,0 +1,118 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Device_GL/TimerQueries.h"
+
+#include "RendererAPI/IContext.h"
+#include "Utils/LogMacros.h"
+
+namespace ramses_internal
+{
+#if defined(__linux__) || defined(__ghs__)
+    #define GL_TIMESTAMP                        GL_TIMESTAMP_EXT
+    #define GL_QUERY_COUNTER_BITS               GL_QUERY_COUNTER_BITS_EXT
+#endif
+
+#ifndef GL_GPU_DISJOINT_EXT
+    #define GL_GPU_DISJOINT_EXT                 0x8FBB
+#endif
+
+    Bool TimerQueries::loadExtensionFunctionPointers(const IContext& context, Bool useExtensionProcs)
+    {
+#if defined(__linux__) || defined(__ghs__)
+        assert(useExtensionProcs);
+        UNUSED(useExtensionProcs);
+        glGenQueries = reinterpret_cast<PFNGLGENQUERIESEXTPROC>(context.getProcAddress("glGenQueriesEXT"));
+        glDeleteQueries = reinterpret_cast<PFNGLDELETEQUERIESEXTPROC>(context.getProcAddress("glDeleteQueriesEXT"));
+        glQueryCounter = reinterpret_cast<PFNGLQUERYCOUNTEREXTPROC>(context.getProcAddress("glQueryCounterEXT"));
+        glGetQueryiv = reinterpret_cast<PFNGLGETQUERYIVEXTPROC>(context.getProcAddress("glGetQueryivEXT"));
+        glGetQueryObjectuiv = reinterpret_cast<PFNGLGETQUERYOBJECTUIVEXTPROC>(context.getProcAddress("glGetQueryObjectuivEXT"));
+        glGetQueryObjectui64v = reinterpret_cast<PFNGLGETQUERYOBJECTUI64VEXTPROC>(context.getProcAddress("glGetQueryObjectui64vEXT"));
+#else
+        // ES context on desktop platform provides same functions under extension names
+        glGenQueries = reinterpret_cast<PFNGLGENQUERIESPROC>(context.getProcAddress(useExtensionProcs ? "glGenQueriesEXT" : "glGenQueries"));
+        glDeleteQueries = reinterpret_cast<PFNGLDELETEQUERIESPROC>(context.getProcAddress(useExtensionProcs ? "glDeleteQueriesEXT" : "glDeleteQueries"));
+        glQueryCounter = reinterpret_cast<PFNGLQUERYCOUNTERPROC>(context.getProcAddress(useExtensionProcs ? "glQueryCounterEXT" : "glQueryCounter"));
+        glGetQueryiv = reinterpret_cast<PFNGLGETQUERYIVPROC>(context.getProcAddress(useExtensionProcs ? "glGetQueryivEXT" : "glGetQueryiv"));
+        glGetQueryObjectuiv = reinterpret_cast<PFNGLGETQUERYOBJECTUIVPROC>(context.getProcAddress(useExtensionProcs ? "glGetQueryObjectuivEXT" : "glGetQueryObjectuiv"));
+        glGetQueryObjectui64v = reinterpret_cast<PFNGLGETQUERYOBJECTUI64VPROC>(context.getProcAddress(useExtensionProcs ? "glGetQueryObjectui64vEXT" : "glGetQueryObjectui64v"));
+#endif
+
+        return isAvailable();
+    }
+
+    Bool TimerQueries::load(const IContext& context, Bool useExtensionProcs)
+    {
+        if (!loadExtensionFunctionPointers(context, useExtensionProcs))
+        {
+            LOG_INFO(CONTEXT_RENDERER, "TimerQueries::load:  could not load OpenGL timer query functions, GPU timer queries not available");
+            return false;
+        }
+
+        // implementation can support timer queries in general, but not timestamps
+        GLint timestampBits = 0;
+        glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &timestampBits);
+        if (timestampBits <= 0)
+        {
+            LOG_INFO(CONTEXT_RENDERER, "TimerQueries::load:  GPU timestamp queries not supported by device");
+            glGenQueries = 0;
+            return false;
+        }
+
+        m_canBeDisjoint = useExtensionProcs;
+        if (m_canBeDisjoint)
+        {
+            // reset disjoint state before first query is issued
+            GLint disjoint = 0;
+            glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+        }
+
+        return true;
+    }
+
+    Bool TimerQueries::isAvailable() const
+    {
+        return glGenQueries && glDeleteQueries && glQueryCounter && glGetQueryiv && glGetQueryObjectuiv && glGetQueryObjectui64v;
+    }
+
+    GLHandle TimerQueries::queryTimestamp() const
+    {
+        GLHandle query = InvalidGLHandle;
+        glGenQueries(1, &query);
+        glQueryCounter(query, GL_TIMESTAMP);
+        return query;
+    }
+
+    Bool TimerQueries::isResultAvailable(GLHandle query) const
+    {
+        GLuint available = GL_FALSE;
+        glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+        return available != GL_FALSE;
+    }
+
+    Bool TimerQueries::getResultAndDelete(GLHandle query, UInt64& timestampNanoseconds) const
+    {
+        GLuint64 result = 0u;
+        glGetQueryObjectui64v(query, GL_QUERY_RESULT, &result);
+        glDeleteQueries(1, &query);
+        timestampNanoseconds = result;
+
+        if (m_canBeDisjoint)
+        {
+            GLint disjoint = 0;
+            glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+            return disjoint == 0;
+        }
+        return true;
+    }
+
+    void TimerQueries::deleteQuery(GLHandle query) const
+    {
+        glDeleteQueries(1, &query);
+    }
+}
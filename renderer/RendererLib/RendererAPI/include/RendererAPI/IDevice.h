@@ -133,6 +133,18 @@ namespace ramses_internal
 
         // read back data, statistics, info
         virtual void readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height) = 0;
+        // asynchronous read of currently active render target, returns invalid handle if not supported by device,
+        // finishing waits for the read if not finished yet and releases the handle
+        virtual DeviceResourceHandle    startReadPixels             (UInt32 x, UInt32 y, UInt32 width, UInt32 height) = 0;
+        virtual Bool                    isReadPixelsFinished        (DeviceResourceHandle readPixelsHandle) = 0;
+        virtual Bool                    finishReadPixels            (DeviceResourceHandle readPixelsHandle, UInt8* buffer) = 0;
+        // GPU timestamp taken when all previously issued commands are executed, returns invalid handle if not supported by device,
+        // getting the result waits for it if not available yet and releases the handle, returns false if result is not valid,
+        // releasing the handle without getting the result does not wait
+        virtual DeviceResourceHandle    issueTimestampQuery         () = 0;
+        virtual Bool                    isTimestampQueryResultAvailable(DeviceResourceHandle queryHandle) = 0;
+        virtual Bool                    getTimestampQueryResult     (DeviceResourceHandle queryHandle, UInt64& timestampNanoseconds) = 0;
+        virtual void                    releaseTimestampQuery       (DeviceResourceHandle queryHandle) = 0;
 
         virtual UInt32  getTotalGpuMemoryUsageInKB() const = 0;
         virtual UInt32  getDrawCallCount() const = 0;
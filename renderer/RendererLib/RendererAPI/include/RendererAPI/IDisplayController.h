@@ -24,6 +24,7 @@ namespace ramses_internal
     class WarpingMeshData;
     class ProjectionParams;
     class FrameTimer;
+    class RendererStatistics;
 
     class IDisplayController
     {
@@ -54,8 +55,15 @@ namespace ramses_internal
         virtual void                    resetView() const = 0;
 
         virtual Bool                    readPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height, std::vector<UInt8>& dataOut) = 0;
+        // returns invalid handle if pixels cannot be read asynchronously, readPixels has to be used then
+        virtual DeviceResourceHandle    startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height) = 0;
+        virtual Bool                    isReadPixelsFinished(DeviceResourceHandle readPixelsHandle) = 0;
+        virtual Bool                    finishReadPixels(DeviceResourceHandle readPixelsHandle, UInt32 width, UInt32 height, std::vector<UInt8>& dataOut) = 0;
         virtual Bool                    isWarpingEnabled() const = 0;
         virtual void                    setWarpingMeshData(const WarpingMeshData& warpingMeshData) = 0;
+        // GPU time of rendered scenes and their render passes is measured while enabled, results are reported when available
+        virtual void                    enableGpuTimerQueries(Bool enable) = 0;
+        virtual void                    collectGpuTimerQueryResults(RendererStatistics& stats) = 0;
 
         virtual void                    validateRenderingStatusHealthy() const = 0;
     };
@@ -28,9 +28,15 @@ namespace ramses_internal
     enum EPostProcessingEffect
     {
         EPostProcessingEffect_None = 0,
-        EPostProcessingEffect_Warping = BIT(0)
+        EPostProcessingEffect_Warping = BIT(0),
+        EPostProcessingEffect_ColorCorrection = BIT(1),
+        EPostProcessingEffect_Downscale = BIT(2)
     };
 
+    // color correction lookup table has one RGBA8 entry per channel value
+    static const UInt32 ColorCorrectionLookupTableEntryCount = 256u;
+    static const UInt32 ColorCorrectionLookupTableSizeInBytes = ColorCorrectionLookupTableEntryCount * 4u;
+
     struct DisplayHandleTag {};
     typedef TypedMemoryHandle<DisplayHandleTag> DisplayHandle;
     typedef std::vector<DisplayHandle> DisplayHandleVector;
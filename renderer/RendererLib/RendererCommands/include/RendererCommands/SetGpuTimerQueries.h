@@ -0,0 +1,29 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SETGPUTIMERQUERIES_H
+#define RAMSES_SETGPUTIMERQUERIES_H
+
+#include "Ramsh/RamshCommandArguments.h"
+
+namespace ramses_internal
+{
+    class RendererCommandBuffer;
+
+    class SetGpuTimerQueries : public RamshCommandArgs<UInt32>
+    {
+    public:
+        explicit SetGpuTimerQueries(RendererCommandBuffer& rendererCommandBuffer);
+        virtual Bool execute(UInt32& enableQueries) const override;
+
+    private:
+        RendererCommandBuffer& m_rendererCommandBuffer;
+    };
+}
+
+#endif
@@ -0,0 +1,98 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererCommands/CaptureFrames.h"
+#include "RendererLib/RendererCommandBuffer.h"
+
+namespace ramses_internal
+{
+    CaptureFrames::CaptureFrames(RendererCommandBuffer& rendererCommandBuffer)
+        : m_rendererCommandBuffer(rendererCommandBuffer)
+    {
+        description = "stream raw RGBA frames of display to file or named pipe [-displayId id] [-filename name] [-fps rate (0 = every frame)] [-stop]";
+        registerKeyword("capture");
+    }
+
+    Bool CaptureFrames::executeInput(const RamshInput& input)
+    {
+        enum EOption
+        {
+            EOption_None = 0,
+            EOption_Filename,
+            EOption_Display,
+            EOption_FramesPerSecond
+        };
+
+        EOption lastOption = EOption_None;
+
+        String              filename = "frames.rgba";
+        DisplayHandle       display = DisplayHandle(0);
+        Float               framesPerSecond = 0.f;
+        Bool                stop = false;
+
+        const UInt32 numArgs = static_cast<UInt32>(input.size());
+        for (UInt argStrIdx = 0u; argStrIdx < numArgs; ++argStrIdx)
+        {
+            const String argStr(input[argStrIdx]);
+
+            if (argStr == String("-filename"))
+            {
+                lastOption = EOption_Filename;
+            }
+            else if (argStr == String("-displayId"))
+            {
+                lastOption = EOption_Display;
+            }
+            else if (argStr == String("-fps"))
+            {
+                lastOption = EOption_FramesPerSecond;
+            }
+            else if (argStr == String("-stop"))
+            {
+                stop = true;
+            }
+            else
+            {
+                switch (lastOption)
+                {
+                case EOption_Display:
+                    display    = DisplayHandle(atoi(argStr.c_str()));
+                    lastOption = EOption_None;
+                    break;
+                case EOption_Filename:
+                    filename   = argStr;
+                    lastOption = EOption_None;
+                    break;
+                case EOption_FramesPerSecond:
+                    framesPerSecond = static_cast<Float>(atof(argStr.c_str()));
+                    lastOption = EOption_None;
+                    if (framesPerSecond < 0.f)
+                        return false;
+                    break;
+
+                case EOption_None:
+                    if (contains_c(m_keywords, argStr)) // check whether a keyword is the current argument
+                    {
+                        continue;
+                    }
+                    return false;
+
+                default:
+                    return false;
+                }
+            }
+        }
+
+        if (stop)
+            m_rendererCommandBuffer.stopFrameCapture(display);
+        else
+            m_rendererCommandBuffer.startFrameCapture(display, filename, framesPerSecond);
+
+        return true;
+    }
+}
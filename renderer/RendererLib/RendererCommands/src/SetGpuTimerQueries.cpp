@@ -0,0 +1,27 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererCommands/SetGpuTimerQueries.h"
+#include "RendererLib/RendererCommandBuffer.h"
+
+
+using namespace ramses_internal;
+
+SetGpuTimerQueries::SetGpuTimerQueries(RendererCommandBuffer& rendererCommandBuffer)
+: m_rendererCommandBuffer(rendererCommandBuffer)
+{
+    description = "measure GPU time of scenes and render passes, reported in renderer statistics";
+    registerKeyword("gpuTimerQueries");
+    getArgument<0>().setDescription("enable GPU timer queries (0: off, 1: enable)");
+}
+
+Bool SetGpuTimerQueries::execute(UInt32& enableQueries) const
+{
+    m_rendererCommandBuffer.setGpuTimerQueries( enableQueries > 0u );
+    return true;
+}
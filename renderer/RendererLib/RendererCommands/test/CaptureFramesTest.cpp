@@ -0,0 +1,87 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include "RendererCommands/CaptureFrames.h"
+#include "RendererLib/RendererCommandBuffer.h"
+
+using namespace ramses_internal;
+using namespace ::testing;
+
+class ACaptureFramesCommand : public ::testing::Test
+{
+public:
+    ACaptureFramesCommand()
+        : m_cmd(m_rendererCommandBuffer)
+    {
+        m_rendererCommandBuffer.clear();
+    }
+
+protected:
+    void expectCaptureCommand(ERendererCommand commandType, DisplayHandle displayHandle, const String& filename = String(), Float framesPerSecond = 0.f)
+    {
+        const RendererCommandContainer& commands = m_rendererCommandBuffer.getCommands();
+        ASSERT_EQ(1u, commands.getTotalCommandCount());
+        EXPECT_EQ(commandType, commands.getCommandType(0u));
+        const FrameCaptureCommand& command = commands.getCommandData<FrameCaptureCommand>(0u);
+        EXPECT_EQ(displayHandle, command.displayHandle);
+        EXPECT_EQ(filename, command.filename);
+        EXPECT_FLOAT_EQ(framesPerSecond, command.framesPerSecond);
+    }
+
+    RendererCommandBuffer m_rendererCommandBuffer;
+    CaptureFrames         m_cmd;
+};
+
+TEST_F(ACaptureFramesCommand, startsCaptureOfEveryFrameWithDefaultsIfNoArgsDefined)
+{
+    RamshInput args;
+
+    EXPECT_TRUE(m_cmd.executeInput(args));
+    expectCaptureCommand(ERendererCommand_StartFrameCapture, DisplayHandle(0u), "frames.rgba", 0.f);
+}
+
+TEST_F(ACaptureFramesCommand, startsCaptureWithGivenArguments)
+{
+    RamshInput args;
+    args.append("-displayId");
+    args.append("3");
+    args.append("-filename");
+    args.append("/tmp/framesPipe");
+    args.append("-fps");
+    args.append("30");
+
+    EXPECT_TRUE(m_cmd.executeInput(args));
+    expectCaptureCommand(ERendererCommand_StartFrameCapture, DisplayHandle(3u), "/tmp/framesPipe", 30.f);
+}
+
+TEST_F(ACaptureFramesCommand, stopsCapture)
+{
+    RamshInput args;
+    args.append("-displayId");
+    args.append("2");
+    args.append("-stop");
+
+    EXPECT_TRUE(m_cmd.executeInput(args));
+    expectCaptureCommand(ERendererCommand_StopFrameCapture, DisplayHandle(2u));
+}
+
+TEST_F(ACaptureFramesCommand, brokenArgumentsAreNotExecuted)
+{
+    RamshInput argsWithoutOption;
+    argsWithoutOption.append("foo");
+
+    RamshInput argsWithNegativeRate;
+    argsWithNegativeRate.append("-fps");
+    argsWithNegativeRate.append("-5");
+
+    EXPECT_FALSE(m_cmd.executeInput(argsWithoutOption));
+    EXPECT_FALSE(m_cmd.executeInput(argsWithNegativeRate));
+    EXPECT_EQ(0u, m_rendererCommandBuffer.getCommands().getTotalCommandCount());
+}
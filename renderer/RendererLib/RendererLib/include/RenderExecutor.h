@@ -18,11 +18,12 @@ namespace ramses_internal
     class IDevice;
     class RendererLogContext;
     class FrameTimer;
+    class GpuTimerQueries;
 
     class RenderExecutor
     {
     public:
-        RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr);
+        RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr, GpuTimerQueries* gpuTimerQueries = nullptr);
 
         SceneRenderExecutionIterator executeScene(const RendererCachedScene& scene, const Matrix44f& rendererViewMatrix) const;
 
@@ -52,6 +53,8 @@ namespace ramses_internal
     private:
         Bool executeRenderPass(const RendererCachedScene& scene, const RenderPassHandle pass) const;
         void executeBlitPass(const RendererCachedScene& scene, const BlitPassHandle pass) const;
+
+        GpuTimerQueries* const m_gpuTimerQueries;
     };
 
 }
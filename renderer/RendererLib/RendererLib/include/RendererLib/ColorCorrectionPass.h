@@ -0,0 +1,49 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_COLORCORRECTIONPASS_H
+#define RAMSES_COLORCORRECTIONPASS_H
+
+#include "RendererAPI/IDevice.h"
+#include "RendererLib/PostprocessingPass.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    // Maps every color channel of source through a lookup table with 256 RGBA8 entries (see ColorCorrectionLookupTableSizeInBytes),
+    // red/green/blue channel of an entry is used as output for respective input channel, alpha is kept
+    class ColorCorrectionPass : public PostprocessingPass
+    {
+    public:
+        explicit ColorCorrectionPass(IDevice& device);
+        virtual ~ColorCorrectionPass();
+
+        void setLookupTable(const std::vector<UInt8>& lookupTable);
+        virtual void execute(DeviceResourceHandle sourceColorBuffer) override;
+
+    private:
+        void initEffect();
+        void initGeometry();
+
+        IDevice& m_device;
+
+        UInt32 m_indexCount;
+        DeviceResourceHandle m_shaderResource;
+        DeviceResourceHandle m_vertexBufferResource;
+        DeviceResourceHandle m_texcoordBufferResource;
+        DeviceResourceHandle m_indexBufferResource;
+        DeviceResourceHandle m_lookupTableTexture;
+
+        DataFieldHandle m_vertexPositionField;
+        DataFieldHandle m_texcoordField;
+        DataFieldHandle m_inputRenderBufferField;
+        DataFieldHandle m_lookupTableField;
+    };
+}
+
+#endif
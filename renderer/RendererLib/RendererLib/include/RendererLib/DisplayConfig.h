@@ -12,6 +12,7 @@
 #include "RendererAPI/Types.h"
 #include "Math3d/Vector3.h"
 #include "Math3d/CameraMatrixHelper.h"
+#include <vector>
 
 namespace ramses_internal
 {
@@ -74,6 +75,13 @@ namespace ramses_internal
         Bool isWarpingEnabled() const;
         void setWarpingEnabled(Bool enabled);
 
+        // empty lookup table disables color correction
+        const std::vector<UInt8>& getColorCorrectionLookupTable() const;
+        void setColorCorrectionLookupTable(const std::vector<UInt8>& lookupTable);
+
+        Bool isDownscaleEnabled() const;
+        void setDownscaleEnabled(Bool enabled);
+
         Bool getKeepEffectsUploaded() const;
         void setKeepEffectsUploaded(Bool enable);
 
@@ -99,6 +107,7 @@ namespace ramses_internal
         Bool m_fullscreen = false;
         Bool m_borderless = false;
         Bool m_warpingEnabled = false;
+        Bool m_downscaleEnabled = false;
         Bool m_resizable = false;
         Bool m_stereoDisplay = false;
 
@@ -125,6 +134,7 @@ namespace ramses_internal
         Vector4 m_clearColor{ 0.f, 0.f, 0.f, 1.0f };
 
         Bool m_offscreen = false;
+        std::vector<UInt8> m_colorCorrectionLookupTable;
     };
 }
 
@@ -13,6 +13,7 @@
 #include "Math3d/Vector3.h"
 #include "Math3d/CameraMatrixHelper.h"
 #include "RendererLib/Postprocessing.h"
+#include "RendererLib/GpuTimerQueries.h"
 #include "EmbeddedCompositingManager.h"
 #include <memory>
 
@@ -57,11 +58,21 @@ namespace ramses_internal
         virtual void                    resetView() const override;
 
         virtual Bool                    readPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height, std::vector<UInt8>& dataOut) override;
+        virtual DeviceResourceHandle    startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual Bool                    isReadPixelsFinished(DeviceResourceHandle readPixelsHandle) override;
+        virtual Bool                    finishReadPixels(DeviceResourceHandle readPixelsHandle, UInt32 width, UInt32 height, std::vector<UInt8>& dataOut) override;
         virtual Bool                    isWarpingEnabled() const override;
         virtual void                    setWarpingMeshData(const WarpingMeshData& warpingMeshData) override;
+        void                            setColorCorrectionLookupTable(const std::vector<UInt8>& lookupTable);
+        virtual void                    enableGpuTimerQueries(Bool enable) override;
+        virtual void                    collectGpuTimerQueryResults(RendererStatistics& stats) override;
 
         virtual void validateRenderingStatusHealthy() const override;
 
+    protected:
+        // null if GPU timer queries are not enabled
+        GpuTimerQueries*        getGpuTimerQueries();
+
     private:
         void updateViewMatrix();
 
@@ -78,6 +89,7 @@ namespace ramses_internal
         const UInt32            m_displayHeight;
 
         std::unique_ptr<Postprocessing> m_postProcessing;
+        std::unique_ptr<GpuTimerQueries> m_gpuTimerQueries;
     };
 }
 
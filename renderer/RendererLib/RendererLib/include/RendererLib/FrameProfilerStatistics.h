@@ -106,10 +106,35 @@ namespace ramses_internal
         void writeLongestFrameTimingsToStream(StringOutputStream& str) const;
         void resetFrameTimings();
 
+        /* Additionally to the overlay data all region times and the total frame time (all regions except MaxFramerateSleep)
+           are aggregated into fixed bucket histograms, independently of whether the overlay is shown or not.
+           Histograms are reset together with frame timings, i.e. they cover the same period as the periodic log.
+
+           Buckets are log-linear: exact values below 8us and 8 buckets per power of two above,
+           resulting in max. relative error of 12.5% for any reported percentile.
+        */
+        static const UInt NumberOfHistogramBuckets = 8u * 23u;
+        using Histogram = std::vector<UInt32>;
+
+        // returns upper bound of histogram bucket containing given percentile (0-100) of region times in microseconds
+        UInt32 getRegionTimePercentile(ERegion region, Float percentile) const;
+        UInt32 getFrameTimePercentile(Float percentile) const;
+        UInt32 getNumberOfFramesInHistograms() const;
+        const Histogram& getRegionTimeHistogram(ERegion region) const;
+        const Histogram& getFrameTimeHistogram() const;
+
+        void writeTimePercentilesToStream(StringOutputStream& str) const;
+        void writeTimeHistogramsToStream(StringOutputStream& str) const;
+
+        static UInt GetHistogramBucket(UInt timeInMicroseconds);
+        static UInt GetHistogramBucketUpperBound(UInt bucket);
+
     private:
         UInt getEntryIdForCurrentRegion() const;
         void initNextFrameTimings();
         void setSleepTimeForLastFrame(std::chrono::microseconds sleepTime);
+        void addToHistogram(UInt histogramId, UInt timeInMicroseconds);
+        UInt32 getPercentile(UInt histogramId, Float percentile) const;
 
         using RegionTimes = std::vector<UInt64>;
         RegionTimes m_regionStartTimes;
@@ -129,6 +154,12 @@ namespace ramses_internal
         UInt m_currentRegionId;
 
         UInt32 m_filteredRegionFlags = ~0u;
+
+        // one histogram per region plus one for total frame time (last)
+        std::vector<Histogram> m_histograms;
+        std::vector<UInt> m_histogramMaxTimes;
+        UInt m_currentFrameTime = 0u;
+        UInt32 m_numFramesInHistograms = 0u;
     };
 
     class ScopedFrameProfilerRegion
@@ -0,0 +1,66 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FRAMESTREAMWRITER_H
+#define RAMSES_FRAMESTREAMWRITER_H
+
+#include "Collections/String.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include "PlatformAbstraction/PlatformConditionVariable.h"
+#include "PlatformAbstraction/PlatformGuard.h"
+#include <deque>
+
+namespace ramses_internal
+{
+    // Appends captured frames as raw RGBA8 pixel data with rows ordered top-down to a file,
+    // which can also be a named pipe. File is opened and written on a worker thread, so that
+    // rendering is not blocked by a slow or not yet connected consumer. Named pipe is opened
+    // only once a reader connected, waiting for it is stopped by finish().
+    class FrameStreamWriter : public Runnable
+    {
+    public:
+        FrameStreamWriter(const String& filename, UInt32 frameWidth, UInt32 frameHeight);
+        // writes all frames still queued before returning, i.e. blocks as long as a connected named pipe reader does not read,
+        // frames are discarded if named pipe has no reader
+        ~FrameStreamWriter();
+
+        // pixel data as read from framebuffer (rows bottom-up), returns false and drops frame if writer cannot keep up or is finishing
+        Bool writeFrame(std::vector<UInt8>&& pixelData);
+        void waitUntilAllFramesWritten();
+        // frames still queued are written and file is closed afterwards without waiting for it, no more frames are accepted,
+        // stops waiting for a named pipe reader
+        void finish();
+        Bool isFinished() const;
+
+        UInt32 getFrameWidth() const;
+        UInt32 getFrameHeight() const;
+
+        static const UInt32 MaximumQueuedFrames = 2u;
+        static const UInt32 NamedPipeReaderPollingPeriod = 10u;
+
+    private:
+        virtual void run() override;
+        Bool waitForNamedPipeReader(Int& readerProbe);
+        static void closeNamedPipeReaderProbe(Int readerProbe);
+
+        const String              m_filename;
+        const UInt32              m_frameWidth;
+        const UInt32              m_frameHeight;
+
+        PlatformThread            m_thread;
+        mutable PlatformLightweightLock m_lock;
+        PlatformConditionVariable m_frameQueuedCondVar;
+        PlatformConditionVariable m_frameWrittenCondVar;
+        std::deque<std::vector<UInt8>> m_frameQueue;
+        Bool                      m_writingFrame = false;
+        Bool                      m_finishRequested = false;
+        Bool                      m_finished = false;
+    };
+}
+
+#endif
@@ -0,0 +1,69 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_GPUTIMERQUERIES_H
+#define RAMSES_GPUTIMERQUERIES_H
+
+#include "RendererAPI/Types.h"
+#include "SceneAPI/SceneId.h"
+#include "SceneAPI/Handles.h"
+#include <deque>
+
+namespace ramses_internal
+{
+    class IDevice;
+    class RendererStatistics;
+
+    // Measures GPU time of scenes and render passes using device timestamp queries.
+    // Results are collected in later frames once available, so that rendering never waits for the GPU.
+    class GpuTimerQueries
+    {
+    public:
+        explicit GpuTimerQueries(IDevice& device);
+        // releases queries of measurements still pending without waiting for their results
+        ~GpuTimerQueries();
+
+        void beginScene(SceneId sceneId);
+        void endScene();
+        void beginRenderPass(RenderPassHandle renderPass);
+        void endRenderPass();
+
+        // reports results of finished measurements in order they were issued, stops at first result not available yet,
+        // invalid result (GPU timer was disjoint) discards all pending measurements as none of them can be trusted
+        void collectResults(RendererStatistics& stats);
+
+        UInt32 getNumPendingMeasurements() const;
+        Bool isSupported() const;
+
+        // measurements are skipped if GPU is that many measurements behind
+        static const UInt32 MaximumPendingMeasurements = 256u;
+
+    private:
+        struct Measurement
+        {
+            SceneId sceneId;
+            RenderPassHandle renderPass;
+            DeviceResourceHandle beginQuery;
+            DeviceResourceHandle endQuery;
+        };
+
+        DeviceResourceHandle beginMeasurement();
+        void endMeasurement(Measurement& measurement);
+        Bool getDurationAndRelease(const Measurement& measurement, UInt32& microseconds);
+        void releasePendingMeasurements();
+
+        IDevice& m_device;
+        Bool m_supported = true;
+
+        Measurement m_sceneMeasurement;
+        Measurement m_renderPassMeasurement;
+        std::deque<Measurement> m_pendingMeasurements;
+    };
+}
+
+#endif
@@ -92,6 +92,13 @@ namespace ramses_internal
         virtual void                    swapDoubleBufferedRenderTarget(DeviceResourceHandle renderTarget) override;
 
         virtual void readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual DeviceResourceHandle    startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual Bool                    isReadPixelsFinished(DeviceResourceHandle readPixelsHandle) override;
+        virtual Bool                    finishReadPixels(DeviceResourceHandle readPixelsHandle, UInt8* buffer) override;
+        virtual DeviceResourceHandle    issueTimestampQuery() override;
+        virtual Bool                    isTimestampQueryResultAvailable(DeviceResourceHandle queryHandle) override;
+        virtual Bool                    getTimestampQueryResult(DeviceResourceHandle queryHandle, UInt64& timestampNanoseconds) override;
+        virtual void                    releaseTimestampQuery(DeviceResourceHandle queryHandle) override;
 
         virtual UInt32 getTotalGpuMemoryUsageInKB() const override;
         virtual UInt32 getDrawCallCount() const override;
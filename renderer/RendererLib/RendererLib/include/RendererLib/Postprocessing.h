@@ -11,13 +11,20 @@
 
 #include "SceneAPI/Handles.h"
 #include "RendererAPI/Types.h"
+#include <memory>
+#include <vector>
 
 namespace ramses_internal
 {
     class IDevice;
-    class WarpingPass;
+    class PostprocessingPass;
+    class ColorCorrectionPass;
     class WarpingMeshData;
 
+    // Executes enabled effects as chain of passes in fixed order downscale -> color correction -> warping,
+    // last pass renders to framebuffer. If downscale is the only effect, an extra copy pass scales its half size
+    // output back to display size. Intermediate render targets are pooled and reused across frames.
+    // If no effect is enabled, scenes are rendered directly to framebuffer and chain is bypassed.
     class Postprocessing
     {
     public:
@@ -32,8 +39,32 @@ namespace ramses_internal
         DeviceResourceHandle getFramebuffer() const;
 
         void setWarpingMeshData(const WarpingMeshData& warpingMeshData);
+        // RGBA8 entries, see ColorCorrectionPass
+        void setColorCorrectionLookupTable(const std::vector<UInt8>& lookupTable);
+
+        UInt32 getIntermediateTargetPoolSize() const;
 
     private:
+        struct ChainedPass
+        {
+            std::unique_ptr<PostprocessingPass> pass;
+            UInt32 outputWidth;
+            UInt32 outputHeight;
+        };
+
+        struct IntermediateTarget
+        {
+            UInt32 width;
+            UInt32 height;
+            DeviceResourceHandle colorBuffer;
+            DeviceResourceHandle renderTarget;
+            Bool inUse;
+        };
+
+        void addPass(PostprocessingPass* pass, UInt32 outputWidth, UInt32 outputHeight);
+        // returns index to pool
+        UInt acquireIntermediateTarget(UInt32 width, UInt32 height);
+
         const UInt32            m_postEffectsMask;
         IDevice&                m_device;
 
@@ -46,7 +77,10 @@ namespace ramses_internal
 
         const DeviceResourceHandle m_framebuffer;
 
-        WarpingPass* m_warpingPass;
+        std::vector<ChainedPass>        m_passes;
+        std::vector<IntermediateTarget> m_intermediateTargetPool;
+        ColorCorrectionPass*            m_colorCorrectionPass;
+        UInt                            m_warpingPassIndex;
     };
 }
 
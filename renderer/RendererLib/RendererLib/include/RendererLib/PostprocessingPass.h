@@ -0,0 +1,26 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_POSTPROCESSINGPASS_H
+#define RAMSES_POSTPROCESSINGPASS_H
+
+#include "SceneAPI/Handles.h"
+
+namespace ramses_internal
+{
+    // Single step of postprocessing chain, renders content of source color buffer into currently active render target
+    class PostprocessingPass
+    {
+    public:
+        virtual ~PostprocessingPass() {}
+
+        virtual void execute(DeviceResourceHandle sourceColorBuffer) = 0;
+    };
+}
+
+#endif
@@ -17,11 +17,14 @@
 #include "RendererLib/DisplayEventHandlerManager.h"
 #include "RendererLib/RendererInterruptState.h"
 #include "RendererLib/DisplaySetup.h"
+#include "RendererLib/FrameStreamWriter.h"
 #include "FrameProfileRenderer.h"
 #include "MemoryStatistics.h"
 #include "Collections/Vector.h"
 #include "Collections/HashMap.h"
 #include <map>
+#include <deque>
+#include <memory>
 
 namespace ramses_internal
 {
@@ -62,6 +65,7 @@ namespace ramses_internal
 
         void                        markBufferWithMappedSceneAsModified(SceneId sceneId);
         void                        setSkippingOfUnmodifiedBuffers(Bool enable);
+        void                        setGpuTimerQueriesEnabled(Bool enable);
 
         virtual void                createDisplayContext(const DisplayConfig& displayConfig, DisplayHandle display);
         virtual void                destroyDisplayContext(DisplayHandle display);
@@ -76,6 +80,11 @@ namespace ramses_internal
         void                        setClearColor(DisplayHandle displayHandle, const Vector4& clearColor);
         void                        scheduleScreenshot(const ScreenshotInfo& screenshot);
         void                        dispatchProcessedScreenshots(ScreenshotInfoVector& screenshots);
+        // framesPerSecond 0 captures every rendered frame, captured frames are still written after stopping a capture
+        // without waiting for it, since writing to a named pipe blocks until its consumer connects
+        void                        startFrameCapture(DisplayHandle display, const String& filename, Float framesPerSecond);
+        void                        stopFrameCapture(DisplayHandle display);
+        Bool                        isCapturingFrames(DisplayHandle display) const;
 
         Bool                        hasAnyBufferWithInterruptedRendering() const;
         void                        resetRenderInterruptState();
@@ -112,18 +121,59 @@ namespace ramses_internal
         void renderToInterruptibleOffscreenBuffers(DisplayHandle displayHandle, DisplayHandle& activeDisplay, Bool& interrupted);
         IDisplayController* createDisplayControllerFromConfig(const DisplayConfig& config, DisplayEventHandler& displayEventHandler);
         void processScheduledScreenshots(DisplayHandle display, IDisplayController& controller, DisplayHandle& activeDisplay);
+        void processPendingScreenshots(DisplayHandle display, DisplayHandle& activeDisplay);
+        void updateFrameCaptureSchedule(DisplayHandle display);
+        void captureFrame(DisplayHandle display, IDisplayController& controller);
+        void processPendingFrameCaptures(DisplayHandle display, DisplayHandle& activeDisplay);
+        void processGpuTimerQueries(DisplayHandle display, DisplayHandle& activeDisplay);
         Bool hasAnyOffscreenBufferToRerender(DisplayHandle display, Bool interruptible) const;
         void onSceneWasRendered(const RendererCachedScene& scene);
 
         static void ActivateDisplayContext(DisplayHandle displayToActivate, DisplayHandle& activeDisplay, IDisplayController& dispController);
         static void ReorderDisplaysToStartWith(std::vector<DisplayHandle>& displays, DisplayHandle displayToStartWith);
 
+        // screenshot whose pixels are being read asynchronously
+        struct PendingScreenshot
+        {
+            ScreenshotInfo       screenshot;
+            DeviceResourceHandle readPixelsHandle;
+        };
+        using PendingScreenshots = std::vector<PendingScreenshot>;
+
+        // display size at read start, display might be resized until read is finished
+        struct PendingFrameCaptureRead
+        {
+            DeviceResourceHandle readPixelsHandle;
+            UInt32               width;
+            UInt32               height;
+        };
+
+        // framebuffer content streamed continuously to file or pipe, up to two frames are read asynchronously at a time
+        struct FrameCapture
+        {
+            std::unique_ptr<FrameStreamWriter> writer;
+            UInt64                           captureIntervalMicroseconds = 0u;
+            UInt64                           nextCaptureTimeMicroseconds = 0u;
+            Bool                             captureThisFrame = false;
+            std::deque<PendingFrameCaptureRead> pendingReads;
+            UInt                             numFramesCaptured = 0u;
+            UInt                             numFramesDropped = 0u;
+        };
+        static const UInt MaximumPendingFrameCaptureReads = 2u;
+
+        void writeCapturedFrame(DisplayHandle display, FrameCapture& capture, UInt32 width, UInt32 height, std::vector<UInt8>&& pixelData);
+        void destroyFinishedFrameStreamWriters();
+        void dropCapturedFrames(DisplayHandle display, FrameCapture& capture, UInt numDroppedFrames);
+
         struct DisplayInfo
         {
             IDisplayController*  displayController;
             Bool                 couldRenderLastFrame;
             DeviceResourceHandle frameBufferDeviceHandle;
             DisplaySetup         buffersSetup;
+            PendingScreenshots   pendingScreenshots;
+            FrameCapture         frameCapture;
+            Bool                 gpuTimerQueriesEnabled = false;
         };
         using Displays = std::map<DisplayHandle, DisplayInfo>;
 
@@ -141,10 +191,14 @@ namespace ramses_internal
         MemoryStatistics                       m_memoryStatistics;
 
         Bool                                   m_skipUnmodifiedBuffers = true;
+        Bool                                   m_gpuTimerQueriesEnabled = false;
         RendererInterruptState                 m_rendererInterruptState;
         const FrameTimer&                      m_frameTimer;
         SceneExpirationMonitor&                        m_expirationMonitor;
 
+        // writers of stopped frame captures still writing queued frames, destroyed when finished
+        std::vector<std::unique_ptr<FrameStreamWriter>> m_finishingFrameStreamWriters;
+
         HashMap<DisplayHandle, ScreenshotInfoVector> m_scheduledScreenshots;
         ScreenshotInfoVector m_processedScreenshots;
 
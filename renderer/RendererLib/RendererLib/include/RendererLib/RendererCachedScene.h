@@ -29,6 +29,7 @@ namespace ramses_internal
         void markAllRenderOncePassesAsRendered() const;
 
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, Bool visible) override;
+        virtual void                        setRenderableBoundingSphere     (RenderableHandle renderableHandle, const Vector4& boundingSphere) override;
 
         virtual void                        releaseRenderGroup              (RenderGroupHandle groupHandle) override;
         virtual void                        addRenderableToRenderGroup      (RenderGroupHandle groupHandle, RenderableHandle renderableHandle, Int32 order) override;
@@ -49,15 +50,54 @@ namespace ramses_internal
         virtual void                        setBlitPassRenderOrder(BlitPassHandle passHandle, Int32 renderOrder) override;
         virtual void                        setBlitPassEnabled(BlitPassHandle passHandle, Bool isEnabled) override;
 
+        virtual void                        setDataFloatArray               (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Float* data) override;
+        virtual void                        setDataVector2fArray            (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector2* data) override;
+        virtual void                        setDataVector3fArray            (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector3* data) override;
+        virtual void                        setDataVector4fArray            (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector4* data) override;
+        virtual void                        setDataIntegerArray             (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Int32* data) override;
+        virtual void                        setDataVector2iArray            (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector2i* data) override;
+        virtual void                        setDataVector3iArray            (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector3i* data) override;
+        virtual void                        setDataVector4iArray            (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector4i* data) override;
+        virtual void                        setDataMatrix22fArray           (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix22f* data) override;
+        virtual void                        setDataMatrix33fArray           (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix33f* data) override;
+        virtual void                        setDataMatrix44fArray           (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix44f* data) override;
+        virtual void                        setDataResource                 (DataInstanceHandle containerHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, UInt32 instancingDivisor) override;
+        virtual void                        setDataTextureSamplerHandle     (DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle) override;
+        virtual void                        setDataReference                (DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef) override;
+
         const RenderingPassInfoVector&      getSortedRenderingPasses        () const;
         const RenderableVector&             getOrderedRenderablesForPass    (RenderPassHandle pass) const;
         const Matrix44f&                    getRenderableWorldMatrix        (RenderableHandle renderable) const;
 
+        // Returns ordered renderables of pass without those whose bounding sphere is outside of frustum given by view projection matrix,
+        // result is cached until renderable order, world matrices, bounding spheres or the view projection matrix change
+        const RenderableVector&             getRenderablesInFrustumForPass  (RenderPassHandle pass, const Matrix44f& viewProjectionMatrix) const;
+        void                                getFrustumCullingResult         (UInt& numCulledRenderables, UInt& numRenderablesInFrustum) const;
+
+        // Render passes into scene render targets are skipped if none of the inputs of any pass rendering into the same render target
+        // (renderables, their data instances and textures, camera) changed since the render target was last completely rendered,
+        // content of such render target is kept from previous frame.
+        // Any other change to scene (e.g. scene actions other than data and transformation changes) invalidates all render targets.
+        // When skipping is disabled, no changes are tracked and all render targets are rendered.
+        void                                setRenderTargetsSkippingEnabled (Bool enable) const;
+        void                                invalidateRenderTargetsContent  ();
+        void                                updateRenderTargetsToRender     (const Matrix44f& rendererViewMatrix) const;
+        Bool                                canRenderPassBeSkipped          (RenderPassHandle pass) const;
+        void                                markRenderTargetsAsRendered     () const;
+        UInt32                              getNumSkippedRenderPasses       () const;
+
     private:
         void updatePassRenderableSorting();
         void updateRenderablesInPass(RenderPassHandle passHandle);
         void addRenderablesFromRenderGroup(RenderableVector& orderedRenderables, RenderGroupHandle renderGroupHandle);
         Bool shouldRenderPassBeRendered(RenderPassHandle handle) const;
+        void setRenderableWorldMatrix(RenderableHandle renderable, const Matrix44f& worldMatrix);
+        void setDataInstanceModified(DataInstanceHandle dataInstance);
+        Bool isDataInstanceModified(DataInstanceHandle dataInstance) const;
+        Bool isRenderTargetModified(RenderTargetHandle renderTarget, const Matrix44f& rendererViewMatrix) const;
+        Bool isRenderableModified(RenderableHandle renderable) const;
+        Bool doesRenderableSampleModifiedContent(RenderableHandle renderable) const;
+        virtual void onRenderableResourcesDirtinessChanged(RenderableHandle renderable) const override;
 
         RenderingPassInfoVector m_sortedRenderingPasses;
         typedef std::vector<RenderableVector> PassRenderableOrder;
@@ -67,8 +107,31 @@ namespace ramses_internal
         typedef std::vector<Matrix44f> MatrixVector;
         MatrixVector            m_renderableMatrices;
 
+        struct PassFrustumCullingCache
+        {
+            Matrix44f        viewProjectionMatrix;
+            RenderableVector renderablesInFrustum;
+            UInt32           generation = 0u;
+        };
+        mutable std::vector<PassFrustumCullingCache> m_passFrustumCullingCache;
+        // incremented whenever any input of frustum culling changes, cache entries with older generation are invalid
+        UInt32                  m_frustumCullingGeneration = 1u;
+
         using RenderPasses = HashSet<RenderPassHandle>;
         mutable RenderPasses m_renderOncePassesToRender;
+
+        mutable Bool                        m_renderTargetsSkippingEnabled = true;
+        // modifications since render targets were last determined to be rendered
+        mutable HashSet<DataInstanceHandle> m_modifiedDataInstances;
+        mutable HashSet<RenderableHandle>   m_modifiedRenderables;
+        mutable Bool                        m_renderTargetsContentInvalid = true;
+        // set when render targets are determined to be rendered, reset when scene was completely rendered
+        mutable Bool                        m_renderTargetsRenderingIncomplete = false;
+        mutable BoolVector                  m_renderTargetsToRender;
+        mutable BoolVector                  m_modifiedRenderBuffers;
+        mutable DeviceHandleVector          m_renderTargetsRenderedDeviceHandles;
+        mutable MatrixVector                m_passViewMatrices;
+        mutable UInt32                      m_numSkippedRenderPasses = 0u;
     };
 }
 
@@ -43,6 +43,8 @@ namespace ramses_internal
         void updateWarpingData(DisplayHandle displayHandle, const WarpingMeshData& warpingData);
         void readPixels(DisplayHandle displayHandle, const String& filename, Bool fullScreen, UInt32 x, UInt32 y, UInt32 width, UInt32 height, Bool sendViaDLT = false);
         void setClearColor(DisplayHandle displayHandle, const Vector4& color);
+        void startFrameCapture(DisplayHandle displayHandle, const String& filename, Float framesPerSecond);
+        void stopFrameCapture(DisplayHandle displayHandle);
 
         void linkSceneData(SceneId providerSceneId, DataSlotId providerDataSlotId, SceneId consumerSceneId, DataSlotId consumerDataSlotId);
         void unlinkSceneData(SceneId consumerSceneId, DataSlotId consumerDataSlotId);
@@ -77,6 +79,7 @@ namespace ramses_internal
         void setLimitsFlushesForceApply(UInt limitFlushesForceApply);
         void setLimitsFlushesForceUnsubscribe(UInt limitFlushesForceUnsubscribe);
         void setSkippingOfUnmodifiedBuffers(Bool enable);
+        void setGpuTimerQueries(Bool enable);
 
         // own functions
         void lock();
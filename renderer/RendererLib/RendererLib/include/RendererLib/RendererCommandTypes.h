@@ -34,6 +34,7 @@ namespace ramses_internal
         ERendererCommandType_WarpingData,
         ERendererCommandType_ReadPixels,
         ERendererCommandType_SetClearColor,
+        ERendererCommandType_FrameCapture,
         ERendererCommandType_DataLinking,
         ERendererCommandType_OffscreenBuffer,
         ERendererCommandType_RendererView,
@@ -69,6 +70,8 @@ namespace ramses_internal
         ERendererCommand_UpdateWarpingData,
         ERendererCommand_ReadPixels,
         ERendererCommand_SetClearColor,
+        ERendererCommand_StartFrameCapture,
+        ERendererCommand_StopFrameCapture,
         ERendererCommand_SceneActions,
         // Data linking
         ERendererCommand_LinkSceneData,
@@ -96,6 +99,7 @@ namespace ramses_internal
         ERendererCommand_SetLimits_FlushesForceApply,
         ERendererCommand_SetLimits_FlushesForceUnsubscribe,
         ERendererCommand_SetSkippingOfUnmodifiedBuffers,
+        ERendererCommand_SetGpuTimerQueries,
 
         // THINK THREE TIMES BEFORE ADDING SOMETHING HERE!
         // This is not a bucket for junk to pass to the renderer because it is convenient
@@ -187,6 +191,15 @@ namespace ramses_internal
         Vector4                 clearColor;
     };
 
+    struct FrameCaptureCommand : public RendererCommand
+    {
+        DEFINE_COMMAND_TYPE(FrameCaptureCommand, ERendererCommandType_FrameCapture);
+
+        DisplayHandle           displayHandle;
+        String                  filename;
+        Float                   framesPerSecond;
+    };
+
     struct DataLinkCommand : public RendererCommand
     {
         DEFINE_COMMAND_TYPE(DataLinkCommand, ERendererCommandType_DataLinking);
@@ -315,6 +328,8 @@ namespace ramses_internal
         "ERendererCommand_UpdateWarpingData",
         "ERendererCommand_ReadPixels",
         "ERendererCommand_SetClearColor",
+        "ERendererCommand_StartFrameCapture",
+        "ERendererCommand_StopFrameCapture",
         "ERendererCommand_SceneActions",
         "ERendererCommand_LinkSceneData",
         "ERendererCommand_LinkBufferToSceneData",
@@ -338,6 +353,7 @@ namespace ramses_internal
         "ERendererCommand_SetLimits_FlushesForceApply",
         "ERendererCommand_SetLimits_FlushesForceUnsubscribe",
         "ERendererCommand_SetSkippingOfUnmodifiedBuffers",
+        "ERendererCommand_SetGpuTimerQueries",
         "ERendererCommand_ConfirmationEcho",
         "ERendererCommand_FrameProfiler_Toggle",
         "ERendererCommand_FrameProfiler_TimingGraphHeight",
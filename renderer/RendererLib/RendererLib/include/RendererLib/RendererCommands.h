@@ -46,6 +46,8 @@ namespace ramses_internal
         void updateWarpingData(DisplayHandle displayHandle, const WarpingMeshData& warpingData);
         void readPixels(DisplayHandle displayHandle, const String& filename, Bool fullScreen, UInt32 x, UInt32 y, UInt32 width, UInt32 height, Bool sendViaDLT = false);
         void setClearColor(DisplayHandle displayHandle, const Vector4& color);
+        void startFrameCapture(DisplayHandle displayHandle, const String& filename, Float framesPerSecond);
+        void stopFrameCapture(DisplayHandle displayHandle);
 
         void linkSceneData(const SceneId providerSceneId, DataSlotId providerDataSlotId, SceneId consumerSceneId, DataSlotId consumerDataSlotId);
         void linkBufferToSceneData(OffscreenBufferHandle providerBuffer, SceneId consumerSceneId, DataSlotId consumerDataSlotId);
@@ -83,6 +85,7 @@ namespace ramses_internal
         void setFrameProfilerFilteredRegionFlags(UInt32 flags);
 
         void setSkippingOfUnmodifiedBuffers(Bool enable);
+        void setGpuTimerQueries(Bool enable);
         void setFrameTimerLimits(UInt64 limitForSceneResourcesUpload, UInt64 limitForClientResourcesUploadMicrosec, UInt64 limitForSceneActionsApplyMicrosec, UInt64 limitForOffscreenBufferRenderMicrosec);
         void setForceApplyPendingFlushesLimit(UInt maximumPendingFlushes);
         void setForceUnsubscribeLimits(UInt maximumPendingFlushes);
@@ -40,6 +40,7 @@ namespace ramses_internal
         ERendererLogTopic_Links,
         ERendererLogTopic_EmbeddedCompositor,
         ERendererLogTopic_EventQueue,
+        ERendererLogTopic_FrameProfiler,
         ERendererLogTopic_All,
         ERendererLogTopic_PeriodicLog,
         ERendererLogTopic_NUMBER_OF_ELEMENTS
@@ -56,6 +57,7 @@ namespace ramses_internal
         "ERendererLogTopic_Links",
         "ERendererLogTopic_EmbeddedCompositor",
         "ERendererLogTopic_EventQueue",
+        "ERendererLogTopic_FrameProfiler",
         "ERendererLogTopic_All",
         "ERendererLogTopic_PeriodicLog"
     };
@@ -81,6 +83,7 @@ namespace ramses_internal
         static void LogLinks(const RendererScenes& scenes, RendererLogContext& context);
         static void LogEmbeddedCompositor(const RendererSceneUpdater& updater, RendererLogContext& context);
         static void LogEventQueue(const RendererSceneUpdater& updater, RendererLogContext& context);
+        static void LogFrameProfiler(const RendererSceneUpdater& updater, RendererLogContext& context);
         static void LogPeriodicInfo(const RendererSceneUpdater& updater);
         static void LogStreamTextures(const RendererSceneUpdater& updater, RendererLogContext& context);
 
@@ -10,6 +10,7 @@
 #define RAMSES_RENDERERSTATISTICS_H
 
 #include "SceneAPI/SceneId.h"
+#include "SceneAPI/Handles.h"
 #include "RendererAPI/Types.h"
 #include "Utils/StatisticCollection.h"
 #include "PlatformAbstraction/PlatformTime.h"
@@ -24,16 +25,25 @@ namespace ramses_internal
     public:
         Float  getFps() const;
         UInt32 getDrawCallsPerFrame() const;
+        // average GPU time measured by timer queries in current period, 0 if nothing was measured
+        UInt32 getAverageSceneGpuTime(SceneId sceneId) const;
+        UInt32 getAverageRenderPassGpuTime(SceneId sceneId, RenderPassHandle renderPass) const;
 
         void sceneRendered(SceneId sceneId);
         void trackArrivedFlush(SceneId sceneId, UInt numSceneActions, UInt numAddedClientResources, UInt numRemovedClientResources, UInt numSceneResourceActions);
         void flushApplied(SceneId sceneId);
         void flushBlocked(SceneId sceneId);
         void flushApplyInterrupted(SceneId sceneId);
+        void trackFrustumCulling(SceneId sceneId, UInt numCulledRenderables, UInt numRenderablesInFrustum);
+        void trackSkippedRenderPasses(SceneId sceneId, UInt numSkippedRenderPasses);
+        void trackSceneGpuTime(SceneId sceneId, UInt32 microseconds);
+        void trackRenderPassGpuTime(SceneId sceneId, RenderPassHandle renderPass, UInt32 microseconds);
 
         void offscreenBufferSwapped(DisplayHandle displayHandle, DeviceResourceHandle offscreenBuffer, bool isInterruptible);
         void offscreenBufferInterrupted(DisplayHandle displayHandle, DeviceResourceHandle offscreenBuffer);
         void framebufferSwapped(DisplayHandle display);
+        void frameCaptured(DisplayHandle display);
+        void frameCaptureDropped(DisplayHandle display, UInt numDroppedFrames);
 
         void clientResourceUploaded(UInt byteSize);
         void sceneResourceUploaded(SceneId sceneId, UInt byteSize);
@@ -61,6 +71,12 @@ namespace ramses_internal
         UInt m_shadersCompiled = 0u;
         UInt64 m_microsecondsForShaderCompilation = 0u;
 
+        struct GpuTimeStatistics
+        {
+            UInt numSamples = 0u;
+            SummaryEntry<UInt> microseconds;
+        };
+
         struct SceneStatistics
         {
             UInt numFlushesArrived = 0u;
@@ -85,6 +101,12 @@ namespace ramses_internal
             UInt sceneResourcesBytesUploaded = 0u;
 
             UInt numRendered = 0u;
+            UInt numRenderablesCulled = 0u;
+            UInt numRenderablesInFrustum = 0u;
+            UInt numRenderPassesSkipped = 0u;
+
+            GpuTimeStatistics gpuTime;
+            std::map<RenderPassHandle, GpuTimeStatistics> renderPassGpuTime;
         };
 
         struct OffscreenBufferStatistics
@@ -97,6 +119,8 @@ namespace ramses_internal
         struct DisplayStatistics
         {
             UInt numFrameBufferSwapped = 0;
+            UInt numFramesCaptured = 0u;
+            UInt numCapturedFramesDropped = 0u;
             std::map<DeviceResourceHandle, OffscreenBufferStatistics> offscreenBufferStatistics;
         };
 
@@ -109,6 +133,9 @@ namespace ramses_internal
             Int32 lastFrameUpdated = -1;
         };
 
+        static UInt32 GetAverageGpuTime(const GpuTimeStatistics& gpuTimeStats);
+        static void WriteGpuTimeToStream(StringOutputStream& str, const GpuTimeStatistics& gpuTimeStats);
+
         template <typename T>
         struct StronglyTypedValueComparator
         {
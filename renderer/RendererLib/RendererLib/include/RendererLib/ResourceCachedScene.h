@@ -64,6 +64,8 @@ namespace ramses_internal
 
     protected:
         Bool resolveTextureSamplerResourceDeviceHandle(const IResourceDeviceHandleAccessor& resourceAccessor, TextureSamplerHandle sampler, DeviceResourceHandle& deviceHandleInOut);
+        // called whenever resources of renderable become dirty or get resolved
+        virtual void onRenderableResourcesDirtinessChanged(RenderableHandle handle) const;
 
     private:
         void setRenderableResourcesDirtyFlag(RenderableHandle handle, Bool dirty) const;
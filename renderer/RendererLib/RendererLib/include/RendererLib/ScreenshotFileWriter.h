@@ -0,0 +1,46 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCREENSHOTFILEWRITER_H
+#define RAMSES_SCREENSHOTFILEWRITER_H
+
+#include "RendererAPI/Types.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include "PlatformAbstraction/PlatformConditionVariable.h"
+#include "PlatformAbstraction/PlatformGuard.h"
+#include <deque>
+
+namespace ramses_internal
+{
+    // Encodes screenshots to PNG files (and sends them via DLT if requested) on a worker thread,
+    // so that rendering is not stalled by file encoding. Worker thread is started with first screenshot.
+    class ScreenshotFileWriter : public Runnable
+    {
+    public:
+        ScreenshotFileWriter();
+        // writes all screenshots still queued before returning
+        ~ScreenshotFileWriter();
+
+        void writeScreenshot(ScreenshotInfo&& screenshot);
+        void waitUntilAllScreenshotsWritten();
+
+    private:
+        virtual void run() override;
+        static void WriteScreenshotToFile(const ScreenshotInfo& screenshot);
+
+        PlatformThread            m_thread;
+        PlatformLightweightLock   m_lock;
+        PlatformConditionVariable m_screenshotQueuedCondVar;
+        PlatformConditionVariable m_screenshotWrittenCondVar;
+        std::deque<ScreenshotInfo> m_screenshotQueue;
+        Bool                      m_writingScreenshot = false;
+        Bool                      m_threadStarted = false;
+    };
+}
+
+#endif
@@ -11,18 +11,19 @@
 
 #include "SceneAPI/RenderBuffer.h"
 #include "RendererAPI/IDevice.h"
+#include "RendererLib/PostprocessingPass.h"
 
 namespace ramses_internal
 {
     class WarpingMeshData;
 
-    class WarpingPass
+    class WarpingPass : public PostprocessingPass
     {
     public:
         explicit WarpingPass(IDevice& device, const WarpingMeshData& warpingMeshData);
         virtual ~WarpingPass();
 
-        void execute(DeviceResourceHandle sourceColorBuffer);
+        virtual void execute(DeviceResourceHandle sourceColorBuffer) override;
 
     private:
         void initEffect();
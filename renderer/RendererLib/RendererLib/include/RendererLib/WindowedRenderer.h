@@ -17,11 +17,14 @@
 #include "RendererLib/RendererScenes.h"
 #include "RendererLib/FrameTimer.h"
 #include "RendererLib/SceneExpirationMonitor.h"
+#include "RendererLib/ScreenshotFileWriter.h"
 #include "RendererCommands/Screenshot.h"
+#include "RendererCommands/CaptureFrames.h"
 #include "RendererCommands/LogRendererInfo.h"
 #include "RendererCommands/PrintStatistics.h"
 #include "RendererCommands/SetClearColor.h"
 #include "RendererCommands/SetSkippingOfUnmodifiedBuffers.h"
+#include "RendererCommands/SetGpuTimerQueries.h"
 #include "RendererCommands/ShowFrameProfiler.h"
 #include "RendererCommands/ShowSceneCommand.h"
 #include "RendererCommands/LinkSceneData.h"
@@ -71,6 +74,9 @@ namespace ramses_internal
         void registerRamshCommands(Ramsh& ramsh);
         void dispatchRendererEvents(RendererEventVector& events);
 
+        // screenshots are saved to files asynchronously
+        void waitUntilAllScreenshotsWritten();
+
     private:
         void updateWindowTitles();
         void processScreenshotResults();
@@ -84,13 +90,16 @@ namespace ramses_internal
         SceneStateExecutor                          m_sceneStateExecutor;
         RendererSceneUpdater                        m_rendererSceneUpdater;
         RendererCommandExecutor                     m_rendererCommandExecutor;
+        ScreenshotFileWriter                        m_screenshotFileWriter;
 
         Screenshot                                        m_cmdScreenshot;
+        CaptureFrames                                     m_cmdCaptureFrames;
         LogRendererInfo                                   m_cmdLogRendererInfo;
         ShowFrameProfiler                                 m_cmdShowFrameProfiler;
         PrintStatistics                                   m_cmdPrintStatistics;
         SetClearColor                                     m_cmdSetClearColor;
         SetSkippingOfUnmodifiedBuffers                    m_cmdSkippingOfUnmodifiedBuffers;
+        SetGpuTimerQueries                                m_cmdGpuTimerQueries;
         LinkSceneData                                     m_cmdLinkSceneData;
         UnlinkSceneData                                   m_cmdUnlinkSceneData;
         ScopedPointer<ShowSceneCommand>                   m_cmdShowSceneOnDisplayInternal;
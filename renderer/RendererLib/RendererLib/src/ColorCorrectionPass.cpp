@@ -0,0 +1,180 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/ColorCorrectionPass.h"
+
+#include "Resource/ArrayResource.h"
+#include "Resource/EffectResource.h"
+#include "RendererLib/WarpingMeshData.h"
+
+namespace ramses_internal
+{
+    ColorCorrectionPass::ColorCorrectionPass(IDevice& device)
+        : m_device(device)
+        , m_indexCount(0u)
+    {
+        initEffect();
+        initGeometry();
+
+        m_lookupTableTexture = m_device.allocateTexture2D(ColorCorrectionLookupTableEntryCount, 1u, ETextureFormat_RGBA8, 1u, ColorCorrectionLookupTableSizeInBytes);
+        assert(m_lookupTableTexture.isValid());
+
+        // identity mapping until lookup table is set
+        std::vector<UInt8> identityLookupTable(ColorCorrectionLookupTableSizeInBytes);
+        for (UInt32 i = 0u; i < ColorCorrectionLookupTableEntryCount; ++i)
+        {
+            for (UInt32 channel = 0u; channel < 4u; ++channel)
+                identityLookupTable[i * 4u + channel] = static_cast<UInt8>(i);
+        }
+        setLookupTable(identityLookupTable);
+    }
+
+    ColorCorrectionPass::~ColorCorrectionPass()
+    {
+        m_device.deleteTexture(m_lookupTableTexture);
+        m_device.deleteVertexBuffer(m_texcoordBufferResource);
+        m_device.deleteIndexBuffer(m_indexBufferResource);
+        m_device.deleteVertexBuffer(m_vertexBufferResource);
+        m_device.deleteShader(m_shaderResource);
+    }
+
+    void ColorCorrectionPass::setLookupTable(const std::vector<UInt8>& lookupTable)
+    {
+        assert(lookupTable.size() == ColorCorrectionLookupTableSizeInBytes);
+        m_device.bindTexture(m_lookupTableTexture);
+        m_device.uploadTextureData(m_lookupTableTexture, 0u, 0u, 0u, 0u, ColorCorrectionLookupTableEntryCount, 1u, 1u, lookupTable.data(), ColorCorrectionLookupTableSizeInBytes);
+    }
+
+    void ColorCorrectionPass::initGeometry()
+    {
+        // full screen quad
+        const WarpingMeshData quad;
+        const UInt32 vertexCount = static_cast<UInt32>(quad.getVertexPositions().size());
+        m_indexCount = static_cast<UInt32>(quad.getIndices().size());
+
+        const ArrayResource vertexArrayRes(EResourceType_VertexArray, vertexCount, EDataType_Vector3F, reinterpret_cast<const Byte*>(&quad.getVertexPositions()[0]), ResourceCacheFlag_DoNotCache, String());
+        m_vertexBufferResource = m_device.allocateVertexBuffer(vertexArrayRes.getElementType(), vertexArrayRes.getDecompressedDataSize());
+        assert(m_vertexBufferResource.isValid());
+        m_device.uploadVertexBufferData(m_vertexBufferResource, vertexArrayRes.getResourceData()->getRawData(), vertexArrayRes.getDecompressedDataSize());
+
+        const ArrayResource texcoordArrayRes(EResourceType_VertexArray, vertexCount, EDataType_Vector2F, reinterpret_cast<const Byte*>(&quad.getTextureCoordinates()[0]), ResourceCacheFlag_DoNotCache, String());
+        m_texcoordBufferResource = m_device.allocateVertexBuffer(texcoordArrayRes.getElementType(), texcoordArrayRes.getDecompressedDataSize());
+        assert(m_texcoordBufferResource.isValid());
+        m_device.uploadVertexBufferData(m_texcoordBufferResource, texcoordArrayRes.getResourceData()->getRawData(), texcoordArrayRes.getDecompressedDataSize());
+
+        const ArrayResource indexArrayRes(EResourceType_IndexArray, m_indexCount, EDataType_UInt16, reinterpret_cast<const Byte*>(&quad.getIndices()[0]), ResourceCacheFlag_DoNotCache, String());
+        m_indexBufferResource = m_device.allocateIndexBuffer(indexArrayRes.getElementType(), indexArrayRes.getDecompressedDataSize());
+        assert(m_indexBufferResource.isValid());
+        m_device.uploadIndexBufferData(m_indexBufferResource, indexArrayRes.getResourceData()->getRawData(), indexArrayRes.getDecompressedDataSize());
+    }
+
+    void ColorCorrectionPass::initEffect()
+    {
+        static const char* vertexShader =
+            "#version 100\n"
+            "precision highp float;\n"
+            "attribute vec3 a_position; \n"
+            "attribute vec2 a_texcoord; \n"
+            "\n"
+            "varying vec2 v_texcoord; \n"
+            "\n"
+            "void main()\n"
+            "{\n"
+            "  v_texcoord = a_texcoord; \n"
+            "  gl_Position = vec4(a_position, 1.0); \n"
+            "}\n";
+
+        // sample lookup table at texel centers, so that input value 0.0 maps to first and 1.0 to last entry
+        static const char* fragmentShader =
+            "#version 100\n"
+            "precision highp float;\n"
+            "uniform sampler2D u_texture; \n"
+            "uniform sampler2D u_lookupTable; \n"
+            "varying vec2 v_texcoord; \n"
+            "\n"
+            "vec3 lookupCoordinates(vec3 value)\n"
+            "{\n"
+            "  return value * (255.0 / 256.0) + (0.5 / 256.0); \n"
+            "}\n"
+            "\n"
+            "void main(void)\n"
+            "{\n"
+            "  vec4 color = texture2D(u_texture, v_texcoord); \n"
+            "  vec3 coords = lookupCoordinates(color.rgb); \n"
+            "  gl_FragColor = vec4(\n"
+            "    texture2D(u_lookupTable, vec2(coords.r, 0.5)).r,\n"
+            "    texture2D(u_lookupTable, vec2(coords.g, 0.5)).g,\n"
+            "    texture2D(u_lookupTable, vec2(coords.b, 0.5)).b,\n"
+            "    color.a); \n"
+            "}\n";
+
+        EffectInputInformation a_position;
+        a_position.inputName = "a_position";
+        a_position.dataType = EDataType_Vector3Buffer;
+        a_position.semantics = EFixedSemantics_VertexPositionAttribute;
+
+        EffectInputInformation a_texcoord;
+        a_texcoord.inputName = "a_texcoord";
+        a_texcoord.dataType = EDataType_Vector2Buffer;
+        a_texcoord.semantics = EFixedSemantics_Invalid;
+
+        EffectInputInformationVector attributeInputs;
+        attributeInputs.push_back(a_position);
+        attributeInputs.push_back(a_texcoord);
+
+        EffectInputInformation u_texture;
+        u_texture.inputName = "u_texture";
+        u_texture.dataType = EDataType_TextureSampler;
+        u_texture.semantics = EFixedSemantics_Invalid;
+        u_texture.textureType = EEffectInputTextureType_Texture2D;
+
+        EffectInputInformation u_lookupTable;
+        u_lookupTable.inputName = "u_lookupTable";
+        u_lookupTable.dataType = EDataType_TextureSampler;
+        u_lookupTable.semantics = EFixedSemantics_Invalid;
+        u_lookupTable.textureType = EEffectInputTextureType_Texture2D;
+
+        EffectInputInformationVector uniformInputs;
+        uniformInputs.push_back(u_texture);
+        uniformInputs.push_back(u_lookupTable);
+
+        EffectResource effect(vertexShader, fragmentShader, uniformInputs, attributeInputs, "ColorCorrectionEffect", ResourceCacheFlag_DoNotCache);
+
+        m_vertexPositionField = effect.getAttributeDataFieldHandleByName("a_position");
+        m_texcoordField = effect.getAttributeDataFieldHandleByName("a_texcoord");
+        m_inputRenderBufferField = effect.getUniformDataFieldHandleByName("u_texture");
+        m_lookupTableField = effect.getUniformDataFieldHandleByName("u_lookupTable");
+
+        assert(m_vertexPositionField.isValid());
+        assert(m_texcoordField.isValid());
+        assert(m_inputRenderBufferField.isValid());
+        assert(m_lookupTableField.isValid());
+
+        m_shaderResource = m_device.uploadShader(effect);
+        assert(m_shaderResource.isValid());
+    }
+
+    void ColorCorrectionPass::execute(DeviceResourceHandle sourceColorBuffer)
+    {
+        m_device.activateShader(m_shaderResource);
+
+        const UInt32 isotropicFilteringLevel = 1u;
+        m_device.activateTexture(sourceColorBuffer, m_inputRenderBufferField);
+        m_device.setTextureSampling(m_inputRenderBufferField,
+            EWrapMethod::Clamp, EWrapMethod::Clamp, EWrapMethod::Clamp, ESamplingMethod::Linear, ESamplingMethod::Linear, isotropicFilteringLevel);
+
+        m_device.activateTexture(m_lookupTableTexture, m_lookupTableField);
+        m_device.setTextureSampling(m_lookupTableField,
+            EWrapMethod::Clamp, EWrapMethod::Clamp, EWrapMethod::Clamp, ESamplingMethod::Linear, ESamplingMethod::Linear, isotropicFilteringLevel);
+
+        m_device.activateIndexBuffer(m_indexBufferResource);
+        m_device.activateVertexBuffer(m_vertexBufferResource, m_vertexPositionField, 0u);
+        m_device.activateVertexBuffer(m_texcoordBufferResource, m_texcoordField, 0u);
+        m_device.drawIndexedTriangles(0, m_indexCount, 1u);
+    }
+}
@@ -164,6 +164,26 @@ namespace ramses_internal
         return m_warpingEnabled;
     }
 
+    const std::vector<UInt8>& DisplayConfig::getColorCorrectionLookupTable() const
+    {
+        return m_colorCorrectionLookupTable;
+    }
+
+    void DisplayConfig::setColorCorrectionLookupTable(const std::vector<UInt8>& lookupTable)
+    {
+        m_colorCorrectionLookupTable = lookupTable;
+    }
+
+    Bool DisplayConfig::isDownscaleEnabled() const
+    {
+        return m_downscaleEnabled;
+    }
+
+    void DisplayConfig::setDownscaleEnabled(Bool enabled)
+    {
+        m_downscaleEnabled = enabled;
+    }
+
     void DisplayConfig::setKeepEffectsUploaded(Bool enabled)
     {
         m_keepEffectsUploaded = enabled;
@@ -260,6 +280,8 @@ namespace ramses_internal
             m_fullscreen                 == other.m_fullscreen &&
             m_borderless                 == other.m_borderless &&
             m_warpingEnabled             == other.m_warpingEnabled &&
+            m_downscaleEnabled           == other.m_downscaleEnabled &&
+            m_colorCorrectionLookupTable == other.m_colorCorrectionLookupTable &&
             m_stereoDisplay              == other.m_stereoDisplay &&
             m_antiAliasingMethod         == other.m_antiAliasingMethod &&
             m_antiAliasingSamples        == other.m_antiAliasingSamples &&
@@ -59,9 +59,16 @@ namespace ramses_internal
     SceneRenderExecutionIterator DisplayController::renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
     {
         const FrameBufferInfo fbInfo(buffer, m_projectionParams, viewport);
-        RenderExecutor executor(m_renderBackend.getDevice(), fbInfo, renderFrom, frameTimer);
+        RenderExecutor executor(m_renderBackend.getDevice(), fbInfo, renderFrom, frameTimer, m_gpuTimerQueries.get());
 
-        return executor.executeScene(scene, getViewMatrix());
+        if (!m_gpuTimerQueries)
+            return executor.executeScene(scene, getViewMatrix());
+
+        m_gpuTimerQueries->beginScene(scene.getSceneId());
+        const SceneRenderExecutionIterator renderedTo = executor.executeScene(scene, getViewMatrix());
+        m_gpuTimerQueries->endScene();
+
+        return renderedTo;
     }
 
     void DisplayController::executePostProcessing()
@@ -97,6 +104,36 @@ namespace ramses_internal
         return true;
     }
 
+    DeviceResourceHandle DisplayController::startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height)
+    {
+        // area out of boundaries is reported by synchronous readPixels
+        if (x + width > getDisplayWidth() ||
+            y + height > getDisplayHeight())
+        {
+            return DeviceResourceHandle::Invalid();
+        }
+
+        m_device.activateRenderTarget(m_postProcessing->getFramebuffer());
+        return m_device.startReadPixels(x, y, width, height);
+    }
+
+    Bool DisplayController::isReadPixelsFinished(DeviceResourceHandle readPixelsHandle)
+    {
+        return m_device.isReadPixelsFinished(readPixelsHandle);
+    }
+
+    Bool DisplayController::finishReadPixels(DeviceResourceHandle readPixelsHandle, UInt32 width, UInt32 height, std::vector<UInt8>& dataOut)
+    {
+        dataOut.resize(width * height * 4u); // Assuming RGBA8 non multisampled
+        if (!m_device.finishReadPixels(readPixelsHandle, &dataOut[0]))
+        {
+            dataOut.clear();
+            return false;
+        }
+
+        return true;
+    }
+
     void DisplayController::setProjectionParams(const ProjectionParams& params)
     {
         m_projectionParams = params;
@@ -165,6 +202,30 @@ namespace ramses_internal
         m_postProcessing->setWarpingMeshData(warpingMeshData);
     }
 
+    void DisplayController::setColorCorrectionLookupTable(const std::vector<UInt8>& lookupTable)
+    {
+        m_postProcessing->setColorCorrectionLookupTable(lookupTable);
+    }
+
+    void DisplayController::enableGpuTimerQueries(Bool enable)
+    {
+        if (enable && !m_gpuTimerQueries)
+            m_gpuTimerQueries.reset(new GpuTimerQueries(m_device));
+        else if (!enable)
+            m_gpuTimerQueries.reset();
+    }
+
+    void DisplayController::collectGpuTimerQueryResults(RendererStatistics& stats)
+    {
+        if (m_gpuTimerQueries)
+            m_gpuTimerQueries->collectResults(stats);
+    }
+
+    GpuTimerQueries* DisplayController::getGpuTimerQueries()
+    {
+        return m_gpuTimerQueries.get();
+    }
+
     void DisplayController::resetView() const
     {
     }
@@ -10,6 +10,9 @@
 #include "Collections/StringOutputStream.h"
 #include "Utils/LoggingUtils.h"
 #include "PlatformAbstraction/PlatformMath.h"
+#include "Utils/TraceEventRecorder.h"
+#include <numeric>
+#include <cmath>
 
 namespace ramses_internal
 {
@@ -19,6 +22,8 @@ namespace ramses_internal
         , m_counters(NumberOfCounters, CounterValues(NumberOfFrames))
         , m_currentFrameId(0)
         , m_currentRegionId(0)
+        , m_histograms(NumberOfRegions + 1, Histogram(NumberOfHistogramBuckets, 0u))
+        , m_histogramMaxTimes(NumberOfRegions + 1, 0u)
     {
         m_frameTimings.reserve(NumberOfFrames * NumberOfRegions);
         initNextFrameTimings();
@@ -51,6 +56,9 @@ namespace ramses_internal
 
         const UInt totalRegionTime = static_cast<UInt>(PlatformTime::GetMicrosecondsMonotonic() - m_regionStartTimes[regionId]);
         m_frameTimings[m_frameTimings.size() - NumberOfRegions + regionId] = totalRegionTime;
+        addToHistogram(regionId, totalRegionTime);
+        m_currentFrameTime += totalRegionTime;
+        GetTraceEventRecorder().recordEvent("renderer", EnumToString(region), m_regionStartTimes[regionId], totalRegionTime);
 
         // add previous region time to current region to get stacked accumulated values which can be used directly by the FrameProfileRenderer
         const UInt entryId = getEntryIdForCurrentRegion();
@@ -114,6 +122,10 @@ namespace ramses_internal
 
         setSleepTimeForLastFrame(sleepTime);
 
+        addToHistogram(NumberOfRegions, m_currentFrameTime);
+        m_currentFrameTime = 0u;
+        ++m_numFramesInHistograms;
+
         m_currentRegionId = 0;
 
         if (++m_currentFrameId >= NumberOfFrames)
@@ -171,12 +183,120 @@ namespace ramses_internal
     {
         m_frameTimings.clear();
         initNextFrameTimings();
+
+        for (auto& histogram : m_histograms)
+            std::fill(histogram.begin(), histogram.end(), 0u);
+        std::fill(m_histogramMaxTimes.begin(), m_histogramMaxTimes.end(), 0u);
+        m_numFramesInHistograms = 0u;
+    }
+
+    UInt FrameProfilerStatistics::GetHistogramBucket(UInt timeInMicroseconds)
+    {
+        if (timeInMicroseconds < 8u)
+            return timeInMicroseconds;
+
+        UInt exponent = 3u;
+        while ((timeInMicroseconds >> (exponent + 1u)) != 0u)
+            ++exponent;
+        const UInt bucket = (exponent - 2u) * 8u + ((timeInMicroseconds >> (exponent - 3u)) & 7u);
+
+        return std::min(bucket, NumberOfHistogramBuckets - 1u);
+    }
+
+    UInt FrameProfilerStatistics::GetHistogramBucketUpperBound(UInt bucket)
+    {
+        if (bucket < 8u)
+            return bucket;
+
+        const UInt exponent = bucket / 8u + 2u;
+        const UInt bucketWidth = UInt(1u) << (exponent - 3u);
+        return (8u + bucket % 8u) * bucketWidth + bucketWidth - 1u;
+    }
+
+    void FrameProfilerStatistics::addToHistogram(UInt histogramId, UInt timeInMicroseconds)
+    {
+        m_histograms[histogramId][GetHistogramBucket(timeInMicroseconds)]++;
+        m_histogramMaxTimes[histogramId] = std::max(m_histogramMaxTimes[histogramId], timeInMicroseconds);
+    }
+
+    UInt32 FrameProfilerStatistics::getPercentile(UInt histogramId, Float percentile) const
+    {
+        const Histogram& histogram = m_histograms[histogramId];
+        const UInt64 numSamples = std::accumulate(histogram.cbegin(), histogram.cend(), UInt64(0u));
+        if (numSamples == 0u)
+            return 0u;
+
+        const UInt64 rank = std::max(UInt64(1u), static_cast<UInt64>(std::ceil(numSamples * std::min(std::max(percentile, 0.f), 100.f) / 100.f)));
+        UInt64 numSamplesInBuckets = 0u;
+        for (UInt bucket = 0u; bucket < NumberOfHistogramBuckets; ++bucket)
+        {
+            numSamplesInBuckets += histogram[bucket];
+            if (numSamplesInBuckets >= rank)
+                return static_cast<UInt32>(std::min(GetHistogramBucketUpperBound(bucket), m_histogramMaxTimes[histogramId]));
+        }
+
+        return static_cast<UInt32>(m_histogramMaxTimes[histogramId]);
+    }
+
+    UInt32 FrameProfilerStatistics::getRegionTimePercentile(ERegion region, Float percentile) const
+    {
+        assert(region != ERegion::Count);
+        return getPercentile(static_cast<UInt>(region), percentile);
+    }
+
+    UInt32 FrameProfilerStatistics::getFrameTimePercentile(Float percentile) const
+    {
+        return getPercentile(NumberOfRegions, percentile);
+    }
+
+    UInt32 FrameProfilerStatistics::getNumberOfFramesInHistograms() const
+    {
+        return m_numFramesInHistograms;
+    }
+
+    const FrameProfilerStatistics::Histogram& FrameProfilerStatistics::getRegionTimeHistogram(ERegion region) const
+    {
+        assert(region != ERegion::Count);
+        return m_histograms[static_cast<UInt>(region)];
+    }
+
+    const FrameProfilerStatistics::Histogram& FrameProfilerStatistics::getFrameTimeHistogram() const
+    {
+        return m_histograms[NumberOfRegions];
+    }
+
+    void FrameProfilerStatistics::writeTimePercentilesToStream(StringOutputStream& str) const
+    {
+        str << "Frame time percentiles(us)[p50/p95/p99/max] over " << m_numFramesInHistograms << " frames:";
+        str << " Frame:" << getFrameTimePercentile(50.f) << "/" << getFrameTimePercentile(95.f) << "/" << getFrameTimePercentile(99.f) << "/" << m_histogramMaxTimes[NumberOfRegions];
+        for (UInt reg = 0u; reg < NumberOfRegions; ++reg)
+        {
+            const ERegion region = ERegion(reg);
+            str << " " << EnumToString(region) << ":" << getRegionTimePercentile(region, 50.f) << "/" << getRegionTimePercentile(region, 95.f) << "/" << getRegionTimePercentile(region, 99.f) << "/" << m_histogramMaxTimes[reg];
+        }
+    }
+
+    void FrameProfilerStatistics::writeTimeHistogramsToStream(StringOutputStream& str) const
+    {
+        // only non-empty buckets are written as [bucket upper bound in us]:count
+        for (UInt histogramId = 0u; histogramId <= NumberOfRegions; ++histogramId)
+        {
+            str << (histogramId < NumberOfRegions ? EnumToString(ERegion(histogramId)) : "Frame") << ":";
+            const Histogram& histogram = m_histograms[histogramId];
+            for (UInt bucket = 0u; bucket < NumberOfHistogramBuckets; ++bucket)
+            {
+                if (histogram[bucket] > 0u)
+                    str << " " << GetHistogramBucketUpperBound(bucket) << ":" << histogram[bucket];
+            }
+            str << "\n";
+        }
     }
 
     void FrameProfilerStatistics::setSleepTimeForLastFrame(std::chrono::microseconds sleepTime)
     {
         assert(m_currentRegionId == static_cast<UInt>(ERegion::MaxFramerateSleep));
         assert(sleepTime.count() >= 0);
+        addToHistogram(static_cast<UInt>(ERegion::MaxFramerateSleep), static_cast<UInt>(sleepTime.count()));
         if (m_currentFrameId == 0)
             return;
 
@@ -0,0 +1,187 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/FrameStreamWriter.h"
+#include "Utils/File.h"
+#include "Utils/LogMacros.h"
+
+#ifdef __linux__
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+namespace ramses_internal
+{
+    FrameStreamWriter::FrameStreamWriter(const String& filename, UInt32 frameWidth, UInt32 frameHeight)
+        : m_filename(filename)
+        , m_frameWidth(frameWidth)
+        , m_frameHeight(frameHeight)
+        , m_thread("R_FrameStreamWr")
+    {
+        m_thread.start(*this);
+    }
+
+    FrameStreamWriter::~FrameStreamWriter()
+    {
+        finish();
+        m_thread.join();
+    }
+
+    void FrameStreamWriter::finish()
+    {
+        PlatformLightweightGuard guard(m_lock);
+        m_finishRequested = true;
+        m_thread.cancel();
+        m_frameQueuedCondVar.signal();
+    }
+
+    Bool FrameStreamWriter::isFinished() const
+    {
+        PlatformLightweightGuard guard(m_lock);
+        return m_finished;
+    }
+
+    UInt32 FrameStreamWriter::getFrameWidth() const
+    {
+        return m_frameWidth;
+    }
+
+    UInt32 FrameStreamWriter::getFrameHeight() const
+    {
+        return m_frameHeight;
+    }
+
+    Bool FrameStreamWriter::writeFrame(std::vector<UInt8>&& pixelData)
+    {
+        assert(pixelData.size() == m_frameWidth * m_frameHeight * 4u);
+
+        PlatformLightweightGuard guard(m_lock);
+        if (m_frameQueue.size() >= MaximumQueuedFrames || m_finishRequested)
+            return false;
+
+        m_frameQueue.push_back(std::move(pixelData));
+        m_frameQueuedCondVar.signal();
+        return true;
+    }
+
+    void FrameStreamWriter::waitUntilAllFramesWritten()
+    {
+        PlatformLightweightGuard guard(m_lock);
+        while (!m_frameQueue.empty() || m_writingFrame)
+            m_frameWrittenCondVar.wait(&m_lock);
+    }
+
+    Bool FrameStreamWriter::waitForNamedPipeReader(Int& readerProbe)
+    {
+        readerProbe = -1;
+#ifdef __linux__
+        struct stat fileStatus;
+        if (::stat(m_filename.c_str(), &fileStatus) != 0 || !S_ISFIFO(fileStatus.st_mode))
+            return true;
+
+        // opening named pipe for writing would block until consumer connects and could not be interrupted,
+        // non-blocking open fails as long as there is no reader
+        while (!isCancelRequested())
+        {
+            const int fd = ::open(m_filename.c_str(), O_WRONLY | O_NONBLOCK);
+            if (fd >= 0)
+            {
+                readerProbe = fd;
+                return true;
+            }
+            if (errno != ENXIO)
+                return true;
+            PlatformThread::Sleep(NamedPipeReaderPollingPeriod);
+        }
+        return false;
+#else
+        return true;
+#endif
+    }
+
+    void FrameStreamWriter::closeNamedPipeReaderProbe(Int readerProbe)
+    {
+#ifdef __linux__
+        if (readerProbe >= 0)
+            ::close(static_cast<int>(readerProbe));
+#else
+        UNUSED(readerProbe);
+#endif
+    }
+
+    void FrameStreamWriter::run()
+    {
+        // probe keeps named pipe open for writing until file is opened, so that reader does not see end of stream in between
+        Int readerProbe = -1;
+        const Bool readerConnected = waitForNamedPipeReader(readerProbe);
+
+        File file(m_filename);
+        const Bool fileOpened = readerConnected && (file.open(EFileMode_WriteNewBinary) == EStatus_RAMSES_OK);
+        closeNamedPipeReaderProbe(readerProbe);
+        if (!readerConnected)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "FrameStreamWriter::run: finished before a reader connected to " << m_filename << ", captured frames will be discarded");
+        }
+        else if (!fileOpened)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "FrameStreamWriter::run: failed to open " << m_filename << ", captured frames will be discarded");
+        }
+        else
+        {
+            LOG_INFO(CONTEXT_RENDERER, "FrameStreamWriter::run: writing frames of size " << m_frameWidth << "x" << m_frameHeight << " RGBA8 to " << m_filename);
+        }
+
+        Bool writeFailed = !fileOpened;
+        const UInt rowSize = m_frameWidth * 4u;
+        for (;;)
+        {
+            std::vector<UInt8> pixelData;
+            {
+                PlatformLightweightGuard guard(m_lock);
+                while (m_frameQueue.empty() && !isCancelRequested())
+                    m_frameQueuedCondVar.wait(&m_lock);
+
+                // queue is written completely also when cancelled
+                if (m_frameQueue.empty())
+                    break;
+
+                pixelData = std::move(m_frameQueue.front());
+                m_frameQueue.pop_front();
+                m_writingFrame = true;
+            }
+
+            // rows are read bottom-up from framebuffer, write them top-down as expected by video tools
+            for (UInt32 row = m_frameHeight; row > 0u && !writeFailed; --row)
+            {
+                if (file.write(reinterpret_cast<const Char*>(&pixelData[(row - 1u) * rowSize]), rowSize) != EStatus_RAMSES_OK)
+                {
+                    LOG_ERROR(CONTEXT_RENDERER, "FrameStreamWriter::run: failed to write frame to " << m_filename << ", further captured frames will be discarded");
+                    writeFailed = true;
+                }
+            }
+            // consumer of named pipe must get every frame completely when it is written, not when file buffer is full
+            if (!writeFailed && file.flush() != EStatus_RAMSES_OK)
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "FrameStreamWriter::run: failed to write frame to " << m_filename << ", further captured frames will be discarded");
+                writeFailed = true;
+            }
+
+            PlatformLightweightGuard guard(m_lock);
+            m_writingFrame = false;
+            m_frameWrittenCondVar.broadcast();
+        }
+
+        if (fileOpened)
+            file.close();
+
+        PlatformLightweightGuard guard(m_lock);
+        m_finished = true;
+    }
+}
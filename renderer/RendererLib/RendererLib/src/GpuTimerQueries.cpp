@@ -0,0 +1,142 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/GpuTimerQueries.h"
+#include "RendererLib/RendererStatistics.h"
+#include "RendererAPI/IDevice.h"
+#include "Utils/LogMacros.h"
+
+namespace ramses_internal
+{
+    GpuTimerQueries::GpuTimerQueries(IDevice& device)
+        : m_device(device)
+    {
+    }
+
+    GpuTimerQueries::~GpuTimerQueries()
+    {
+        endRenderPass();
+        endScene();
+        releasePendingMeasurements();
+    }
+
+    void GpuTimerQueries::beginScene(SceneId sceneId)
+    {
+        assert(!m_sceneMeasurement.beginQuery.isValid());
+        m_sceneMeasurement.sceneId = sceneId;
+        m_sceneMeasurement.renderPass = RenderPassHandle::Invalid();
+        m_sceneMeasurement.beginQuery = beginMeasurement();
+    }
+
+    void GpuTimerQueries::endScene()
+    {
+        endMeasurement(m_sceneMeasurement);
+    }
+
+    void GpuTimerQueries::beginRenderPass(RenderPassHandle renderPass)
+    {
+        assert(!m_renderPassMeasurement.beginQuery.isValid());
+        m_renderPassMeasurement.sceneId = m_sceneMeasurement.sceneId;
+        m_renderPassMeasurement.renderPass = renderPass;
+        m_renderPassMeasurement.beginQuery = beginMeasurement();
+    }
+
+    void GpuTimerQueries::endRenderPass()
+    {
+        endMeasurement(m_renderPassMeasurement);
+    }
+
+    void GpuTimerQueries::collectResults(RendererStatistics& stats)
+    {
+        while (!m_pendingMeasurements.empty())
+        {
+            const Measurement& measurement = m_pendingMeasurements.front();
+            // timestamps are written in order by GPU, so begin query is finished if end query is
+            if (!m_device.isTimestampQueryResultAvailable(measurement.endQuery))
+                break;
+
+            UInt32 microseconds = 0u;
+            if (!getDurationAndRelease(measurement, microseconds))
+            {
+                // disjoint state is reset once queried, following results would be reported as valid although they are not
+                m_pendingMeasurements.pop_front();
+                releasePendingMeasurements();
+                break;
+            }
+
+            if (measurement.renderPass.isValid())
+                stats.trackRenderPassGpuTime(measurement.sceneId, measurement.renderPass, microseconds);
+            else
+                stats.trackSceneGpuTime(measurement.sceneId, microseconds);
+            m_pendingMeasurements.pop_front();
+        }
+    }
+
+    UInt32 GpuTimerQueries::getNumPendingMeasurements() const
+    {
+        return static_cast<UInt32>(m_pendingMeasurements.size());
+    }
+
+    Bool GpuTimerQueries::isSupported() const
+    {
+        return m_supported;
+    }
+
+    DeviceResourceHandle GpuTimerQueries::beginMeasurement()
+    {
+        // each pending measurement holds two queries, count also measurements started but not ended yet
+        const UInt numStartedMeasurements = (m_sceneMeasurement.beginQuery.isValid() ? 1u : 0u) + (m_renderPassMeasurement.beginQuery.isValid() ? 1u : 0u);
+        if (!m_supported || m_pendingMeasurements.size() + numStartedMeasurements >= MaximumPendingMeasurements)
+            return DeviceResourceHandle::Invalid();
+
+        const DeviceResourceHandle query = m_device.issueTimestampQuery();
+        if (!query.isValid())
+        {
+            LOG_WARN(CONTEXT_RENDERER, "GpuTimerQueries::beginMeasurement: GPU timer queries not supported by device, no GPU times will be measured");
+            m_supported = false;
+        }
+
+        return query;
+    }
+
+    void GpuTimerQueries::endMeasurement(Measurement& measurement)
+    {
+        if (!measurement.beginQuery.isValid())
+            return;
+
+        measurement.endQuery = m_device.issueTimestampQuery();
+        assert(measurement.endQuery.isValid());
+        m_pendingMeasurements.push_back(measurement);
+        measurement.beginQuery = DeviceResourceHandle::Invalid();
+        measurement.endQuery = DeviceResourceHandle::Invalid();
+    }
+
+    Bool GpuTimerQueries::getDurationAndRelease(const Measurement& measurement, UInt32& microseconds)
+    {
+        UInt64 beginTimestamp = 0u;
+        UInt64 endTimestamp = 0u;
+        // both queries have to be released regardless of results being valid
+        const Bool beginValid = m_device.getTimestampQueryResult(measurement.beginQuery, beginTimestamp);
+        const Bool endValid = m_device.getTimestampQueryResult(measurement.endQuery, endTimestamp);
+        if (!beginValid || !endValid || endTimestamp < beginTimestamp)
+            return false;
+
+        microseconds = static_cast<UInt32>((endTimestamp - beginTimestamp) / 1000u);
+        return true;
+    }
+
+    void GpuTimerQueries::releasePendingMeasurements()
+    {
+        for (const auto& measurement : m_pendingMeasurements)
+        {
+            m_device.releaseTimestampQuery(measurement.beginQuery);
+            m_device.releaseTimestampQuery(measurement.endQuery);
+        }
+        m_pendingMeasurements.clear();
+    }
+}
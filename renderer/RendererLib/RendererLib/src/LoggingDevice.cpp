@@ -398,6 +398,40 @@ namespace ramses_internal
     {
     }
 
+    DeviceResourceHandle LoggingDevice::startReadPixels(UInt32 /*x*/, UInt32 /*y*/, UInt32 /*width*/, UInt32 /*height*/)
+    {
+        return DeviceResourceHandle::Invalid();
+    }
+
+    Bool LoggingDevice::isReadPixelsFinished(DeviceResourceHandle /*readPixelsHandle*/)
+    {
+        return true;
+    }
+
+    Bool LoggingDevice::finishReadPixels(DeviceResourceHandle /*readPixelsHandle*/, UInt8* /*buffer*/)
+    {
+        return false;
+    }
+
+    DeviceResourceHandle LoggingDevice::issueTimestampQuery()
+    {
+        return DeviceResourceHandle::Invalid();
+    }
+
+    Bool LoggingDevice::isTimestampQueryResultAvailable(DeviceResourceHandle /*queryHandle*/)
+    {
+        return true;
+    }
+
+    Bool LoggingDevice::getTimestampQueryResult(DeviceResourceHandle /*queryHandle*/, UInt64& /*timestampNanoseconds*/)
+    {
+        return false;
+    }
+
+    void LoggingDevice::releaseTimestampQuery(DeviceResourceHandle /*queryHandle*/)
+    {
+    }
+
     UInt32 LoggingDevice::getTotalGpuMemoryUsageInKB() const
     {
         return m_deviceDelegate.getTotalGpuMemoryUsageInKB();
@@ -10,8 +10,11 @@
 
 #include "RendererAPI/IDevice.h"
 #include "RendererLib/WarpingPass.h"
+#include "RendererLib/ColorCorrectionPass.h"
 #include "RendererLib/WarpingMeshData.h"
 #include "Math3d/Vector4.h"
+#include <algorithm>
+#include <limits>
 
 namespace ramses_internal
 {
@@ -21,7 +24,8 @@ namespace ramses_internal
         , m_displayWidth(width)
         , m_displayHeight(height)
         , m_framebuffer(device.getFramebufferRenderTarget())
-        , m_warpingPass(nullptr)
+        , m_colorCorrectionPass(nullptr)
+        , m_warpingPassIndex(0u)
     {
         if (effectIds != EPostProcessingEffect_None)
         {
@@ -35,11 +39,41 @@ namespace ramses_internal
             sceneRenderTargetBuffers.push_back(m_sceneDepthStencilBuffer);
             m_scenesRenderTarget = m_device.uploadRenderTarget(sceneRenderTargetBuffers);
 
+            // passes following downscale work on half resolution, only last pass is scaled back to display size
+            UInt32 passWidth = m_displayWidth;
+            UInt32 passHeight = m_displayHeight;
+            if (effectIds & EPostProcessingEffect_Downscale)
+            {
+                passWidth = std::max(passWidth / 2u, 1u);
+                passHeight = std::max(passHeight / 2u, 1u);
+                // plain copy of source to smaller target using linear filtering
+                WarpingMeshData quad;
+                addPass(new WarpingPass(m_device, quad), passWidth, passHeight);
+            }
+
+            if (effectIds & EPostProcessingEffect_ColorCorrection)
+            {
+                m_colorCorrectionPass = new ColorCorrectionPass(m_device);
+                addPass(m_colorCorrectionPass, passWidth, passHeight);
+            }
+
             if (effectIds & EPostProcessingEffect_Warping)
             {
                 WarpingMeshData warpingMeshQuad;
-                m_warpingPass = new WarpingPass(m_device, warpingMeshQuad);
+                m_warpingPassIndex = m_passes.size();
+                addPass(new WarpingPass(m_device, warpingMeshQuad), passWidth, passHeight);
             }
+
+            // downscaled image is scaled back to display size by last pass, plain copy if no other effect follows
+            if ((effectIds & EPostProcessingEffect_Downscale) && m_passes.size() == 1u)
+            {
+                WarpingMeshData quad;
+                addPass(new WarpingPass(m_device, quad), m_displayWidth, m_displayHeight);
+            }
+
+            // last pass renders to framebuffer
+            m_passes.back().outputWidth = m_displayWidth;
+            m_passes.back().outputHeight = m_displayHeight;
         }
         else
         {
@@ -51,7 +85,14 @@ namespace ramses_internal
 
     Postprocessing::~Postprocessing()
     {
-        delete m_warpingPass;
+        m_passes.clear();
+
+        for (const auto& intermediateTarget : m_intermediateTargetPool)
+        {
+            assert(!intermediateTarget.inUse);
+            m_device.deleteRenderTarget(intermediateTarget.renderTarget);
+            m_device.deleteRenderBuffer(intermediateTarget.colorBuffer);
+        }
 
         if (m_scenesRenderTarget != m_framebuffer)
         {
@@ -62,24 +103,86 @@ namespace ramses_internal
         }
     }
 
+    void Postprocessing::addPass(PostprocessingPass* pass, UInt32 outputWidth, UInt32 outputHeight)
+    {
+        m_passes.push_back({ std::unique_ptr<PostprocessingPass>(pass), outputWidth, outputHeight });
+    }
+
+    UInt Postprocessing::acquireIntermediateTarget(UInt32 width, UInt32 height)
+    {
+        for (UInt i = 0u; i < m_intermediateTargetPool.size(); ++i)
+        {
+            IntermediateTarget& intermediateTarget = m_intermediateTargetPool[i];
+            if (!intermediateTarget.inUse && intermediateTarget.width == width && intermediateTarget.height == height)
+            {
+                intermediateTarget.inUse = true;
+                return i;
+            }
+        }
+
+        // passes always overwrite whole target, no depth buffer needed
+        IntermediateTarget intermediateTarget;
+        intermediateTarget.width = width;
+        intermediateTarget.height = height;
+        intermediateTarget.colorBuffer = m_device.uploadRenderBuffer({ width, height, ERenderBufferType_ColorBuffer, ETextureFormat_RGBA8, ERenderBufferAccessMode_ReadWrite, 0u });
+        assert(intermediateTarget.colorBuffer.isValid());
+        intermediateTarget.renderTarget = m_device.uploadRenderTarget({ intermediateTarget.colorBuffer });
+        intermediateTarget.inUse = true;
+        m_intermediateTargetPool.push_back(intermediateTarget);
+
+        return m_intermediateTargetPool.size() - 1u;
+    }
+
     void Postprocessing::execute()
     {
-        if (nullptr != m_warpingPass)
+        const UInt noIntermediateTarget = std::numeric_limits<UInt>::max();
+        DeviceResourceHandle sourceColorBuffer = m_scenesColorBuffer;
+        UInt sourceTargetIdx = noIntermediateTarget;
+
+        for (UInt passIdx = 0u; passIdx < m_passes.size(); ++passIdx)
         {
-            m_device.activateRenderTarget(m_framebuffer);
-            m_device.cullMode(ECullMode::Disabled);
-            m_device.scissorTest(EScissorTest::Disabled, {});
-            m_device.depthFunc(EDepthFunc::Disabled);
-            m_device.depthWrite(EDepthWrite::Disabled);
-            m_device.colorMask(true, true, true, true);
-            // Use default clear color here, the content should be anyway overwritten by warped 'scenes buffer'.
-            // If warping geometry does not cover whole frame, this clear color will be in the final image.
-            // TODO vaclav use framebuffer clear color set in renderer also here.
-            m_device.clearColor({ 0.f, 0.f, 0.f, 1.f });
-            m_device.clear(EClearFlags_Color);
-            m_device.setViewport(0u, 0u, m_displayWidth, m_displayHeight);
-
-            m_warpingPass->execute(m_scenesColorBuffer);
+            const ChainedPass& chainedPass = m_passes[passIdx];
+            const Bool isLastPass = (passIdx + 1u == m_passes.size());
+
+            UInt targetIdx = noIntermediateTarget;
+            if (isLastPass)
+            {
+                m_device.activateRenderTarget(m_framebuffer);
+            }
+            else
+            {
+                targetIdx = acquireIntermediateTarget(chainedPass.outputWidth, chainedPass.outputHeight);
+                m_device.activateRenderTarget(m_intermediateTargetPool[targetIdx].renderTarget);
+            }
+
+            if (passIdx == 0u)
+            {
+                m_device.cullMode(ECullMode::Disabled);
+                m_device.scissorTest(EScissorTest::Disabled, {});
+                m_device.depthFunc(EDepthFunc::Disabled);
+                m_device.depthWrite(EDepthWrite::Disabled);
+                m_device.colorMask(true, true, true, true);
+            }
+
+            // Intermediate targets are fully overwritten by screen quad passes and need no clear.
+            if (isLastPass)
+            {
+                // Use default clear color here, the content should be anyway overwritten by warped 'scenes buffer'.
+                // If warping geometry does not cover whole frame, this clear color will be in the final image.
+                // TODO vaclav use framebuffer clear color set in renderer also here.
+                m_device.clearColor({ 0.f, 0.f, 0.f, 1.f });
+                m_device.clear(EClearFlags_Color);
+            }
+            m_device.setViewport(0u, 0u, chainedPass.outputWidth, chainedPass.outputHeight);
+
+            chainedPass.pass->execute(sourceColorBuffer);
+
+            // source is not read anymore and can be reused by following passes
+            if (sourceTargetIdx != noIntermediateTarget)
+                m_intermediateTargetPool[sourceTargetIdx].inUse = false;
+            if (targetIdx != noIntermediateTarget)
+                sourceColorBuffer = m_intermediateTargetPool[targetIdx].colorBuffer;
+            sourceTargetIdx = targetIdx;
         }
     }
 
@@ -98,11 +201,22 @@ namespace ramses_internal
         return m_framebuffer;
     }
 
+    UInt32 Postprocessing::getIntermediateTargetPoolSize() const
+    {
+        return static_cast<UInt32>(m_intermediateTargetPool.size());
+    }
+
     void Postprocessing::setWarpingMeshData(const WarpingMeshData& warpingMeshData)
     {
-        assert(nullptr != m_warpingPass);
-        delete m_warpingPass;
+        assert((m_postEffectsMask & EPostProcessingEffect_Warping) != 0u);
+        // delete old pass first so that device resources are released before new ones are created
+        m_passes[m_warpingPassIndex].pass.reset();
+        m_passes[m_warpingPassIndex].pass.reset(new WarpingPass(m_device, warpingMeshData));
+    }
 
-        m_warpingPass = new WarpingPass(m_device, warpingMeshData);
+    void Postprocessing::setColorCorrectionLookupTable(const std::vector<UInt8>& lookupTable)
+    {
+        assert(nullptr != m_colorCorrectionPass);
+        m_colorCorrectionPass->setLookupTable(lookupTable);
     }
 }
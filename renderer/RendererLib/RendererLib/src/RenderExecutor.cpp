@@ -8,22 +8,30 @@
 
 #include "RenderExecutor.h"
 #include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/GpuTimerQueries.h"
 #include "RendererAPI/IDevice.h"
 #include "SceneAPI/BlitPass.h"
+#include "Utils/TraceEventRecorder.h"
 
 namespace ramses_internal
 {
     UInt32 RenderExecutor::NumRenderablesToRenderInBetweenTimeBudgetChecks = RenderExecutor::DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks;
 
-    RenderExecutor::RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
+    RenderExecutor::RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer, GpuTimerQueries* gpuTimerQueries)
         : m_state(device, frameBuffer, renderFrom, frameTimer)
+        , m_gpuTimerQueries(gpuTimerQueries)
     {
     }
 
     SceneRenderExecutionIterator RenderExecutor::executeScene(const RendererCachedScene& scene, const Matrix44f& rendererViewMatrix) const
     {
+        TRACE_SCOPE_WITH_ID("renderer", "RenderScene", scene.getSceneId().getValue());
         setGlobalInternalStates(scene, rendererViewMatrix);
 
+        // decide which render targets need re-rendering only when scene rendering starts, not when resumed after interruption
+        if (m_state.m_currentRenderIterator == SceneRenderExecutionIterator())
+            scene.updateRenderTargetsToRender(rendererViewMatrix);
+
         const RenderingPassInfoVector& orderedPasses = scene.getSortedRenderingPasses();
         for ( ; m_state.m_currentRenderIterator.getRenderPassIdx() < orderedPasses.size(); m_state.m_currentRenderIterator.incrementRenderPassIdx())
         {
@@ -31,12 +39,25 @@ namespace ramses_internal
             switch (passInfo.getType())
             {
             case ERenderingPassType::RenderPass:
-                if (!executeRenderPass(scene, passInfo.getRenderPassHandle()))
+            {
+                // render target content from previous frame is kept if none of its inputs changed
+                if (scene.canRenderPassBeSkipped(passInfo.getRenderPassHandle()))
+                    break;
+
+                if (m_gpuTimerQueries)
+                    m_gpuTimerQueries->beginRenderPass(passInfo.getRenderPassHandle());
+                const Bool passFinished = executeRenderPass(scene, passInfo.getRenderPassHandle());
+                // interrupted pass is measured up to interruption, its remaining part is measured separately when resumed
+                if (m_gpuTimerQueries)
+                    m_gpuTimerQueries->endRenderPass();
+
+                if (!passFinished)
                 {
                     assert(m_state.m_currentRenderIterator.getFlattenedRenderableIdx() > 0);
                     return m_state.m_currentRenderIterator;
                 }
                 break;
+            }
             case ERenderingPassType::BlitPass:
                 executeBlitPass(scene, passInfo.getBlitPassHandle());
                 break;
@@ -50,6 +71,7 @@ namespace ramses_internal
 
     Bool RenderExecutor::executeRenderPass(const RendererCachedScene& scene, const RenderPassHandle pass) const
     {
+        TRACE_SCOPE_WITH_ID("renderer", "RenderPass", pass.asMemoryHandle());
         const RenderPass& renderPass = scene.getRenderPass(pass);
         executeRenderTarget(renderPass.renderTarget);
         executeCamera(renderPass.camera);
@@ -85,7 +107,7 @@ namespace ramses_internal
             }
         }
 
-        const RenderableVector& orderedRenderables = scene.getOrderedRenderablesForPass(pass);
+        const RenderableVector& orderedRenderables = scene.getRenderablesInFrustumForPass(pass, m_state.getProjectionMatrix() * m_state.getViewMatrix());
         while (m_state.m_currentRenderIterator.getRenderableIdx() < orderedRenderables.size())
         {
             const RenderableHandle renderableHandle = orderedRenderables[m_state.m_currentRenderIterator.getRenderableIdx()];
@@ -528,6 +550,7 @@ namespace ramses_internal
 
     void RenderExecutor::executeBlitPass(const RendererCachedScene& scene, const BlitPassHandle pass) const
     {
+        TRACE_SCOPE_WITH_ID("renderer", "BlitPass", pass.asMemoryHandle());
         //set invalid render target to state
         m_state.renderTargetState.setState(RenderTargetHandle::Invalid() - 1);
 
@@ -24,6 +24,8 @@
 #include "RendererLib/SceneExpirationMonitor.h"
 #include "Platform_Base/PlatformFactory_Base.h"
 #include "Utils/LogMacros.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
@@ -46,6 +48,8 @@ namespace ramses_internal
     Renderer::~Renderer()
     {
         assert(m_displays.empty());
+        // writers of stopped frame captures still writing are waited for when destroyed
+        m_finishingFrameStreamWriters.clear();
         m_platformFactory.destroyPerRendererComponents();
     }
 
@@ -162,6 +166,22 @@ namespace ramses_internal
         IDisplayController& displayController = *displayInfo.displayController;
         displayController.validateRenderingStatusHealthy();
 
+        if (!displayInfo.pendingScreenshots.empty())
+        {
+            // release pending reads, screenshots of removed display are not reported
+            displayController.enableContext();
+            std::vector<UInt8> ignoredPixelData;
+            for (const auto& pendingScreenshot : displayInfo.pendingScreenshots)
+                displayController.finishReadPixels(pendingScreenshot.readPixelsHandle, pendingScreenshot.screenshot.rectangle.width, pendingScreenshot.screenshot.rectangle.height, ignoredPixelData);
+        }
+        stopFrameCapture(display);
+        if (displayInfo.gpuTimerQueriesEnabled)
+        {
+            // release pending queries, their results are not reported
+            displayController.enableContext();
+            displayController.enableGpuTimerQueries(false);
+        }
+
         m_displays.erase(display);
         m_scheduledScreenshots.remove(display);
 
@@ -361,6 +381,8 @@ namespace ramses_internal
         profileRenderer->renderStatistics(m_profilerStatistics);
 
         processScheduledScreenshots(displayHandle, display, activeDisplay);
+        if (displayInfo.frameCapture.captureThisFrame)
+            captureFrame(displayHandle, display);
 
         m_tempDisplaysToSwapBuffers.push_back(displayHandle);
         displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayInfo.frameBufferDeviceHandle, false);
@@ -505,6 +527,17 @@ namespace ramses_internal
         m_profilerStatistics.endRegion(FrameProfilerStatistics::ERegion::HandleDisplayEvents);
 
         m_profilerStatistics.startRegion(FrameProfilerStatistics::ERegion::DrawScenes);
+        // SCREENSHOTS, CAPTURED FRAMES AND GPU TIMES MEASURED IN PREVIOUS FRAMES
+        for (const auto& displayIt : m_displays)
+        {
+            processPendingScreenshots(displayIt.first, activeDisplay);
+            processPendingFrameCaptures(displayIt.first, activeDisplay);
+            processGpuTimerQueries(displayIt.first, activeDisplay);
+        }
+        for (auto displayHandle : m_tempDisplaysToRender)
+            updateFrameCaptureSchedule(displayHandle);
+        destroyFinishedFrameStreamWriters();
+
         // FRAMEBUFFER AND OFFSCREEN BUFFERS
         for (auto displayHandle : m_tempDisplaysToRender)
         {
@@ -554,7 +587,16 @@ namespace ramses_internal
 
     void Renderer::onSceneWasRendered(const RendererCachedScene& scene)
     {
+        UInt numCulledRenderables = 0u;
+        UInt numRenderablesInFrustum = 0u;
+        scene.getFrustumCullingResult(numCulledRenderables, numRenderablesInFrustum);
+        m_statistics.trackFrustumCulling(scene.getSceneId(), numCulledRenderables, numRenderablesInFrustum);
+
+        m_statistics.trackSkippedRenderPasses(scene.getSceneId(), scene.getNumSkippedRenderPasses());
+
         scene.markAllRenderOncePassesAsRendered();
+        if (m_skipUnmodifiedBuffers)
+            scene.markRenderTargetsAsRendered();
         m_expirationMonitor.onRendered(scene.getSceneId());
         m_statistics.sceneRendered(scene.getSceneId());
     }
@@ -602,6 +644,7 @@ namespace ramses_internal
         displayInfo.buffersSetup.mapSceneToDisplayBuffer(sceneId, buffer, globalSceneOrder);
         if (wasShown)
             displayInfo.buffersSetup.setSceneShown(sceneId, wasShown);
+        m_rendererScenes.getScene(sceneId).setRenderTargetsSkippingEnabled(m_skipUnmodifiedBuffers);
     }
 
     void Renderer::unmapScene(SceneId sceneId)
@@ -637,6 +680,14 @@ namespace ramses_internal
     void Renderer::setSkippingOfUnmodifiedBuffers(Bool enable)
     {
         m_skipUnmodifiedBuffers = enable;
+        for (const auto& sceneIt : m_rendererScenes)
+            sceneIt.value.scene->setRenderTargetsSkippingEnabled(enable);
+    }
+
+    void Renderer::setGpuTimerQueriesEnabled(Bool enable)
+    {
+        // applied to displays in next render loop when their context can be activated
+        m_gpuTimerQueriesEnabled = enable;
     }
 
     DisplayHandle Renderer::getDisplaySceneIsMappedTo(SceneId sceneId) const
@@ -740,9 +791,19 @@ namespace ramses_internal
         }
         else
         {
-            const UInt32 postProcessorEffects = config.isWarpingEnabled() ? EPostProcessingEffect_Warping : EPostProcessingEffect_None;
+            UInt32 postProcessorEffects = EPostProcessingEffect_None;
+            if (config.isWarpingEnabled())
+                postProcessorEffects |= EPostProcessingEffect_Warping;
+            if (!config.getColorCorrectionLookupTable().empty())
+                postProcessorEffects |= EPostProcessingEffect_ColorCorrection;
+            if (config.isDownscaleEnabled())
+                postProcessorEffects |= EPostProcessingEffect_Downscale;
+
             const UInt32 numSamples = (config.getAntialiasingMethod() == EAntiAliasingMethod_MultiSampling) ? config.getAntialiasingSampleCount() : 1u;
-            displayController = new DisplayController(*renderBackend, numSamples, postProcessorEffects);
+            DisplayController* monoDisplayController = new DisplayController(*renderBackend, numSamples, postProcessorEffects);
+            if (!config.getColorCorrectionLookupTable().empty())
+                monoDisplayController->setColorCorrectionLookupTable(config.getColorCorrectionLookupTable());
+            displayController = monoDisplayController;
         }
         assert(displayController != nullptr);
 
@@ -783,8 +844,17 @@ namespace ramses_internal
         if (!displayScreenshots.empty())
             ActivateDisplayContext(display, activeDisplay, controller);
 
+        PendingScreenshots& pendingScreenshots = m_displays.find(display)->second.pendingScreenshots;
         for(const auto& screenshot : displayScreenshots)
         {
+            // pixels are read asynchronously if supported and finished in one of next frames without stalling rendering
+            const DeviceResourceHandle readPixelsHandle = controller.startReadPixels(screenshot.rectangle.x, screenshot.rectangle.y, screenshot.rectangle.width, screenshot.rectangle.height);
+            if (readPixelsHandle.isValid())
+            {
+                pendingScreenshots.push_back({ screenshot, readPixelsHandle });
+                continue;
+            }
+
             m_processedScreenshots.push_back(screenshot);
             ScreenshotInfo& result = m_processedScreenshots.back();
             result.success = controller.readPixels(result.rectangle.x, result.rectangle.y, result.rectangle.width, result.rectangle.height, result.pixelData);
@@ -793,6 +863,207 @@ namespace ramses_internal
         displayScreenshots.clear();
     }
 
+    void Renderer::processPendingScreenshots(DisplayHandle display, DisplayHandle& activeDisplay)
+    {
+        DisplayInfo& displayInfo = m_displays.find(display)->second;
+        PendingScreenshots& pendingScreenshots = displayInfo.pendingScreenshots;
+        if (pendingScreenshots.empty())
+            return;
+
+        IDisplayController& controller = *displayInfo.displayController;
+        ActivateDisplayContext(display, activeDisplay, controller);
+
+        // keep order in which screenshots were taken, stop at first read that is not finished yet
+        auto pendingIt = pendingScreenshots.begin();
+        for (; pendingIt != pendingScreenshots.end(); ++pendingIt)
+        {
+            if (!controller.isReadPixelsFinished(pendingIt->readPixelsHandle))
+                break;
+
+            m_processedScreenshots.push_back(std::move(pendingIt->screenshot));
+            ScreenshotInfo& result = m_processedScreenshots.back();
+            result.success = controller.finishReadPixels(pendingIt->readPixelsHandle, result.rectangle.width, result.rectangle.height, result.pixelData);
+        }
+        pendingScreenshots.erase(pendingScreenshots.begin(), pendingIt);
+    }
+
+    void Renderer::startFrameCapture(DisplayHandle display, const String& filename, Float framesPerSecond)
+    {
+        assert(hasDisplayController(display));
+        assert(framesPerSecond >= 0.f);
+        stopFrameCapture(display);
+
+        DisplayInfo& displayInfo = m_displays.find(display)->second;
+        const IDisplayController& controller = *displayInfo.displayController;
+        FrameCapture& capture = displayInfo.frameCapture;
+        capture.writer.reset(new FrameStreamWriter(filename, controller.getDisplayWidth(), controller.getDisplayHeight()));
+        capture.captureIntervalMicroseconds = (framesPerSecond > 0.f ? static_cast<UInt64>(1000000.0 / framesPerSecond) : 0u);
+        capture.nextCaptureTimeMicroseconds = PlatformTime::GetMicrosecondsMonotonic();
+
+        LOG_INFO(CONTEXT_RENDERER, "Renderer::startFrameCapture: capturing frames of display " << display.asMemoryHandle() << " to " << filename << " at " << framesPerSecond << " FPS (0 = every rendered frame)");
+    }
+
+    void Renderer::stopFrameCapture(DisplayHandle display)
+    {
+        assert(hasDisplayController(display));
+        DisplayInfo& displayInfo = m_displays.find(display)->second;
+        FrameCapture& capture = displayInfo.frameCapture;
+        if (!capture.writer)
+            return;
+
+        if (!capture.pendingReads.empty())
+        {
+            IDisplayController& controller = *displayInfo.displayController;
+            controller.enableContext();
+            for (const auto& pendingRead : capture.pendingReads)
+            {
+                std::vector<UInt8> pixelData;
+                if (controller.finishReadPixels(pendingRead.readPixelsHandle, pendingRead.width, pendingRead.height, pixelData))
+                    writeCapturedFrame(display, capture, pendingRead.width, pendingRead.height, std::move(pixelData));
+                else
+                    dropCapturedFrames(display, capture, 1u);
+            }
+        }
+
+        // writer might block on a named pipe without consumer, so frames still queued are written without waiting for it
+        capture.writer->finish();
+        m_finishingFrameStreamWriters.push_back(std::move(capture.writer));
+        LOG_INFO(CONTEXT_RENDERER, "Renderer::stopFrameCapture: display " << display.asMemoryHandle() << " captured " << capture.numFramesCaptured << " frames, dropped " << capture.numFramesDropped << " frames");
+        capture = FrameCapture();
+    }
+
+    Bool Renderer::isCapturingFrames(DisplayHandle display) const
+    {
+        assert(hasDisplayController(display));
+        return m_displays.find(display)->second.frameCapture.writer != nullptr;
+    }
+
+    void Renderer::updateFrameCaptureSchedule(DisplayHandle display)
+    {
+        DisplayInfo& displayInfo = m_displays.find(display)->second;
+        FrameCapture& capture = displayInfo.frameCapture;
+        if (!capture.writer)
+            return;
+
+        if (capture.captureIntervalMicroseconds > 0u)
+        {
+            const UInt64 currentTime = PlatformTime::GetMicrosecondsMonotonic();
+            if (currentTime < capture.nextCaptureTimeMicroseconds)
+                return;
+
+            // capture times that passed without rendering any frame are reported as dropped to keep output at fixed rate
+            const UInt64 numMissedFrames = (currentTime - capture.nextCaptureTimeMicroseconds) / capture.captureIntervalMicroseconds;
+            if (numMissedFrames > 0u)
+                dropCapturedFrames(display, capture, static_cast<UInt>(numMissedFrames));
+            capture.nextCaptureTimeMicroseconds += (numMissedFrames + 1u) * capture.captureIntervalMicroseconds;
+        }
+
+        // frame must be rendered also if nothing changed on display
+        capture.captureThisFrame = true;
+        displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayInfo.frameBufferDeviceHandle, true);
+    }
+
+    void Renderer::captureFrame(DisplayHandle display, IDisplayController& controller)
+    {
+        FrameCapture& capture = m_displays.find(display)->second.frameCapture;
+        capture.captureThisFrame = false;
+
+        // do not stall rendering if reads of previous frames did not finish yet
+        if (capture.pendingReads.size() >= MaximumPendingFrameCaptureReads)
+        {
+            dropCapturedFrames(display, capture, 1u);
+            return;
+        }
+
+        const UInt32 width = controller.getDisplayWidth();
+        const UInt32 height = controller.getDisplayHeight();
+        const DeviceResourceHandle readPixelsHandle = controller.startReadPixels(0u, 0u, width, height);
+        if (readPixelsHandle.isValid())
+        {
+            capture.pendingReads.push_back({ readPixelsHandle, width, height });
+            return;
+        }
+
+        std::vector<UInt8> pixelData;
+        if (controller.readPixels(0u, 0u, width, height, pixelData))
+            writeCapturedFrame(display, capture, width, height, std::move(pixelData));
+        else
+            dropCapturedFrames(display, capture, 1u);
+    }
+
+    void Renderer::processPendingFrameCaptures(DisplayHandle display, DisplayHandle& activeDisplay)
+    {
+        DisplayInfo& displayInfo = m_displays.find(display)->second;
+        FrameCapture& capture = displayInfo.frameCapture;
+        if (capture.pendingReads.empty())
+            return;
+
+        IDisplayController& controller = *displayInfo.displayController;
+        ActivateDisplayContext(display, activeDisplay, controller);
+
+        while (!capture.pendingReads.empty() && controller.isReadPixelsFinished(capture.pendingReads.front().readPixelsHandle))
+        {
+            const PendingFrameCaptureRead& pendingRead = capture.pendingReads.front();
+            std::vector<UInt8> pixelData;
+            if (controller.finishReadPixels(pendingRead.readPixelsHandle, pendingRead.width, pendingRead.height, pixelData))
+                writeCapturedFrame(display, capture, pendingRead.width, pendingRead.height, std::move(pixelData));
+            else
+                dropCapturedFrames(display, capture, 1u);
+            capture.pendingReads.pop_front();
+        }
+    }
+
+    void Renderer::processGpuTimerQueries(DisplayHandle display, DisplayHandle& activeDisplay)
+    {
+        DisplayInfo& displayInfo = m_displays.find(display)->second;
+        if (!displayInfo.gpuTimerQueriesEnabled && !m_gpuTimerQueriesEnabled)
+            return;
+
+        IDisplayController& controller = *displayInfo.displayController;
+        ActivateDisplayContext(display, activeDisplay, controller);
+
+        if (displayInfo.gpuTimerQueriesEnabled)
+            controller.collectGpuTimerQueryResults(m_statistics);
+        if (displayInfo.gpuTimerQueriesEnabled != m_gpuTimerQueriesEnabled)
+        {
+            controller.enableGpuTimerQueries(m_gpuTimerQueriesEnabled);
+            displayInfo.gpuTimerQueriesEnabled = m_gpuTimerQueriesEnabled;
+        }
+    }
+
+    void Renderer::writeCapturedFrame(DisplayHandle display, FrameCapture& capture, UInt32 width, UInt32 height, std::vector<UInt8>&& pixelData)
+    {
+        // stream has fixed frame size, frames of resized display are dropped
+        if (width != capture.writer->getFrameWidth() || height != capture.writer->getFrameHeight())
+        {
+            LOG_WARN(CONTEXT_RENDERER, "Renderer::writeCapturedFrame: display " << display.asMemoryHandle() << " size " << width << "x" << height
+                << " differs from size of captured frames " << capture.writer->getFrameWidth() << "x" << capture.writer->getFrameHeight() << ", frame dropped");
+            dropCapturedFrames(display, capture, 1u);
+            return;
+        }
+
+        if (!capture.writer->writeFrame(std::move(pixelData)))
+        {
+            dropCapturedFrames(display, capture, 1u);
+            return;
+        }
+
+        ++capture.numFramesCaptured;
+        m_statistics.frameCaptured(display);
+    }
+
+    void Renderer::destroyFinishedFrameStreamWriters()
+    {
+        m_finishingFrameStreamWriters.erase(std::remove_if(m_finishingFrameStreamWriters.begin(), m_finishingFrameStreamWriters.end(),
+            [](const std::unique_ptr<FrameStreamWriter>& writer) { return writer->isFinished(); }), m_finishingFrameStreamWriters.end());
+    }
+
+    void Renderer::dropCapturedFrames(DisplayHandle display, FrameCapture& capture, UInt numDroppedFrames)
+    {
+        capture.numFramesDropped += numDroppedFrames;
+        m_statistics.frameCaptureDropped(display, numDroppedFrames);
+    }
+
     void Renderer::dispatchProcessedScreenshots(ScreenshotInfoVector& screenshots)
     {
         assert(screenshots.empty());
@@ -26,6 +26,12 @@ namespace ramses_internal
         m_renderableOrderingDirty = true;
     }
 
+    void RendererCachedScene::setRenderableBoundingSphere(RenderableHandle renderableHandle, const Vector4& boundingSphere)
+    {
+        TextureLinkCachedScene::setRenderableBoundingSphere(renderableHandle, boundingSphere);
+        ++m_frustumCullingGeneration;
+    }
+
     void RendererCachedScene::releaseRenderGroup(RenderGroupHandle groupHandle)
     {
         TextureLinkCachedScene::releaseRenderGroup(groupHandle);
@@ -145,6 +151,96 @@ namespace ramses_internal
         m_renderableOrderingDirty = true;
     }
 
+    void RendererCachedScene::setDataFloatArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Float* data)
+    {
+        TextureLinkCachedScene::setDataFloatArray(containerHandle, field, elementCount, data);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataVector2fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector2* data)
+    {
+        TextureLinkCachedScene::setDataVector2fArray(containerHandle, field, elementCount, data);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataVector3fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector3* data)
+    {
+        TextureLinkCachedScene::setDataVector3fArray(containerHandle, field, elementCount, data);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataVector4fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector4* data)
+    {
+        TextureLinkCachedScene::setDataVector4fArray(containerHandle, field, elementCount, data);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataIntegerArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Int32* data)
+    {
+        TextureLinkCachedScene::setDataIntegerArray(containerHandle, field, elementCount, data);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataVector2iArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector2i* data)
+    {
+        TextureLinkCachedScene::setDataVector2iArray(containerHandle, field, elementCount, data);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataVector3iArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector3i* data)
+    {
+        TextureLinkCachedScene::setDataVector3iArray(containerHandle, field, elementCount, data);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataVector4iArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector4i* data)
+    {
+        TextureLinkCachedScene::setDataVector4iArray(containerHandle, field, elementCount, data);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataMatrix22fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix22f* data)
+    {
+        TextureLinkCachedScene::setDataMatrix22fArray(containerHandle, field, elementCount, data);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataMatrix33fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix33f* data)
+    {
+        TextureLinkCachedScene::setDataMatrix33fArray(containerHandle, field, elementCount, data);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataMatrix44fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix44f* data)
+    {
+        TextureLinkCachedScene::setDataMatrix44fArray(containerHandle, field, elementCount, data);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataResource(DataInstanceHandle containerHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, UInt32 instancingDivisor)
+    {
+        TextureLinkCachedScene::setDataResource(containerHandle, field, hash, dataBuffer, instancingDivisor);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataTextureSamplerHandle(DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle)
+    {
+        TextureLinkCachedScene::setDataTextureSamplerHandle(containerHandle, field, samplerHandle);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataReference(DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef)
+    {
+        TextureLinkCachedScene::setDataReference(containerHandle, field, dataRef);
+        setDataInstanceModified(containerHandle);
+    }
+
+    void RendererCachedScene::setDataInstanceModified(DataInstanceHandle dataInstance)
+    {
+        if (m_renderTargetsSkippingEnabled)
+            m_modifiedDataInstances.put(dataInstance);
+    }
+
     const RenderingPassInfoVector& RendererCachedScene::getSortedRenderingPasses() const
     {
         return m_sortedRenderingPasses;
@@ -207,6 +303,8 @@ namespace ramses_internal
             }
 
             m_renderableOrderingDirty = false;
+            ++m_frustumCullingGeneration;
+            m_renderTargetsContentInvalid = true;
         }
     }
 
@@ -293,7 +391,7 @@ namespace ramses_internal
                 assert(renderable.isValid());
                 const NodeHandle node = getRenderable(renderable).node;
                 assert(node.isValid());
-                m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCache(ETransformationMatrixType_World, node);
+                setRenderableWorldMatrix(renderable, updateMatrixCache(ETransformationMatrixType_World, node));
             }
         }
     }
@@ -308,9 +406,339 @@ namespace ramses_internal
                 assert(renderable.isValid());
                 const NodeHandle node = TextureLinkCachedScene::getRenderable(renderable).node;
                 assert(node.isValid());
-                m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCacheWithLinks(ETransformationMatrixType_World, node);
+                setRenderableWorldMatrix(renderable, updateMatrixCacheWithLinks(ETransformationMatrixType_World, node));
+            }
+        }
+    }
+
+    void RendererCachedScene::setRenderableWorldMatrix(RenderableHandle renderable, const Matrix44f& worldMatrix)
+    {
+        Matrix44f& cachedMatrix = m_renderableMatrices[renderable.asMemoryHandle()];
+        if (cachedMatrix != worldMatrix)
+        {
+            cachedMatrix = worldMatrix;
+            ++m_frustumCullingGeneration;
+            if (m_renderTargetsSkippingEnabled)
+                m_modifiedRenderables.put(renderable);
+        }
+    }
+
+    void RendererCachedScene::onRenderableResourcesDirtinessChanged(RenderableHandle renderable) const
+    {
+        // renderables with unresolved resources are not rendered, render targets they are rendered into
+        // have to be re-rendered once their resources get resolved
+        if (m_renderTargetsSkippingEnabled)
+            m_modifiedRenderables.put(renderable);
+    }
+
+    static Bool IsBoundingSphereOutsideOfFrustum(const Vector4 (&frustumPlanes)[6], const Matrix44f& worldMatrix, const Vector4& boundingSphere)
+    {
+        const Vector4 center = worldMatrix * Vector4(boundingSphere.x, boundingSphere.y, boundingSphere.z, 1.f);
+
+        // conservative radius in world space for non-uniform scaling
+        const Float scaleX = Vector3(worldMatrix.m11, worldMatrix.m21, worldMatrix.m31).length();
+        const Float scaleY = Vector3(worldMatrix.m12, worldMatrix.m22, worldMatrix.m32).length();
+        const Float scaleZ = Vector3(worldMatrix.m13, worldMatrix.m23, worldMatrix.m33).length();
+        const Float radius = boundingSphere.w * std::max(scaleX, std::max(scaleY, scaleZ));
+
+        for (const auto& plane : frustumPlanes)
+        {
+            const Float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+            if (distance < -radius * Vector3(plane.x, plane.y, plane.z).length())
+                return true;
+        }
+
+        return false;
+    }
+
+    const RenderableVector& RendererCachedScene::getRenderablesInFrustumForPass(RenderPassHandle pass, const Matrix44f& viewProjectionMatrix) const
+    {
+        const RenderableVector& orderedRenderables = getOrderedRenderablesForPass(pass);
+
+        m_passFrustumCullingCache.resize(m_passRenderableOrder.size());
+        PassFrustumCullingCache& cache = m_passFrustumCullingCache[pass.asMemoryHandle()];
+        if (cache.generation == m_frustumCullingGeneration && cache.viewProjectionMatrix == viewProjectionMatrix)
+            return cache.renderablesInFrustum;
+
+        // frustum planes in world space extracted from view projection matrix (left, right, bottom, top, near, far)
+        const Matrix44f& m = viewProjectionMatrix;
+        const Vector4 row1(m.m11, m.m12, m.m13, m.m14);
+        const Vector4 row2(m.m21, m.m22, m.m23, m.m24);
+        const Vector4 row3(m.m31, m.m32, m.m33, m.m34);
+        const Vector4 row4(m.m41, m.m42, m.m43, m.m44);
+        const Vector4 frustumPlanes[6] = { row4 + row1, row4 - row1, row4 + row2, row4 - row2, row4 + row3, row4 - row3 };
+
+        cache.renderablesInFrustum.clear();
+        for (const auto renderable : orderedRenderables)
+        {
+            const Vector4& boundingSphere = TextureLinkCachedScene::getRenderable(renderable).boundingSphere;
+            if (boundingSphere.w <= 0.f || !IsBoundingSphereOutsideOfFrustum(frustumPlanes, getRenderableWorldMatrix(renderable), boundingSphere))
+                cache.renderablesInFrustum.push_back(renderable);
+        }
+        cache.viewProjectionMatrix = viewProjectionMatrix;
+        cache.generation = m_frustumCullingGeneration;
+
+        return cache.renderablesInFrustum;
+    }
+
+    void RendererCachedScene::getFrustumCullingResult(UInt& numCulledRenderables, UInt& numRenderablesInFrustum) const
+    {
+        numCulledRenderables = 0u;
+        numRenderablesInFrustum = 0u;
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (ERenderingPassType::RenderPass != pass.getType())
+                continue;
+
+            const RenderPassHandle passHandle = pass.getRenderPassHandle();
+            if (passHandle.asMemoryHandle() < m_passFrustumCullingCache.size())
+            {
+                const PassFrustumCullingCache& cache = m_passFrustumCullingCache[passHandle.asMemoryHandle()];
+                if (cache.generation == m_frustumCullingGeneration)
+                {
+                    numRenderablesInFrustum += cache.renderablesInFrustum.size();
+                    numCulledRenderables += getOrderedRenderablesForPass(passHandle).size() - cache.renderablesInFrustum.size();
+                }
+            }
+        }
+    }
+
+    void RendererCachedScene::setRenderTargetsSkippingEnabled(Bool enable) const
+    {
+        if (enable == m_renderTargetsSkippingEnabled)
+            return;
+
+        // changes were not tracked while disabled
+        m_modifiedDataInstances.clear();
+        m_modifiedRenderables.clear();
+        m_renderTargetsContentInvalid = true;
+        m_renderTargetsSkippingEnabled = enable;
+    }
+
+    void RendererCachedScene::invalidateRenderTargetsContent()
+    {
+        m_renderTargetsContentInvalid = true;
+    }
+
+    void RendererCachedScene::updateRenderTargetsToRender(const Matrix44f& rendererViewMatrix) const
+    {
+        const UInt32 numRenderTargets = TextureLinkCachedScene::getRenderTargetCount();
+        const UInt32 numRenderBuffers = TextureLinkCachedScene::getRenderBufferCount();
+
+        m_numSkippedRenderPasses = 0u;
+        if (!m_renderTargetsSkippingEnabled)
+        {
+            m_renderTargetsToRender.assign(numRenderTargets, true);
+            return;
+        }
+
+        // if last rendering did not finish all render targets might be partially rendered
+        const Bool renderAllRenderTargets = m_renderTargetsContentInvalid || m_renderTargetsRenderingIncomplete;
+        m_renderTargetsToRender.assign(numRenderTargets, renderAllRenderTargets);
+        m_renderTargetsRenderedDeviceHandles.resize(numRenderTargets);
+        m_passViewMatrices.resize(TextureLinkCachedScene::getRenderPassCount());
+
+        // render buffers modified by blit passes are never considered unchanged
+        m_modifiedRenderBuffers.assign(numRenderBuffers, false);
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (ERenderingPassType::BlitPass == pass.getType())
+                m_modifiedRenderBuffers[TextureLinkCachedScene::getBlitPass(pass.getBlitPassHandle()).destinationRenderBuffer.asMemoryHandle()] = true;
+        }
+
+        if (!renderAllRenderTargets)
+        {
+            for (RenderTargetHandle renderTarget(0u); renderTarget < numRenderTargets; ++renderTarget)
+            {
+                if (TextureLinkCachedScene::isRenderTargetAllocated(renderTarget))
+                    m_renderTargetsToRender[renderTarget.asMemoryHandle()] = isRenderTargetModified(renderTarget, rendererViewMatrix);
+            }
+
+            // render target sampling content of another render target which is to be rendered has to be rendered as well
+            Bool renderTargetAdded = true;
+            while (renderTargetAdded)
+            {
+                renderTargetAdded = false;
+                for (RenderTargetHandle renderTarget(0u); renderTarget < numRenderTargets; ++renderTarget)
+                {
+                    if (m_renderTargetsToRender[renderTarget.asMemoryHandle()])
+                    {
+                        const UInt32 numBuffers = TextureLinkCachedScene::getRenderTargetRenderBufferCount(renderTarget);
+                        for (UInt32 i = 0u; i < numBuffers; ++i)
+                            m_modifiedRenderBuffers[TextureLinkCachedScene::getRenderTargetRenderBuffer(renderTarget, i).asMemoryHandle()] = true;
+                    }
+                }
+
+                for (const auto& pass : m_sortedRenderingPasses)
+                {
+                    if (ERenderingPassType::RenderPass != pass.getType())
+                        continue;
+
+                    const RenderTargetHandle renderTarget = TextureLinkCachedScene::getRenderPass(pass.getRenderPassHandle()).renderTarget;
+                    if (!renderTarget.isValid() || m_renderTargetsToRender[renderTarget.asMemoryHandle()])
+                        continue;
+
+                    const RenderableVector& renderables = getOrderedRenderablesForPass(pass.getRenderPassHandle());
+                    if (std::any_of(renderables.cbegin(), renderables.cend(), [this](RenderableHandle r) { return doesRenderableSampleModifiedContent(r); }))
+                    {
+                        m_renderTargetsToRender[renderTarget.asMemoryHandle()] = true;
+                        renderTargetAdded = true;
+                    }
+                }
             }
         }
+
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (ERenderingPassType::RenderPass != pass.getType())
+                continue;
+
+            const RenderPass& renderPass = TextureLinkCachedScene::getRenderPass(pass.getRenderPassHandle());
+            m_passViewMatrices[pass.getRenderPassHandle().asMemoryHandle()] = rendererViewMatrix * updateMatrixCacheWithLinks(ETransformationMatrixType_Object, TextureLinkCachedScene::getCamera(renderPass.camera).node);
+            if (canRenderPassBeSkipped(pass.getRenderPassHandle()))
+                ++m_numSkippedRenderPasses;
+        }
+
+        const DeviceHandleVector& renderTargetDeviceHandles = getCachedHandlesForRenderTargets();
+        for (RenderTargetHandle renderTarget(0u); renderTarget < numRenderTargets; ++renderTarget)
+        {
+            if (renderTarget.asMemoryHandle() < renderTargetDeviceHandles.size())
+                m_renderTargetsRenderedDeviceHandles[renderTarget.asMemoryHandle()] = renderTargetDeviceHandles[renderTarget.asMemoryHandle()];
+        }
+
+        m_modifiedDataInstances.clear();
+        m_modifiedRenderables.clear();
+        m_renderTargetsContentInvalid = false;
+        m_renderTargetsRenderingIncomplete = true;
+    }
+
+    Bool RendererCachedScene::canRenderPassBeSkipped(RenderPassHandle pass) const
+    {
+        const RenderTargetHandle renderTarget = TextureLinkCachedScene::getRenderPass(pass).renderTarget;
+        return renderTarget.isValid()
+            && renderTarget.asMemoryHandle() < m_renderTargetsToRender.size()
+            && !m_renderTargetsToRender[renderTarget.asMemoryHandle()];
+    }
+
+    void RendererCachedScene::markRenderTargetsAsRendered() const
+    {
+        m_renderTargetsRenderingIncomplete = false;
+    }
+
+    UInt32 RendererCachedScene::getNumSkippedRenderPasses() const
+    {
+        return m_numSkippedRenderPasses;
+    }
+
+    Bool RendererCachedScene::isRenderTargetModified(RenderTargetHandle renderTarget, const Matrix44f& rendererViewMatrix) const
+    {
+        const DeviceHandleVector& renderTargetDeviceHandles = getCachedHandlesForRenderTargets();
+        if (renderTarget.asMemoryHandle() >= renderTargetDeviceHandles.size()
+            || renderTargetDeviceHandles[renderTarget.asMemoryHandle()] != m_renderTargetsRenderedDeviceHandles[renderTarget.asMemoryHandle()])
+            return true;
+
+        const UInt32 numBuffers = TextureLinkCachedScene::getRenderTargetRenderBufferCount(renderTarget);
+        for (UInt32 i = 0u; i < numBuffers; ++i)
+        {
+            if (m_modifiedRenderBuffers[TextureLinkCachedScene::getRenderTargetRenderBuffer(renderTarget, i).asMemoryHandle()])
+                return true;
+        }
+
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (ERenderingPassType::RenderPass != pass.getType())
+                continue;
+
+            const RenderPass& renderPass = TextureLinkCachedScene::getRenderPass(pass.getRenderPassHandle());
+            if (renderPass.renderTarget != renderTarget)
+                continue;
+
+            const Camera& camera = TextureLinkCachedScene::getCamera(renderPass.camera);
+            const Matrix44f viewMatrix = rendererViewMatrix * updateMatrixCacheWithLinks(ETransformationMatrixType_Object, camera.node);
+            if (viewMatrix != m_passViewMatrices[pass.getRenderPassHandle().asMemoryHandle()] || isDataInstanceModified(camera.viewportDataInstance))
+                return true;
+
+            const RenderableVector& renderables = getOrderedRenderablesForPass(pass.getRenderPassHandle());
+            if (std::any_of(renderables.cbegin(), renderables.cend(), [this](RenderableHandle r) { return isRenderableModified(r); }))
+                return true;
+        }
+
+        return false;
+    }
+
+    Bool RendererCachedScene::isRenderableModified(RenderableHandle renderable) const
+    {
+        if (m_modifiedRenderables.hasElement(renderable) || renderableResourcesDirty(renderable))
+            return true;
+
+        const Renderable& renderableData = TextureLinkCachedScene::getRenderable(renderable);
+        for (const auto dataInstance : renderableData.dataInstances)
+        {
+            if (dataInstance.isValid() && isDataInstanceModified(dataInstance))
+                return true;
+        }
+
+        return doesRenderableSampleModifiedContent(renderable);
+    }
+
+    Bool RendererCachedScene::isDataInstanceModified(DataInstanceHandle dataInstance) const
+    {
+        if (m_modifiedDataInstances.hasElement(dataInstance))
+            return true;
+
+        // data references (e.g. camera viewport or consumers of data links) are modified separately from the referencing instance
+        const DataLayout& layout = TextureLinkCachedScene::getDataLayout(TextureLinkCachedScene::getLayoutOfDataInstance(dataInstance));
+        const UInt32 numFields = layout.getFieldCount();
+        for (DataFieldHandle field(0u); field < numFields; ++field)
+        {
+            if (layout.getField(field).dataType == EDataType_DataReference)
+            {
+                const DataInstanceHandle dataRef = TextureLinkCachedScene::getDataReference(dataInstance, field);
+                if (m_modifiedDataInstances.hasElement(dataRef))
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    Bool RendererCachedScene::doesRenderableSampleModifiedContent(RenderableHandle renderable) const
+    {
+        const DataInstanceHandle uniforms = TextureLinkCachedScene::getRenderable(renderable).dataInstances[ERenderableDataSlotType_Uniforms];
+        if (!uniforms.isValid())
+            return false;
+
+        const DataLayout& layout = TextureLinkCachedScene::getDataLayout(TextureLinkCachedScene::getLayoutOfDataInstance(uniforms));
+        const UInt32 numFields = layout.getFieldCount();
+        for (DataFieldHandle field(0u); field < numFields; ++field)
+        {
+            if (layout.getField(field).dataType != EDataType_TextureSampler)
+                continue;
+
+            const TextureSamplerHandle sampler = TextureLinkCachedScene::getDataTextureSamplerHandle(uniforms, field);
+            if (!sampler.isValid() || !TextureLinkCachedScene::isTextureSamplerAllocated(sampler))
+                continue;
+
+            // content of stream textures and linked textures can change without any modification of this scene
+            if (m_fallbackTextureSamplers.contains(sampler))
+                return true;
+
+            const TextureSampler& samplerData = TextureLinkCachedScene::getTextureSampler(sampler);
+            switch (samplerData.contentType)
+            {
+            case TextureSampler::ContentType::StreamTexture:
+            case TextureSampler::ContentType::OffscreenBuffer:
+                return true;
+            case TextureSampler::ContentType::RenderBuffer:
+                if (samplerData.contentHandle >= m_modifiedRenderBuffers.size() || m_modifiedRenderBuffers[samplerData.contentHandle])
+                    return true;
+                break;
+            default:
+                break;
+            }
+        }
+
+        return false;
     }
 
     Bool RendererCachedScene::shouldRenderPassBeRendered(RenderPassHandle handle) const
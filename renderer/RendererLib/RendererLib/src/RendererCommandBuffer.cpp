@@ -96,6 +96,18 @@ namespace ramses_internal
         RendererCommands::setClearColor(displayHandle, color);
     }
 
+    void RendererCommandBuffer::startFrameCapture(DisplayHandle displayHandle, const String& filename, Float framesPerSecond)
+    {
+        PlatformGuard guard(m_lock);
+        RendererCommands::startFrameCapture(displayHandle, filename, framesPerSecond);
+    }
+
+    void RendererCommandBuffer::stopFrameCapture(DisplayHandle displayHandle)
+    {
+        PlatformGuard guard(m_lock);
+        RendererCommands::stopFrameCapture(displayHandle);
+    }
+
     void RendererCommandBuffer::linkSceneData(SceneId providerSceneId, DataSlotId providerDataSlotId, SceneId consumerSceneId, DataSlotId consumerDataSlotId)
     {
         PlatformGuard guard(m_lock);
@@ -258,6 +270,12 @@ namespace ramses_internal
         RendererCommands::setSkippingOfUnmodifiedBuffers(enable);
     }
 
+    void RendererCommandBuffer::setGpuTimerQueries(Bool enable)
+    {
+        PlatformGuard guard(m_lock);
+        RendererCommands::setGpuTimerQueries(enable);
+    }
+
     void RendererCommandBuffer::lock()
     {
         m_lock.lock();
@@ -526,6 +544,18 @@ namespace ramses_internal
                 setClearColor(cmd.displayHandle, cmd.clearColor);
             }
             break;
+            case ERendererCommand_StartFrameCapture:
+            {
+                const auto& cmd = commands.getCommandData<FrameCaptureCommand>(i);
+                startFrameCapture(cmd.displayHandle, cmd.filename, cmd.framesPerSecond);
+            }
+            break;
+            case ERendererCommand_StopFrameCapture:
+            {
+                const auto& cmd = commands.getCommandData<FrameCaptureCommand>(i);
+                stopFrameCapture(cmd.displayHandle);
+            }
+            break;
             case ERendererCommand_SetFrameTimerLimits:
             {
                 const auto& cmd = commands.getCommandData<SetFrameTimerLimitsCommmand>(i);
@@ -550,6 +580,12 @@ namespace ramses_internal
                 setSkippingOfUnmodifiedBuffers(cmd.enable);
             }
             break;
+            case ERendererCommand_SetGpuTimerQueries:
+            {
+                const auto& cmd = commands.getCommandData<SetFeatureCommand>(i);
+                setGpuTimerQueries(cmd.enable);
+            }
+            break;
             default:
             {
                 assert(false);
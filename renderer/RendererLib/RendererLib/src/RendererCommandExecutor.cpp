@@ -201,6 +201,34 @@ namespace ramses_internal
                 }
                 break;
             }
+            case ERendererCommand_StartFrameCapture:
+            {
+                const auto& command = m_executedCommands.getCommandData<FrameCaptureCommand>(i);
+                LOG_INFO(CONTEXT_RENDERER, " - executing " << EnumToString(commandType) << " displayId " << command.displayHandle << " file " << command.filename << " fps " << command.framesPerSecond);
+                if (m_renderer.hasDisplayController(command.displayHandle))
+                {
+                    m_renderer.startFrameCapture(command.displayHandle, command.filename, command.framesPerSecond);
+                }
+                else
+                {
+                    LOG_ERROR(CONTEXT_RENDERER, "RendererCommandExecutor::startFrameCapture failed, unknown display " << command.displayHandle.asMemoryHandle());
+                }
+                break;
+            }
+            case ERendererCommand_StopFrameCapture:
+            {
+                const auto& command = m_executedCommands.getCommandData<FrameCaptureCommand>(i);
+                LOG_INFO(CONTEXT_RENDERER, " - executing " << EnumToString(commandType) << " displayId " << command.displayHandle);
+                if (m_renderer.hasDisplayController(command.displayHandle))
+                {
+                    m_renderer.stopFrameCapture(command.displayHandle);
+                }
+                else
+                {
+                    LOG_ERROR(CONTEXT_RENDERER, "RendererCommandExecutor::stopFrameCapture failed, unknown display " << command.displayHandle.asMemoryHandle());
+                }
+                break;
+            }
             case ERendererCommand_RelativeTranslation:
             {
                 const RendererViewCommand& command = m_executedCommands.getCommandData<RendererViewCommand>(i);
@@ -319,6 +347,7 @@ namespace ramses_internal
                 LOG_INFO(CONTEXT_RENDERER, " - executing " << EnumToString(commandType));
                 LOG_INFO_F(CONTEXT_RENDERER, ([&](StringOutputStream& sos) { m_renderer.getStatistics().writeStatsToStream(sos); }));
                 LOG_INFO_F(CONTEXT_RENDERER, ([&](StringOutputStream& sos) { m_renderer.getProfilerStatistics().writeLongestFrameTimingsToStream(sos); }));
+                LOG_INFO_F(CONTEXT_RENDERER, ([&](StringOutputStream& sos) { m_renderer.getProfilerStatistics().writeTimePercentilesToStream(sos); }));
                 break;
             }
             case ERendererCommand_ResetRenderView:
@@ -472,6 +501,13 @@ namespace ramses_internal
                 m_renderer.setSkippingOfUnmodifiedBuffers(command.enable);
                 break;
             }
+            case ERendererCommand_SetGpuTimerQueries:
+            {
+                const SetFeatureCommand& command = m_executedCommands.getCommandData<SetFeatureCommand>(i);
+                LOG_INFO(CONTEXT_RENDERER, " - executing " << EnumToString(commandType) << " enable=" << command.enable);
+                m_renderer.setGpuTimerQueriesEnabled(command.enable);
+                break;
+            }
             default:
                 LOG_ERROR(CONTEXT_RENDERER, "RendererCommandExecutor::executePendingCommands failed, unknown renderer command type!");
                 assert(false);
@@ -142,6 +142,23 @@ namespace ramses_internal
         m_commands.addCommand(ERendererCommand_SetClearColor, cmd);
     }
 
+    void RendererCommands::startFrameCapture(DisplayHandle displayHandle, const String& filename, Float framesPerSecond)
+    {
+        FrameCaptureCommand cmd;
+        cmd.displayHandle = displayHandle;
+        cmd.filename = filename;
+        cmd.framesPerSecond = framesPerSecond;
+        m_commands.addCommand(ERendererCommand_StartFrameCapture, cmd);
+    }
+
+    void RendererCommands::stopFrameCapture(DisplayHandle displayHandle)
+    {
+        FrameCaptureCommand cmd;
+        cmd.displayHandle = displayHandle;
+        cmd.framesPerSecond = 0.f;
+        m_commands.addCommand(ERendererCommand_StopFrameCapture, cmd);
+    }
+
     void RendererCommands::linkSceneData(SceneId providerSceneId, DataSlotId providerDataSlotId, SceneId consumerSceneId, DataSlotId consumerDataSlotId)
     {
         DataLinkCommand cmd;
@@ -395,6 +412,13 @@ namespace ramses_internal
         m_commands.addCommand(ERendererCommand_SetSkippingOfUnmodifiedBuffers, cmd);
     }
 
+    void RendererCommands::setGpuTimerQueries(Bool enable)
+    {
+        SetFeatureCommand cmd;
+        cmd.enable = enable;
+        m_commands.addCommand(ERendererCommand_SetGpuTimerQueries, cmd);
+    }
+
     const RendererCommandContainer& RendererCommands::getCommands() const
     {
         return m_commands;
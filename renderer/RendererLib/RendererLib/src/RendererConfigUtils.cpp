@@ -70,6 +70,7 @@ namespace ramses_internal
             , fullscreen("f", "fullscreen", config.getFullscreenState(), "enable fullscreen mode")
             , borderless("bl", "borderless", config.getBorderlessState(), "disable window borders")
             , enableWarping("warp", "enable-warping", config.isWarpingEnabled(), "enable warping")
+            , enableDownscale("downscale", "enable-downscale", config.isDownscaleEnabled(), "enable downscale post effect")
             , deleteEffects("de", "delete-effects", !config.getKeepEffectsUploaded(), "do not keep effects uploaded")
             , antialiasingMethod("aa", "antialiasing-method", "", "set antialiasing method (options: MSAA)")
             , antialiasingSampleCount("as", "aa-samples", config.getAntialiasingSampleCount(), "set antialiasing sample count")
@@ -108,6 +109,7 @@ namespace ramses_internal
         ArgumentBool borderless;
 
         ArgumentBool enableWarping;
+        ArgumentBool enableDownscale;
         ArgumentBool deleteEffects;
         ArgumentString antialiasingMethod;
         ArgumentUInt32 antialiasingSampleCount;
@@ -160,6 +162,7 @@ namespace ramses_internal
                         if (!onlyExposedArgs)
                         {
                             sos << enableWarping.getHelpString();
+                            sos << enableDownscale.getHelpString();
                             sos << deleteEffects.getHelpString();
                             sos << antialiasingMethod.getHelpString();
                             sos << antialiasingSampleCount.getHelpString();
@@ -188,6 +191,7 @@ namespace ramses_internal
         config.setFullscreenState(rendererArgs.fullscreen.parseValueFromCmdLine(parser));
         config.setBorderlessState(rendererArgs.borderless.parseValueFromCmdLine(parser));
         config.setWarpingEnabled(rendererArgs.enableWarping.parseValueFromCmdLine(parser));
+        config.setDownscaleEnabled(rendererArgs.enableDownscale.parseValueFromCmdLine(parser));
         config.setKeepEffectsUploaded(!rendererArgs.deleteEffects.parseValueFromCmdLine(parser));
         config.setDesiredWindowWidth(rendererArgs.windowWidth.parseValueFromCmdLine(parser));
         config.setDesiredWindowHeight(rendererArgs.windowHeight.parseValueFromCmdLine(parser));
@@ -97,6 +97,9 @@ namespace ramses_internal
         case ERendererLogTopic_EventQueue:
             LogEventQueue(updater, context);
             break;
+        case ERendererLogTopic_FrameProfiler:
+            LogFrameProfiler(updater, context);
+            break;
         case ERendererLogTopic_All:
             LogDisplays(updater, context);
             LogSceneStates(updater, context);
@@ -107,6 +110,7 @@ namespace ramses_internal
             LogLinks(updater.m_rendererScenes, context);
             LogEmbeddedCompositor(updater, context);
             LogEventQueue(updater, context);
+            LogFrameProfiler(updater, context);
             break;
         case ERendererLogTopic_PeriodicLog:
             LogPeriodicInfo(updater);
@@ -1131,6 +1135,30 @@ namespace ramses_internal
         EndSection("RENDERER EVENTS", context);
     }
 
+    void RendererLogger::LogFrameProfiler(const RendererSceneUpdater& updater, RendererLogContext& context)
+    {
+        StartSection("FRAME PROFILER", context);
+
+        const FrameProfilerStatistics& profilerStatistics = updater.m_renderer.getProfilerStatistics();
+        context << profilerStatistics.getNumberOfFramesInHistograms() << " frame(s) profiled since last periodic log" << RendererLogContext::NewLine << RendererLogContext::NewLine;
+        context.indent();
+
+        StringOutputStream percentiles;
+        profilerStatistics.writeTimePercentilesToStream(percentiles);
+        context << percentiles.c_str() << RendererLogContext::NewLine;
+
+        if (context.isLogLevelFlagEnabled(ERendererLogLevelFlag_Details))
+        {
+            context << RendererLogContext::NewLine << "Histograms [bucket upper bound(us):count]:" << RendererLogContext::NewLine;
+            StringOutputStream histograms;
+            profilerStatistics.writeTimeHistogramsToStream(histograms);
+            context << histograms.c_str();
+        }
+
+        context.unindent();
+        EndSection("FRAME PROFILER", context);
+    }
+
     void RendererLogger::LogPeriodicInfo(const RendererSceneUpdater& updater)
     {
         LOG_INFO_F(CONTEXT_PERIODIC, ([&](StringOutputStream& sos) {
@@ -1170,6 +1198,8 @@ namespace ramses_internal
                     sos << "\n";
                     updater.m_renderer.getProfilerStatistics().writeLongestFrameTimingsToStream(sos);
                     sos << "\n";
+                    updater.m_renderer.getProfilerStatistics().writeTimePercentilesToStream(sos);
+                    sos << "\n";
                     updater.m_renderer.getMemoryStatistics().writeMemoryUsageSummaryToString(sos);
                 }));
 
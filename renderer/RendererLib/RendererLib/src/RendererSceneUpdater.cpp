@@ -32,6 +32,7 @@
 #include "RendererEventCollector.h"
 #include "Components/FlushTimeInformation.h"
 #include "Utils/LogMacros.h"
+#include "Utils/TraceEventRecorder.h"
 #include "PlatformAbstraction/PlatformTime.h"
 
 namespace ramses_internal
@@ -116,7 +117,8 @@ namespace ramses_internal
             m_rendererEventCollector.addEvent(ERendererEventType_DisplayCreated, handle);
 
             LOG_INFO(CONTEXT_RENDERER, "Created display " << handle.asMemoryHandle() << ": " << displayController.getDisplayWidth() << "x" << displayController.getDisplayHeight()
-                << (displayConfig.getFullscreenState() ? " fullscreen" : "") << (displayConfig.isWarpingEnabled() ? " warped" : "") << " MSAA" << displayConfig.getAntialiasingSampleCount());
+                << (displayConfig.getFullscreenState() ? " fullscreen" : "") << (displayConfig.isWarpingEnabled() ? " warped" : "")
+                << (displayConfig.getColorCorrectionLookupTable().empty() ? "" : " colorCorrected") << (displayConfig.isDownscaleEnabled() ? " downscaled" : "") << " MSAA" << displayConfig.getAntialiasingSampleCount());
         }
         else
         {
@@ -548,6 +550,20 @@ namespace ramses_internal
                 // mark it as if rendered for expiration monitor so that it does not expire
                 m_expirationMonitor.onRendered(sceneID);
 
+            // data and transformation changes are tracked by scene to skip re-rendering of unmodified render targets,
+            // any other change can affect content of any render target in scene
+            static const std::vector<ESceneActionId> SceneActionsTrackedForRenderTargets = {
+                ESceneActionId_SetTransformComponent, ESceneActionId_AllocateNode, ESceneActionId_AllocateTransform, ESceneActionId_AddChildToNode, ESceneActionId_RemoveChildFromNode,
+                ESceneActionId_AllocateDataInstance, ESceneActionId_SetDataIntegerArray, ESceneActionId_SetDataFloatArray,
+                ESceneActionId_SetDataVector2fArray, ESceneActionId_SetDataVector3fArray, ESceneActionId_SetDataVector4fArray,
+                ESceneActionId_SetDataVector2iArray, ESceneActionId_SetDataVector3iArray, ESceneActionId_SetDataVector4iArray,
+                ESceneActionId_SetDataMatrix22fArray, ESceneActionId_SetDataMatrix33fArray, ESceneActionId_SetDataMatrix44fArray, ESceneActionId_SetDataArrayForInstances,
+                ESceneActionId_SetDataResource, ESceneActionId_SetDataTextureSamplerHandle, ESceneActionId_SetDataReference };
+            const bool isFlushWithUntrackedChanges = std::any_of(pendingFlush.sceneActions.begin(), pendingFlush.sceneActions.end(),
+                [](const SceneActionCollection::SceneActionReader& a) { return !contains_c(SceneActionsIgnoredForMarkingAsModified, a.type()) && !contains_c(SceneActionsTrackedForRenderTargets, a.type()); });
+            if (isFlushWithUntrackedChanges)
+                m_rendererScenes.getScene(sceneID).invalidateRenderTargetsContent();
+
             ++numFlushesApplied;
         }
 
@@ -848,6 +864,7 @@ namespace ramses_internal
 
     void RendererSceneUpdater::applySceneActions(IScene& scene, PendingFlush& flushInfo)
     {
+        TRACE_SCOPE_WITH_ID("renderer", "ApplySceneActions", scene.getSceneId().getValue());
         const SceneActionCollection& actionsForScene = flushInfo.sceneActions;
         const UInt32 numActions = actionsForScene.numberOfActions();
         LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::applySceneActions start applying scene actions [count:" << numActions << "] for scene with id " << scene.getSceneId().getValue());
@@ -861,6 +878,7 @@ namespace ramses_internal
 
     void RendererSceneUpdater::applySceneActionsPartially(IScene& scene, PendingFlush& flushInfo, bool firstChunk)
     {
+        TRACE_SCOPE_WITH_ID("renderer", "ApplySceneActionsPartially", scene.getSceneId().getValue());
         const SceneActionCollection& actionsForScene = flushInfo.sceneActions;
         const UInt sceneActionsCount = actionsForScene.numberOfActions();
         const UInt sceneActionsItBefore = flushInfo.sceneActionsIt;
@@ -935,6 +953,7 @@ namespace ramses_internal
 
         RendererCachedScene& rendererScene = m_rendererScenes.getScene(sceneId);
         rendererScene.resetResourceCache();
+        rendererScene.invalidateRenderTargetsContent();
     }
 
     bool RendererSceneUpdater::markClientAndSceneResourcesForReupload(SceneId sceneId)
@@ -1229,6 +1248,7 @@ namespace ramses_internal
 
         m_rendererScenes.getSceneLinksManager().createDataLink(providerSceneId, providerId, consumerSceneId, consumerId);
         m_modifiedScenesToRerender.put(consumerSceneId);
+        m_rendererScenes.getScene(consumerSceneId).invalidateRenderTargetsContent();
         m_renderer.resetRenderInterruptState();
     }
 
@@ -1252,6 +1272,7 @@ namespace ramses_internal
 
         m_rendererScenes.getSceneLinksManager().createBufferLink(buffer, consumerSceneId, consumerId);
         m_modifiedScenesToRerender.put(consumerSceneId);
+        m_rendererScenes.getScene(consumerSceneId).invalidateRenderTargetsContent();
         m_renderer.resetRenderInterruptState();
     }
 
@@ -1259,6 +1280,7 @@ namespace ramses_internal
     {
         m_rendererScenes.getSceneLinksManager().removeDataLink(consumerSceneId, consumerId);
         m_modifiedScenesToRerender.put(consumerSceneId);
+        m_rendererScenes.getScene(consumerSceneId).invalidateRenderTargetsContent();
         m_renderer.resetRenderInterruptState();
     }
 
@@ -26,6 +26,28 @@ namespace ramses_internal
         return m_frameNumber <= 0 ? 0u : m_drawCalls / m_frameNumber;
     }
 
+    UInt32 RendererStatistics::getAverageSceneGpuTime(SceneId sceneId) const
+    {
+        const auto sceneStatIt = m_sceneStatistics.find(sceneId);
+        if (sceneStatIt == m_sceneStatistics.cend())
+            return 0u;
+
+        return GetAverageGpuTime(sceneStatIt->second.gpuTime);
+    }
+
+    UInt32 RendererStatistics::getAverageRenderPassGpuTime(SceneId sceneId, RenderPassHandle renderPass) const
+    {
+        const auto sceneStatIt = m_sceneStatistics.find(sceneId);
+        if (sceneStatIt == m_sceneStatistics.cend())
+            return 0u;
+
+        const auto passStatIt = sceneStatIt->second.renderPassGpuTime.find(renderPass);
+        if (passStatIt == sceneStatIt->second.renderPassGpuTime.cend())
+            return 0u;
+
+        return GetAverageGpuTime(passStatIt->second);
+    }
+
     void RendererStatistics::sceneRendered(SceneId sceneId)
     {
         m_sceneStatistics[sceneId].numRendered++;
@@ -50,6 +72,16 @@ namespace ramses_internal
         m_displayStatistics[display].numFrameBufferSwapped++;
     }
 
+    void RendererStatistics::frameCaptured(DisplayHandle display)
+    {
+        m_displayStatistics[display].numFramesCaptured++;
+    }
+
+    void RendererStatistics::frameCaptureDropped(DisplayHandle display, UInt numDroppedFrames)
+    {
+        m_displayStatistics[display].numCapturedFramesDropped += numDroppedFrames;
+    }
+
     void RendererStatistics::clientResourceUploaded(UInt byteSize)
     {
         m_clientResourcesUploaded++;
@@ -128,6 +160,32 @@ namespace ramses_internal
         m_sceneStatistics[sceneId].numFlushApplyInterrupted++;
     }
 
+    void RendererStatistics::trackFrustumCulling(SceneId sceneId, UInt numCulledRenderables, UInt numRenderablesInFrustum)
+    {
+        auto& sceneStats = m_sceneStatistics[sceneId];
+        sceneStats.numRenderablesCulled += numCulledRenderables;
+        sceneStats.numRenderablesInFrustum += numRenderablesInFrustum;
+    }
+
+    void RendererStatistics::trackSkippedRenderPasses(SceneId sceneId, UInt numSkippedRenderPasses)
+    {
+        m_sceneStatistics[sceneId].numRenderPassesSkipped += numSkippedRenderPasses;
+    }
+
+    void RendererStatistics::trackSceneGpuTime(SceneId sceneId, UInt32 microseconds)
+    {
+        auto& gpuTimeStats = m_sceneStatistics[sceneId].gpuTime;
+        gpuTimeStats.numSamples++;
+        gpuTimeStats.microseconds.update(microseconds);
+    }
+
+    void RendererStatistics::trackRenderPassGpuTime(SceneId sceneId, RenderPassHandle renderPass, UInt32 microseconds)
+    {
+        auto& gpuTimeStats = m_sceneStatistics[sceneId].renderPassGpuTime[renderPass];
+        gpuTimeStats.numSamples++;
+        gpuTimeStats.microseconds.update(microseconds);
+    }
+
     void RendererStatistics::untrackScene(SceneId sceneId)
     {
         m_sceneStatistics.erase(sceneId);
@@ -204,11 +262,18 @@ namespace ramses_internal
             sceneStat.sceneResourcesUploaded = 0u;
             sceneStat.sceneResourcesBytesUploaded = 0u;
             sceneStat.numRendered = 0u;
+            sceneStat.numRenderablesCulled = 0u;
+            sceneStat.numRenderablesInFrustum = 0u;
+            sceneStat.numRenderPassesSkipped = 0u;
+            sceneStat.gpuTime = {};
+            sceneStat.renderPassGpuTime.clear();
         }
 
         for (auto& dispStat : m_displayStatistics)
         {
             dispStat.second.numFrameBufferSwapped = 0u;
+            dispStat.second.numFramesCaptured = 0u;
+            dispStat.second.numCapturedFramesDropped = 0u;
             for (auto& obStat : dispStat.second.offscreenBufferStatistics)
             {
                 obStat.second.numSwapped = 0u;
@@ -251,6 +316,8 @@ namespace ramses_internal
                 if (obStat.second.isInterruptible)
                     str << " (intr: " << obStat.second.numInterrupted << ")";
             }
+            if (dbStat.second.numFramesCaptured > 0u || dbStat.second.numCapturedFramesDropped > 0u)
+                str << "; captured: " << dbStat.second.numFramesCaptured << " (dropped: " << dbStat.second.numCapturedFramesDropped << ")";
             str << "\n";
         }
 
@@ -282,6 +349,20 @@ namespace ramses_internal
             }
             if (sceneStats.sceneResourcesUploaded > 0u)
                 str << ", RSUploaded " << sceneStats.sceneResourcesUploaded << " (" << sceneStats.sceneResourcesBytesUploaded << " B)";
+            if (sceneStats.numRenderablesCulled > 0u)
+                str << ", culled " << sceneStats.numRenderablesCulled << " (inFrustum " << sceneStats.numRenderablesInFrustum << ")";
+            if (sceneStats.numRenderPassesSkipped > 0u)
+                str << ", RPSkipped " << sceneStats.numRenderPassesSkipped;
+            if (sceneStats.gpuTime.numSamples > 0u)
+            {
+                str << ", gpuTimeUs ";
+                WriteGpuTimeToStream(str, sceneStats.gpuTime);
+            }
+            for (const auto& passStat : sceneStats.renderPassGpuTime)
+            {
+                str << ", RP" << passStat.first << " gpuTimeUs ";
+                WriteGpuTimeToStream(str, passStat.second);
+            }
             str << "\n";
         }
 
@@ -295,4 +376,14 @@ namespace ramses_internal
             str << "\n";
         }
     }
+
+    UInt32 RendererStatistics::GetAverageGpuTime(const GpuTimeStatistics& gpuTimeStats)
+    {
+        return gpuTimeStats.numSamples == 0u ? 0u : static_cast<UInt32>(gpuTimeStats.microseconds.sum / gpuTimeStats.numSamples);
+    }
+
+    void RendererStatistics::WriteGpuTimeToStream(StringOutputStream& str, const GpuTimeStatistics& gpuTimeStats)
+    {
+        str << "(" << gpuTimeStats.microseconds.minValue << "/" << gpuTimeStats.microseconds.maxValue << "/" << GetAverageGpuTime(gpuTimeStats) << ")";
+    }
 }
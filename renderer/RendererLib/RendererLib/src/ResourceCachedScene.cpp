@@ -539,7 +539,15 @@ namespace ramses_internal
     {
         const UInt32 indexIntoCache = handle.asMemoryHandle();
         assert(indexIntoCache < m_renderableResourcesDirty.size());
-        m_renderableResourcesDirty[indexIntoCache] = dirty;
+        if (m_renderableResourcesDirty[indexIntoCache] != dirty)
+        {
+            m_renderableResourcesDirty[indexIntoCache] = dirty;
+            onRenderableResourcesDirtinessChanged(handle);
+        }
+    }
+
+    void ResourceCachedScene::onRenderableResourcesDirtinessChanged(RenderableHandle /*handle*/) const
+    {
     }
 
     void ResourceCachedScene::setDataInstanceDirtyFlag(DataInstanceHandle handle, Bool dirty) const
@@ -0,0 +1,100 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/ScreenshotFileWriter.h"
+#include "Utils/Image.h"
+#include "Utils/LogMacros.h"
+#include "Utils/RamsesLogger.h"
+
+namespace ramses_internal
+{
+    ScreenshotFileWriter::ScreenshotFileWriter()
+        : m_thread("R_ScreenshotWr")
+    {
+    }
+
+    ScreenshotFileWriter::~ScreenshotFileWriter()
+    {
+        if (m_threadStarted)
+        {
+            {
+                PlatformLightweightGuard guard(m_lock);
+                m_thread.cancel();
+                m_screenshotQueuedCondVar.signal();
+            }
+            m_thread.join();
+        }
+    }
+
+    void ScreenshotFileWriter::writeScreenshot(ScreenshotInfo&& screenshot)
+    {
+        PlatformLightweightGuard guard(m_lock);
+        if (!m_threadStarted)
+        {
+            m_thread.start(*this);
+            m_threadStarted = true;
+        }
+
+        m_screenshotQueue.push_back(std::move(screenshot));
+        m_screenshotQueuedCondVar.signal();
+    }
+
+    void ScreenshotFileWriter::waitUntilAllScreenshotsWritten()
+    {
+        PlatformLightweightGuard guard(m_lock);
+        while (!m_screenshotQueue.empty() || m_writingScreenshot)
+            m_screenshotWrittenCondVar.wait(&m_lock);
+    }
+
+    void ScreenshotFileWriter::run()
+    {
+        for (;;)
+        {
+            ScreenshotInfo screenshot;
+            {
+                PlatformLightweightGuard guard(m_lock);
+                while (m_screenshotQueue.empty() && !isCancelRequested())
+                    m_screenshotQueuedCondVar.wait(&m_lock);
+
+                // queue is written completely also when cancelled
+                if (m_screenshotQueue.empty())
+                    return;
+
+                screenshot = std::move(m_screenshotQueue.front());
+                m_screenshotQueue.pop_front();
+                m_writingScreenshot = true;
+            }
+
+            WriteScreenshotToFile(screenshot);
+
+            PlatformLightweightGuard guard(m_lock);
+            m_writingScreenshot = false;
+            m_screenshotWrittenCondVar.broadcast();
+        }
+    }
+
+    void ScreenshotFileWriter::WriteScreenshotToFile(const ScreenshotInfo& screenshot)
+    {
+        // flip image vertically so that the layout read from frame buffer (bottom-up)
+        // is converted to layout normally used in image files (top-down)
+        const Image bitmap((screenshot.rectangle.width - screenshot.rectangle.x), (screenshot.rectangle.height - screenshot.rectangle.y), screenshot.pixelData.cbegin(), screenshot.pixelData.cend(), true);
+        bitmap.saveToFilePNG(screenshot.filename);
+        LOG_INFO(CONTEXT_RENDERER, "ScreenshotFileWriter::WriteScreenshotToFile: screenshot successfully saved to file: " << screenshot.filename);
+        if (screenshot.sendViaDLT)
+        {
+            if (GetRamsesLogger().transmitFile(screenshot.filename, false))
+            {
+                LOG_INFO(CONTEXT_RENDERER, "ScreenshotFileWriter::WriteScreenshotToFile: screenshot file successfully send via dlt: " << screenshot.filename);
+            }
+            else
+            {
+                LOG_WARN(CONTEXT_RENDERER, "ScreenshotFileWriter::WriteScreenshotToFile: screenshot file could not send via dlt: " << screenshot.filename);
+            }
+        }
+    }
+}
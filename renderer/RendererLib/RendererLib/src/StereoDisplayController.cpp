@@ -10,6 +10,7 @@
 #include "RendererAPI/IRenderBackend.h"
 #include "RendererAPI/IDevice.h"
 #include "RendererAPI/ISurface.h"
+#include "RendererLib/RendererCachedScene.h"
 #include "SceneAPI/PixelRectangle.h"
 #include "Math3d/CameraMatrixHelper.h"
 #include "Math3d/Vector2i.h"
@@ -70,6 +71,12 @@ namespace ramses_internal
     // Stereo display controller creates its own buffers and viewports per eye
     SceneRenderExecutionIterator StereoDisplayController::renderScene(const RendererCachedScene& scene, DeviceResourceHandle, const Viewport&, const SceneRenderExecutionIterator& renderFrom, const FrameTimer*)
     {
+        // both eyes are measured together as one scene execution, render passes are not measured
+        // because they are executed once per eye and their times would be reported twice per frame
+        GpuTimerQueries* gpuTimerQueries = getGpuTimerQueries();
+        if (gpuTimerQueries)
+            gpuTimerQueries->beginScene(scene.getSceneId());
+
         // Stereo Rendering, one pass for left and one for right eye
         for (UInt32 eyeIndex = 0; eyeIndex < 2; eyeIndex++)
         {
@@ -77,6 +84,9 @@ namespace ramses_internal
             executor.executeScene(scene, m_viewInfo[eyeIndex].m_viewMatrix);
         }
 
+        if (gpuTimerQueries)
+            gpuTimerQueries->endScene();
+
         return SceneRenderExecutionIterator();
     }
 
@@ -22,8 +22,6 @@
 #include "Monitoring/Monitor.h"
 #include "RendererLib/RendererCachedScene.h"
 #include "Ramsh/Ramsh.h"
-#include "Utils/Image.h"
-#include "Utils/RamsesLogger.h"
 
 
 
@@ -43,11 +41,13 @@ namespace ramses_internal
         , m_rendererSceneUpdater(m_renderer, m_rendererScenes, m_sceneStateExecutor, m_rendererEventCollector, m_frameTimer, m_expirationMonitor)
         , m_rendererCommandExecutor(m_renderer, m_rendererCommandBuffer, m_rendererSceneUpdater, m_rendererEventCollector, m_frameTimer)
         , m_cmdScreenshot                                  (m_rendererCommandBuffer)
+        , m_cmdCaptureFrames                               (m_rendererCommandBuffer)
         , m_cmdLogRendererInfo                             (m_rendererCommandBuffer)
         , m_cmdShowFrameProfiler                           (m_rendererCommandBuffer)
         , m_cmdPrintStatistics                             (m_rendererCommandBuffer)
         , m_cmdSetClearColor                               (m_rendererCommandBuffer)
         , m_cmdSkippingOfUnmodifiedBuffers                 (m_rendererCommandBuffer)
+        , m_cmdGpuTimerQueries                             (m_rendererCommandBuffer)
         , m_cmdLinkSceneData                               (m_rendererCommandBuffer)
         , m_cmdUnlinkSceneData                             (m_rendererCommandBuffer)
         , m_cmdSystemCompositorControllerListIviSurfaces         (m_rendererCommandBuffer)
@@ -166,7 +166,9 @@ namespace ramses_internal
         ramsh.add(m_cmdPrintStatistics);
         ramsh.add(m_cmdSetClearColor);
         ramsh.add(m_cmdSkippingOfUnmodifiedBuffers);
+        ramsh.add(m_cmdGpuTimerQueries);
         ramsh.add(m_cmdScreenshot);
+        ramsh.add(m_cmdCaptureFrames);
         ramsh.add(m_cmdLogRendererInfo);
         ramsh.add(m_cmdShowFrameProfiler);
         ramsh.add(*m_cmdShowSceneOnDisplayInternal);
@@ -191,6 +193,11 @@ namespace ramses_internal
         m_rendererEventCollector.dispatchEvents(events);
     }
 
+    void WindowedRenderer::waitUntilAllScreenshotsWritten()
+    {
+        m_screenshotFileWriter.waitUntilAllScreenshotsWritten();
+    }
+
     void WindowedRenderer::update()
     {
         LOG_TRACE(CONTEXT_PROFILING, "WindowedRenderer::update() start update section of frame");
@@ -234,22 +241,7 @@ namespace ramses_internal
             {
                 if (screenshot.success)
                 {
-                    // flip image vertically so that the layout read from frame buffer (bottom-up)
-                    // is converted to layout normally used in image files (top-down)
-                    const Image bitmap((screenshot.rectangle.width - screenshot.rectangle.x), (screenshot.rectangle.height - screenshot.rectangle.y), screenshot.pixelData.cbegin(), screenshot.pixelData.cend(), true);
-                    bitmap.saveToFilePNG(screenshot.filename);
-                    LOG_INFO(CONTEXT_RENDERER, "RamsesRenderer::processScreenshots: screenshot successfully saved to file: " << screenshot.filename);
-                    if (screenshot.sendViaDLT)
-                    {
-                        if (GetRamsesLogger().transmitFile(screenshot.filename, false))
-                        {
-                            LOG_INFO(CONTEXT_RENDERER, "RamsesRenderer::processScreenshots: screenshot file successfully send via dlt: " << screenshot.filename);
-                        }
-                        else
-                        {
-                            LOG_WARN(CONTEXT_RENDERER, "RamsesRenderer::processScreenshots: screenshot file could not send via dlt: " << screenshot.filename);
-                        }
-                    }
+                    m_screenshotFileWriter.writeScreenshot(std::move(screenshot));
                 }
                 else
                 {
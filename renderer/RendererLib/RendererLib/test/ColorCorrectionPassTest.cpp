@@ -0,0 +1,76 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/ColorCorrectionPass.h"
+
+#include "DeviceMock.h"
+
+using namespace testing;
+using namespace ramses_internal;
+
+class AColorCorrectionPass : public ::testing::Test
+{
+public:
+    AColorCorrectionPass()
+    {
+        EXPECT_CALL(device, uploadShader(_));
+        EXPECT_CALL(device, allocateIndexBuffer(_, _));
+        EXPECT_CALL(device, uploadIndexBufferData(_, _, _));
+        EXPECT_CALL(device, allocateVertexBuffer(_, _)).Times(2);
+        EXPECT_CALL(device, uploadVertexBufferData(_, _, _)).Times(2);
+        EXPECT_CALL(device, allocateTexture2D(256u, 1u, ETextureFormat_RGBA8, 1u, 1024u));
+        EXPECT_CALL(device, bindTexture(DeviceMock::FakeTextureDeviceHandle));
+        EXPECT_CALL(device, uploadTextureData(DeviceMock::FakeTextureDeviceHandle, 0u, 0u, 0u, 0u, 256u, 1u, 1u, _, 1024u));
+
+        pass = new ColorCorrectionPass(device);
+    }
+
+    ~AColorCorrectionPass()
+    {
+        EXPECT_CALL(device, deleteTexture(DeviceMock::FakeTextureDeviceHandle));
+        EXPECT_CALL(device, deleteIndexBuffer(_));
+        EXPECT_CALL(device, deleteVertexBuffer(_)).Times(2);
+        EXPECT_CALL(device, deleteShader(_));
+
+        delete pass;
+    }
+
+protected:
+    StrictMock<DeviceMock> device;
+    ColorCorrectionPass* pass;
+};
+
+TEST_F(AColorCorrectionPass, uploadsLookupTableToTexture)
+{
+    const std::vector<UInt8> lookupTable(ColorCorrectionLookupTableSizeInBytes, 42u);
+
+    InSequence sequenceEnforcer;
+    EXPECT_CALL(device, bindTexture(DeviceMock::FakeTextureDeviceHandle));
+    EXPECT_CALL(device, uploadTextureData(DeviceMock::FakeTextureDeviceHandle, 0u, 0u, 0u, 0u, 256u, 1u, 1u, lookupTable.data(), 1024u));
+    pass->setLookupTable(lookupTable);
+}
+
+TEST_F(AColorCorrectionPass, ValidRenderBackendCallsOnExecute)
+{
+    const DeviceResourceHandle inputColorBuffer(1);
+
+    InSequence sequenceEnforcer;
+    EXPECT_CALL(device, activateShader(Ne(DeviceResourceHandle::Invalid())));
+
+    const UInt32 isotropicFilteringLevel = 1;
+    EXPECT_CALL(device, activateTexture(inputColorBuffer, Ne(DataFieldHandle::Invalid())));
+    EXPECT_CALL(device, setTextureSampling(Ne(DataFieldHandle::Invalid()), EWrapMethod::Clamp, EWrapMethod::Clamp, EWrapMethod::Clamp, ESamplingMethod::Linear, ESamplingMethod::Linear, isotropicFilteringLevel));
+    EXPECT_CALL(device, activateTexture(DeviceMock::FakeTextureDeviceHandle, Ne(DataFieldHandle::Invalid())));
+    EXPECT_CALL(device, setTextureSampling(Ne(DataFieldHandle::Invalid()), EWrapMethod::Clamp, EWrapMethod::Clamp, EWrapMethod::Clamp, ESamplingMethod::Linear, ESamplingMethod::Linear, isotropicFilteringLevel));
+
+    EXPECT_CALL(device, activateIndexBuffer(Ne(DeviceResourceHandle::Invalid())));
+    EXPECT_CALL(device, activateVertexBuffer(Ne(DeviceResourceHandle::Invalid()), Ne(DataFieldHandle::Invalid()), 0u)).Times(2);
+    EXPECT_CALL(device, drawIndexedTriangles(0, 6, 1u));
+
+    pass->execute(inputColorBuffer);
+}
@@ -32,6 +32,8 @@ TEST_F(AInternalDisplayConfig, hasDefaultValues)
     EXPECT_EQ(ramses_internal::Vector3(0.0f), m_config.getCameraRotation());
     EXPECT_EQ(ramses_internal::Vector3(0.0f), m_config.getCameraPosition());
     EXPECT_FALSE(m_config.isWarpingEnabled());
+    EXPECT_TRUE(m_config.getColorCorrectionLookupTable().empty());
+    EXPECT_FALSE(m_config.isDownscaleEnabled());
     EXPECT_TRUE(m_config.getKeepEffectsUploaded());
     EXPECT_FALSE(m_config.isStereoDisplay());
     EXPECT_TRUE(ramses_internal::InvalidWaylandIviLayerId == m_config.getWaylandIviLayerID());
@@ -92,6 +94,13 @@ TEST_F(AInternalDisplayConfig, setAndGetValues)
     m_config.setWarpingEnabled(true);
     EXPECT_TRUE(m_config.isWarpingEnabled());
 
+    const std::vector<ramses_internal::UInt8> lookupTable(1024u, 7u);
+    m_config.setColorCorrectionLookupTable(lookupTable);
+    EXPECT_EQ(lookupTable, m_config.getColorCorrectionLookupTable());
+
+    m_config.setDownscaleEnabled(true);
+    EXPECT_TRUE(m_config.isDownscaleEnabled());
+
     m_config.setKeepEffectsUploaded(false);
     EXPECT_FALSE(m_config.getKeepEffectsUploaded());
 
@@ -145,6 +154,7 @@ TEST_F(AInternalDisplayConfig, getsValuesAssignedFromCommandLine)
         "-f",
         "-bl",
         "-warp",
+        "-downscale",
         "-de",
         "-aa", "MSAA",
         "-as", "4",
@@ -194,6 +204,7 @@ TEST_F(AInternalDisplayConfig, getsValuesAssignedFromCommandLine)
     EXPECT_EQ(42u, config.getIntegrityRGLDeviceUnit().getValue());
     EXPECT_TRUE(config.getStartVisibleIvi());
     EXPECT_TRUE(config.isWarpingEnabled());
+    EXPECT_TRUE(config.isDownscaleEnabled());
     EXPECT_FALSE(config.getKeepEffectsUploaded());
     EXPECT_TRUE(config.isResizable());
     EXPECT_TRUE(config.getOffscreen());
@@ -243,3 +254,17 @@ TEST_F(AInternalDisplayConfig, canBeCompared_Offscreen)
     configOffscreen.setOffscreen(true);
     EXPECT_NE(configDefault, configOffscreen);
 }
+
+TEST_F(AInternalDisplayConfig, canBeCompared_PostEffects)
+{
+    ramses_internal::DisplayConfig configDefault;
+    ramses_internal::DisplayConfig configColorCorrection;
+    ramses_internal::DisplayConfig configDownscale;
+
+    configColorCorrection.setColorCorrectionLookupTable(std::vector<ramses_internal::UInt8>(1024u, 0u));
+    configDownscale.setDownscaleEnabled(true);
+
+    EXPECT_NE(configDefault, configColorCorrection);
+    EXPECT_NE(configDefault, configDownscale);
+    EXPECT_NE(configColorCorrection, configDownscale);
+}
@@ -171,4 +171,53 @@ namespace ramses_internal
         destroyDisplayController(displayController);
     }
 
+    TEST_F(ADisplayController, readsPixelsAsynchronously)
+    {
+        IDisplayController& displayController = createDisplayController();
+
+        const UInt32 x = 1u;
+        const UInt32 y = 2u;
+        const UInt32 width = WindowMock::FakeWidth - 2u;
+        const UInt32 height = WindowMock::FakeHeight - 3u;
+        const DeviceResourceHandle readPixelsHandle(123u);
+
+        InSequence seq;
+        EXPECT_CALL(m_renderBackend.deviceMock, activateRenderTarget(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle));
+        EXPECT_CALL(m_renderBackend.deviceMock, startReadPixels(x, y, width, height)).WillOnce(Return(readPixelsHandle));
+        EXPECT_EQ(readPixelsHandle, displayController.startReadPixels(x, y, width, height));
+
+        EXPECT_CALL(m_renderBackend.deviceMock, isReadPixelsFinished(readPixelsHandle)).WillOnce(Return(true));
+        EXPECT_TRUE(displayController.isReadPixelsFinished(readPixelsHandle));
+
+        EXPECT_CALL(m_renderBackend.deviceMock, finishReadPixels(readPixelsHandle, _)).WillOnce(Return(true));
+        UInt8Vector pixels;
+        EXPECT_TRUE(displayController.finishReadPixels(readPixelsHandle, width, height, pixels));
+        EXPECT_EQ(width * height * 4u, pixels.size());
+
+        destroyDisplayController(displayController);
+    }
+
+    TEST_F(ADisplayController, doesNotStartAsynchronousReadOfPixelsOutOfBoundaries)
+    {
+        IDisplayController& displayController = createDisplayController();
+
+        EXPECT_CALL(m_renderBackend.deviceMock, startReadPixels(_, _, _, _)).Times(0);
+        EXPECT_FALSE(displayController.startReadPixels(10u, 11u, WindowMock::FakeWidth + 1u, 13u).isValid());
+
+        destroyDisplayController(displayController);
+    }
+
+    TEST_F(ADisplayController, reportsFailedAsynchronousReadOfPixels)
+    {
+        IDisplayController& displayController = createDisplayController();
+        const DeviceResourceHandle readPixelsHandle(123u);
+
+        EXPECT_CALL(m_renderBackend.deviceMock, finishReadPixels(readPixelsHandle, _)).WillOnce(Return(false));
+        UInt8Vector pixels;
+        EXPECT_FALSE(displayController.finishReadPixels(readPixelsHandle, 10u, 10u, pixels));
+        EXPECT_TRUE(pixels.empty());
+
+        destroyDisplayController(displayController);
+    }
+
 }
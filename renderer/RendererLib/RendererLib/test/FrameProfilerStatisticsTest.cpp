@@ -0,0 +1,134 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/FrameProfilerStatistics.h"
+#include "Collections/StringOutputStream.h"
+#include <numeric>
+
+using namespace testing;
+using namespace ramses_internal;
+
+class AFrameProfilerStatistics : public ::testing::Test
+{
+protected:
+    void finishFramesWithSleepTime(UInt32 numFrames, UInt32 sleepTimeInMicroseconds)
+    {
+        for (UInt32 i = 0u; i < numFrames; ++i)
+            stats.markFrameFinished(std::chrono::microseconds(sleepTimeInMicroseconds));
+    }
+
+    UInt32 getSleepTimePercentile(Float percentile) const
+    {
+        return stats.getRegionTimePercentile(FrameProfilerStatistics::ERegion::MaxFramerateSleep, percentile);
+    }
+
+    FrameProfilerStatistics stats;
+};
+
+TEST_F(AFrameProfilerStatistics, mapsSmallTimesToExactBuckets)
+{
+    for (UInt time = 0u; time < 8u; ++time)
+    {
+        EXPECT_EQ(time, FrameProfilerStatistics::GetHistogramBucket(time));
+        EXPECT_EQ(time, FrameProfilerStatistics::GetHistogramBucketUpperBound(time));
+    }
+}
+
+TEST_F(AFrameProfilerStatistics, mapsTimesToBucketsWithBoundedRelativeError)
+{
+    for (UInt time = 8u; time < 1000000u; time = time * 9u / 8u + 1u)
+    {
+        const UInt bucket = FrameProfilerStatistics::GetHistogramBucket(time);
+        const UInt upperBound = FrameProfilerStatistics::GetHistogramBucketUpperBound(bucket);
+        EXPECT_GE(upperBound, time);
+        EXPECT_LE(upperBound - time, time / 8u);
+        EXPECT_LT(FrameProfilerStatistics::GetHistogramBucketUpperBound(bucket - 1u), time);
+    }
+}
+
+TEST_F(AFrameProfilerStatistics, mapsHugeTimesToLastBucket)
+{
+    EXPECT_EQ(FrameProfilerStatistics::NumberOfHistogramBuckets - 1u, FrameProfilerStatistics::GetHistogramBucket(std::numeric_limits<UInt32>::max()));
+}
+
+TEST_F(AFrameProfilerStatistics, reportsZeroPercentilesIfNoFramesProfiled)
+{
+    EXPECT_EQ(0u, stats.getNumberOfFramesInHistograms());
+    EXPECT_EQ(0u, getSleepTimePercentile(50.f));
+    EXPECT_EQ(0u, stats.getFrameTimePercentile(99.f));
+}
+
+TEST_F(AFrameProfilerStatistics, reportsPercentilesOfRegionTimes)
+{
+    finishFramesWithSleepTime(90u, 100u);
+    finishFramesWithSleepTime(9u, 1000u);
+    finishFramesWithSleepTime(1u, 10000u);
+    EXPECT_EQ(100u, stats.getNumberOfFramesInHistograms());
+
+    const UInt32 p50 = getSleepTimePercentile(50.f);
+    const UInt32 p95 = getSleepTimePercentile(95.f);
+    const UInt32 p99 = getSleepTimePercentile(99.f);
+    EXPECT_GE(p50, 100u);
+    EXPECT_LE(p50, 100u + 100u / 8u);
+    EXPECT_GE(p95, 1000u);
+    EXPECT_LE(p95, 1000u + 1000u / 8u);
+    EXPECT_GE(p99, 1000u);
+    EXPECT_LE(p99, 1000u + 1000u / 8u);
+    EXPECT_EQ(10000u, getSleepTimePercentile(100.f));
+}
+
+TEST_F(AFrameProfilerStatistics, neverReportsPercentileHigherThanMaximum)
+{
+    finishFramesWithSleepTime(10u, 1001u);
+    EXPECT_EQ(1001u, getSleepTimePercentile(50.f));
+    EXPECT_EQ(1001u, getSleepTimePercentile(99.f));
+}
+
+TEST_F(AFrameProfilerStatistics, countsAllSamplesInHistogram)
+{
+    finishFramesWithSleepTime(5u, 10u);
+    finishFramesWithSleepTime(3u, 20000u);
+
+    const auto& histogram = stats.getRegionTimeHistogram(FrameProfilerStatistics::ERegion::MaxFramerateSleep);
+    ASSERT_EQ(static_cast<UInt>(FrameProfilerStatistics::NumberOfHistogramBuckets), histogram.size());
+    EXPECT_EQ(5u, histogram[FrameProfilerStatistics::GetHistogramBucket(10u)]);
+    EXPECT_EQ(3u, histogram[FrameProfilerStatistics::GetHistogramBucket(20000u)]);
+    EXPECT_EQ(8u, std::accumulate(stats.getFrameTimeHistogram().cbegin(), stats.getFrameTimeHistogram().cend(), 0u));
+}
+
+TEST_F(AFrameProfilerStatistics, excludesSleepTimeFromFrameTime)
+{
+    finishFramesWithSleepTime(10u, 50000u);
+    EXPECT_LT(stats.getFrameTimePercentile(100.f), 50000u);
+}
+
+TEST_F(AFrameProfilerStatistics, resetsHistogramsTogetherWithFrameTimings)
+{
+    finishFramesWithSleepTime(10u, 1000u);
+    stats.resetFrameTimings();
+
+    EXPECT_EQ(0u, stats.getNumberOfFramesInHistograms());
+    EXPECT_EQ(0u, getSleepTimePercentile(100.f));
+
+    finishFramesWithSleepTime(1u, 10u);
+    EXPECT_EQ(1u, stats.getNumberOfFramesInHistograms());
+    EXPECT_EQ(10u, getSleepTimePercentile(100.f));
+}
+
+TEST_F(AFrameProfilerStatistics, writesPercentilesOfAllRegionsToStream)
+{
+    finishFramesWithSleepTime(4u, 10u);
+
+    StringOutputStream str;
+    stats.writeTimePercentilesToStream(str);
+    const String output = str.release();
+    EXPECT_GE(output.find("over 4 frames"), 0);
+    EXPECT_GE(output.find("Frame:"), 0);
+    EXPECT_GE(output.find("MaxFramerateSleep:10/10/10/10"), 0);
+}
@@ -0,0 +1,149 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/FrameStreamWriter.h"
+#include "Utils/File.h"
+
+#ifdef __linux__
+#include <sys/stat.h>
+#endif
+
+using namespace testing;
+using namespace ramses_internal;
+
+class AFrameStreamWriter : public ::testing::Test
+{
+public:
+    AFrameStreamWriter()
+        : m_filename("frameStream.rgba")
+    {
+    }
+
+    ~AFrameStreamWriter()
+    {
+        File file(m_filename);
+        if (file.exists())
+            file.remove();
+    }
+
+    static std::vector<UInt8> CreateFrame(UInt32 width, UInt32 height, UInt8 firstValue)
+    {
+        std::vector<UInt8> frame(width * height * 4u);
+        for (UInt i = 0u; i < frame.size(); ++i)
+            frame[i] = static_cast<UInt8>(firstValue + i);
+        return frame;
+    }
+
+    std::vector<UInt8> readFile() const
+    {
+        File file(m_filename);
+        UInt fileSize = 0u;
+        EXPECT_EQ(EStatus_RAMSES_OK, file.getSizeInBytes(fileSize));
+        std::vector<UInt8> data(fileSize);
+        UInt numBytesRead = 0u;
+        EXPECT_EQ(EStatus_RAMSES_OK, file.open(EFileMode_ReadOnlyBinary));
+        if (fileSize > 0u)
+        {
+            EXPECT_EQ(EStatus_RAMSES_OK, file.read(reinterpret_cast<Char*>(data.data()), fileSize, numBytesRead));
+        }
+        file.close();
+        return data;
+    }
+
+protected:
+    const String m_filename;
+};
+
+TEST_F(AFrameStreamWriter, writesFramesWithRowsOrderedTopDown)
+{
+    {
+        FrameStreamWriter writer(m_filename, 1u, 2u);
+        EXPECT_TRUE(writer.writeFrame(CreateFrame(1u, 2u, 0u)));
+        writer.waitUntilAllFramesWritten();
+        EXPECT_TRUE(writer.writeFrame(CreateFrame(1u, 2u, 10u)));
+    }
+
+    const std::vector<UInt8> expectedData = { 4, 5, 6, 7, 0, 1, 2, 3, 14, 15, 16, 17, 10, 11, 12, 13 };
+    EXPECT_EQ(expectedData, readFile());
+}
+
+TEST_F(AFrameStreamWriter, writesAllAcceptedFramesIfFramesAreQueuedFasterThanWritten)
+{
+    UInt32 numFramesAccepted = 0u;
+    {
+        FrameStreamWriter writer(m_filename, 64u, 64u);
+        for (UInt32 i = 0u; i < 100u; ++i)
+        {
+            if (writer.writeFrame(CreateFrame(64u, 64u, 0u)))
+                ++numFramesAccepted;
+        }
+    }
+
+    EXPECT_GE(numFramesAccepted, UInt32(FrameStreamWriter::MaximumQueuedFrames));
+    EXPECT_EQ(numFramesAccepted * 64u * 64u * 4u, readFile().size());
+}
+
+TEST_F(AFrameStreamWriter, discardsFramesIfFileCannotBeOpened)
+{
+    FrameStreamWriter writer("nonExistingDirectory/frameStream.rgba", 1u, 1u);
+    writer.writeFrame(CreateFrame(1u, 1u, 0u));
+    writer.waitUntilAllFramesWritten();
+}
+
+TEST_F(AFrameStreamWriter, writesQueuedFramesAfterFinishWithoutAcceptingNewOnes)
+{
+    {
+        FrameStreamWriter writer(m_filename, 1u, 2u);
+        EXPECT_TRUE(writer.writeFrame(CreateFrame(1u, 2u, 0u)));
+        writer.finish();
+        EXPECT_FALSE(writer.writeFrame(CreateFrame(1u, 2u, 10u)));
+
+        while (!writer.isFinished())
+            PlatformThread::Sleep(1u);
+    }
+
+    const std::vector<UInt8> expectedData = { 4, 5, 6, 7, 0, 1, 2, 3 };
+    EXPECT_EQ(expectedData, readFile());
+}
+
+#ifdef __linux__
+TEST_F(AFrameStreamWriter, writesFramesToNamedPipeOnceReaderConnected)
+{
+    ASSERT_EQ(0, ::mkfifo(m_filename.c_str(), 0600));
+
+    FrameStreamWriter writer(m_filename, 1u, 2u);
+    EXPECT_TRUE(writer.writeFrame(CreateFrame(1u, 2u, 0u)));
+    PlatformThread::Sleep(3u * FrameStreamWriter::NamedPipeReaderPollingPeriod);
+
+    File reader(m_filename);
+    ASSERT_EQ(EStatus_RAMSES_OK, reader.open(EFileMode_ReadOnlyBinary));
+    std::vector<UInt8> data(8u);
+    UInt numBytesRead = 0u;
+    EXPECT_EQ(EStatus_RAMSES_OK, reader.read(reinterpret_cast<Char*>(data.data()), data.size(), numBytesRead));
+    reader.close();
+
+    const std::vector<UInt8> expectedData = { 4, 5, 6, 7, 0, 1, 2, 3 };
+    EXPECT_EQ(8u, numBytesRead);
+    EXPECT_EQ(expectedData, data);
+}
+
+TEST_F(AFrameStreamWriter, finishesWithoutWaitingForNamedPipeReader)
+{
+    ASSERT_EQ(0, ::mkfifo(m_filename.c_str(), 0600));
+
+    {
+        FrameStreamWriter writer(m_filename, 1u, 1u);
+        writer.writeFrame(CreateFrame(1u, 1u, 0u));
+        writer.finish();
+
+        while (!writer.isFinished())
+            PlatformThread::Sleep(1u);
+    }
+}
+#endif
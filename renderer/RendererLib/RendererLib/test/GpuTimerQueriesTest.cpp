@@ -0,0 +1,155 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/GpuTimerQueries.h"
+#include "RendererLib/RendererStatistics.h"
+
+#include "DeviceMock.h"
+
+using namespace testing;
+using namespace ramses_internal;
+
+class AGpuTimerQueries : public ::testing::Test
+{
+protected:
+    AGpuTimerQueries()
+    {
+        ON_CALL(device, issueTimestampQuery()).WillByDefault(Invoke([this]() { return DeviceResourceHandle(m_nextQuery++); }));
+        ON_CALL(device, isTimestampQueryResultAvailable(_)).WillByDefault(Return(true));
+        // each query returns its handle in milliseconds as timestamp
+        ON_CALL(device, getTimestampQueryResult(_, _)).WillByDefault(Invoke([](DeviceResourceHandle query, UInt64& timestamp)
+        {
+            timestamp = query.asMemoryHandle() * 1000000u;
+            return true;
+        }));
+    }
+
+    NiceMock<DeviceMock> device;
+    RendererStatistics stats;
+    const SceneId sceneId{ 13u };
+    const RenderPassHandle pass1{ 1u };
+    const RenderPassHandle pass2{ 2u };
+
+private:
+    UInt32 m_nextQuery = 1u;
+};
+
+TEST_F(AGpuTimerQueries, measuresSceneAndItsRenderPasses)
+{
+    GpuTimerQueries queries(device);
+
+    EXPECT_CALL(device, issueTimestampQuery()).Times(6);
+    queries.beginScene(sceneId);      // query 1
+    queries.beginRenderPass(pass1);   // query 2
+    queries.endRenderPass();          // query 3
+    queries.beginRenderPass(pass2);   // query 4
+    queries.endRenderPass();          // query 5
+    queries.endScene();               // query 6
+    EXPECT_EQ(3u, queries.getNumPendingMeasurements());
+
+    EXPECT_CALL(device, getTimestampQueryResult(_, _)).Times(6);
+    queries.collectResults(stats);
+    EXPECT_EQ(0u, queries.getNumPendingMeasurements());
+
+    EXPECT_EQ(5000u, stats.getAverageSceneGpuTime(sceneId));
+    EXPECT_EQ(1000u, stats.getAverageRenderPassGpuTime(sceneId, pass1));
+    EXPECT_EQ(1000u, stats.getAverageRenderPassGpuTime(sceneId, pass2));
+}
+
+TEST_F(AGpuTimerQueries, keepsMeasurementsPendingUntilResultsAreAvailable)
+{
+    GpuTimerQueries queries(device);
+
+    queries.beginScene(sceneId);
+    queries.endScene();               // query 2
+    queries.beginScene(sceneId);
+    queries.endScene();               // query 4
+
+    EXPECT_CALL(device, isTimestampQueryResultAvailable(DeviceResourceHandle(2u))).WillOnce(Return(false));
+    EXPECT_CALL(device, getTimestampQueryResult(_, _)).Times(0);
+    queries.collectResults(stats);
+    EXPECT_EQ(2u, queries.getNumPendingMeasurements());
+    Mock::VerifyAndClearExpectations(&device);
+
+    EXPECT_CALL(device, isTimestampQueryResultAvailable(DeviceResourceHandle(2u))).WillOnce(Return(true));
+    EXPECT_CALL(device, isTimestampQueryResultAvailable(DeviceResourceHandle(4u))).WillOnce(Return(false));
+    queries.collectResults(stats);
+    EXPECT_EQ(1u, queries.getNumPendingMeasurements());
+    EXPECT_EQ(1000u, stats.getAverageSceneGpuTime(sceneId));
+}
+
+TEST_F(AGpuTimerQueries, discardsAllPendingMeasurementsIfResultIsNotValid)
+{
+    GpuTimerQueries queries(device);
+
+    queries.beginScene(sceneId);
+    queries.endScene();               // query 2
+    queries.beginScene(sceneId);
+    queries.endScene();               // query 4
+
+    EXPECT_CALL(device, getTimestampQueryResult(DeviceResourceHandle(1u), _)).WillOnce(Return(false));
+    EXPECT_CALL(device, getTimestampQueryResult(DeviceResourceHandle(2u), _)).WillOnce(Return(true));
+    EXPECT_CALL(device, getTimestampQueryResult(DeviceResourceHandle(3u), _)).Times(0);
+    EXPECT_CALL(device, getTimestampQueryResult(DeviceResourceHandle(4u), _)).Times(0);
+    EXPECT_CALL(device, releaseTimestampQuery(DeviceResourceHandle(3u)));
+    EXPECT_CALL(device, releaseTimestampQuery(DeviceResourceHandle(4u)));
+    queries.collectResults(stats);
+    EXPECT_EQ(0u, queries.getNumPendingMeasurements());
+    EXPECT_EQ(0u, stats.getAverageSceneGpuTime(sceneId));
+}
+
+TEST_F(AGpuTimerQueries, stopsMeasuringIfDeviceDoesNotSupportTimerQueries)
+{
+    GpuTimerQueries queries(device);
+
+    EXPECT_CALL(device, issueTimestampQuery()).WillOnce(Return(DeviceResourceHandle::Invalid()));
+    queries.beginScene(sceneId);
+    queries.beginRenderPass(pass1);
+    queries.endRenderPass();
+    queries.endScene();
+    EXPECT_FALSE(queries.isSupported());
+    EXPECT_EQ(0u, queries.getNumPendingMeasurements());
+
+    EXPECT_CALL(device, issueTimestampQuery()).Times(0);
+    queries.beginScene(sceneId);
+    queries.endScene();
+    EXPECT_EQ(0u, queries.getNumPendingMeasurements());
+}
+
+TEST_F(AGpuTimerQueries, skipsMeasurementsIfTooManyArePending)
+{
+    GpuTimerQueries queries(device);
+
+    for (UInt32 i = 0u; i < GpuTimerQueries::MaximumPendingMeasurements; ++i)
+    {
+        queries.beginScene(sceneId);
+        queries.endScene();
+    }
+    EXPECT_EQ(UInt32(GpuTimerQueries::MaximumPendingMeasurements), queries.getNumPendingMeasurements());
+
+    EXPECT_CALL(device, issueTimestampQuery()).Times(0);
+    queries.beginScene(sceneId);
+    queries.endScene();
+    EXPECT_EQ(UInt32(GpuTimerQueries::MaximumPendingMeasurements), queries.getNumPendingMeasurements());
+}
+
+TEST_F(AGpuTimerQueries, releasesPendingQueriesWithoutWaitingForResultsWhenDestroyed)
+{
+    {
+        GpuTimerQueries queries(device);
+        queries.beginScene(sceneId);
+        queries.endScene();
+        queries.beginScene(sceneId);
+        queries.endScene();
+
+        EXPECT_CALL(device, isTimestampQueryResultAvailable(_)).Times(0);
+        EXPECT_CALL(device, getTimestampQueryResult(_, _)).Times(0);
+        EXPECT_CALL(device, releaseTimestampQuery(_)).Times(4);
+    }
+    EXPECT_EQ(0u, stats.getAverageSceneGpuTime(sceneId));
+}
@@ -0,0 +1,161 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/Postprocessing.h"
+
+#include "DeviceMock.h"
+#include <memory>
+
+using namespace testing;
+using namespace ramses_internal;
+
+static const UInt32 DisplayWidth = 16u;
+static const UInt32 DisplayHeight = 8u;
+
+class APostprocessing : public ::testing::Test
+{
+protected:
+    static RenderBuffer IntermediateColorBuffer(UInt32 width, UInt32 height)
+    {
+        return { width, height, ERenderBufferType_ColorBuffer, ETextureFormat_RGBA8, ERenderBufferAccessMode_ReadWrite, 0u };
+    }
+
+    NiceMock<DeviceMock> device;
+};
+
+TEST_F(APostprocessing, rendersScenesDirectlyToFramebufferIfNoEffectEnabled)
+{
+    EXPECT_CALL(device, uploadRenderBuffer(_)).Times(0);
+    EXPECT_CALL(device, uploadRenderTarget(_)).Times(0);
+
+    Postprocessing postprocessing(EPostProcessingEffect_None, DisplayWidth, DisplayHeight, device);
+    EXPECT_EQ(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, postprocessing.getScenesRenderTarget());
+
+    EXPECT_CALL(device, activateRenderTarget(_)).Times(0);
+    EXPECT_CALL(device, drawIndexedTriangles(_, _, _)).Times(0);
+    postprocessing.execute();
+    EXPECT_EQ(0u, postprocessing.getIntermediateTargetPoolSize());
+
+    EXPECT_CALL(device, deleteRenderTarget(_)).Times(0);
+    EXPECT_CALL(device, deleteRenderBuffer(_)).Times(0);
+}
+
+TEST_F(APostprocessing, rendersSinglePassDirectlyToFramebuffer)
+{
+    Postprocessing postprocessing(EPostProcessingEffect_ColorCorrection, DisplayWidth, DisplayHeight, device);
+    EXPECT_EQ(DeviceMock::FakeRenderTargetDeviceHandle, postprocessing.getScenesRenderTarget());
+
+    {
+        InSequence seq;
+        EXPECT_CALL(device, activateRenderTarget(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle));
+        EXPECT_CALL(device, clear(EClearFlags_Color));
+        EXPECT_CALL(device, setViewport(0u, 0u, DisplayWidth, DisplayHeight));
+        EXPECT_CALL(device, drawIndexedTriangles(_, _, _));
+    }
+    EXPECT_CALL(device, uploadRenderTarget(_)).Times(0);
+    postprocessing.execute();
+    EXPECT_EQ(0u, postprocessing.getIntermediateTargetPoolSize());
+}
+
+TEST_F(APostprocessing, chainsPassesThroughIntermediateTargetsAndLastPassToFramebuffer)
+{
+    Postprocessing postprocessing(EPostProcessingEffect_Downscale | EPostProcessingEffect_ColorCorrection | EPostProcessingEffect_Warping, DisplayWidth, DisplayHeight, device);
+
+    const DeviceResourceHandle intermediateTarget1(100u);
+    const DeviceResourceHandle intermediateTarget2(101u);
+    EXPECT_CALL(device, uploadRenderBuffer(IntermediateColorBuffer(DisplayWidth / 2u, DisplayHeight / 2u))).Times(2);
+    EXPECT_CALL(device, uploadRenderTarget(_)).WillOnce(Return(intermediateTarget1)).WillOnce(Return(intermediateTarget2));
+    {
+        InSequence seq;
+        // downscale
+        EXPECT_CALL(device, activateRenderTarget(intermediateTarget1));
+        EXPECT_CALL(device, setViewport(0u, 0u, DisplayWidth / 2u, DisplayHeight / 2u));
+        EXPECT_CALL(device, drawIndexedTriangles(_, _, _));
+        // color correction
+        EXPECT_CALL(device, activateRenderTarget(intermediateTarget2));
+        EXPECT_CALL(device, setViewport(0u, 0u, DisplayWidth / 2u, DisplayHeight / 2u));
+        EXPECT_CALL(device, drawIndexedTriangles(_, _, _));
+        // warping
+        EXPECT_CALL(device, activateRenderTarget(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle));
+        EXPECT_CALL(device, clear(EClearFlags_Color));
+        EXPECT_CALL(device, setViewport(0u, 0u, DisplayWidth, DisplayHeight));
+        EXPECT_CALL(device, drawIndexedTriangles(_, _, _));
+    }
+    postprocessing.execute();
+    EXPECT_EQ(2u, postprocessing.getIntermediateTargetPoolSize());
+
+    EXPECT_CALL(device, deleteRenderTarget(intermediateTarget1));
+    EXPECT_CALL(device, deleteRenderTarget(intermediateTarget2));
+    EXPECT_CALL(device, deleteRenderTarget(DeviceMock::FakeRenderTargetDeviceHandle));
+}
+
+TEST_F(APostprocessing, reusesIntermediateTargetsInNextFrames)
+{
+    Postprocessing postprocessing(EPostProcessingEffect_Downscale | EPostProcessingEffect_ColorCorrection | EPostProcessingEffect_Warping, DisplayWidth, DisplayHeight, device);
+
+    postprocessing.execute();
+    EXPECT_EQ(2u, postprocessing.getIntermediateTargetPoolSize());
+
+    EXPECT_CALL(device, uploadRenderBuffer(_)).Times(0);
+    EXPECT_CALL(device, uploadRenderTarget(_)).Times(0);
+    postprocessing.execute();
+    postprocessing.execute();
+    EXPECT_EQ(2u, postprocessing.getIntermediateTargetPoolSize());
+}
+
+TEST_F(APostprocessing, usesSingleIntermediateTargetForTwoPassChainAcrossFrames)
+{
+    // output of color correction is the only intermediate target, warping renders to framebuffer
+    Postprocessing postprocessing(EPostProcessingEffect_ColorCorrection | EPostProcessingEffect_Warping, DisplayWidth, DisplayHeight, device);
+
+    EXPECT_CALL(device, uploadRenderBuffer(IntermediateColorBuffer(DisplayWidth, DisplayHeight)));
+    postprocessing.execute();
+    postprocessing.execute();
+    EXPECT_EQ(1u, postprocessing.getIntermediateTargetPoolSize());
+}
+
+TEST_F(APostprocessing, downscalesToHalfSizeTargetAndScalesBackToFramebufferIfDownscaleIsOnlyEffect)
+{
+    Postprocessing postprocessing(EPostProcessingEffect_Downscale, DisplayWidth, DisplayHeight, device);
+
+    const DeviceResourceHandle intermediateTarget(100u);
+    EXPECT_CALL(device, uploadRenderBuffer(IntermediateColorBuffer(DisplayWidth / 2u, DisplayHeight / 2u)));
+    EXPECT_CALL(device, uploadRenderTarget(_)).WillOnce(Return(intermediateTarget));
+    {
+        InSequence seq;
+        // downscale
+        EXPECT_CALL(device, activateRenderTarget(intermediateTarget));
+        EXPECT_CALL(device, setViewport(0u, 0u, DisplayWidth / 2u, DisplayHeight / 2u));
+        EXPECT_CALL(device, drawIndexedTriangles(_, _, _));
+        // upscale
+        EXPECT_CALL(device, activateRenderTarget(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle));
+        EXPECT_CALL(device, clear(EClearFlags_Color));
+        EXPECT_CALL(device, setViewport(0u, 0u, DisplayWidth, DisplayHeight));
+        EXPECT_CALL(device, drawIndexedTriangles(_, _, _));
+    }
+    postprocessing.execute();
+    EXPECT_EQ(1u, postprocessing.getIntermediateTargetPoolSize());
+}
+
+TEST_F(APostprocessing, releasesIntermediateTargetsAfterPasses)
+{
+    std::unique_ptr<Postprocessing> postprocessing(new Postprocessing(EPostProcessingEffect_ColorCorrection | EPostProcessingEffect_Warping, DisplayWidth, DisplayHeight, device));
+    postprocessing->execute();
+
+    const Expectation passesDeleted = EXPECT_CALL(device, deleteShader(_)).Times(2);
+    {
+        InSequence seq;
+        // intermediate target
+        EXPECT_CALL(device, deleteRenderTarget(DeviceMock::FakeRenderTargetDeviceHandle)).After(passesDeleted);
+        EXPECT_CALL(device, deleteRenderBuffer(DeviceMock::FakeRenderBufferDeviceHandle));
+        // scenes target
+        EXPECT_CALL(device, deleteRenderTarget(DeviceMock::FakeRenderTargetDeviceHandle));
+        EXPECT_CALL(device, deleteRenderBuffer(DeviceMock::FakeRenderBufferDeviceHandle)).Times(2);
+    }
+    postprocessing.reset();
+}
@@ -12,6 +12,7 @@
 #include "EmbeddedCompositingManagerMock.h"
 #include "ResourceProviderMock.h"
 #include "RenderExecutor.h"
+#include "RendererLib/GpuTimerQueries.h"
 #include "RendererLib/RendererCachedScene.h"
 #include "RendererLib/Renderer.h"
 #include "RendererLib/RendererScenes.h"
@@ -453,11 +454,11 @@ protected:
         Mock::VerifyAndClearExpectations(&renderer);
     }
 
-    SceneRenderExecutionIterator executeScene(SceneRenderExecutionIterator renderFrom = {}, const FrameTimer* frameTimer = nullptr)
+    SceneRenderExecutionIterator executeScene(SceneRenderExecutionIterator renderFrom = {}, const FrameTimer* frameTimer = nullptr, GpuTimerQueries* gpuTimerQueries = nullptr)
     {
         const Viewport vp(fakeViewportX, fakeViewportY, fakeViewportWidth, fakeViewportHeight);
         const FrameBufferInfo fbInfo(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, projectionParams, vp);
-        RenderExecutor executor(device, fbInfo, renderFrom, frameTimer);
+        RenderExecutor executor(device, fbInfo, renderFrom, frameTimer, gpuTimerQueries);
 
         return executor.executeScene(scene, Matrix44f::Identity);
     }
@@ -551,6 +552,50 @@ TEST_F(ARenderExecutor, RenderMultipleConsecutiveRenderPassesIntoOneRenderTarget
     executeScene();
 }
 
+TEST_F(ARenderExecutor, MeasuresGpuTimeOfEachRenderPassIfTimerQueriesGiven)
+{
+    const RenderPassHandle pass1 = createRenderPassWithCamera(ECameraProjectionType_Perspective);
+    const RenderableHandle renderable1 = createTestRenderable(createTestDataInstance(), createRenderGroup(pass1));
+
+    const RenderTargetHandle targetHandle = createRenderTarget(16, 20);
+    scene.setRenderPassRenderTarget(pass1, targetHandle);
+
+    const RenderPassHandle pass2 = createRenderPassWithCamera(ECameraProjectionType_Perspective);
+    scene.setRenderPassClearFlag(pass2, EClearFlags_None);
+    const RenderableHandle renderable2 = createTestRenderable(createTestDataInstance(), createRenderGroup(pass2));
+    scene.setRenderPassRenderTarget(pass2, targetHandle);
+
+    scene.setRenderPassRenderOrder(pass1, 0);
+    scene.setRenderPassRenderOrder(pass2, 1);
+
+    updateScenes();
+
+    const Matrix44f expectedProjectionMatrix = CameraMatrixHelper::ProjectionMatrix(ProjectionParams::Perspective(fakeFieldOfView, fakeAspectRatio, fakeNearPlane, fakeFarPlane));
+
+    const DeviceResourceHandle renderTargetDeviceHandle = resourceManager.getRenderTargetDeviceHandle(targetHandle, scene.getSceneId());
+
+    GpuTimerQueries gpuTimerQueries(device);
+    {
+        InSequence seq;
+
+        EXPECT_CALL(device, issueTimestampQuery()).WillOnce(Return(DeviceResourceHandle(1u)));
+        expectActivateRenderTarget(renderTargetDeviceHandle);
+        expectClearRenderTarget();
+        expectFrameRenderCommands(renderable1, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix);
+        EXPECT_CALL(device, issueTimestampQuery()).WillOnce(Return(DeviceResourceHandle(2u)));
+        EXPECT_CALL(device, issueTimestampQuery()).WillOnce(Return(DeviceResourceHandle(3u)));
+        expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false);
+        EXPECT_CALL(device, issueTimestampQuery()).WillOnce(Return(DeviceResourceHandle(4u)));
+    }
+
+    executeScene({}, nullptr, &gpuTimerQueries);
+    EXPECT_EQ(2u, gpuTimerQueries.getNumPendingMeasurements());
+
+    // pending queries released when timer queries destroyed
+    EXPECT_CALL(device, getTimestampQueryResult(_, _)).Times(0);
+    EXPECT_CALL(device, releaseTimestampQuery(_)).Times(4);
+}
+
 TEST_F(ARenderExecutor, RenderMultipleRenderPassesIntoMultipleRenderTargets)
 {
     const Viewport fakeVp1(1, 2, 3, 4);
@@ -36,6 +36,23 @@ namespace ramses_internal
                 EXPECT_EQ(r, orderedRenderables[i++]);
         }
 
+        RenderableHandle createRenderableWithResources(RenderPassHandle pass, TextureSamplerHandle sampler)
+        {
+            const RenderableHandle renderable = sceneHelper.createRenderable(sceneHelper.createRenderGroup(pass));
+            sceneHelper.createAndAssignUniformDataInstance(renderable, sampler);
+            sceneHelper.createAndAssignVertexDataInstance(renderable);
+            sceneHelper.setResourcesToRenderable(renderable);
+            return renderable;
+        }
+
+        void renderScene()
+        {
+            scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+            scene.updateRenderableWorldMatrices();
+            scene.updateRenderTargetsToRender(Matrix44f::Identity);
+            scene.markRenderTargetsAsRendered();
+        }
+
         RendererEventCollector rendererEventCollector;
         RendererScenes rendererScenes;
         RendererCachedScene& scene;
@@ -1306,4 +1323,225 @@ namespace ramses_internal
         scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
         EXPECT_TRUE(orderedPasses.empty());
     }
+
+    TEST_F(ARendererCachedScene, skipsRenderablesWithBoundingSphereOutsideOfFrustum)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rendInside = sceneHelper.createRenderable(group);
+        const RenderableHandle rendOutside = sceneHelper.createRenderable(group);
+        const RenderableHandle rendWithoutBounds = sceneHelper.createRenderable(group);
+        scene.setRenderableBoundingSphere(rendInside, Vector4(0.f, 0.f, 0.f, 0.5f));
+        scene.setRenderableBoundingSphere(rendOutside, Vector4(5.f, 0.f, 0.f, 1.f));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        scene.updateRenderableWorldMatrices();
+
+        const RenderableVector& renderables = scene.getRenderablesInFrustumForPass(pass, Matrix44f::Identity);
+        EXPECT_EQ(2u, renderables.size());
+        EXPECT_TRUE(contains_c(renderables, rendInside));
+        EXPECT_TRUE(contains_c(renderables, rendWithoutBounds));
+
+        UInt numCulled = 0u;
+        UInt numInFrustum = 0u;
+        scene.getFrustumCullingResult(numCulled, numInFrustum);
+        EXPECT_EQ(1u, numCulled);
+        EXPECT_EQ(2u, numInFrustum);
+    }
+
+    TEST_F(ARendererCachedScene, updatesFrustumCullingWhenBoundingSphereOrViewProjectionChanges)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend = sceneHelper.createRenderable(group);
+        scene.setRenderableBoundingSphere(rend, Vector4(5.f, 0.f, 0.f, 1.f));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        scene.updateRenderableWorldMatrices();
+        EXPECT_TRUE(scene.getRenderablesInFrustumForPass(pass, Matrix44f::Identity).empty());
+        EXPECT_EQ(1u, scene.getRenderablesInFrustumForPass(pass, Matrix44f::Translation(-5.f, 0.f, 0.f)).size());
+
+        scene.setRenderableBoundingSphere(rend, Vector4(0.f, 0.f, 0.f, 1.f));
+        EXPECT_TRUE(scene.getRenderablesInFrustumForPass(pass, Matrix44f::Translation(-5.f, 0.f, 0.f)).empty());
+        EXPECT_EQ(1u, scene.getRenderablesInFrustumForPass(pass, Matrix44f::Identity).size());
+    }
+
+    TEST_F(ARendererCachedScene, updatesFrustumCullingWhenRenderableIsTransformedIntoFrustum)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend = sceneHelper.createRenderable(group);
+        scene.setRenderableBoundingSphere(rend, Vector4(5.f, 0.f, 0.f, 1.f));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        scene.updateRenderableWorldMatrices();
+        EXPECT_TRUE(scene.getRenderablesInFrustumForPass(pass, Matrix44f::Identity).empty());
+
+        const TransformHandle transform = sceneAllocator.allocateTransform(scene.getRenderable(rend).node);
+        scene.setTranslation(transform, Vector3(-5.f, 0.f, 0.f));
+        scene.updateRenderableWorldMatrices();
+        EXPECT_EQ(1u, scene.getRenderablesInFrustumForPass(pass, Matrix44f::Identity).size());
+    }
+
+    TEST_F(ARendererCachedScene, skipsRenderPassIntoRenderTargetIfNothingChangedSinceLastRendered)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass, sceneHelper.renderTarget);
+        createRenderableWithResources(pass, sceneHelper.createTextureSamplerWithFakeClientTexture());
+
+        renderScene();
+        EXPECT_FALSE(scene.canRenderPassBeSkipped(pass));
+        EXPECT_EQ(0u, scene.getNumSkippedRenderPasses());
+
+        renderScene();
+        EXPECT_TRUE(scene.canRenderPassBeSkipped(pass));
+        EXPECT_EQ(1u, scene.getNumSkippedRenderPasses());
+    }
+
+    TEST_F(ARendererCachedScene, neverSkipsRenderPassIntoFramebuffer)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        createRenderableWithResources(pass, sceneHelper.createTextureSamplerWithFakeClientTexture());
+
+        renderScene();
+        renderScene();
+        EXPECT_FALSE(scene.canRenderPassBeSkipped(pass));
+        EXPECT_EQ(0u, scene.getNumSkippedRenderPasses());
+    }
+
+    TEST_F(ARendererCachedScene, rendersRenderPassIntoRenderTargetIfUniformOfItsRenderableChanged)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass, sceneHelper.renderTarget);
+        const RenderableHandle renderable = createRenderableWithResources(pass, sceneHelper.createTextureSamplerWithFakeClientTexture());
+        renderScene();
+        renderScene();
+        EXPECT_TRUE(scene.canRenderPassBeSkipped(pass));
+
+        scene.setDataSingleFloat(scene.getRenderable(renderable).dataInstances[ERenderableDataSlotType_Uniforms], sceneHelper.dataField, 1.f);
+        renderScene();
+        EXPECT_FALSE(scene.canRenderPassBeSkipped(pass));
+
+        renderScene();
+        EXPECT_TRUE(scene.canRenderPassBeSkipped(pass));
+    }
+
+    TEST_F(ARendererCachedScene, rendersRenderPassIntoRenderTargetIfItsRenderableWasTransformed)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass, sceneHelper.renderTarget);
+        const RenderableHandle renderable = createRenderableWithResources(pass, sceneHelper.createTextureSamplerWithFakeClientTexture());
+        const TransformHandle transform = sceneAllocator.allocateTransform(scene.getRenderable(renderable).node);
+        renderScene();
+        renderScene();
+        EXPECT_TRUE(scene.canRenderPassBeSkipped(pass));
+
+        scene.setTranslation(transform, Vector3(1.f, 0.f, 0.f));
+        renderScene();
+        EXPECT_FALSE(scene.canRenderPassBeSkipped(pass));
+    }
+
+    TEST_F(ARendererCachedScene, rendersRenderPassIntoRenderTargetIfRendererViewMatrixChanged)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass, sceneHelper.renderTarget);
+        createRenderableWithResources(pass, sceneHelper.createTextureSamplerWithFakeClientTexture());
+        renderScene();
+        renderScene();
+        EXPECT_TRUE(scene.canRenderPassBeSkipped(pass));
+
+        scene.updateRenderTargetsToRender(Matrix44f::Translation(0.f, 1.f, 0.f));
+        EXPECT_FALSE(scene.canRenderPassBeSkipped(pass));
+    }
+
+    TEST_F(ARendererCachedScene, rendersRenderPassIntoRenderTargetSamplingOtherRenderTargetWhichIsRendered)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass1, sceneHelper.renderTarget);
+        const RenderableHandle renderable1 = createRenderableWithResources(pass1, sceneHelper.createTextureSamplerWithFakeClientTexture());
+
+        const RenderTargetHandle renderTarget2 = sceneAllocator.allocateRenderTarget();
+        scene.addRenderTargetRenderBuffer(renderTarget2, sceneAllocator.allocateRenderBuffer({ 16u, 12u, ERenderBufferType_ColorBuffer, ETextureFormat_R8, ERenderBufferAccessMode_ReadWrite, 0u }));
+        const RenderPassHandle pass2 = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass2, renderTarget2);
+        scene.setRenderPassRenderOrder(pass2, 1);
+        createRenderableWithResources(pass2, sceneHelper.createTextureSampler(sceneHelper.renderTargetColorBuffer));
+
+        renderScene();
+        renderScene();
+        EXPECT_TRUE(scene.canRenderPassBeSkipped(pass1));
+        EXPECT_TRUE(scene.canRenderPassBeSkipped(pass2));
+
+        scene.setDataSingleFloat(scene.getRenderable(renderable1).dataInstances[ERenderableDataSlotType_Uniforms], sceneHelper.dataField, 1.f);
+        renderScene();
+        EXPECT_FALSE(scene.canRenderPassBeSkipped(pass1));
+        EXPECT_FALSE(scene.canRenderPassBeSkipped(pass2));
+    }
+
+    TEST_F(ARendererCachedScene, rendersAllRenderPassesIntoRenderTargetsIfInvalidatedOrPreviousRenderingDidNotFinish)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass, sceneHelper.renderTarget);
+        createRenderableWithResources(pass, sceneHelper.createTextureSamplerWithFakeClientTexture());
+        renderScene();
+        renderScene();
+        EXPECT_TRUE(scene.canRenderPassBeSkipped(pass));
+
+        scene.invalidateRenderTargetsContent();
+        renderScene();
+        EXPECT_FALSE(scene.canRenderPassBeSkipped(pass));
+
+        // rendering started but not marked as finished
+        scene.updateRenderTargetsToRender(Matrix44f::Identity);
+        EXPECT_TRUE(scene.canRenderPassBeSkipped(pass));
+        scene.updateRenderTargetsToRender(Matrix44f::Identity);
+        EXPECT_FALSE(scene.canRenderPassBeSkipped(pass));
+    }
+
+    TEST_F(ARendererCachedScene, rendersRenderPassIntoRenderTargetOnceResourcesOfItsRenderableGetResolved)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass, sceneHelper.renderTarget);
+        ON_CALL(sceneHelper.resourceManager, getClientResourceDeviceHandle(ResourceProviderMock::FakeIndexArrayHash)).WillByDefault(Return(DeviceResourceHandle::Invalid()));
+        const RenderableHandle renderable = createRenderableWithResources(pass, sceneHelper.createTextureSamplerWithFakeClientTexture());
+        renderScene();
+        renderScene();
+        EXPECT_TRUE(scene.renderableResourcesDirty(renderable));
+        EXPECT_FALSE(scene.canRenderPassBeSkipped(pass));
+
+        ON_CALL(sceneHelper.resourceManager, getClientResourceDeviceHandle(ResourceProviderMock::FakeIndexArrayHash)).WillByDefault(Return(DeviceMock::FakeIndexBufferDeviceHandle));
+        renderScene();
+        EXPECT_FALSE(scene.renderableResourcesDirty(renderable));
+        EXPECT_FALSE(scene.canRenderPassBeSkipped(pass));
+
+        renderScene();
+        EXPECT_TRUE(scene.canRenderPassBeSkipped(pass));
+    }
+
+    TEST_F(ARendererCachedScene, rendersAllRenderPassesIntoRenderTargetsWhileSkippingIsDisabled)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass, sceneHelper.renderTarget);
+        createRenderableWithResources(pass, sceneHelper.createTextureSamplerWithFakeClientTexture());
+
+        scene.setRenderTargetsSkippingEnabled(false);
+        renderScene();
+        renderScene();
+        EXPECT_FALSE(scene.canRenderPassBeSkipped(pass));
+        EXPECT_EQ(0u, scene.getNumSkippedRenderPasses());
+
+        scene.setRenderTargetsSkippingEnabled(true);
+        renderScene();
+        EXPECT_FALSE(scene.canRenderPassBeSkipped(pass));
+        renderScene();
+        EXPECT_TRUE(scene.canRenderPassBeSkipped(pass));
+    }
 }
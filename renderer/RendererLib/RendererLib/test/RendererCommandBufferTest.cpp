@@ -132,14 +132,16 @@ TEST_F(ARendererCommandBuffer, canFetchAllTypesOfRendererCommands)
     queueToFetch.logRendererInfo(ERendererLogTopic_All, true, NodeHandle::Invalid());
     queueToFetch.setClearColor(displayHandle, clearColor);
     queueToFetch.setFrameTimerLimits(4u, 1u, 2u, 3u);
+    queueToFetch.startFrameCapture(displayHandle, "capture.rgba", 30.f);
+    queueToFetch.stopFrameCapture(displayHandle);
 
-    EXPECT_EQ(34u, queueToFetch.getCommands().getTotalCommandCount());
+    EXPECT_EQ(36u, queueToFetch.getCommands().getTotalCommandCount());
 
     queue.addCommands(queueToFetch); //fetchRendererCommands
     queueToFetch.clear(); //clear fetched command queue
 
     EXPECT_EQ(0u, queueToFetch.getCommands().getTotalCommandCount());
-    EXPECT_EQ(34u, queue.getCommands().getTotalCommandCount());
+    EXPECT_EQ(36u, queue.getCommands().getTotalCommandCount());
 
     //check some details of the fetched commands
     EXPECT_EQ(ERendererCommand_PublishedScene, queue.getCommands().getCommandType(0));
@@ -161,5 +163,11 @@ TEST_F(ARendererCommandBuffer, canFetchAllTypesOfRendererCommands)
     EXPECT_EQ(ERendererCommand_SetClearColor, queue.getCommands().getCommandType(32));
     const auto& clearColorCmd = queue.getCommands().getCommandData<SetClearColorCommand>(32);
     EXPECT_TRUE(clearColorCmd.clearColor == clearColor);
+
+    EXPECT_EQ(ERendererCommand_StartFrameCapture, queue.getCommands().getCommandType(34));
+    const auto& frameCaptureCmd = queue.getCommands().getCommandData<FrameCaptureCommand>(34);
+    EXPECT_EQ(String("capture.rgba"), frameCaptureCmd.filename);
+    EXPECT_EQ(30.f, frameCaptureCmd.framesPerSecond);
+    EXPECT_EQ(ERendererCommand_StopFrameCapture, queue.getCommands().getCommandType(35));
 }
 }
@@ -373,6 +373,7 @@ TEST_P(ARendererCommandExecutor, readPixelsFromDisplay)
         EXPECT_CALL(m_platformFactoryMock.windowEventsPollingManagerMock, pollWindowsTillAnyCanRender());
     EXPECT_CALL(displayControllerMock, handleWindowEvents());
     EXPECT_CALL(displayControllerMock, canRenderNewFrame()).WillOnce(Return(true));
+    EXPECT_CALL(displayControllerMock, startReadPixels(x, y, width, height));
     EXPECT_CALL(displayControllerMock, readPixels(x, y, width, height, _)).WillOnce(Return(true));
     expectReadPixelsInRenderLoop(); // needed overhead calls
     m_renderer.doOneRenderLoop();
@@ -420,6 +421,7 @@ TEST_P(ARendererCommandExecutor, readAndSavePixelsFromDisplay)
         EXPECT_CALL(m_platformFactoryMock.windowEventsPollingManagerMock, pollWindowsTillAnyCanRender());
     EXPECT_CALL(displayControllerMock, handleWindowEvents());
     EXPECT_CALL(displayControllerMock, canRenderNewFrame()).WillOnce(Return(true));
+    EXPECT_CALL(displayControllerMock, startReadPixels(x, y, width, height));
     EXPECT_CALL(displayControllerMock, readPixels(x, y, width, height, _)).WillOnce(Return(true));
     expectReadPixelsInRenderLoop(); // needed overhead calls
     m_renderer.doOneRenderLoop();
@@ -446,6 +448,7 @@ TEST_P(ARendererCommandExecutor, readAndSaveFullscreenPixelsFromDisplay)
         EXPECT_CALL(m_platformFactoryMock.windowEventsPollingManagerMock, pollWindowsTillAnyCanRender());
     EXPECT_CALL(displayControllerMock, handleWindowEvents());
     EXPECT_CALL(displayControllerMock, canRenderNewFrame()).WillOnce(Return(true));
+    EXPECT_CALL(displayControllerMock, startReadPixels(0u, 0u, WindowMock::FakeWidth, WindowMock::FakeHeight));
     EXPECT_CALL(displayControllerMock, readPixels(0u, 0u, WindowMock::FakeWidth, WindowMock::FakeHeight, _)).WillOnce(Return(true));
     expectReadPixelsInRenderLoop(); // needed overhead calls
     m_renderer.doOneRenderLoop();
@@ -627,6 +627,27 @@ TEST_F(ARendererCommands, createsCommandsForSetClearColor)
     }
 }
 
+TEST_F(ARendererCommands, createsCommandsForFrameCapture)
+{
+    const DisplayHandle displayHandle(1u);
+    queue.startFrameCapture(displayHandle, "capture.rgba", 25.f);
+    queue.stopFrameCapture(displayHandle);
+
+    EXPECT_EQ(2u, queue.getCommands().getTotalCommandCount());
+    {
+        const auto& command = queue.getCommands().getCommandData<FrameCaptureCommand>(0);
+        EXPECT_EQ(ERendererCommand_StartFrameCapture, queue.getCommands().getCommandType(0));
+        EXPECT_EQ(displayHandle, command.displayHandle);
+        EXPECT_EQ(String("capture.rgba"), command.filename);
+        EXPECT_EQ(25.f, command.framesPerSecond);
+    }
+    {
+        const auto& command = queue.getCommands().getCommandData<FrameCaptureCommand>(1);
+        EXPECT_EQ(ERendererCommand_StopFrameCapture, queue.getCommands().getCommandType(1));
+        EXPECT_EQ(displayHandle, command.displayHandle);
+    }
+}
+
 TEST_F(ARendererCommands, createsCommandForSettingFrameTimerLimits)
 {
     queue.setFrameTimerLimits(5u, 10u, 20u, 30u);
@@ -677,4 +698,16 @@ TEST_F(ARendererCommands, createsCommandForSettingSkippingUnmodifiedBuffersFeatu
         EXPECT_TRUE(command.enable);
     }
 }
+
+TEST_F(ARendererCommands, createsCommandForSettingGpuTimerQueriesFeature)
+{
+    queue.setGpuTimerQueries(true);
+
+    EXPECT_EQ(1u, queue.getCommands().getTotalCommandCount());
+    {
+        const auto& command = queue.getCommands().getCommandData<SetFeatureCommand>(0);
+        EXPECT_EQ(ERendererCommand_SetGpuTimerQueries, queue.getCommands().getCommandType(0));
+        EXPECT_TRUE(command.enable);
+    }
+}
 }
@@ -207,6 +207,23 @@ TEST_F(ARendererStatistics, tracksFramebufferAndOffscreenBufferSwapCounts)
     EXPECT_TRUE(logOutputContains("FB2: 1; OB22: 1; OB33: 1"));
 }
 
+TEST_F(ARendererStatistics, tracksCapturedAndDroppedFrames)
+{
+    stats.framebufferSwapped(disp1);
+    stats.frameCaptured(disp1);
+    stats.framebufferSwapped(disp2);
+    stats.frameFinished(0u);
+
+    stats.framebufferSwapped(disp1);
+    stats.frameCaptured(disp1);
+    stats.frameCaptureDropped(disp1, 3u);
+    stats.framebufferSwapped(disp2);
+    stats.frameFinished(0u);
+
+    EXPECT_TRUE(logOutputContains("FB1: 2; captured: 2 (dropped: 3)"));
+    EXPECT_TRUE(logOutputContains("FB2: 2\n"));
+}
+
 TEST_F(ARendererStatistics, tracksInterruptibleOffscreenBuffer)
 {
     stats.offscreenBufferInterrupted(disp1, ob1);
@@ -291,6 +308,70 @@ TEST_F(ARendererStatistics, doesNotLogInterruptedFlushesIfThereAreNone)
     EXPECT_FALSE(logOutputContains("FApplyInterrupted"));
 }
 
+TEST_F(ARendererStatistics, tracksFrustumCulledRenderables)
+{
+    stats.trackFrustumCulling(sceneId1, 3u, 7u);
+    stats.trackFrustumCulling(sceneId1, 2u, 8u);
+    stats.frameFinished(0u);
+    EXPECT_TRUE(logOutputContains("culled 5 (inFrustum 15)"));
+
+    stats.reset();
+    EXPECT_FALSE(logOutputContains("culled"));
+}
+
+TEST_F(ARendererStatistics, tracksSkippedRenderPasses)
+{
+    stats.trackSkippedRenderPasses(sceneId1, 2u);
+    stats.trackSkippedRenderPasses(sceneId1, 3u);
+    stats.frameFinished(0u);
+    EXPECT_TRUE(logOutputContains("RPSkipped 5"));
+
+    stats.reset();
+    EXPECT_FALSE(logOutputContains("RPSkipped"));
+}
+
+TEST_F(ARendererStatistics, tracksSceneGpuTime)
+{
+    EXPECT_EQ(0u, stats.getAverageSceneGpuTime(sceneId1));
+
+    stats.trackSceneGpuTime(sceneId1, 100u);
+    stats.trackSceneGpuTime(sceneId1, 300u);
+    stats.trackSceneGpuTime(sceneId2, 50u);
+    stats.frameFinished(0u);
+    EXPECT_EQ(200u, stats.getAverageSceneGpuTime(sceneId1));
+    EXPECT_EQ(50u, stats.getAverageSceneGpuTime(sceneId2));
+    EXPECT_TRUE(logOutputContains("gpuTimeUs (100/300/200)"));
+    EXPECT_TRUE(logOutputContains("gpuTimeUs (50/50/50)"));
+
+    stats.reset();
+    EXPECT_EQ(0u, stats.getAverageSceneGpuTime(sceneId1));
+    stats.frameFinished(0u);
+    EXPECT_FALSE(logOutputContains("gpuTimeUs"));
+}
+
+TEST_F(ARendererStatistics, tracksRenderPassGpuTime)
+{
+    const RenderPassHandle pass1{ 3u };
+    const RenderPassHandle pass2{ 4u };
+    EXPECT_EQ(0u, stats.getAverageRenderPassGpuTime(sceneId1, pass1));
+
+    stats.trackRenderPassGpuTime(sceneId1, pass1, 10u);
+    stats.trackRenderPassGpuTime(sceneId1, pass1, 30u);
+    stats.trackRenderPassGpuTime(sceneId1, pass2, 7u);
+    stats.frameFinished(0u);
+    EXPECT_EQ(20u, stats.getAverageRenderPassGpuTime(sceneId1, pass1));
+    EXPECT_EQ(7u, stats.getAverageRenderPassGpuTime(sceneId1, pass2));
+    EXPECT_EQ(0u, stats.getAverageRenderPassGpuTime(sceneId2, pass1));
+    EXPECT_EQ(0u, stats.getAverageSceneGpuTime(sceneId1));
+    EXPECT_TRUE(logOutputContains("RP3 gpuTimeUs (10/30/20)"));
+    EXPECT_TRUE(logOutputContains("RP4 gpuTimeUs (7/7/7)"));
+
+    stats.reset();
+    EXPECT_EQ(0u, stats.getAverageRenderPassGpuTime(sceneId1, pass1));
+    stats.frameFinished(0u);
+    EXPECT_FALSE(logOutputContains("gpuTimeUs"));
+}
+
 TEST_F(ARendererStatistics, tracksClientResourceUploads)
 {
     stats.clientResourceUploaded(2u);
@@ -24,6 +24,9 @@
 #include "RendererMock.h"
 #include "ComponentMocks.h"
 #include "TestSceneHelper.h"
+#include "WindowMock.h"
+#include "Utils/File.h"
+#include "PlatformAbstraction/PlatformThread.h"
 #include <map>
 
 using namespace ramses_internal;
@@ -211,6 +214,20 @@ public:
         }
     }
 
+    // frames are written in background after frame capture is stopped
+    static UInt WaitForCaptureFileSize(const String& filename, UInt expectedSize)
+    {
+        UInt fileSize = 0u;
+        for (UInt32 i = 0u; i < 1000u; ++i)
+        {
+            File captureFile(filename);
+            if (captureFile.getSizeInBytes(fileSize) == EStatus_RAMSES_OK && fileSize >= expectedSize)
+                break;
+            PlatformThread::Sleep(10u);
+        }
+        return fileSize;
+    }
+
 protected:
     StrictMock<PlatformFactoryStrictMock>       platformFactoryMock;
     RendererCommandBuffer                       rendererCommandBuffer;
@@ -964,6 +981,7 @@ TEST_P(ARenderer, canTakeASingleScreenshot)
     screenshot.display = displayHandle;
     screenshot.filename = "";
     renderer.scheduleScreenshot(screenshot);
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(20u, 30u, 100u, 100u));
     EXPECT_CALL(*displayMock.m_displayController, readPixels(20u, 30u, 100u, 100u, _));
     expectFrameBufferRendered();
     expectSwapBuffers();
@@ -1018,10 +1036,15 @@ TEST_P(ARenderer, canTakeMultipleScreenshotsForMultipleDisplays)
     screenshot.display = displayHandle1;
     renderer.scheduleScreenshot(screenshot);
 
+    EXPECT_CALL(*displayMock1.m_displayController, startReadPixels(10u, 10u, 110u, 110u));
     EXPECT_CALL(*displayMock1.m_displayController, readPixels(10u, 10u, 110u, 110u, _));
+    EXPECT_CALL(*displayMock2.m_displayController, startReadPixels(20u, 20u, 120u, 120u));
     EXPECT_CALL(*displayMock2.m_displayController, readPixels(20u, 20u, 120u, 120u, _));
+    EXPECT_CALL(*displayMock1.m_displayController, startReadPixels(30u, 30u, 130u, 130u));
     EXPECT_CALL(*displayMock1.m_displayController, readPixels(30u, 30u, 130u, 130u, _));
+    EXPECT_CALL(*displayMock2.m_displayController, startReadPixels(40u, 40u, 140u, 140u));
     EXPECT_CALL(*displayMock2.m_displayController, readPixels(40u, 40u, 140u, 140u, _));
+    EXPECT_CALL(*displayMock1.m_displayController, startReadPixels(50u, 50u, 150u, 150u));
     EXPECT_CALL(*displayMock1.m_displayController, readPixels(50u, 50u, 150u, 150u, _));
     expectFrameBufferRendered(displayHandle1);
     expectFrameBufferRendered(displayHandle2);
@@ -1062,6 +1085,7 @@ TEST_P(ARenderer, failsToCreateScreenshot)
     screenshot.filename = "";
 
     renderer.scheduleScreenshot(screenshot);
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(0u, 0u, 100u, 100u));
     EXPECT_CALL(*displayMock.m_displayController, readPixels(0u, 0u, 100u, 100u, _)).WillOnce(Return(false));
     expectFrameBufferRendered();
     expectSwapBuffers();
@@ -1115,6 +1139,319 @@ TEST_P(ARenderer, willIgnoreScreenshotIfDisplayIsDestroyedAtTheSameTime)
     EXPECT_EQ(0u, screenshots.size());
 }
 
+TEST_P(ARenderer, readsScreenshotAsynchronouslyAndReportsItWhenReadIsFinished)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+    const DeviceResourceHandle readPixelsHandle(123u);
+
+    ScreenshotInfo screenshot;
+    screenshot.rectangle = { 0u, 0u, 10u, 20u };
+    screenshot.display = displayHandle;
+    screenshot.filename = "";
+    renderer.scheduleScreenshot(screenshot);
+
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(0u, 0u, 10u, 20u)).WillOnce(Return(readPixelsHandle));
+    EXPECT_CALL(*displayMock.m_displayController, readPixels(_, _, _, _, _)).Times(0);
+    expectFrameBufferRendered();
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    ScreenshotInfoVector screenshots;
+    renderer.dispatchProcessedScreenshots(screenshots);
+    EXPECT_TRUE(screenshots.empty());
+
+    // read not finished yet
+    EXPECT_CALL(*displayMock.m_displayController, enableContext());
+    EXPECT_CALL(*displayMock.m_displayController, isReadPixelsFinished(readPixelsHandle)).WillOnce(Return(false));
+    expectFrameBufferRendered(displayHandle, false, false);
+    doOneRendererLoop();
+
+    renderer.dispatchProcessedScreenshots(screenshots);
+    EXPECT_TRUE(screenshots.empty());
+
+    EXPECT_CALL(*displayMock.m_displayController, enableContext());
+    EXPECT_CALL(*displayMock.m_displayController, isReadPixelsFinished(readPixelsHandle)).WillOnce(Return(true));
+    EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(readPixelsHandle, 10u, 20u, _));
+    expectFrameBufferRendered(displayHandle, false, false);
+    doOneRendererLoop();
+
+    renderer.dispatchProcessedScreenshots(screenshots);
+    ASSERT_EQ(1u, screenshots.size());
+    EXPECT_TRUE(screenshots[0].success);
+    EXPECT_EQ(displayHandle, screenshots[0].display);
+    EXPECT_EQ(10u * 20u * 4u, screenshots[0].pixelData.size());
+
+    // check that finished read is not processed again
+    expectFrameBufferRendered(displayHandle, false, false);
+    doOneRendererLoop();
+
+    screenshots.clear();
+    renderer.dispatchProcessedScreenshots(screenshots);
+    EXPECT_TRUE(screenshots.empty());
+}
+
+TEST_P(ARenderer, releasesPendingScreenshotReadIfDisplayIsDestroyed)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+    const DeviceResourceHandle readPixelsHandle(123u);
+
+    ScreenshotInfo screenshot;
+    screenshot.rectangle = { 0u, 0u, 10u, 20u };
+    screenshot.display = displayHandle;
+    screenshot.filename = "";
+    renderer.scheduleScreenshot(screenshot);
+
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(0u, 0u, 10u, 20u)).WillOnce(Return(readPixelsHandle));
+    expectFrameBufferRendered();
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    EXPECT_CALL(*displayMock.m_displayController, enableContext());
+    EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(readPixelsHandle, 10u, 20u, _));
+    destroyDisplayController(displayHandle);
+    doOneRendererLoop();
+
+    ScreenshotInfoVector screenshots;
+    renderer.dispatchProcessedScreenshots(screenshots);
+    EXPECT_TRUE(screenshots.empty());
+}
+
+TEST_P(ARenderer, capturesEveryFrameAsynchronouslyAndWritesItToFile)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+    const DeviceResourceHandle readPixelsHandle1(123u);
+    const DeviceResourceHandle readPixelsHandle2(124u);
+    const String filename("rendererFrameCapture.rgba");
+    const UInt frameSize = WindowMock::FakeWidth * WindowMock::FakeHeight * 4u;
+
+    expectFrameBufferRendered();
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    renderer.startFrameCapture(displayHandle, filename, 0.f);
+    EXPECT_TRUE(renderer.isCapturingFrames(displayHandle));
+
+    // frame is re-rendered for capture although nothing changed
+    expectFrameBufferRendered();
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(0u, 0u, WindowMock::FakeWidth, WindowMock::FakeHeight)).InSequence(SeqRender).WillOnce(Return(readPixelsHandle1));
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    EXPECT_CALL(*displayMock.m_displayController, enableContext()).InSequence(SeqRender);
+    EXPECT_CALL(*displayMock.m_displayController, isReadPixelsFinished(readPixelsHandle1)).InSequence(SeqRender).WillOnce(Return(true));
+    EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(readPixelsHandle1, WindowMock::FakeWidth, WindowMock::FakeHeight, _)).InSequence(SeqRender);
+    expectFrameBufferRendered(displayHandle, false);
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(0u, 0u, WindowMock::FakeWidth, WindowMock::FakeHeight)).InSequence(SeqRender).WillOnce(Return(readPixelsHandle2));
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    // pending read is finished when capture is stopped
+    EXPECT_CALL(*displayMock.m_displayController, enableContext());
+    EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(readPixelsHandle2, WindowMock::FakeWidth, WindowMock::FakeHeight, _));
+    renderer.stopFrameCapture(displayHandle);
+    EXPECT_FALSE(renderer.isCapturingFrames(displayHandle));
+
+    expectFrameBufferRendered(displayHandle, false, false);
+    doOneRendererLoop();
+
+    EXPECT_EQ(2u * frameSize, WaitForCaptureFileSize(filename, 2u * frameSize));
+    File captureFile(filename);
+    EXPECT_EQ(EStatus_RAMSES_OK, captureFile.remove());
+
+    rendererStatistics.frameFinished(0u);
+    StringOutputStream statsStream;
+    rendererStatistics.writeStatsToStream(statsStream);
+    EXPECT_TRUE(statsStream.release().find("captured: 2 (dropped: 0)") >= 0);
+}
+
+TEST_P(ARenderer, dropsCapturedFrameIfReadsOfPreviousFramesAreNotFinished)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+    const DeviceResourceHandle readPixelsHandle1(123u);
+    const DeviceResourceHandle readPixelsHandle2(124u);
+    const String filename("rendererFrameCapture.rgba");
+
+    renderer.startFrameCapture(displayHandle, filename, 0.f);
+
+    expectFrameBufferRendered();
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(_, _, _, _)).InSequence(SeqRender).WillOnce(Return(readPixelsHandle1));
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    EXPECT_CALL(*displayMock.m_displayController, enableContext()).InSequence(SeqRender);
+    EXPECT_CALL(*displayMock.m_displayController, isReadPixelsFinished(readPixelsHandle1)).InSequence(SeqRender).WillOnce(Return(false));
+    expectFrameBufferRendered(displayHandle, false);
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(_, _, _, _)).InSequence(SeqRender).WillOnce(Return(readPixelsHandle2));
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    // two reads pending, frame is rendered but not captured
+    EXPECT_CALL(*displayMock.m_displayController, enableContext()).InSequence(SeqRender);
+    EXPECT_CALL(*displayMock.m_displayController, isReadPixelsFinished(readPixelsHandle1)).InSequence(SeqRender).WillOnce(Return(false));
+    expectFrameBufferRendered(displayHandle, false);
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(_, _, _, _)).Times(0);
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    EXPECT_CALL(*displayMock.m_displayController, enableContext());
+    EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(readPixelsHandle1, _, _, _));
+    EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(readPixelsHandle2, _, _, _));
+    renderer.stopFrameCapture(displayHandle);
+
+    WaitForCaptureFileSize(filename, 2u * WindowMock::FakeWidth * WindowMock::FakeHeight * 4u);
+    File captureFile(filename);
+    EXPECT_EQ(EStatus_RAMSES_OK, captureFile.remove());
+
+    rendererStatistics.frameFinished(0u);
+    StringOutputStream statsStream;
+    rendererStatistics.writeStatsToStream(statsStream);
+    EXPECT_TRUE(statsStream.release().find("captured: 2 (dropped: 1)") >= 0);
+}
+
+TEST_P(ARenderer, capturesFramesAtGivenRateAndReadsPixelsSynchronouslyIfAsynchronousReadIsNotSupported)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+    const String filename("rendererFrameCapture.rgba");
+
+    // first frame is captured immediately, next one only after very long time
+    renderer.startFrameCapture(displayHandle, filename, 0.001f);
+
+    expectFrameBufferRendered();
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(0u, 0u, WindowMock::FakeWidth, WindowMock::FakeHeight)).InSequence(SeqRender).WillOnce(Return(DeviceResourceHandle::Invalid()));
+    EXPECT_CALL(*displayMock.m_displayController, readPixels(0u, 0u, WindowMock::FakeWidth, WindowMock::FakeHeight, _)).InSequence(SeqRender);
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    expectFrameBufferRendered(displayHandle, false, false);
+    doOneRendererLoop();
+
+    renderer.stopFrameCapture(displayHandle);
+
+    const UInt frameSize = WindowMock::FakeWidth * WindowMock::FakeHeight * 4u;
+    EXPECT_EQ(frameSize, WaitForCaptureFileSize(filename, frameSize));
+    File captureFile(filename);
+    EXPECT_EQ(EStatus_RAMSES_OK, captureFile.remove());
+}
+
+TEST_P(ARenderer, finishesPendingFrameCaptureIfDisplayIsDestroyed)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+    const DeviceResourceHandle readPixelsHandle(123u);
+    const String filename("rendererFrameCapture.rgba");
+
+    renderer.startFrameCapture(displayHandle, filename, 0.f);
+
+    expectFrameBufferRendered();
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(_, _, _, _)).InSequence(SeqRender).WillOnce(Return(readPixelsHandle));
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    EXPECT_CALL(*displayMock.m_displayController, enableContext());
+    EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(readPixelsHandle, _, _, _));
+    destroyDisplayController(displayHandle);
+    doOneRendererLoop();
+
+    const UInt frameSize = WindowMock::FakeWidth * WindowMock::FakeHeight * 4u;
+    EXPECT_EQ(frameSize, WaitForCaptureFileSize(filename, frameSize));
+    File captureFile(filename);
+    EXPECT_EQ(EStatus_RAMSES_OK, captureFile.remove());
+}
+
+TEST_P(ARenderer, finishesPendingFrameCaptureReadWithDisplaySizeAtReadStartAndDropsFramesOfResizedDisplay)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+    const DeviceResourceHandle readPixelsHandle1(123u);
+    const DeviceResourceHandle readPixelsHandle2(124u);
+    const String filename("rendererFrameCapture.rgba");
+    const UInt32 resizedWidth = WindowMock::FakeWidth * 2u;
+
+    renderer.startFrameCapture(displayHandle, filename, 0.f);
+
+    expectFrameBufferRendered();
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(0u, 0u, WindowMock::FakeWidth, WindowMock::FakeHeight)).InSequence(SeqRender).WillOnce(Return(readPixelsHandle1));
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    ON_CALL(*displayMock.m_displayController, getDisplayWidth()).WillByDefault(Return(resizedWidth));
+    EXPECT_CALL(*displayMock.m_displayController, enableContext()).InSequence(SeqRender);
+    EXPECT_CALL(*displayMock.m_displayController, isReadPixelsFinished(readPixelsHandle1)).InSequence(SeqRender).WillOnce(Return(true));
+    EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(readPixelsHandle1, WindowMock::FakeWidth, WindowMock::FakeHeight, _)).InSequence(SeqRender);
+    expectFrameBufferRendered(displayHandle, false);
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(0u, 0u, resizedWidth, WindowMock::FakeHeight)).InSequence(SeqRender).WillOnce(Return(readPixelsHandle2));
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    EXPECT_CALL(*displayMock.m_displayController, enableContext());
+    EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(readPixelsHandle2, resizedWidth, WindowMock::FakeHeight, _));
+    renderer.stopFrameCapture(displayHandle);
+
+    const UInt frameSize = WindowMock::FakeWidth * WindowMock::FakeHeight * 4u;
+    EXPECT_EQ(frameSize, WaitForCaptureFileSize(filename, frameSize));
+    File captureFile(filename);
+    EXPECT_EQ(EStatus_RAMSES_OK, captureFile.remove());
+
+    rendererStatistics.frameFinished(0u);
+    StringOutputStream statsStream;
+    rendererStatistics.writeStatsToStream(statsStream);
+    EXPECT_TRUE(statsStream.release().find("captured: 1 (dropped: 1)") >= 0);
+}
+
+TEST_P(ARenderer, enablesGpuTimerQueriesOnDisplayAndCollectsResultsEveryFrame)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+
+    renderer.setGpuTimerQueriesEnabled(true);
+
+    EXPECT_CALL(*displayMock.m_displayController, enableContext()).InSequence(SeqRender);
+    EXPECT_CALL(*displayMock.m_displayController, enableGpuTimerQueries(true)).InSequence(SeqRender);
+    expectFrameBufferRendered(displayHandle, false);
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    EXPECT_CALL(*displayMock.m_displayController, enableContext()).InSequence(SeqRender);
+    EXPECT_CALL(*displayMock.m_displayController, collectGpuTimerQueryResults(Ref(rendererStatistics))).InSequence(SeqRender);
+    expectFrameBufferRendered(displayHandle, false, false);
+    doOneRendererLoop();
+
+    // results measured before disabling are still collected
+    renderer.setGpuTimerQueriesEnabled(false);
+    EXPECT_CALL(*displayMock.m_displayController, enableContext()).InSequence(SeqRender);
+    EXPECT_CALL(*displayMock.m_displayController, collectGpuTimerQueryResults(Ref(rendererStatistics))).InSequence(SeqRender);
+    EXPECT_CALL(*displayMock.m_displayController, enableGpuTimerQueries(false)).InSequence(SeqRender);
+    expectFrameBufferRendered(displayHandle, false, false);
+    doOneRendererLoop();
+
+    expectFrameBufferRendered(displayHandle, false, false);
+    doOneRendererLoop();
+}
+
+TEST_P(ARenderer, disablesGpuTimerQueriesIfDisplayIsDestroyed)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+
+    renderer.setGpuTimerQueriesEnabled(true);
+
+    EXPECT_CALL(*displayMock.m_displayController, enableContext()).InSequence(SeqRender);
+    EXPECT_CALL(*displayMock.m_displayController, enableGpuTimerQueries(true)).InSequence(SeqRender);
+    expectFrameBufferRendered(displayHandle, false);
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    EXPECT_CALL(*displayMock.m_displayController, enableContext());
+    EXPECT_CALL(*displayMock.m_displayController, enableGpuTimerQueries(false));
+    destroyDisplayController(displayHandle);
+    doOneRendererLoop();
+}
+
 TEST_P(ARenderer, marksRenderOncePassesAsRenderedAfterRenderingScene)
 {
     const DisplayHandle displayHandle = addDisplayController();
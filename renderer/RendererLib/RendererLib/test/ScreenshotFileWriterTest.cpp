@@ -0,0 +1,71 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2019 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/ScreenshotFileWriter.h"
+#include "Utils/Image.h"
+#include "ramses-capu/os/File.h"
+
+using namespace testing;
+using namespace ramses_internal;
+
+class AScreenshotFileWriter : public ::testing::Test
+{
+public:
+    static ScreenshotInfo CreateScreenshot(const String& filename, UInt32 width, UInt32 height)
+    {
+        ScreenshotInfo screenshot;
+        screenshot.rectangle = { 0u, 0u, width, height };
+        screenshot.filename = filename;
+        screenshot.success = true;
+        screenshot.sendViaDLT = false;
+        screenshot.pixelData.resize(width * height * 4u, 0xffu);
+        return screenshot;
+    }
+
+    static void ExpectFileWrittenAndRemove(const String& filename, UInt32 width, UInt32 height)
+    {
+        ramses_capu::File screenshotFile(filename.stdRef());
+        ASSERT_TRUE(screenshotFile.exists());
+
+        Image bitmap;
+        bitmap.loadFromFilePNG(filename);
+        EXPECT_EQ(width, bitmap.getWidth());
+        EXPECT_EQ(height, bitmap.getHeight());
+        EXPECT_EQ(ramses_capu::CAPU_OK, screenshotFile.remove());
+    }
+};
+
+TEST_F(AScreenshotFileWriter, writesScreenshotsToFiles)
+{
+    ScreenshotFileWriter writer;
+    writer.writeScreenshot(CreateScreenshot("asyncScreenshot1.png", 4u, 2u));
+    writer.writeScreenshot(CreateScreenshot("asyncScreenshot2.png", 3u, 5u));
+    writer.waitUntilAllScreenshotsWritten();
+
+    ExpectFileWrittenAndRemove("asyncScreenshot1.png", 4u, 2u);
+    ExpectFileWrittenAndRemove("asyncScreenshot2.png", 3u, 5u);
+}
+
+TEST_F(AScreenshotFileWriter, writesQueuedScreenshotsBeforeDestruction)
+{
+    {
+        ScreenshotFileWriter writer;
+        writer.writeScreenshot(CreateScreenshot("asyncScreenshot1.png", 4u, 2u));
+        writer.writeScreenshot(CreateScreenshot("asyncScreenshot2.png", 3u, 5u));
+    }
+
+    ExpectFileWrittenAndRemove("asyncScreenshot1.png", 4u, 2u);
+    ExpectFileWrittenAndRemove("asyncScreenshot2.png", 3u, 5u);
+}
+
+TEST_F(AScreenshotFileWriter, canWaitWithoutAnyScreenshotQueued)
+{
+    ScreenshotFileWriter writer;
+    writer.waitUntilAllScreenshotsWritten();
+}
@@ -153,4 +153,43 @@ namespace ramses_internal
         destroyDisplayController(stereoController);
     }
 
+    TEST_F(AStereoDisplayController, MeasuresGpuTimeOfSceneOverBothEyesButNotOfItsRenderPasses)
+    {
+        StereoDisplayControllerFacade& stereoController = createStereoDisplayController();
+        stereoController.setProjectionParams(ProjectionParams::Perspective(1.f, 1.f, 1.f, 2.f)); // dummy but valid params
+        stereoController.enableGpuTimerQueries(true);
+
+        RendererEventCollector rendererEventCollector;
+        RendererScenes rendererScenes(rendererEventCollector);
+        RendererCachedScene& scene = rendererScenes.createScene(SceneInfo());
+        SceneAllocateHelper sceneAllocator(scene);
+        const RenderPassHandle pass = sceneAllocator.allocateRenderPass();
+        const NodeHandle cameraNode = sceneAllocator.allocateNode();
+        const auto dataLayout = sceneAllocator.allocateDataLayout({ {EDataType_Vector2I}, {EDataType_Vector2I} });
+        const CameraHandle camera = sceneAllocator.allocateCamera(ECameraProjectionType_Renderer, cameraNode, sceneAllocator.allocateDataInstance(dataLayout));
+        sceneAllocator.allocateTransform(cameraNode);
+        scene.setRenderPassCamera(pass, camera);
+
+        NiceMock<ResourceDeviceHandleAccessorMock> resourceAccessor;
+        NiceMock<EmbeddedCompositingManagerMock> embeddedCompositingManager;
+        scene.updateRenderablesAndResourceCache(resourceAccessor, embeddedCompositingManager);
+
+        {
+            InSequence seq;
+            EXPECT_CALL(m_renderBackend.deviceMock, issueTimestampQuery()).WillOnce(Return(DeviceResourceHandle(1u)));
+            for (UInt32 eye = 0u; eye < 2u; ++eye)
+            {
+                EXPECT_CALL(m_renderBackend.deviceMock, activateRenderTarget(DeviceMock::FakeRenderTargetDeviceHandle));
+                EXPECT_CALL(m_renderBackend.deviceMock, setViewport(_, _, _, _));
+            }
+            EXPECT_CALL(m_renderBackend.deviceMock, issueTimestampQuery()).WillOnce(Return(DeviceResourceHandle(2u)));
+        }
+
+        const DeviceResourceHandle unusedBuffer(0);
+        const Viewport unusedViewport(1, 2, 3, 4);
+        stereoController.renderScene(scene, unusedBuffer, unusedViewport);
+
+        EXPECT_CALL(m_renderBackend.deviceMock, releaseTimestampQuery(_)).Times(2);
+        destroyDisplayController(stereoController);
+    }
 }
@@ -166,6 +166,7 @@ TEST_F(AWindowedRendererWithDisplay, saveScreenshotToFileWithFullscreenDoesNotGe
 
     m_commandBuffer.readPixels(displayHandle, filename, true, 0u, 0u, 1u, 1u);
     updateAndRender();
+    m_renderer.waitUntilAllScreenshotsWritten();
 
     // expect file has been written
     ramses_capu::File screenshotFile(filename.stdRef());
@@ -109,6 +109,13 @@ namespace ramses_internal
         MOCK_METHOD1(deleteBlitPassRenderTargets, void(DeviceResourceHandle));
 
         MOCK_METHOD5(readPixels, void(UInt8*, UInt32, UInt32, UInt32, UInt32));
+        MOCK_METHOD4(startReadPixels, DeviceResourceHandle(UInt32, UInt32, UInt32, UInt32));
+        MOCK_METHOD1(isReadPixelsFinished, Bool(DeviceResourceHandle));
+        MOCK_METHOD2(finishReadPixels, Bool(DeviceResourceHandle, UInt8*));
+        MOCK_METHOD0(issueTimestampQuery, DeviceResourceHandle());
+        MOCK_METHOD1(isTimestampQueryResultAvailable, Bool(DeviceResourceHandle));
+        MOCK_METHOD2(getTimestampQueryResult, Bool(DeviceResourceHandle, UInt64&));
+        MOCK_METHOD1(releaseTimestampQuery, void(DeviceResourceHandle));
 
         MOCK_CONST_METHOD0(getTotalGpuMemoryUsageInKB, UInt32());
         MOCK_CONST_METHOD0(getDrawCallCount, UInt32());
@@ -40,9 +40,14 @@ public:
     MOCK_METHOD0(executePostProcessing, void());
     MOCK_CONST_METHOD0(getDisplayBuffer, DeviceResourceHandle());
     MOCK_METHOD5(readPixels, ramses_internal::Bool(UInt32 x, UInt32 y, UInt32 width, UInt32 height, std::vector<UInt8>& dataOut));
+    MOCK_METHOD4(startReadPixels, DeviceResourceHandle(UInt32 x, UInt32 y, UInt32 width, UInt32 height));
+    MOCK_METHOD1(isReadPixelsFinished, ramses_internal::Bool(DeviceResourceHandle readPixelsHandle));
+    MOCK_METHOD4(finishReadPixels, ramses_internal::Bool(DeviceResourceHandle readPixelsHandle, UInt32 width, UInt32 height, std::vector<UInt8>& dataOut));
     MOCK_METHOD1(setProjectionParams, void(const ProjectionParams& params));
     MOCK_CONST_METHOD0(isWarpingEnabled, bool());
     MOCK_METHOD1(setWarpingMeshData, void(const WarpingMeshData& meshData));
+    MOCK_METHOD1(enableGpuTimerQueries, void(Bool enable));
+    MOCK_METHOD1(collectGpuTimerQueryResults, void(RendererStatistics& stats));
     MOCK_CONST_METHOD0(getProjectionParams, const ProjectionParams&());
     MOCK_METHOD1(setViewPosition, void(const Vector3& position));
     MOCK_METHOD1(setViewRotation, void(const Vector3& rotation));
@@ -58,6 +63,7 @@ public:
 
 private:
     static ramses_internal::Bool ResizePixelBuffer(UInt32 x, UInt32 y, UInt32 width, UInt32 height, std::vector<UInt8>& dataOut);
+    static ramses_internal::Bool ResizeFinishedPixelBuffer(DeviceResourceHandle readPixelsHandle, UInt32 width, UInt32 height, std::vector<UInt8>& dataOut);
 };
 }
 #endif
@@ -57,6 +57,11 @@ namespace ramses_internal
         ON_CALL(*this, uploadTextureSampler(_,_,_,_,_,_)).WillByDefault(Return(FakeTextureSamplerDeviceHandle));
         ON_CALL(*this, uploadRenderTarget(_)).WillByDefault(Return(FakeRenderTargetDeviceHandle));
         ON_CALL(*this, getFramebufferRenderTarget()).WillByDefault(Return(FakeFrameBufferRenderTargetDeviceHandle));
+
+        // pixels are read synchronously unless test provides a read pixels handle
+        ON_CALL(*this, startReadPixels(_, _, _, _)).WillByDefault(Return(DeviceResourceHandle::Invalid()));
+        // GPU timer queries are not supported unless test provides a query handle
+        ON_CALL(*this, issueTimestampQuery()).WillByDefault(Return(DeviceResourceHandle::Invalid()));
     }
 
     DeviceMockWithDestructor::DeviceMockWithDestructor()
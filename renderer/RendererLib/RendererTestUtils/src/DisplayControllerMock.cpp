@@ -22,6 +22,9 @@ DisplayControllerMock::DisplayControllerMock()
     ON_CALL(*this, getProjectionParams()).WillByDefault(ReturnRef(FakeProjectionParams));
     ON_CALL(*this, getViewMatrix()).WillByDefault(ReturnRef(Matrix44f::Identity));
     ON_CALL(*this, readPixels(_, _, _, _, _)).WillByDefault(Invoke(ResizePixelBuffer));
+    ON_CALL(*this, startReadPixels(_, _, _, _)).WillByDefault(Return(DeviceResourceHandle::Invalid()));
+    ON_CALL(*this, isReadPixelsFinished(_)).WillByDefault(Return(true));
+    ON_CALL(*this, finishReadPixels(_, _, _, _)).WillByDefault(Invoke(ResizeFinishedPixelBuffer));
     ON_CALL(*this, renderScene(_, _, _, _, _)).WillByDefault(Return(SceneRenderExecutionIterator()));
 }
 
@@ -34,4 +37,10 @@ bool DisplayControllerMock::ResizePixelBuffer(UInt32 x, UInt32 y, UInt32 width,
     dataOut.resize((width - x) * (height - y) * 4u); // Assuming RGBA8 non multisampled
     return true;
 }
+
+bool DisplayControllerMock::ResizeFinishedPixelBuffer(DeviceResourceHandle, UInt32 width, UInt32 height, std::vector<UInt8>& dataOut)
+{
+    dataOut.resize(width * height * 4u); // Assuming RGBA8 non multisampled
+    return true;
+}
 }
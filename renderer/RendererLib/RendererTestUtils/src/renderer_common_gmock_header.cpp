@@ -18,6 +18,8 @@ namespace ramses_internal
         *os << "Fullscreen=" << config.getFullscreenState();
         *os << "\nBorderlesss=" << config.getBorderlessState();
         *os << "\nWarping=" << config.isWarpingEnabled();
+        *os << "\nColorCorrection=" << !config.getColorCorrectionLookupTable().empty();
+        *os << "\nDownscale=" << config.isDownscaleEnabled();
 
         *os << "\nAntialiasing method=" << config.getAntialiasingMethod();
         *os << "\nAntialiasing samples=" << config.getAntialiasingSampleCount();
@@ -196,6 +196,29 @@ namespace ramses
         */
         status_t enableWarpingPostEffect();
 
+        /**
+        * @brief Enable color correction post effect. Every color channel of the rendered image is mapped
+        *        through the given lookup table, alpha channel is kept unchanged.
+        *        Post effects are applied in order downscale, color correction, warping.
+        *
+        * @param[in] lookupTable 256 RGBA8 entries (1024 bytes), entry at index i holds the output
+        *            for input value i in its red, green and blue component for the respective channel.
+        *            Data is copied.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t enableColorCorrectionPostEffect(const uint8_t* lookupTable);
+
+        /**
+        * @brief Enable downscale post effect. Rendered image is reduced to half of display resolution
+        *        before following post effects are applied, which reduces their cost at the expense of detail.
+        *        Final image is scaled back to display resolution.
+        *
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t enableDownscalePostEffect();
+
         /**
         * @brief Enable stereo display.
         *        Will create a stereo display that can be used to render left and right eye.
@@ -443,6 +443,34 @@ namespace ramses
         */
         status_t readPixels(displayId_t displayId, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
 
+        /**
+        * @brief Starts continuous capture of the display framebuffer, e.g. for headless rendering and video encoding.
+        * @details Frames are read back asynchronously and appended as raw RGBA8 data (display width * height * 4 bytes
+        *          per frame, rows ordered top-down) to the given file, which can also be a named pipe consumed by another process.
+        *          A frame is captured whenever the capture interval elapsed (the display is re-rendered for it even if no scene changed).
+        *          Frames which cannot be captured in time, because the renderer was too slow or read back or writing
+        *          could not keep up, are dropped and reported in the renderer statistics.
+        *          Starting a capture on a display which is already being captured restarts it with the new parameters.
+        *
+        * @param[in] displayId id of display to capture frames of.
+        * @param[in] fileName Path of file or named pipe the frames are written to.
+        * @param[in] framesPerSecond Rate at which frames are captured, 0 captures every rendered frame.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t startFrameCapture(displayId_t displayId, const char* fileName, float framesPerSecond);
+
+        /**
+        * @brief Stops continuous capture of the display framebuffer started with RamsesRenderer::startFrameCapture.
+        * @details All frames captured so far are still written after the capture is stopped. The renderer does not wait for that,
+        *          e.g. for a named pipe which has no consumer connected yet, only when the renderer is destroyed.
+        *
+        * @param[in] displayId id of display to stop capturing frames of.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t stopFrameCapture(displayId_t displayId);
+
         /////////////////////////////////////////////////
         //      System Compositor API
         /////////////////////////////////////////////////
@@ -32,6 +32,8 @@ namespace ramses
         status_t setMultiSampling(uint32_t numSamples);
         status_t getMultiSamplingSamples(uint32_t& numSamples) const;
         status_t enableWarpingPostEffect();
+        status_t enableColorCorrectionPostEffect(const uint8_t* lookupTable);
+        status_t enableDownscalePostEffect();
         status_t enableStereoDisplay();
         status_t setWaylandIviSurfaceID(uint32_t waylandIviSurfaceID);
         uint32_t getWaylandIviSurfaceID() const;
@@ -75,6 +75,8 @@ namespace ramses
         status_t assignSceneToFramebuffer(sceneId_t sceneId);
 
         status_t readPixels(displayId_t displayId, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+        status_t startFrameCapture(displayId_t displayId, const char* fileName, float framesPerSecond);
+        status_t stopFrameCapture(displayId_t displayId);
         status_t updateWarpingMeshData(displayId_t displayId, const WarpingMeshData& newWarpingMeshData);
 
         status_t systemCompositorSetIviSurfaceVisibility(uint32_t surfaceId, bool visibility);
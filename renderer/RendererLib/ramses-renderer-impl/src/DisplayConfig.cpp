@@ -121,6 +121,20 @@ namespace ramses
         return status;
     }
 
+    status_t DisplayConfig::enableColorCorrectionPostEffect(const uint8_t* lookupTable)
+    {
+        const status_t status = impl.enableColorCorrectionPostEffect(lookupTable);
+        LOG_HL_RENDERER_API1(status, LOG_API_GENERIC_PTR_STRING(lookupTable));
+        return status;
+    }
+
+    status_t DisplayConfig::enableDownscalePostEffect()
+    {
+        const status_t status = impl.enableDownscalePostEffect();
+        LOG_HL_RENDERER_API_NOARG(status);
+        return status;
+    }
+
     status_t DisplayConfig::enableStereoDisplay()
     {
         const status_t status = impl.enableStereoDisplay();
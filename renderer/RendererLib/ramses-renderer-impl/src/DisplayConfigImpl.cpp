@@ -8,6 +8,7 @@
 
 #include "DisplayConfigImpl.h"
 #include "RendererLib/RendererConfigUtils.h"
+#include "RendererAPI/Types.h"
 #include "Math3d/CameraMatrixHelper.h"
 
 namespace ramses
@@ -149,6 +150,23 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t DisplayConfigImpl::enableColorCorrectionPostEffect(const uint8_t* lookupTable)
+    {
+        if (lookupTable == nullptr)
+        {
+            return addErrorEntry("DisplayConfig::enableColorCorrectionPostEffect failed - lookup table cannot be null!");
+        }
+
+        m_internalConfig.setColorCorrectionLookupTable(std::vector<ramses_internal::UInt8>(lookupTable, lookupTable + ramses_internal::ColorCorrectionLookupTableSizeInBytes));
+        return StatusOK;
+    }
+
+    status_t DisplayConfigImpl::enableDownscalePostEffect()
+    {
+        m_internalConfig.setDownscaleEnabled(true);
+        return StatusOK;
+    }
+
     status_t DisplayConfigImpl::enableStereoDisplay()
     {
         m_internalConfig.setStereoDisplay(true);
@@ -275,6 +293,16 @@ namespace ramses
                 addValidationMessage(EValidationSeverity_Error, indent, "warping is not supported for stereo display");
                 status = getValidationErrorStatus();
             }
+            if (!m_internalConfig.getColorCorrectionLookupTable().empty())
+            {
+                addValidationMessage(EValidationSeverity_Error, indent, "color correction is not supported for stereo display");
+                status = getValidationErrorStatus();
+            }
+            if (m_internalConfig.isDownscaleEnabled())
+            {
+                addValidationMessage(EValidationSeverity_Error, indent, "downscale is not supported for stereo display");
+                status = getValidationErrorStatus();
+            }
             if (m_internalConfig.getAntialiasingMethod() != ramses_internal::EAntiAliasingMethod_PlainFramebuffer)
             {
                 addValidationMessage(EValidationSeverity_Error, indent, "anti aliasing is not supported for stereo display");
@@ -192,6 +192,20 @@ namespace ramses
         return status;
     }
 
+    status_t RamsesRenderer::startFrameCapture(displayId_t displayId, const char* fileName, float framesPerSecond)
+    {
+        const status_t status = impl.startFrameCapture(displayId, fileName, framesPerSecond);
+        LOG_HL_RENDERER_API3(status, displayId, fileName, framesPerSecond);
+        return status;
+    }
+
+    status_t RamsesRenderer::stopFrameCapture(displayId_t displayId)
+    {
+        const status_t status = impl.stopFrameCapture(displayId);
+        LOG_HL_RENDERER_API1(status, displayId);
+        return status;
+    }
+
     status_t RamsesRenderer::updateWarpingMeshData(displayId_t displayId, const WarpingMeshData& newWarpingMeshData)
     {
         const status_t status = impl.updateWarpingMeshData(displayId, newWarpingMeshData);
@@ -328,6 +328,31 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t RamsesRendererImpl::startFrameCapture(displayId_t displayId, const char* fileName, float framesPerSecond)
+    {
+        if (fileName == nullptr || fileName[0] == '\0')
+            return addErrorEntry("RamsesRenderer::startFrameCapture failed: file name must not be empty");
+        if (framesPerSecond < 0.f)
+            return addErrorEntry("RamsesRenderer::startFrameCapture failed: frames per second must not be negative");
+
+        ramses_internal::PlatformLightweightGuard guard(m_lock);
+
+        const ramses_internal::DisplayHandle displayHandle(displayId);
+        m_pendingRendererCommands.startFrameCapture(displayHandle, fileName, framesPerSecond);
+
+        return StatusOK;
+    }
+
+    status_t RamsesRendererImpl::stopFrameCapture(displayId_t displayId)
+    {
+        ramses_internal::PlatformLightweightGuard guard(m_lock);
+
+        const ramses_internal::DisplayHandle displayHandle(displayId);
+        m_pendingRendererCommands.stopFrameCapture(displayHandle);
+
+        return StatusOK;
+    }
+
     status_t RamsesRendererImpl::systemCompositorSetIviSurfaceVisibility(uint32_t surfaceId, bool visibility)
     {
         ramses_internal::PlatformLightweightGuard guard(m_lock);
@@ -68,6 +68,8 @@ TEST_F(ADisplayConfig, hasDefaultValuesUponConstruction)
     EXPECT_EQ(defaultDisplayConfig.getFullscreenState(), displayConfig.getFullscreenState());
     EXPECT_EQ(defaultDisplayConfig.getBorderlessState(), displayConfig.getBorderlessState());
     EXPECT_EQ(defaultDisplayConfig.isWarpingEnabled(), displayConfig.isWarpingEnabled());
+    EXPECT_EQ(defaultDisplayConfig.getColorCorrectionLookupTable(), displayConfig.getColorCorrectionLookupTable());
+    EXPECT_EQ(defaultDisplayConfig.isDownscaleEnabled(), displayConfig.isDownscaleEnabled());
     EXPECT_EQ(defaultDisplayConfig.getKeepEffectsUploaded(), displayConfig.getKeepEffectsUploaded());
     EXPECT_EQ(defaultDisplayConfig.isStereoDisplay(), displayConfig.isStereoDisplay());
 
@@ -178,6 +180,28 @@ TEST_F(ADisplayConfig, enablesWarping)
     EXPECT_TRUE(config.impl.getInternalDisplayConfig().isWarpingEnabled());
 }
 
+TEST_F(ADisplayConfig, enablesColorCorrection)
+{
+    std::vector<uint8_t> lookupTable(1024u);
+    for (uint32_t i = 0u; i < lookupTable.size(); ++i)
+        lookupTable[i] = static_cast<uint8_t>(255u - i / 4u);
+
+    EXPECT_EQ(ramses::StatusOK, config.enableColorCorrectionPostEffect(lookupTable.data()));
+    EXPECT_EQ(lookupTable, config.impl.getInternalDisplayConfig().getColorCorrectionLookupTable());
+}
+
+TEST_F(ADisplayConfig, failsToEnableColorCorrectionWithoutLookupTable)
+{
+    EXPECT_NE(ramses::StatusOK, config.enableColorCorrectionPostEffect(nullptr));
+    EXPECT_TRUE(config.impl.getInternalDisplayConfig().getColorCorrectionLookupTable().empty());
+}
+
+TEST_F(ADisplayConfig, enablesDownscale)
+{
+    EXPECT_EQ(ramses::StatusOK, config.enableDownscalePostEffect());
+    EXPECT_TRUE(config.impl.getInternalDisplayConfig().isDownscaleEnabled());
+}
+
 TEST_F(ADisplayConfig, disablesKeepingOfEffectsInVRAM)
 {
     EXPECT_EQ(ramses::StatusOK, config.keepEffectsUploaded(false));
@@ -331,6 +355,21 @@ TEST_F(ADisplayConfig, failsValidationOfStereoDisplayWithWarping)
     EXPECT_NE(ramses::StatusOK, config.validate());
 }
 
+TEST_F(ADisplayConfig, failsValidationOfStereoDisplayWithColorCorrection)
+{
+    const std::vector<uint8_t> lookupTable(1024u, 0u);
+    EXPECT_EQ(ramses::StatusOK, config.enableStereoDisplay());
+    EXPECT_EQ(ramses::StatusOK, config.enableColorCorrectionPostEffect(lookupTable.data()));
+    EXPECT_NE(ramses::StatusOK, config.validate());
+}
+
+TEST_F(ADisplayConfig, failsValidationOfStereoDisplayWithDownscale)
+{
+    EXPECT_EQ(ramses::StatusOK, config.enableStereoDisplay());
+    EXPECT_EQ(ramses::StatusOK, config.enableDownscalePostEffect());
+    EXPECT_NE(ramses::StatusOK, config.validate());
+}
+
 TEST_F(ADisplayConfig, failsValidationOfStereoDisplayWithAntialiasing)
 {
     EXPECT_EQ(ramses::StatusOK, config.enableStereoDisplay());
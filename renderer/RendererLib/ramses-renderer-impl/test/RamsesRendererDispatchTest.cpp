@@ -86,7 +86,7 @@ namespace ramses_internal
 
         void publishScene()
         {
-            m_sceneGraphProvider.handleCreateScene(m_scene, false);
+            m_sceneGraphProvider.handleCreateScene(m_scene, false, false);
             m_sceneGraphProvider.handlePublishScene(ramses_internal::SceneId(m_sceneId), EScenePublicationMode_LocalOnly);
         }
 
@@ -137,7 +137,7 @@ namespace ramses_internal
 
         void createPublishedAndSubscribedScene(ramses::sceneId_t newSceneId, ramses_internal::ClientScene& newScene)
         {
-            m_sceneGraphProvider.handleCreateScene(newScene, false);
+            m_sceneGraphProvider.handleCreateScene(newScene, false, false);
             m_sceneGraphProvider.handlePublishScene(ramses_internal::SceneId(newSceneId), EScenePublicationMode_LocalOnly);
             updateAndDispatch(m_handler);
             m_handler.expectScenePublished(newSceneId);
@@ -1114,8 +1114,8 @@ namespace ramses_internal
         ramses_internal::ClientScene sceneConsumer(createInfoConsumer);
 
         // publish scenes
-        m_sceneGraphProvider.handleCreateScene(sceneProvider, false);
-        m_sceneGraphProvider.handleCreateScene(sceneConsumer, false);
+        m_sceneGraphProvider.handleCreateScene(sceneProvider, false, false);
+        m_sceneGraphProvider.handleCreateScene(sceneConsumer, false, false);
         m_sceneGraphProvider.handlePublishScene(ramses_internal::SceneId(customSceneProviderId), EScenePublicationMode_LocalOnly);
         m_sceneGraphProvider.handlePublishScene(ramses_internal::SceneId(customsceneConsumerId), EScenePublicationMode_LocalOnly);
         updateAndDispatch(m_handler);
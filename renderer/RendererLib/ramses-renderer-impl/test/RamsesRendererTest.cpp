@@ -123,6 +123,8 @@ protected:
         renderer.showScene(0u);
         renderer.hideScene(0u);
         renderer.readPixels(0u, 1u, 2u, 3u, 4u);
+        renderer.startFrameCapture(0u, "frames.rgba", 30.f);
+        renderer.stopFrameCapture(0u);
         renderer.updateWarpingMeshData(0u,warpingMeshData);
         renderer.createOffscreenBuffer(0u, 1u, 1u);
         renderer.destroyOffscreenBuffer(0u, 0u);
@@ -527,6 +529,23 @@ TEST_F(ARamsesRendererWithDisplay, createsCommandForReadPixels)
     checkForRendererCommand(0u, ramses_internal::ERendererCommand_ReadPixels);
 }
 
+TEST_F(ARamsesRendererWithDisplay, createsCommandsForFrameCapture)
+{
+    EXPECT_EQ(ramses::StatusOK, renderer.startFrameCapture(displayId, "frames.rgba", 25.f));
+    EXPECT_EQ(ramses::StatusOK, renderer.stopFrameCapture(displayId));
+    checkForRendererCommandCount(2u);
+    checkForRendererCommand(0u, ramses_internal::ERendererCommand_StartFrameCapture);
+    checkForRendererCommand(1u, ramses_internal::ERendererCommand_StopFrameCapture);
+}
+
+TEST_F(ARamsesRendererWithDisplay, failsToStartFrameCaptureWithInvalidArguments)
+{
+    EXPECT_NE(ramses::StatusOK, renderer.startFrameCapture(displayId, "", 25.f));
+    EXPECT_NE(ramses::StatusOK, renderer.startFrameCapture(displayId, nullptr, 25.f));
+    EXPECT_NE(ramses::StatusOK, renderer.startFrameCapture(displayId, "frames.rgba", -1.f));
+    checkForRendererCommandCount(0u);
+}
+
 /*
 * SystemCompositorControl
 */